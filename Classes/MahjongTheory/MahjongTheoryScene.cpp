@@ -413,36 +413,28 @@ void MahjongTheoryScene::filterResultsByFlag(uint8_t flag) {
 
         if (it2 == _resultSources.end()) {  // 没找到，直接到resultSources
             _resultSources.emplace_back();
-            memcpy(&_resultSources.back(), &*it1, sizeof(mahjong::enum_result_t));
+            memcpy(&_resultSources.back(), &*it1, sizeof(mahjong::enum_result_bits_t));
             continue;
         }
 
         // 找到，则合并resultSources与allResults的和牌形式标记及有效牌
         it2->form_flag |= it1->form_flag;
-        for (int i = 0; i < 34; ++i) {
-            mahjong::tile_t t = mahjong::all_tiles[i];
-            if (it1->useful_table[t]) {
-                it2->useful_table[t] = true;
-            }
-        }
+        it2->useful_set |= it1->useful_set;
     }
 
     // 更新ResultEx
     std::for_each(_resultSources.begin(), _resultSources.end(), [this](ResultEx &result) {
-        result.count_in_tiles = 0;
+        result.count_in_tiles = mahjong::tile_set_count(result.useful_set);
         result.count_total = 0;
         memset(result.imaginary_table, 0, sizeof(result.imaginary_table));
-        for (int i = 0; i < 34; ++i) {
-            mahjong::tile_t t = mahjong::all_tiles[i];
-            if (result.useful_table[t]) {
-                ++result.count_in_tiles;
-                int tile_count = 4 - _handTilesTable[t];
-                if (tile_count > 0) {
-                    result.count_total += tile_count;
-                }
-                else {
-                    result.imaginary_table[i] = true;
-                }
+        for (mahjong::tile_set_t set = result.useful_set; set != 0; set &= set - 1) {
+            mahjong::tile_t t = mahjong::tile_set_first(set);
+            int tile_count = 4 - _handTilesTable[t];
+            if (tile_count > 0) {
+                result.count_total += tile_count;
+            }
+            else {
+                result.imaginary_table[mahjong::tile_counts_index(t)] = true;
             }
         }
     });
@@ -524,14 +516,15 @@ void MahjongTheoryScene::calculate() {
             loadingView->dismiss();
         }
     }, nullptr, [thiz, hand_tiles, serving_tile]() {
-        mahjong::enum_discard_tile(&hand_tiles, serving_tile, FORM_FLAG_ALL, thiz.get(),
-            [](void *context, const mahjong::enum_result_t *result) {
+        // 回调只在本线程中执行，与单线程版本的顺序一致
+        mahjong::enum_discard_tile_parallel_bits(&hand_tiles, serving_tile, FORM_FLAG_ALL, thiz.get(),
+            [](void *context, const mahjong::enum_result_bits_t *result) {
             MahjongTheoryScene *thiz = (MahjongTheoryScene *)context;
             if (result->shanten != std::numeric_limits<int>::max()) {
                 thiz->_allResults.push_back(*result);
             }
             return (thiz->isRunning());
-        });
+        }, 0);
     });
 }
 
@@ -987,7 +980,7 @@ cw::TableViewCell *MahjongTheoryScene::tableCellAtIndex(cw::TableView *table, ss
 
     // 34张牌button
     for (int i = 0; i < 34; ++i) {
-        if (!result->useful_table[mahjong::all_tiles[i]]) {
+        if (!mahjong::tile_set_contains(result->useful_set, mahjong::all_tiles[i])) {
             usefulButtons[i]->setVisible(false);
             continue;
         }
@@ -25,19 +25,19 @@ private:
 
     mahjong::tile_table_t _handTilesTable;
 
-    struct ResultEx : mahjong::enum_result_t {
+    struct ResultEx : mahjong::enum_result_bits_t {
         int count_in_tiles;
         int count_total;
         bool imaginary_table[34];
     };
-    std::vector<mahjong::enum_result_t> _allResults;
+    std::vector<mahjong::enum_result_bits_t> _allResults;
     std::vector<ResultEx> _resultSources;
     std::vector<size_t> _orderedIndices;
 
     typedef struct {
         mahjong::hand_tiles_t handTiles;
         mahjong::tile_t servingTile;
-        std::vector<mahjong::enum_result_t> allResults;
+        std::vector<mahjong::enum_result_bits_t> allResults;
     } StateData;
     std::vector<StateData> _undoCache;
     std::vector<StateData> _redoCache;
@@ -0,0 +1,707 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+// 枚举所有和牌的手牌，对每种和牌张与和牌标记算番，输出二进制语料与番数分布
+// 语料可作为算番的回归基准，运行时间即为算番的吞吐量
+// 用法：g++ -std=c++11 -O2 -pthread corpus_generator.cpp fan_calculator.cpp fan_cache.cpp hand_code.cpp shanten.cpp worker_pool.cpp -o corpus_generator
+//       或者在CMake中打开MAHJONG_BUILD_TOOLS生成corpus_generator目标
+//       ./corpus_generator [-t 线程数] [-m 副露组数] [-a] [-n 单元数] [-o 语料文件] [-s 统计文件] [-c 断点文件] [-r]
+//   -t 线程数，默认为硬件支持的并发线程数
+//   -m 基本和型额外枚举吃碰出0~N组的情况，默认为0，即只有门清
+//   -a 枚举全部32种和牌标记组合，默认只有点和与自摸
+//   -n 最多生成多少个单元，用于试跑或者测吞吐量
+//   -r 从断点文件继续上次的运行，选项必须与上次相同
+//
+// 语料文件：16字节文件头（8字节"MJCORPUS"，4字节版本，4字节记录长度，小端序），之后每条记录16字节，
+// 依次为8字节手牌编码（见encode_hand）、和牌标记、圈风门风（各4位）、花牌数、1字节保留、2字节番数（出错时为错误码）、2字节保留，
+// 多字节的都是小端序
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <algorithm>
+#include <chrono>
+#include <set>
+#include <string>
+#include <vector>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+#include "fan_calculator.h"
+#include "fan_cache.h"
+#include "shanten.h"
+#include "win_table.h"
+#include "worker_pool.h"
+
+using namespace mahjong;
+
+#define CORPUS_MAGIC "MJCORPUS"
+#define CORPUS_VERSION 2
+#define CORPUS_HEADER_SIZE 16
+#define RECORD_SIZE 16
+#define RECORD_SITUATION_OFFSET 8
+#define RECORD_FAN_OFFSET 12
+#define CHECKPOINT_MAGIC "MJCORPUS-CHECKPOINT"
+#define MAX_FAN 1023  // 超出的计入最后一格
+#define BATCH_UNITS 1024  // 每批单元数，每批结束写一次断点
+
+// 生成单元的种类
+enum unit_kind_t {
+    UNIT_BASIC_FORM,                // 基本和型，参数为万子与条子在suit_keys中的下标
+    UNIT_SEVEN_PAIRS,               // 七对，参数为最小的对子在all_tiles中的下标
+    UNIT_THIRTEEN_ORPHANS,          // 十三幺
+    UNIT_HONORS_AND_KNITTED_TILES,  // 全不靠
+    UNIT_KNITTED_STRAIGHT           // 组合龙
+};
+
+// 生成单元，按顺序编号，断点记录的是已完成的单元数
+struct unit_t {
+    unit_kind_t kind;
+    uint32_t arg[2];
+};
+
+// 一门数牌的张数组合
+struct suit_key_t {
+    uint8_t cnt[9];
+    uint8_t sum;
+    bool has_pair;
+};
+
+// 字牌的张数组合
+struct honor_key_t {
+    uint8_t cnt[7];
+};
+
+struct options_t {
+    int thread_cnt;
+    int meld_cnt;
+    bool all_flags;
+    size_t unit_limit;
+    const char *corpus_path;
+    const char *stats_path;
+    const char *checkpoint_path;
+    bool resume;
+};
+
+// 统计，各线程分别累加，每批结束后合并
+struct stats_t {
+    uint64_t hand_cnt;
+    uint64_t record_cnt;
+    uint64_t error_cnt;
+    uint64_t fan_hist[MAX_FAN + 1];
+    uint64_t fan_kind_cnt[FAN_TABLE_SIZE];
+};
+
+static options_t options;
+static std::vector<suit_key_t> suit_keys;
+static std::vector<uint32_t> suit_keys_by[15][2];  // 按张数与是否有雀头分组的下标
+static std::vector<honor_key_t> honor_keys_by[15][2];
+static std::vector<win_flag_t> win_flags;
+
+// 解码一门数牌的张数组合，与win_table.h的编码一致
+static void add_suit_keys(const uint32_t *keys, size_t cnt, bool has_pair) {
+    for (size_t i = 0; i < cnt; ++i) {
+        suit_key_t sk;
+        sk.sum = 0;
+        sk.has_pair = has_pair;
+        uint32_t key = keys[i];
+        for (int r = 0; r < 9; ++r, key /= 5) {
+            sk.cnt[r] = static_cast<uint8_t>(key % 5);
+            sk.sum = static_cast<uint8_t>(sk.sum + sk.cnt[r]);
+        }
+        suit_keys_by[sk.sum][has_pair].push_back(static_cast<uint32_t>(suit_keys.size()));
+        suit_keys.push_back(sk);
+    }
+}
+
+// 字牌每种只能是0张、雀头或者刻子，最多一组雀头
+static void init_honor_keys() {
+    honor_key_t hk;
+    for (int code = 0; code < 2187; ++code) {  // 3^7
+        int sum = 0, pair_cnt = 0;
+        for (int i = 0, c = code; i < 7; ++i, c /= 3) {
+            static const uint8_t values[3] = { 0, 2, 3 };
+            hk.cnt[i] = values[c % 3];
+            sum += hk.cnt[i];
+            pair_cnt += (hk.cnt[i] == 2);
+        }
+        if (pair_cnt <= 1 && sum <= 14) {
+            honor_keys_by[sum][pair_cnt].push_back(hk);
+        }
+    }
+}
+
+static std::vector<unit_t> build_units() {
+    std::vector<unit_t> units;
+    for (uint32_t m = 0; m < suit_keys.size(); ++m) {
+        for (uint32_t s = 0; s < suit_keys.size(); ++s) {
+            if (suit_keys[m].sum + suit_keys[s].sum <= 14 && !(suit_keys[m].has_pair && suit_keys[s].has_pair)) {
+                units.push_back(unit_t{ UNIT_BASIC_FORM, { m, s } });
+            }
+        }
+    }
+    for (uint32_t i = 0; i < 34; ++i) {
+        units.push_back(unit_t{ UNIT_SEVEN_PAIRS, { i, 0 } });
+    }
+    units.push_back(unit_t{ UNIT_THIRTEEN_ORPHANS, { 0, 0 } });
+    units.push_back(unit_t{ UNIT_HONORS_AND_KNITTED_TILES, { 0, 0 } });
+    units.push_back(unit_t{ UNIT_KNITTED_STRAIGHT, { 0, 0 } });
+    return units;
+}
+
+// 张数表转成牌
+static intptr_t counts_to_tiles(const uint8_t (&cnt)[34], tile_t *tiles) {
+    intptr_t n = 0;
+    for (int i = 0; i < 34; ++i) {
+        for (int k = 0; k < cnt[i]; ++k) {
+            tiles[n++] = all_tiles[i];
+        }
+    }
+    return n;
+}
+
+// 立牌（含和牌张）能否组成基本和型
+static bool is_basic_form_complete(const uint8_t (&cnt)[34]) {
+    tile_t tiles[14];
+    intptr_t n = counts_to_tiles(cnt, tiles);
+    return is_basic_form_win(tiles, n - 1, tiles[n - 1]);
+}
+
+// 生成单元的上下文
+struct generator_t {
+    std::vector<uint8_t> *output;
+    stats_t *stats;
+};
+
+// 对一种副露情况，枚举和牌张与和牌标记算番
+static void emit_records(generator_t &gen, const uint8_t (&cnt)[34], const pack_t *packs, intptr_t pack_cnt) {
+    calculate_param_t param;
+    memset(&param, 0, sizeof(param));
+    memcpy(param.hand_tiles.fixed_packs, packs, pack_cnt * sizeof(pack_t));
+    param.hand_tiles.pack_count = pack_cnt;
+    param.prevalent_wind = wind_t::EAST;
+    param.seat_wind = wind_t::EAST;
+
+    uint8_t temp[34];
+    memcpy(temp, cnt, sizeof(temp));
+    for (int i = 0; i < 34; ++i) {
+        if (cnt[i] == 0) {
+            continue;
+        }
+        --temp[i];
+        param.hand_tiles.tile_count = counts_to_tiles(temp, param.hand_tiles.standing_tiles);
+        ++temp[i];
+        param.win_tile = all_tiles[i];
+
+        for (win_flag_t win_flag : win_flags) {
+            param.win_flag = win_flag;
+            fan_table_t fan_table = { 0 };
+            int fan = calculate_fan(&param, &fan_table);
+
+            fan_cache_key_t key;
+            make_fan_cache_key(&param, &key);
+            uint8_t record[RECORD_SIZE] = { 0 };
+            for (int k = 0; k < 8; ++k) {
+                record[k] = static_cast<uint8_t>(key.hand_code >> (k * 8));
+            }
+            for (int k = 0; k < 3; ++k) {
+                record[RECORD_SITUATION_OFFSET + k] = static_cast<uint8_t>(key.situation >> (k * 8));
+            }
+            record[RECORD_FAN_OFFSET] = static_cast<uint8_t>(fan);
+            record[RECORD_FAN_OFFSET + 1] = static_cast<uint8_t>(static_cast<uint16_t>(fan) >> 8);
+            gen.output->insert(gen.output->end(), record, record + RECORD_SIZE);
+
+            stats_t &stats = *gen.stats;
+            ++stats.record_cnt;
+            if (fan <= 0) {
+                ++stats.error_cnt;
+                continue;
+            }
+            ++stats.fan_hist[std::min(fan, MAX_FAN)];
+            for (int k = 0; k < FAN_TABLE_SIZE; ++k) {
+                stats.fan_kind_cnt[k] += (fan_table[k] != 0);
+            }
+        }
+    }
+}
+
+// 副露的候选：0~33为各种牌的刻子，34~54为各门数牌以2~8为中间张的顺子
+#define MELD_CANDIDATE_CNT 55
+
+// 从立牌中吃碰出候选的面子，候选编号不减，避免重复
+static void expose_melds(generator_t &gen, uint8_t (&cnt)[34], pack_t *packs, intptr_t pack_cnt, int min_candidate) {
+    emit_records(gen, cnt, packs, pack_cnt);
+    if (pack_cnt == options.meld_cnt) {
+        return;
+    }
+
+    for (int c = min_candidate; c < MELD_CANDIDATE_CNT; ++c) {
+        int first, step;
+        uint8_t type;
+        if (c < 34) {
+            first = c, step = 0, type = PACK_TYPE_PUNG;
+        }
+        else {
+            first = (c - 34) / 7 * 9 + (c - 34) % 7, step = 1, type = PACK_TYPE_CHOW;
+        }
+        if (cnt[first] == 0 || cnt[first + step] == 0 || cnt[first + step * 2] == 0 || (step == 0 && cnt[first] < 3)) {
+            continue;
+        }
+
+        --cnt[first]; --cnt[first + step]; --cnt[first + step * 2];
+        if (is_basic_form_complete(cnt)) {
+            packs[pack_cnt] = make_pack(1, type, all_tiles[first + step]);
+            expose_melds(gen, cnt, packs, pack_cnt + 1, c);
+        }
+        ++cnt[first]; ++cnt[first + step]; ++cnt[first + step * 2];
+    }
+}
+
+// 一手门清的牌
+static void emit_hand(generator_t &gen, uint8_t (&cnt)[34], bool basic_form) {
+    ++gen.stats->hand_cnt;
+    pack_t packs[4];
+    if (basic_form && options.meld_cnt > 0) {
+        expose_melds(gen, cnt, packs, 0, 0);
+    }
+    else {
+        emit_records(gen, cnt, packs, 0);
+    }
+}
+
+// 基本和型：万子与条子固定，枚举饼与字，总共14张且恰好一组雀头
+static void generate_basic_form(generator_t &gen, uint32_t m_idx, uint32_t s_idx) {
+    const suit_key_t &m = suit_keys[m_idx];
+    const suit_key_t &s = suit_keys[s_idx];
+    uint8_t cnt[34];
+    memcpy(cnt, m.cnt, 9);
+    memcpy(cnt + 9, s.cnt, 9);
+    const int rest = 14 - m.sum - s.sum;
+    const bool pair_used = m.has_pair || s.has_pair;
+
+    for (int p_sum = 0; p_sum <= rest; ++p_sum) {
+        for (int p_pair = 0; p_pair < 2; ++p_pair) {
+            if (pair_used && p_pair) {
+                continue;
+            }
+            const std::vector<honor_key_t> &honors = honor_keys_by[rest - p_sum][!(pair_used || p_pair)];
+            if (honors.empty()) {
+                continue;
+            }
+            for (uint32_t p_idx : suit_keys_by[p_sum][p_pair]) {
+                memcpy(cnt + 18, suit_keys[p_idx].cnt, 9);
+                for (const honor_key_t &hk : honors) {
+                    memcpy(cnt + 27, hk.cnt, 7);
+                    emit_hand(gen, cnt, true);
+                }
+            }
+        }
+    }
+}
+
+// 七对：从下标idx开始选剩下的对子，四张相同的牌算两对，与基本和型重复的跳过
+static void generate_seven_pairs(generator_t &gen, uint8_t (&cnt)[34], int idx, int pair_cnt) {
+    if (pair_cnt == 7) {
+        if (!is_basic_form_complete(cnt)) {
+            emit_hand(gen, cnt, false);
+        }
+        return;
+    }
+    for (int i = idx; i < 34; ++i) {
+        for (int k = 1; k <= 2 && pair_cnt + k <= 7; ++k) {
+            cnt[i] = static_cast<uint8_t>(k * 2);
+            generate_seven_pairs(gen, cnt, i + 1, pair_cnt + k);
+        }
+        cnt[i] = 0;
+    }
+}
+
+// 十三幺
+static void generate_thirteen_orphans(generator_t &gen) {
+    static const int orphans[13] = { 0, 8, 9, 17, 18, 26, 27, 28, 29, 30, 31, 32, 33 };
+    for (int dup : orphans) {
+        uint8_t cnt[34] = { 0 };
+        for (int i : orphans) {
+            cnt[i] = 1;
+        }
+        ++cnt[dup];
+        emit_hand(gen, cnt, false);
+    }
+}
+
+// 组合龙的6种排列，各门数牌分别取147、258、369中的哪一种
+static const int knitted_perms[6][3] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+
+static void add_knitted_tiles(uint8_t (&cnt)[34], const int (&perm)[3]) {
+    for (int s = 0; s < 3; ++s) {
+        for (int r = perm[s]; r < 9; r += 3) {
+            ++cnt[s * 9 + r];
+        }
+    }
+}
+
+// 全不靠：9张组合龙的牌加7种字牌，去掉其中2张
+static void generate_honors_and_knitted_tiles(generator_t &gen) {
+    for (const int (&perm)[3] : knitted_perms) {
+        uint8_t all[34] = { 0 };
+        add_knitted_tiles(all, perm);
+        for (int i = 27; i < 34; ++i) {
+            all[i] = 1;
+        }
+        for (int a = 0; a < 34; ++a) {
+            for (int b = a + 1; b < 34; ++b) {
+                if (all[a] == 0 || all[b] == 0) {
+                    continue;
+                }
+                uint8_t cnt[34];
+                memcpy(cnt, all, sizeof(cnt));
+                cnt[a] = cnt[b] = 0;
+                emit_hand(gen, cnt, false);
+            }
+        }
+    }
+}
+
+// 组合龙：9张组合龙的牌加1组面子1组雀头，与基本和型重复的跳过
+static void generate_knitted_straight(generator_t &gen) {
+    std::set<std::string> seen;
+    for (const int (&perm)[3] : knitted_perms) {
+        for (int c = 0; c < MELD_CANDIDATE_CNT; ++c) {
+            for (int pair = 0; pair < 34; ++pair) {
+                uint8_t cnt[34] = { 0 };
+                add_knitted_tiles(cnt, perm);
+                if (c < 34) {
+                    cnt[c] += 3;
+                }
+                else {
+                    int first = (c - 34) / 7 * 9 + (c - 34) % 7;
+                    ++cnt[first]; ++cnt[first + 1]; ++cnt[first + 2];
+                }
+                cnt[pair] += 2;
+                if (std::any_of(cnt, cnt + 34, [](uint8_t n) { return n > 4; }) || is_basic_form_complete(cnt)) {
+                    continue;
+                }
+                if (seen.insert(std::string(reinterpret_cast<const char *>(cnt), sizeof(cnt))).second) {
+                    emit_hand(gen, cnt, false);
+                }
+            }
+        }
+    }
+}
+
+static void generate_unit(generator_t &gen, const unit_t &unit) {
+    switch (unit.kind) {
+    case UNIT_BASIC_FORM:
+        generate_basic_form(gen, unit.arg[0], unit.arg[1]);
+        break;
+    case UNIT_SEVEN_PAIRS: {
+        uint8_t cnt[34] = { 0 };
+        for (int k = 1; k <= 2; ++k) {
+            cnt[unit.arg[0]] = static_cast<uint8_t>(k * 2);
+            generate_seven_pairs(gen, cnt, unit.arg[0] + 1, k);
+        }
+        break;
+    }
+    case UNIT_THIRTEEN_ORPHANS:
+        generate_thirteen_orphans(gen);
+        break;
+    case UNIT_HONORS_AND_KNITTED_TILES:
+        generate_honors_and_knitted_tiles(gen);
+        break;
+    case UNIT_KNITTED_STRAIGHT:
+        generate_knitted_straight(gen);
+        break;
+    }
+}
+
+// 一批单元的上下文
+struct batch_t {
+    const std::vector<unit_t> *units;
+    size_t begin;  // 这一批的第一个单元
+    std::vector<std::vector<uint8_t> > *outputs;
+    std::vector<stats_t> *stats;
+};
+
+// 生成一批中的一段单元，每个单元的语料与统计各自存放
+static void generate_range(void *context, size_t begin, size_t end) {
+    batch_t *batch = static_cast<batch_t *>(context);
+    for (size_t i = begin; i < end; ++i) {
+        generator_t gen;
+        gen.output = &(*batch->outputs)[i];
+        gen.output->clear();
+        gen.stats = &(*batch->stats)[i];
+        memset(gen.stats, 0, sizeof(stats_t));
+        generate_unit(gen, (*batch->units)[batch->begin + i]);
+    }
+}
+
+static void merge_stats(stats_t &dst, const stats_t &src) {
+    dst.hand_cnt += src.hand_cnt;
+    dst.record_cnt += src.record_cnt;
+    dst.error_cnt += src.error_cnt;
+    for (int i = 0; i <= MAX_FAN; ++i) {
+        dst.fan_hist[i] += src.fan_hist[i];
+    }
+    for (int i = 0; i < FAN_TABLE_SIZE; ++i) {
+        dst.fan_kind_cnt[i] += src.fan_kind_cnt[i];
+    }
+}
+
+// 断点：已完成的单元数、语料文件长度、统计，先写临时文件再改名，中途退出也不会损坏
+static bool save_checkpoint(size_t next_unit, uint64_t corpus_bytes, const stats_t &stats) {
+    std::string temp_path = std::string(options.checkpoint_path) + ".tmp";
+    FILE *fp = fopen(temp_path.c_str(), "w");
+    if (fp == nullptr) {
+        return false;
+    }
+    fprintf(fp, "%s %d\n", CHECKPOINT_MAGIC, CORPUS_VERSION);
+    fprintf(fp, "options %d %d\n", options.meld_cnt, options.all_flags ? 1 : 0);
+    fprintf(fp, "progress %llu %llu\n", static_cast<unsigned long long>(next_unit), static_cast<unsigned long long>(corpus_bytes));
+    fprintf(fp, "counts %llu %llu %llu\n", static_cast<unsigned long long>(stats.hand_cnt),
+        static_cast<unsigned long long>(stats.record_cnt), static_cast<unsigned long long>(stats.error_cnt));
+    for (int i = 0; i <= MAX_FAN; ++i) {
+        fprintf(fp, "%llu%c", static_cast<unsigned long long>(stats.fan_hist[i]), i == MAX_FAN ? '\n' : ' ');
+    }
+    for (int i = 0; i < FAN_TABLE_SIZE; ++i) {
+        fprintf(fp, "%llu%c", static_cast<unsigned long long>(stats.fan_kind_cnt[i]), i == FAN_TABLE_SIZE - 1 ? '\n' : ' ');
+    }
+    bool ok = fclose(fp) == 0;
+    remove(options.checkpoint_path);
+    return ok && rename(temp_path.c_str(), options.checkpoint_path) == 0;
+}
+
+static bool load_checkpoint(size_t *next_unit, uint64_t *corpus_bytes, stats_t *stats) {
+    FILE *fp = fopen(options.checkpoint_path, "r");
+    if (fp == nullptr) {
+        return false;
+    }
+    char magic[32];
+    int version = 0, meld_cnt = -1, all_flags = -1;
+    unsigned long long v[5];
+    bool ok = fscanf(fp, "%31s %d", magic, &version) == 2 && strcmp(magic, CHECKPOINT_MAGIC) == 0 && version == CORPUS_VERSION
+        && fscanf(fp, " options %d %d", &meld_cnt, &all_flags) == 2 && meld_cnt == options.meld_cnt && all_flags == (options.all_flags ? 1 : 0)
+        && fscanf(fp, " progress %llu %llu", &v[0], &v[1]) == 2
+        && fscanf(fp, " counts %llu %llu %llu", &v[2], &v[3], &v[4]) == 3;
+    if (ok) {
+        *next_unit = static_cast<size_t>(v[0]);
+        *corpus_bytes = v[1];
+        stats->hand_cnt = v[2];
+        stats->record_cnt = v[3];
+        stats->error_cnt = v[4];
+        for (int i = 0; ok && i <= MAX_FAN; ++i) {
+            ok = fscanf(fp, "%llu", &v[0]) == 1;
+            stats->fan_hist[i] = v[0];
+        }
+        for (int i = 0; ok && i < FAN_TABLE_SIZE; ++i) {
+            ok = fscanf(fp, "%llu", &v[0]) == 1;
+            stats->fan_kind_cnt[i] = v[0];
+        }
+    }
+    fclose(fp);
+    return ok;
+}
+
+// 截断文件，丢弃上次断点之后写入的不完整数据
+static bool truncate_file(FILE *fp, uint64_t size) {
+    fflush(fp);
+#ifdef _WIN32
+    return _chsize_s(_fileno(fp), static_cast<__int64>(size)) == 0;
+#else
+    return ftruncate(fileno(fp), static_cast<off_t>(size)) == 0;
+#endif
+}
+
+static FILE *open_corpus(bool resume, uint64_t corpus_bytes) {
+    if (resume) {
+        FILE *fp = fopen(options.corpus_path, "r+b");
+        if (fp == nullptr || !truncate_file(fp, corpus_bytes) || fseek(fp, 0, SEEK_END) != 0) {
+            if (fp != nullptr) {
+                fclose(fp);
+            }
+            return nullptr;
+        }
+        return fp;
+    }
+
+    FILE *fp = fopen(options.corpus_path, "wb");
+    if (fp == nullptr) {
+        return nullptr;
+    }
+    uint8_t header[CORPUS_HEADER_SIZE] = { 0 };
+    memcpy(header, CORPUS_MAGIC, 8);
+    header[8] = CORPUS_VERSION;
+    header[12] = RECORD_SIZE;
+    fwrite(header, 1, sizeof(header), fp);
+    return fp;
+}
+
+// 番数分布与各番种出现的次数
+static bool write_stats(const stats_t &stats) {
+    FILE *fp = fopen(options.stats_path, "w");
+    if (fp == nullptr) {
+        return false;
+    }
+    fprintf(fp, "# hands %llu, records %llu, errors %llu\n", static_cast<unsigned long long>(stats.hand_cnt),
+        static_cast<unsigned long long>(stats.record_cnt), static_cast<unsigned long long>(stats.error_cnt));
+    fprintf(fp, "# fan,count\n");
+    for (int i = 0; i <= MAX_FAN; ++i) {
+        if (stats.fan_hist[i] != 0) {
+            fprintf(fp, "%d%s,%llu\n", i, i == MAX_FAN ? "+" : "", static_cast<unsigned long long>(stats.fan_hist[i]));
+        }
+    }
+    fprintf(fp, "# fan_id,name,count\n");
+    for (int i = 1; i < FAN_TABLE_SIZE; ++i) {
+        fprintf(fp, "%d,%s,%llu\n", i, fan_name[i], static_cast<unsigned long long>(stats.fan_kind_cnt[i]));
+    }
+    return fclose(fp) == 0;
+}
+
+static bool parse_options(int argc, const char *argv[]) {
+    options.thread_cnt = 0;
+    options.meld_cnt = 0;
+    options.all_flags = false;
+    options.unit_limit = 0;
+    options.corpus_path = "corpus.bin";
+    options.stats_path = "corpus_stats.txt";
+    options.checkpoint_path = "corpus.checkpoint";
+    options.resume = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const char *arg = argv[i];
+        const char *value = i + 1 < argc ? argv[i + 1] : nullptr;
+        if (strcmp(arg, "-a") == 0) {
+            options.all_flags = true;
+        }
+        else if (strcmp(arg, "-r") == 0) {
+            options.resume = true;
+        }
+        else if (value == nullptr) {
+            return false;
+        }
+        else {
+            if (strcmp(arg, "-t") == 0) options.thread_cnt = atoi(value);
+            else if (strcmp(arg, "-m") == 0) options.meld_cnt = atoi(value);
+            else if (strcmp(arg, "-n") == 0) options.unit_limit = static_cast<size_t>(strtoull(value, nullptr, 10));
+            else if (strcmp(arg, "-o") == 0) options.corpus_path = value;
+            else if (strcmp(arg, "-s") == 0) options.stats_path = value;
+            else if (strcmp(arg, "-c") == 0) options.checkpoint_path = value;
+            else return false;
+            ++i;
+        }
+    }
+    options.thread_cnt = parallel_thread_count(options.thread_cnt);
+    return options.meld_cnt >= 0 && options.meld_cnt <= 4;
+}
+
+int main(int argc, const char *argv[]) {
+    if (!parse_options(argc, argv)) {
+        fprintf(stderr, "usage: %s [-t threads] [-m melds] [-a] [-n units] [-o corpus] [-s stats] [-c checkpoint] [-r]\n", argv[0]);
+        return 1;
+    }
+
+    add_suit_keys(win_table_melds, sizeof(win_table_melds) / sizeof(win_table_melds[0]), false);
+    add_suit_keys(win_table_melds_and_pair, sizeof(win_table_melds_and_pair) / sizeof(win_table_melds_and_pair[0]), true);
+    init_honor_keys();
+    for (int f = 0; f < (options.all_flags ? 32 : 2); ++f) {
+        win_flags.push_back(static_cast<win_flag_t>(f));
+    }
+    const std::vector<unit_t> units = build_units();
+
+    stats_t total;
+    memset(&total, 0, sizeof(total));
+    size_t next_unit = 0;
+    uint64_t corpus_bytes = CORPUS_HEADER_SIZE;
+    if (options.resume) {
+        if (!load_checkpoint(&next_unit, &corpus_bytes, &total)) {
+            fprintf(stderr, "cannot resume from %s\n", options.checkpoint_path);
+            return 1;
+        }
+        fprintf(stderr, "resume from unit %llu\n", static_cast<unsigned long long>(next_unit));
+    }
+    FILE *corpus = open_corpus(options.resume, corpus_bytes);
+    if (corpus == nullptr) {
+        fprintf(stderr, "cannot open %s\n", options.corpus_path);
+        return 1;
+    }
+
+    size_t end_unit = units.size();
+    if (options.unit_limit != 0) {
+        end_unit = std::min(end_unit, next_unit + options.unit_limit);
+    }
+
+    // 每批单元在共享线程池上领取，结果按单元顺序写入，所以语料与线程数无关
+    std::vector<std::vector<uint8_t> > outputs(BATCH_UNITS);
+    std::vector<stats_t> unit_stats(BATCH_UNITS);
+    const uint64_t start_records = total.record_cnt;
+    auto start = std::chrono::steady_clock::now();
+
+    while (next_unit < end_unit) {
+        const size_t batch_begin = next_unit;
+        const size_t batch_end = std::min(batch_begin + BATCH_UNITS, end_unit);
+        batch_t batch;
+        batch.units = &units;
+        batch.begin = batch_begin;
+        batch.outputs = &outputs;
+        batch.stats = &unit_stats;
+        parallel_for(batch_end - batch_begin, 1, options.thread_cnt, &batch, &generate_range);
+
+        for (size_t u = batch_begin; u < batch_end; ++u) {
+            const std::vector<uint8_t> &output = outputs[u - batch_begin];
+            if (!output.empty() && fwrite(&output[0], 1, output.size(), corpus) != output.size()) {
+                fprintf(stderr, "cannot write %s\n", options.corpus_path);
+                fclose(corpus);
+                return 1;
+            }
+            corpus_bytes += output.size();
+        }
+        for (size_t u = batch_begin; u < batch_end; ++u) {
+            merge_stats(total, unit_stats[u - batch_begin]);
+        }
+        next_unit = batch_end;
+
+        fflush(corpus);
+        if (!save_checkpoint(next_unit, corpus_bytes, total)) {
+            fprintf(stderr, "cannot write %s\n", options.checkpoint_path);
+        }
+        fprintf(stderr, "\r%llu/%llu units, %llu hands, %llu records", static_cast<unsigned long long>(next_unit),
+            static_cast<unsigned long long>(units.size()), static_cast<unsigned long long>(total.hand_cnt),
+            static_cast<unsigned long long>(total.record_cnt));
+    }
+    fclose(corpus);
+    fputc('\n', stderr);
+
+    if (!write_stats(total)) {
+        fprintf(stderr, "cannot write %s\n", options.stats_path);
+        return 1;
+    }
+
+    long long ms = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+    uint64_t records = total.record_cnt - start_records;
+    printf("%llu/%llu units, %llu hands, %llu records, %llu errors, %d threads, %lld ms, %.0f records/s\n",
+        static_cast<unsigned long long>(next_unit), static_cast<unsigned long long>(units.size()),
+        static_cast<unsigned long long>(total.hand_cnt), static_cast<unsigned long long>(total.record_cnt),
+        static_cast<unsigned long long>(total.error_cnt), options.thread_cnt, ms, ms > 0 ? records * 1000.0 / ms : 0.0);
+    return 0;
+}
@@ -0,0 +1,168 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#include "fan_cache.h"
+#include "worker_pool.h"
+#include <string.h>
+#include <algorithm>
+
+namespace mahjong {
+
+// 计算算番参数对应的键
+bool make_fan_cache_key(const calculate_param_t *calculate_param, fan_cache_key_t *key) {
+    if (calculate_param->win_tile == 0 || !encode_hand(&calculate_param->hand_tiles, calculate_param->win_tile, &key->hand_code)) {
+        return false;
+    }
+    const uint32_t winds = (static_cast<uint32_t>(calculate_param->prevalent_wind) << 4) | static_cast<uint32_t>(calculate_param->seat_wind);
+    key->situation = static_cast<uint32_t>(calculate_param->win_flag) | (winds & 0xFF) << 8 | static_cast<uint32_t>(calculate_param->flower_count) << 16;
+    return true;
+}
+
+size_t fan_cache_t::key_hash_t::operator()(const fan_cache_key_t &key) const {
+    return static_cast<size_t>(hand_code_hash(key.hand_code ^ hand_code_hash(key.situation)));
+}
+
+bool fan_cache_t::key_equal_t::operator()(const fan_cache_key_t &a, const fan_cache_key_t &b) const {
+    return is_same_hand_code(a.hand_code, b.hand_code) && a.situation == b.situation;
+}
+
+fan_cache_t::fan_cache_t(size_t capacity, size_t shard_cnt)
+    : _shard_cnt(std::max<size_t>(shard_cnt, 1)) {
+    _shard_capacity = (capacity + _shard_cnt - 1) / _shard_cnt;
+    _shards.reset(new shard_t[_shard_cnt]);
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        _shards[i].hit_cnt = 0;
+        _shards[i].miss_cnt = 0;
+    }
+}
+
+// 查找缓存，命中时移到最前
+bool fan_cache_t::find(shard_t &shard, const fan_cache_key_t &key, result_t *result) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        ++shard.miss_cnt;
+        return false;
+    }
+    ++shard.hit_cnt;
+    shard.lru_list.splice(shard.lru_list.begin(), shard.lru_list, it->second);
+    *result = it->second->second;
+    return true;
+}
+
+// 加入缓存，超出容量时淘汰最久未使用的
+void fan_cache_t::insert(shard_t &shard, const fan_cache_key_t &key, const result_t &result) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (_shard_capacity == 0 || shard.index.find(key) != shard.index.end()) {  // 其他线程可能已经算好了
+        return;
+    }
+    shard.lru_list.push_front(std::make_pair(key, result));
+    shard.index[key] = shard.lru_list.begin();
+    if (shard.index.size() > _shard_capacity) {
+        shard.index.erase(shard.lru_list.back().first);
+        shard.lru_list.pop_back();
+    }
+}
+
+void fan_cache_t::clear() {
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        shard_t &shard = _shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.lru_list.clear();
+        shard.index.clear();
+        shard.hit_cnt = shard.miss_cnt = 0;
+    }
+}
+
+size_t fan_cache_t::hit_count() const {
+    size_t cnt = 0;
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        std::lock_guard<std::mutex> lock(_shards[i].mutex);
+        cnt += _shards[i].hit_cnt;
+    }
+    return cnt;
+}
+
+size_t fan_cache_t::miss_count() const {
+    size_t cnt = 0;
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        std::lock_guard<std::mutex> lock(_shards[i].mutex);
+        cnt += _shards[i].miss_cnt;
+    }
+    return cnt;
+}
+
+// 算番
+int fan_cache_t::calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table) {
+    fan_cache_key_t key;
+    if (!make_fan_cache_key(calculate_param, &key)) {  // 不合法的参数不缓存
+        return mahjong::calculate_fan(calculate_param, fan_table);
+    }
+
+    // 高位选分片，低位留给分片内的哈希表
+    size_t h = key_hash_t()(key);
+    shard_t &shard = _shards[(h >> (sizeof(size_t) * 4)) % _shard_cnt];
+
+    result_t result;
+    if (!find(shard, key, &result)) {
+        memset(result.fan_table, 0, sizeof(result.fan_table));
+        result.fan = mahjong::calculate_fan(calculate_param, &result.fan_table);
+        insert(shard, key, result);
+    }
+
+    if (fan_table != nullptr && result.fan >= 0) {  // 出错时不改动番表，同calculate_fan
+        memcpy(*fan_table, result.fan_table, sizeof(result.fan_table));
+    }
+    return result.fan;
+}
+
+namespace {
+    // 经过缓存批量算番的参数
+    struct cached_fan_batch_t {
+        const calculate_param_t *calculate_params;
+        fan_table_t *fan_tables;
+        int *fans;
+        fan_cache_t *fan_cache;
+    };
+}
+
+// 经过缓存计算一段手牌
+static void calculate_cached_fan_range(void *context, size_t begin, size_t end) {
+    const cached_fan_batch_t *batch = static_cast<const cached_fan_batch_t *>(context);
+    for (size_t i = begin; i < end; ++i) {
+        batch->fans[i] = batch->fan_cache->calculate_fan(&batch->calculate_params[i], batch->fan_tables != nullptr ? &batch->fan_tables[i] : nullptr);
+    }
+}
+
+// 批量算番，经过缓存
+void calculate_fan_batch(const calculate_param_t *calculate_params, size_t count, fan_table_t *fan_tables, int *fans, int thread_cnt,
+        fan_cache_t *fan_cache) {
+    if (fan_cache == nullptr) {
+        calculate_fan_batch(calculate_params, count, fan_tables, fans, thread_cnt);
+        return;
+    }
+    cached_fan_batch_t batch = { calculate_params, fan_tables, fans, fan_cache };
+    // 每次领取一小段，与不带缓存的版本相同
+    parallel_for(count, 64, thread_cnt, &batch, &calculate_cached_fan_range);
+}
+
+}
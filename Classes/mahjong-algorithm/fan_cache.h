@@ -0,0 +1,139 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__FAN_CACHE_H__
+#define __MAHJONG_ALGORITHM__FAN_CACHE_H__
+
+#include "fan_calculator.h"
+#include "hand_code.h"
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+namespace mahjong {
+
+/**
+ * @addtogroup calculator
+ * @{
+ */
+
+/**
+ * @brief 算番缓存的键
+ *  手牌与和牌张用encode_hand编码，立牌与副露的顺序不影响键
+ */
+struct fan_cache_key_t {
+    hand_code_t hand_code;  ///< 手牌与和牌张的编码
+    uint32_t situation;     ///< 从低到高依次是和牌标记、圈风门风（各4位）、花牌数，各占8位
+};
+
+/**
+ * @brief 计算算番参数对应的键
+ *
+ * @param [in] calculate_param 算番参数
+ * @param [out] key 键
+ * @return bool 参数能否编码，同encode_hand
+ */
+bool make_fan_cache_key(const calculate_param_t *calculate_param, fan_cache_key_t *key);
+
+/**
+ * @brief 算番结果的缓存
+ *  按键的哈希值分成若干片，每片有独立的锁与LRU链表，多个线程同时查询时很少互相等待。
+ *  只缓存通行计法（rules_default_t）的结果。所有接口都是线程安全的
+ */
+class fan_cache_t {
+public:
+    /**
+     * @brief 构造
+     *
+     * @param [in] capacity 最多缓存多少条结果，平均分给各片
+     * @param [in] shard_cnt 分片数（为0时按1处理）
+     */
+    fan_cache_t(size_t capacity, size_t shard_cnt);
+
+    /**
+     * @brief 算番，同calculate_fan
+     *  未命中时总是计算完整的番表，以便缓存
+     */
+    int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table);
+
+    /**
+     * @brief 清空缓存
+     */
+    void clear();
+
+    /**
+     * @brief 命中次数
+     */
+    size_t hit_count() const;
+
+    /**
+     * @brief 未命中次数
+     */
+    size_t miss_count() const;
+
+private:
+    struct result_t {
+        int fan;
+        fan_table_t fan_table;
+    };
+    struct key_hash_t {
+        size_t operator()(const fan_cache_key_t &key) const;
+    };
+    struct key_equal_t {
+        bool operator()(const fan_cache_key_t &a, const fan_cache_key_t &b) const;
+    };
+    typedef std::list<std::pair<fan_cache_key_t, result_t> > lru_list_t;
+
+    struct shard_t {
+        size_t hit_cnt;
+        size_t miss_cnt;
+        lru_list_t lru_list;  ///< 最近使用的在前
+        std::unordered_map<fan_cache_key_t, lru_list_t::iterator, key_hash_t, key_equal_t> index;
+        mutable std::mutex mutex;
+    };
+
+    bool find(shard_t &shard, const fan_cache_key_t &key, result_t *result);
+    void insert(shard_t &shard, const fan_cache_key_t &key, const result_t &result);
+
+    size_t _shard_capacity;
+    size_t _shard_cnt;
+    std::unique_ptr<shard_t[]> _shards;
+};
+
+/**
+ * @brief 批量算番，经过缓存
+ *  同calculate_fan_batch，每手牌先查缓存，未命中时再计算
+ *
+ * @param [in] fan_cache 缓存（可为null，此时同不带缓存的版本）
+ */
+void calculate_fan_batch(const calculate_param_t *calculate_params, size_t count, fan_table_t *fan_tables, int *fans, int thread_cnt,
+    fan_cache_t *fan_cache);
+
+/**
+ * end group
+ * @}
+ */
+
+}
+
+#endif
@@ -26,8 +26,10 @@
 #include <string.h>
 #include <algorithm>
 #include <iterator>
+#include <vector>
 #include "standard_tiles.h"
 #include "shanten.h"
+#include "worker_pool.h"
 
 /**
  * 算番流程概述：
@@ -58,7 +60,7 @@
  * 14. 以上流程走完，得到算番结果。如果为0番，则调整为无番和
  */
 
-#define MAX_DIVISION_CNT 20  // 一副牌最多也没有20种划分吧，够用了
+#define MAX_DIVISION_CNT 4  // 一副牌最多4种划分（如11122223333444s），单元测试中穷举验证
 
 #if 0
 #define LOG(fmt_, ...) printf(fmt_, ##__VA_ARGS__)
@@ -66,7 +68,7 @@
 #define LOG(...) ((void)0)
 #endif
 
-//#define STRICT_98_RULE
+//#define VERIFY_DIVISION_PRUNING  // 校验算番时划分的剪枝结果，调试用
 
 namespace mahjong {
 
@@ -90,74 +92,34 @@ namespace {
     };
 }
 
-// 递归划分算法的最后一步，添加划分
-static void divide_tail_add_division(intptr_t fixed_cnt, const division_t *work_division, division_result_t *result) {
-    // 拷贝一份当前的划分出来的面子，并排序暗手的面子
-    // 这里不能直接在work_division->packs上排序，否则会破坏递归外层的数据
-    division_t temp;
-    memcpy(&temp, work_division, sizeof(temp));
-    std::sort(temp.packs + fixed_cnt, temp.packs + 4);
-
-    // 如果这种划分是否已经存在了
-    if (std::none_of(&result->divisions[0], &result->divisions[result->count],
-        [&temp, fixed_cnt](const division_t &od) {
-        return std::equal(&od.packs[fixed_cnt], &od.packs[4], &temp.packs[fixed_cnt]);
-    })) {
-        // 写入划分结果里
-        memcpy(&result->divisions[result->count], &temp, sizeof(temp));
-        ++result->count;
-    }
-    else {
-        LOG("same case");
-    }
-}
-
-// 递归划分的最后一步
-static bool divide_tail(tile_table_t &cnt_table, intptr_t fixed_cnt, division_t *work_division, division_result_t *result) {
-    for (int i = 0; i < 34; ++i) {
-        tile_t t = all_tiles[i];
-        if (cnt_table[t] < 2) {
-            continue;
-        }
-
-        cnt_table[t] -= 2;  // 削减
-        // 所有牌全部使用完毕
-        if (std::all_of(std::begin(cnt_table), std::end(cnt_table), [](int n) { return n == 0; })) {
-            cnt_table[t] += 2;  // 还原
-
-            // 这2张作为雀头
-            work_division->packs[4] = make_pack(0, PACK_TYPE_PAIR, t);
-            divide_tail_add_division(fixed_cnt, work_division, result);  // 记录
-            return true;
-        }
-        cnt_table[t] += 2;  // 还原
-    }
-
-    return false;
-}
-
-// 判断一条划分分支是否来过
-static bool is_division_branch_exist(intptr_t fixed_cnt, intptr_t step, const division_t *work_division, const division_result_t *result) {
-    // 没有划分时，以及划分步骤小于3时，不检测，因为至少要有3步递归才会产生不同划分
-    if (result->count <= 0 || step < 3) {
+// 递归划分的最后一步，剩下的2张牌为雀头时添加划分
+static bool divide_tail(const tile_table_t &cnt_table, intptr_t fixed_cnt, division_t *work_division, division_result_t *result) {
+    // 此时恰好剩2张牌，找到第一张即可判断
+    const tile_t *it = std::find_if(std::begin(all_tiles), std::end(all_tiles), [&cnt_table](tile_t t) { return cnt_table[t] != 0; });
+    if (it == std::end(all_tiles) || cnt_table[*it] != 2) {
         return false;
     }
+    tile_t t = *it;
 
-    // std::includes要求有序
-    // 这里不能直接在work_division->packs上排序，否则会破坏递归外层的数据
-    division_t temp;
-    memcpy(&temp.packs[fixed_cnt], &work_division->packs[fixed_cnt], step * sizeof(pack_t));
-    std::sort(&temp.packs[fixed_cnt], &temp.packs[fixed_cnt + step]);
+    if (result->count >= MAX_DIVISION_CNT) {  // 不会发生，以防万一
+        assert(0 && "too many divisions");
+        return true;
+    }
 
-    // 只需要比较面子是否重复分支，雀头不参与比较，所以下标是4
-    return std::any_of(&result->divisions[0], &result->divisions[result->count],
-        [&temp, fixed_cnt, step](const division_t &od) {
-        return std::includes(&od.packs[fixed_cnt], &od.packs[4], &temp.packs[fixed_cnt], &temp.packs[fixed_cnt + step]);
-    });
+    // 这2张作为雀头，写入划分结果里
+    // 暗手的面子按牌组的值排序，与以前的结果保持一致
+    work_division->packs[4] = make_pack(0, PACK_TYPE_PAIR, t);
+    division_t &division = result->divisions[result->count++];
+    memcpy(&division, work_division, sizeof(division));
+    std::sort(division.packs + fixed_cnt, division.packs + 4);
+    return true;
 }
 
 // 递归划分
-static bool divide_recursively(tile_table_t &cnt_table, intptr_t fixed_cnt, intptr_t step, division_t *work_division, division_result_t *result) {
+// 每一步拆出的面子按“牌的下标*2+（刻子0，顺子1）”的序号不减，这样每种划分只会产生一次，无需去重
+// start_idx之前剩下的牌都不可能再组成面子了，只能作为雀头，所以最多只能剩2张
+static bool divide_recursively(tile_table_t &cnt_table, intptr_t fixed_cnt, intptr_t step, int start_seq, int left_cnt,
+    division_t *work_division, division_result_t *result) {
     const intptr_t idx = step + fixed_cnt;
     if (idx == 4) {  // 4组面子都有了
         return divide_tail(cnt_table, fixed_cnt, work_division, result);
@@ -166,45 +128,47 @@ static bool divide_recursively(tile_table_t &cnt_table, intptr_t fixed_cnt, intp
     bool ret = false;
 
     // 按牌表张遍历牌
-    for (int i = 0; i < 34; ++i) {
+    for (int i = start_seq / 2; i < 34; ++i) {
         tile_t t = all_tiles[i];
         if (cnt_table[t] < 1) {
             continue;
         }
 
         // 刻子
-        if (cnt_table[t] > 2) {
+        if (cnt_table[t] > 2 && i * 2 >= start_seq) {
             work_division->packs[idx] = make_pack(0, PACK_TYPE_PUNG, t);  // 记录刻子
-            if (!is_division_branch_exist(fixed_cnt, step + 1, work_division, result)) {
-                // 削减这组刻子，递归
-                cnt_table[t] -= 3;
-                if (divide_recursively(cnt_table, fixed_cnt, step + 1, work_division, result)) {
-                    ret = true;
-                }
-                // 还原
-                cnt_table[t] += 3;
+            // 削减这组刻子，递归
+            cnt_table[t] -= 3;
+            if (divide_recursively(cnt_table, fixed_cnt, step + 1, i * 2, left_cnt, work_division, result)) {
+                ret = true;
             }
+            // 还原
+            cnt_table[t] += 3;
         }
 
         // 顺子（只能是数牌）
         if (is_numbered_suit(t)) {
             if (tile_get_rank(t) < 8 && cnt_table[t + 1] && cnt_table[t + 2]) {
                 work_division->packs[idx] = make_pack(0, PACK_TYPE_CHOW, static_cast<tile_t>(t + 1));  // 记录顺子
-                if (!is_division_branch_exist(fixed_cnt, step + 1, work_division, result)) {
-                    // 削减这组顺子，递归
-                    --cnt_table[t];
-                    --cnt_table[t + 1];
-                    --cnt_table[t + 2];
-                    if (divide_recursively(cnt_table, fixed_cnt, step + 1, work_division, result)) {
-                        ret = true;
-                    }
-                    // 还原
-                    ++cnt_table[t];
-                    ++cnt_table[t + 1];
-                    ++cnt_table[t + 2];
+                // 削减这组顺子，递归
+                --cnt_table[t];
+                --cnt_table[t + 1];
+                --cnt_table[t + 2];
+                if (divide_recursively(cnt_table, fixed_cnt, step + 1, i * 2 + 1, left_cnt, work_division, result)) {
+                    ret = true;
                 }
+                // 还原
+                ++cnt_table[t];
+                ++cnt_table[t + 1];
+                ++cnt_table[t + 2];
             }
         }
+
+        // 此后的面子都不会再用到这种牌了
+        left_cnt += cnt_table[t];
+        if (left_cnt > 2) {
+            break;
+        }
     }
 
     return ret;
@@ -223,7 +187,7 @@ static bool divide_win_hand(const tile_t *standing_tiles, const pack_t *fixed_pa
     // 复制副露的面子
     division_t work_division;
     memcpy(work_division.packs, fixed_packs, fixed_cnt * sizeof(pack_t));
-    return divide_recursively(cnt_table, fixed_cnt, 0, &work_division, result);
+    return divide_recursively(cnt_table, fixed_cnt, 0, 0, 0, &work_division, result);
 }
 
 //-------------------------------- 算番 --------------------------------
@@ -627,6 +591,7 @@ static void calculate_2_chows_unordered(const tile_t (&mid_tiles)[2], fan_table_
 }
 
 // 刻子（杠）算番
+template <class rules_t>
 static void calculate_kongs(const pack_t *pung_packs, intptr_t pung_cnt, fan_table_t &fan_table) {
     // 统计明杠 暗杠 明刻 暗刻
     int melded_kong_cnt = 0;
@@ -703,11 +668,15 @@ static void calculate_kongs(const pack_t *pung_packs, intptr_t pung_cnt, fan_tab
             break;
         case 1:  // 明暗杠
 #if SUPPORT_CONCEALED_KONG_AND_MELDED_KONG
-            fan_table[CONCEALED_KONG_AND_MELDED_KONG] = 1;
-#else
-            fan_table[MELDED_KONG] = 1;
-            fan_table[CONCEALED_KONG] = 1;
+            if (rules_t::concealed_kong_and_melded_kong) {
+                fan_table[CONCEALED_KONG_AND_MELDED_KONG] = 1;
+            }
+            else
 #endif
+            {
+                fan_table[MELDED_KONG] = 1;
+                fan_table[CONCEALED_KONG] = 1;
+            }
             switch (concealed_pung_cnt) {  // 暗刻的个数
             case 1: fan_table[TWO_CONCEALED_PUNGS] = 1; break;
             case 2: fan_table[THREE_CONCEALED_PUNGS] = 1; break;
@@ -1044,12 +1013,11 @@ static void adjust_by_suits(const tile_t *tiles, intptr_t tile_cnt, fan_table_t
 }
 
 // 根据数牌的范围调整——涉及番种：大于五、小于五、全大、全中、全小
+template <class rules_t>
 static void adjust_by_rank_range(const tile_t *tiles, intptr_t tile_cnt, fan_table_t &fan_table) {
-#ifdef STRICT_98_RULE
-    if (fan_table[SEVEN_PAIRS]) {
+    if (rules_t::strict_98 && fan_table[SEVEN_PAIRS]) {
         return;  // 严格98规则的七对不支持叠加这些
     }
-#endif
 
     // 打表标记有哪些数
     uint16_t rank_flag = 0;
@@ -1131,6 +1099,7 @@ static void adjust_by_packs_traits(const pack_t (&packs)[5], fan_table_t &fan_ta
 }
 
 // 根据牌特性调整——涉及番种：断幺、推不倒、绿一色、字一色、清幺九、混幺九
+template <class rules_t>
 static void adjust_by_tiles_traits(const tile_t *tiles, intptr_t tile_cnt, fan_table_t &fan_table) {
     // 断幺
     if (std::none_of(tiles, tiles + tile_cnt, &is_terminal_or_honor)) {
@@ -1142,11 +1111,9 @@ static void adjust_by_tiles_traits(const tile_t *tiles, intptr_t tile_cnt, fan_t
         fan_table[REVERSIBLE_TILES] = 1;
     }
 
-#ifdef STRICT_98_RULE
-    if (fan_table[SEVEN_PAIRS]) {
+    if (rules_t::strict_98 && fan_table[SEVEN_PAIRS]) {
         return;  // 严格98规则的七对不支持绿一色、字一色、清幺九、混幺九
     }
-#endif
 
     // 绿一色
     if (std::all_of(tiles, tiles + tile_cnt, &is_green)) {
@@ -1184,36 +1151,28 @@ static void adjust_by_tiles_hog(const tile_t *tiles, intptr_t tile_cnt, fan_tabl
     fan_table[TILE_HOG] = static_cast<uint8_t>(_4_cnt - kong_cnt);
 }
 
-// 根据听牌方式调整——涉及番种：边张、嵌张、单钓将
-static void adjust_by_waiting_form(const pack_t *concealed_packs, intptr_t pack_cnt, const tile_t *standing_tiles, intptr_t standing_cnt,
-    tile_t win_tile, fan_table_t &fan_table) {
-    // 全求人和四杠不计单钓将，也不可能有边张、嵌张
-    if (fan_table[MELDED_HAND] || fan_table[FOUR_KONGS]) {
-        return;
-    }
-
+// 是否只听一张牌，门清时七对的听牌也算在内
+// 与划分无关，每手牌只需计算一次
+static bool is_waiting_for_one_tile(const tile_t *standing_tiles, intptr_t standing_cnt, bool concealed) {
     useful_table_t waiting_table;  // 听牌标记表
     if (!is_basic_form_wait(standing_tiles, standing_cnt, &waiting_table)) {
-        return;
+        return false;
     }
+    tile_set_t waiting_set = table_to_tile_set(waiting_table);
 
-    if (pack_cnt == 5) {  // 门清状态
+    if (concealed) {  // 门清状态
         // 判断是否为七对听牌
-        useful_table_t temp_table;
-        if (is_seven_pairs_wait(standing_tiles, standing_cnt, &temp_table)) {
-            // 合并听牌标记表
-            std::transform(std::begin(temp_table), std::end(temp_table), std::begin(waiting_table),
-                std::begin(waiting_table), [](bool w, bool t) { return w || t; });
+        if (is_seven_pairs_wait(standing_tiles, standing_cnt, &waiting_table)) {
+            waiting_set |= table_to_tile_set(waiting_table);  // 合并听牌
         }
     }
 
-    // 统计听牌张数，听牌数大于1张，不计边张、嵌张、单钓将
-    if (1 != std::count(std::begin(waiting_table), std::end(waiting_table), true)) {
-        return;
-    }
+    // 统计听牌张数
+    return tile_set_count(waiting_set) == 1;
+}
 
-    // 听1张的情况，看和牌张处于什么位置
-    // 边张0x01 嵌张0x02 单钓将0x04
+// 和牌张在划分中的位置，边张0x01 嵌张0x02 单钓将0x04
+static uint8_t get_waiting_position(const pack_t *concealed_packs, intptr_t pack_cnt, tile_t win_tile) {
     uint8_t pos_flag = 0;
 
     for (intptr_t i = 0; i < pack_cnt; ++i) {
@@ -1240,6 +1199,25 @@ static void adjust_by_waiting_form(const pack_t *concealed_packs, intptr_t pack_
         }
     }
 
+    return pos_flag;
+}
+
+// 根据听牌方式调整——涉及番种：边张、嵌张、单钓将
+static void adjust_by_waiting_form(const pack_t *concealed_packs, intptr_t pack_cnt, bool waiting_for_one_tile,
+    tile_t win_tile, fan_table_t &fan_table) {
+    // 全求人和四杠不计单钓将，也不可能有边张、嵌张
+    if (fan_table[MELDED_HAND] || fan_table[FOUR_KONGS]) {
+        return;
+    }
+
+    // 听牌数大于1张，不计边张、嵌张、单钓将
+    if (!waiting_for_one_tile) {
+        return;
+    }
+
+    // 听1张的情况，看和牌张处于什么位置
+    uint8_t pos_flag = get_waiting_position(concealed_packs, pack_cnt, win_tile);
+
     // 当多种可能存在时，只能计其中一种
     if (pos_flag & 0x01U) {
         fan_table[EDGE_WAIT] = 1;
@@ -1252,291 +1230,314 @@ static void adjust_by_waiting_form(const pack_t *concealed_packs, intptr_t pack_
     }
 }
 
-// 统一调整一些不计的
-static void adjust_fan_table(fan_table_t &fan_table) {
-    // 大四喜不计三风刻、碰碰和、圈风刻、门风刻、幺九刻
-    if (fan_table[BIG_FOUR_WINDS]) {
-        fan_table[BIG_THREE_WINDS] = 0;
-        fan_table[ALL_PUNGS] = 0;
-        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
-    }
-    // 大三元不计双箭刻、箭刻（严格98规则不计缺一门）
-    if (fan_table[BIG_THREE_DRAGONS]) {
-        fan_table[TWO_DRAGONS_PUNGS] = 0;
-        fan_table[DRAGON_PUNG] = 0;
-#ifdef STRICT_98_RULE
-        fan_table[ONE_VOIDED_SUIT] = 0;
-#endif
-    }
-    // 绿一色不计混一色、缺一门
-    if (fan_table[ALL_GREEN]) {
-        fan_table[HALF_FLUSH] = 0;
-        fan_table[ONE_VOIDED_SUIT] = 0;
-    }
-    // 九莲宝灯不计清一色、门前清、缺一门、无字，减计1个幺九刻，把不求人修正为自摸
-    if (fan_table[NINE_GATES]) {
-        fan_table[FULL_FLUSH] = 0;
-        fan_table[CONCEALED_HAND] = 0;
-        --fan_table[PUNG_OF_TERMINALS_OR_HONORS];
-        fan_table[ONE_VOIDED_SUIT] = 0;
-        fan_table[NO_HONORS] = 0;
-        if (fan_table[FULLY_CONCEALED_HAND]) {
-            fan_table[FULLY_CONCEALED_HAND] = 0;
-            fan_table[SELF_DRAWN] = 1;
-        }
-    }
-    // 四杠不计单钓将
-    if (fan_table[FOUR_KONGS]) {
-        fan_table[SINGLE_WAIT] = 0;
-    }
-    // 连七对不计七对、清一色、门前清、缺一门、无字
-    if (fan_table[SEVEN_SHIFTED_PAIRS]) {
-        fan_table[SEVEN_PAIRS] = 0;
-        fan_table[FULL_FLUSH] = 0;
-        fan_table[CONCEALED_HAND] = 0;
-        fan_table[ONE_VOIDED_SUIT] = 0;
-        fan_table[NO_HONORS] = 0;
-    }
-    // 十三幺不计五门齐、门前清、单钓将
-    if (fan_table[THIRTEEN_ORPHANS]) {
-        fan_table[ALL_TYPES] = 0;
-        fan_table[CONCEALED_HAND] = 0;
-        fan_table[SINGLE_WAIT] = 0;
-    }
-
-    // 清幺九不计混幺九、碰碰胡、全带幺、幺九刻、无字（严格98规则不计双同刻、不计三同刻）
-    if (fan_table[ALL_TERMINALS]) {
-        fan_table[ALL_TERMINALS_AND_HONORS] = 0;
-        fan_table[ALL_PUNGS] = 0;
-        fan_table[OUTSIDE_HAND] = 0;
-        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
-        fan_table[NO_HONORS] = 0;
-        fan_table[DOUBLE_PUNG] = 0;  // 通行计法不计双同刻
-#ifdef STRICT_98_RULE
-        fan_table[TRIPLE_PUNG] = 0;
-        fan_table[DOUBLE_PUNG] = 0;
-#endif
-    }
+//-------------------------------- 不计 --------------------------------
 
-    // 小四喜不计三风刻
-    if (fan_table[LITTLE_FOUR_WINDS]) {
-        fan_table[BIG_THREE_WINDS] = 0;
-        // 小四喜的第四组牌如果是19的刻子，则是混幺九；如果是箭刻则是字一色；这两种都是不计幺九刻的
-        // 如果是顺子或者2-8的刻子，则不存在多余的幺九刻
-        // 所以这里将幺九刻置为0
-        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
-    }
+namespace {
 
-    // 小三元不计双箭刻、箭刻（严格98规则不计缺一门）
-    if (fan_table[LITTLE_THREE_DRAGONS]) {
-        fan_table[TWO_DRAGONS_PUNGS] = 0;
-        fan_table[DRAGON_PUNG] = 0;
-#ifdef STRICT_98_RULE
-        fan_table[ONE_VOIDED_SUIT] = 0;
-#endif
-    }
+    // 番种集合，第i位表示番种i，共2个64位字
+    struct fan_bits_t {
+        uint64_t words[2];
+    };
 
-    // 字一色不计混幺九、碰碰胡、全带幺、幺九刻、缺一门
-    if (fan_table[ALL_HONORS]) {
-        fan_table[ALL_TERMINALS_AND_HONORS] = 0;
-        fan_table[ALL_PUNGS] = 0;
-        fan_table[OUTSIDE_HAND] = 0;
-        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
-        fan_table[ONE_VOIDED_SUIT] = 0;
-    }
-    // 四暗刻不计碰碰和、门前清，把不求人修正为自摸
-    if (fan_table[FOUR_CONCEALED_PUNGS]) {
-        fan_table[ALL_PUNGS] = 0;
-        fan_table[CONCEALED_HAND] = 0;
-        if (fan_table[FULLY_CONCEALED_HAND]) {
-            fan_table[FULLY_CONCEALED_HAND] = 0;
-            fan_table[SELF_DRAWN] = 1;
-        }
-    }
-    // 一色双龙会不计七对、清一色、平和、一般高、老少副、缺一门、无字
-    if (fan_table[PURE_TERMINAL_CHOWS]) {
-        fan_table[SEVEN_PAIRS] = 0;
-        fan_table[FULL_FLUSH] = 0;
-        fan_table[ALL_CHOWS] = 0;
-        fan_table[PURE_DOUBLE_CHOW] = 0;
-        fan_table[TWO_TERMINAL_CHOWS] = 0;
-        fan_table[ONE_VOIDED_SUIT] = 0;
-        fan_table[NO_HONORS] = 0;
+    constexpr fan_bits_t operator|(const fan_bits_t &a, const fan_bits_t &b) {
+        return fan_bits_t{{a.words[0] | b.words[0], a.words[1] | b.words[1]}};
     }
+}
 
-    // 一色四同顺不计一色三同顺、一般高、四归一（严格98规则不计缺一门）
-    if (fan_table[QUADRUPLE_CHOW]) {
-        fan_table[PURE_SHIFTED_PUNGS] = 0;
-        fan_table[TILE_HOG] = 0;
-        fan_table[PURE_DOUBLE_CHOW] = 0;
-#ifdef STRICT_98_RULE
-        fan_table[ONE_VOIDED_SUIT] = 0;
-#endif
-    }
-    // 一色四节高不计一色三节高、碰碰和（严格98规则不计缺一门）
-    if (fan_table[FOUR_PURE_SHIFTED_PUNGS]) {
-        fan_table[PURE_TRIPLE_CHOW] = 0;
-        fan_table[ALL_PUNGS] = 0;
-#ifdef STRICT_98_RULE
-        fan_table[ONE_VOIDED_SUIT] = 0;
-#endif
-    }
+static_assert(FAN_TABLE_SIZE <= 128, "fan_bits_t is too small");
 
-    // 一色四步高不计一色三步高、老少副、连六（严格98规则不计缺一门）
-    if (fan_table[FOUR_PURE_SHIFTED_CHOWS]) {
-        fan_table[PURE_SHIFTED_CHOWS] = 0;
-        fan_table[TWO_TERMINAL_CHOWS] = 0;
-        fan_table[SHORT_STRAIGHT] = 0;
-#ifdef STRICT_98_RULE
-        fan_table[ONE_VOIDED_SUIT] = 0;
+// 只含一个番种的集合
+static constexpr fan_bits_t fan_bit(fan_t fan) {
+    return fan < 64 ? fan_bits_t{{UINT64_C(1) << fan, 0}} : fan_bits_t{{0, UINT64_C(1) << (fan - 64)}};
+}
+
+// 集合是否包含番种
+static FORCE_INLINE bool fan_bits_contains(const fan_bits_t &bits, fan_t fan) {
+    return ((bits.words[fan >> 6] >> (fan & 63)) & 1) != 0;
+}
+
+#if defined(TILE_COUNTS_SSE2)
+// 番表中从first开始的16项哪些非0
+static FORCE_INLINE uint64_t fan_table_nonzero_mask16(const fan_table_t &fan_table, int first) {
+    const __m128i zero = _mm_setzero_si128();
+    __m128i v0 = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&fan_table[first])), zero);
+    __m128i v1 = _mm_cmpeq_epi16(_mm_loadu_si128(reinterpret_cast<const __m128i *>(&fan_table[first + 8])), zero);
+    return ~static_cast<uint64_t>(_mm_movemask_epi8(_mm_packs_epi16(v0, v1))) & 0xFFFF;
+}
 #endif
-    }
 
-    // 混幺九不计碰碰和、全带幺、幺九刻
-    if (fan_table[ALL_TERMINALS_AND_HONORS]) {
-        fan_table[ALL_PUNGS] = 0;
-        fan_table[OUTSIDE_HAND] = 0;
-        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
-    }
+static_assert(FAN_TABLE_SIZE >= 80, "fan_table_to_bits assumes at least 80 entries");
 
-    // 七对不计门前清、单钓将
-    if (fan_table[SEVEN_PAIRS]) {
-        fan_table[CONCEALED_HAND] = 0;
-        fan_table[SINGLE_WAIT] = 0;
+// 番表中出现的番种
+static FORCE_INLINE fan_bits_t fan_table_to_bits(const fan_table_t &fan_table) {
+    uint64_t lo = 0, hi = 0;
+#if defined(TILE_COUNTS_SSE2)
+    // 每次比较16项，最后不足16项的逐个处理
+    for (int i = 0; i < 64; i += 16) {
+        lo |= fan_table_nonzero_mask16(fan_table, i) << i;
     }
-    // 七星不靠不计五门齐、门前清
-    if (fan_table[GREATER_HONORS_AND_KNITTED_TILES]) {
-        fan_table[ALL_TYPES] = 0;
-        fan_table[CONCEALED_HAND] = 0;
+    hi = fan_table_nonzero_mask16(fan_table, 64);
+    for (int i = 80; i < FAN_TABLE_SIZE; ++i) {
+        hi |= static_cast<uint64_t>(fan_table[i] != 0) << (i - 64);
     }
-    // 全双刻不计碰碰胡、断幺、无字
-    if (fan_table[ALL_EVEN_PUNGS]) {
-        fan_table[ALL_PUNGS] = 0;
-        fan_table[ALL_SIMPLES] = 0;
-        fan_table[NO_HONORS] = 0;
-    }
-    // 清一色不计缺一门、无字
-    if (fan_table[FULL_FLUSH]) {
-        fan_table[ONE_VOIDED_SUIT] = 0;
-        fan_table[NO_HONORS] = 0;
-    }
-    // 一色三同顺不计一色三节高、一般高
-    if (fan_table[PURE_TRIPLE_CHOW]) {
-        fan_table[PURE_SHIFTED_PUNGS] = 0;
-        fan_table[PURE_DOUBLE_CHOW] = 0;
-    }
-    // 一色三节高不计一色三同顺
-    if (fan_table[PURE_SHIFTED_PUNGS]) {
-        fan_table[PURE_TRIPLE_CHOW] = 0;
-    }
-    // 全大不计大于五、无字
-    if (fan_table[UPPER_TILES]) {
-        fan_table[UPPER_FOUR] = 0;
-        fan_table[NO_HONORS] = 0;
-    }
-    // 全中不计断幺
-    if (fan_table[MIDDLE_TILES]) {
-        fan_table[ALL_SIMPLES] = 0;
-        fan_table[NO_HONORS] = 0;
-    }
-    // 全小不计小于五、无字
-    if (fan_table[LOWER_TILES]) {
-        fan_table[LOWER_FOUR] = 0;
-        fan_table[NO_HONORS] = 0;
-    }
-
-    // 三色双龙会不计平和、无字、喜相逢、老少副
-    if (fan_table[THREE_SUITED_TERMINAL_CHOWS]) {
-        fan_table[ALL_CHOWS] = 0;
-        fan_table[NO_HONORS] = 0;
-        fan_table[MIXED_DOUBLE_CHOW] = 0;
-        fan_table[TWO_TERMINAL_CHOWS] = 0;
+#else
+    for (int i = 0; i < 64; ++i) {
+        lo |= static_cast<uint64_t>(fan_table[i] != 0) << i;
     }
-    // 全带五不计断幺、无字
-    if (fan_table[ALL_FIVE]) {
-        fan_table[ALL_SIMPLES] = 0;
-        fan_table[NO_HONORS] = 0;
+    for (int i = 64; i < FAN_TABLE_SIZE; ++i) {
+        hi |= static_cast<uint64_t>(fan_table[i] != 0) << (i - 64);
     }
+#endif
+    lo &= ~UINT64_C(1);  // 无效番种不算
+    return fan_bits_t{{lo, hi}};
+}
 
-    // 七星不靠不计五门齐、门前清
-    if (fan_table[LESSER_HONORS_AND_KNITTED_TILES]) {
-        fan_table[ALL_TYPES] = 0;
-        fan_table[CONCEALED_HAND] = 0;
-    }
-    // 大于五不计无字
-    if (fan_table[UPPER_FOUR]) {
-        fan_table[NO_HONORS] = 0;
-    }
-    // 小于五不计无字
-    if (fan_table[LOWER_FOUR]) {
-        fan_table[NO_HONORS] = 0;
+// 最低位的1的位置（x不可为0）
+static FORCE_INLINE int lowest_bit_index(uint64_t x) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctzll(x);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long idx;
+    _BitScanForward64(&idx, x);
+    return static_cast<int>(idx);
+#else
+    int idx = 0;
+    for (; (x & 1) == 0; x >>= 1) {
+        ++idx;
     }
-    // 三风刻内部不再计幺九刻（严格98规则不计缺一门）
-    if (fan_table[BIG_THREE_WINDS]) {
-        // 如果不是字一色或混幺九，则要减去3个幺九刻
-        if (!fan_table[ALL_HONORS] && !fan_table[ALL_TERMINALS_AND_HONORS]) {
-            assert(fan_table[PUNG_OF_TERMINALS_OR_HONORS] >= 3);
-            fan_table[PUNG_OF_TERMINALS_OR_HONORS] -= 3;
-        }
-#ifdef STRICT_98_RULE
-        fan_table[ONE_VOIDED_SUIT] = 0;
+    return idx;
 #endif
-    }
+}
 
-    // 推不倒不计缺一门
-    if (fan_table[REVERSIBLE_TILES]) {
-        fan_table[ONE_VOIDED_SUIT] = 0;
-    }
-    // 妙手回春不计自摸
-    if (fan_table[LAST_TILE_DRAW]) {
-        fan_table[SELF_DRAWN] = 0;
-    }
-    // 杠上开花不计自摸
-    if (fan_table[OUT_WITH_REPLACEMENT_TILE]) {
-        fan_table[SELF_DRAWN] = 0;
-    }
-    // 抢杠和不计和绝张
-    if (fan_table[ROBBING_THE_KONG]) {
-        fan_table[LAST_TILE] = 0;
-    }
-    // 双暗杠不计暗杠
-    if (fan_table[TWO_CONCEALED_KONGS]) {
-        fan_table[CONCEALED_KONG] = 0;
-    }
+#define STRICT_98_EXCLUDE(bits_) | (strict_98 ? (bits_) : fan_bits_t{{0, 0}})  // 严格98规则额外不计的
 
-    // 混一色不计缺一门
-    if (fan_table[HALF_FLUSH]) {
-        fan_table[ONE_VOIDED_SUIT] = 0;
-    }
-    // 全求人不计单钓将
-    if (fan_table[MELDED_HAND]) {
-        fan_table[SINGLE_WAIT] = 0;
+namespace {
+
+    // 不计矩阵，第i行为番种i存在时不计的番种
+    // 按番种编号从小到大依次处理，前面的番种先把后面的番种排除掉，被排除掉的番种其自身的不计也不再生效
+    template <bool strict_98>
+    struct fan_exclusion_table_t {
+        static constexpr fan_bits_t rows[FAN_TABLE_SIZE] = {
+            {{0, 0}},  // 无效
+            // 大四喜不计三风刻、碰碰和、圈风刻、门风刻、幺九刻
+            fan_bit(BIG_THREE_WINDS) | fan_bit(ALL_PUNGS) | fan_bit(PUNG_OF_TERMINALS_OR_HONORS),
+            // 大三元不计双箭刻、箭刻（严格98规则不计缺一门）
+            fan_bit(TWO_DRAGONS_PUNGS) | fan_bit(DRAGON_PUNG) STRICT_98_EXCLUDE(fan_bit(ONE_VOIDED_SUIT)),
+            // 绿一色不计混一色、缺一门
+            fan_bit(HALF_FLUSH) | fan_bit(ONE_VOIDED_SUIT),
+            // 九莲宝灯不计清一色、门前清、缺一门、无字（减计幺九刻和修正不求人见adjust_fan_count）
+            fan_bit(FULL_FLUSH) | fan_bit(CONCEALED_HAND) | fan_bit(ONE_VOIDED_SUIT) | fan_bit(NO_HONORS),
+            // 四杠不计单钓将
+            fan_bit(SINGLE_WAIT),
+            // 连七对不计七对、清一色、门前清、缺一门、无字
+            fan_bit(SEVEN_PAIRS) | fan_bit(FULL_FLUSH) | fan_bit(CONCEALED_HAND) | fan_bit(ONE_VOIDED_SUIT) | fan_bit(NO_HONORS),
+            // 十三幺不计五门齐、门前清、单钓将
+            fan_bit(ALL_TYPES) | fan_bit(CONCEALED_HAND) | fan_bit(SINGLE_WAIT),
+
+            // 清幺九不计混幺九、碰碰胡、全带幺、幺九刻、无字、双同刻（严格98规则不计三同刻）
+            fan_bit(ALL_TERMINALS_AND_HONORS) | fan_bit(ALL_PUNGS) | fan_bit(OUTSIDE_HAND) | fan_bit(PUNG_OF_TERMINALS_OR_HONORS)
+                | fan_bit(NO_HONORS) | fan_bit(DOUBLE_PUNG) STRICT_98_EXCLUDE(fan_bit(TRIPLE_PUNG)),
+            // 小四喜不计三风刻
+            // 小四喜的第四组牌如果是19的刻子，则是混幺九；如果是箭刻则是字一色；这两种都是不计幺九刻的
+            // 如果是顺子或者2-8的刻子，则不存在多余的幺九刻，所以幺九刻也不计
+            fan_bit(BIG_THREE_WINDS) | fan_bit(PUNG_OF_TERMINALS_OR_HONORS),
+            // 小三元不计双箭刻、箭刻（严格98规则不计缺一门）
+            fan_bit(TWO_DRAGONS_PUNGS) | fan_bit(DRAGON_PUNG) STRICT_98_EXCLUDE(fan_bit(ONE_VOIDED_SUIT)),
+            // 字一色不计混幺九、碰碰胡、全带幺、幺九刻、缺一门
+            fan_bit(ALL_TERMINALS_AND_HONORS) | fan_bit(ALL_PUNGS) | fan_bit(OUTSIDE_HAND) | fan_bit(PUNG_OF_TERMINALS_OR_HONORS)
+                | fan_bit(ONE_VOIDED_SUIT),
+            // 四暗刻不计碰碰和、门前清（修正不求人见adjust_fan_count）
+            fan_bit(ALL_PUNGS) | fan_bit(CONCEALED_HAND),
+            // 一色双龙会不计七对、清一色、平和、一般高、老少副、缺一门、无字
+            fan_bit(SEVEN_PAIRS) | fan_bit(FULL_FLUSH) | fan_bit(ALL_CHOWS) | fan_bit(PURE_DOUBLE_CHOW) | fan_bit(TWO_TERMINAL_CHOWS)
+                | fan_bit(ONE_VOIDED_SUIT) | fan_bit(NO_HONORS),
+
+            // 一色四同顺不计一色三节高、一般高、四归一（严格98规则不计缺一门）
+            fan_bit(PURE_SHIFTED_PUNGS) | fan_bit(TILE_HOG) | fan_bit(PURE_DOUBLE_CHOW) STRICT_98_EXCLUDE(fan_bit(ONE_VOIDED_SUIT)),
+            // 一色四节高不计一色三同顺、碰碰和（严格98规则不计缺一门）
+            fan_bit(PURE_TRIPLE_CHOW) | fan_bit(ALL_PUNGS) STRICT_98_EXCLUDE(fan_bit(ONE_VOIDED_SUIT)),
+
+            // 一色四步高不计一色三步高、老少副、连六（严格98规则不计缺一门）
+            fan_bit(PURE_SHIFTED_CHOWS) | fan_bit(TWO_TERMINAL_CHOWS) | fan_bit(SHORT_STRAIGHT) STRICT_98_EXCLUDE(fan_bit(ONE_VOIDED_SUIT)),
+            {{0, 0}},  // 三杠
+            // 混幺九不计碰碰和、全带幺、幺九刻
+            fan_bit(ALL_PUNGS) | fan_bit(OUTSIDE_HAND) | fan_bit(PUNG_OF_TERMINALS_OR_HONORS),
+
+            // 七对不计门前清、单钓将
+            fan_bit(CONCEALED_HAND) | fan_bit(SINGLE_WAIT),
+            // 七星不靠不计五门齐、门前清
+            fan_bit(ALL_TYPES) | fan_bit(CONCEALED_HAND),
+            // 全双刻不计碰碰胡、断幺、无字
+            fan_bit(ALL_PUNGS) | fan_bit(ALL_SIMPLES) | fan_bit(NO_HONORS),
+            // 清一色不计缺一门、无字
+            fan_bit(ONE_VOIDED_SUIT) | fan_bit(NO_HONORS),
+            // 一色三同顺不计一色三节高、一般高
+            fan_bit(PURE_SHIFTED_PUNGS) | fan_bit(PURE_DOUBLE_CHOW),
+            // 一色三节高不计一色三同顺
+            fan_bit(PURE_TRIPLE_CHOW),
+            // 全大不计大于五、无字
+            fan_bit(UPPER_FOUR) | fan_bit(NO_HONORS),
+            // 全中不计断幺、无字
+            fan_bit(ALL_SIMPLES) | fan_bit(NO_HONORS),
+            // 全小不计小于五、无字
+            fan_bit(LOWER_FOUR) | fan_bit(NO_HONORS),
+
+            {{0, 0}},  // 清龙
+            // 三色双龙会不计平和、无字、喜相逢、老少副
+            fan_bit(ALL_CHOWS) | fan_bit(NO_HONORS) | fan_bit(MIXED_DOUBLE_CHOW) | fan_bit(TWO_TERMINAL_CHOWS),
+            {{0, 0}},  // 一色三步高
+            // 全带五不计断幺、无字
+            fan_bit(ALL_SIMPLES) | fan_bit(NO_HONORS),
+            {{0, 0}},  // 三同刻
+            {{0, 0}},  // 三暗刻
+
+            // 全不靠不计五门齐、门前清
+            fan_bit(ALL_TYPES) | fan_bit(CONCEALED_HAND),
+            {{0, 0}},  // 组合龙
+            // 大于五不计无字
+            fan_bit(NO_HONORS),
+            // 小于五不计无字
+            fan_bit(NO_HONORS),
+            // 三风刻内部不再计幺九刻（减计见adjust_fan_count）（严格98规则不计缺一门）
+            fan_bits_t{{0, 0}} STRICT_98_EXCLUDE(fan_bit(ONE_VOIDED_SUIT)),
+
+            {{0, 0}},  // 花龙
+            // 推不倒不计缺一门
+            fan_bit(ONE_VOIDED_SUIT),
+            {{0, 0}},  // 三色三同顺
+            {{0, 0}},  // 三色三节高
+            {{0, 0}},  // 无番和
+            // 妙手回春不计自摸
+            fan_bit(SELF_DRAWN),
+            {{0, 0}},  // 海底捞月
+            // 杠上开花不计自摸
+            fan_bit(SELF_DRAWN),
+            // 抢杠和不计和绝张
+            fan_bit(LAST_TILE),
+
+            {{0, 0}},  // 碰碰和
+            // 混一色不计缺一门
+            fan_bit(ONE_VOIDED_SUIT),
+            {{0, 0}},  // 三色三步高
+            {{0, 0}},  // 五门齐
+            // 全求人不计单钓将
+            fan_bit(SINGLE_WAIT),
+            // 双暗杠不计暗杠
+            fan_bit(CONCEALED_KONG),
+            // 双箭刻不计箭刻
+            fan_bit(DRAGON_PUNG),
+
+            {{0, 0}},  // 全带幺
+            // 不求人不计自摸
+            fan_bit(SELF_DRAWN),
+            // 双明杠不计明杠
+            fan_bit(MELDED_KONG),
+            {{0, 0}},  // 和绝张
+
+            {{0, 0}},  // 箭刻
+            {{0, 0}},  // 圈风刻
+            {{0, 0}},  // 门风刻
+            {{0, 0}},  // 门前清
+            // 平和不计无字
+            fan_bit(NO_HONORS),
+            {{0, 0}},  // 四归一
+            {{0, 0}},  // 双同刻
+            {{0, 0}},  // 双暗刻
+            {{0, 0}},  // 暗杠
+            // 断幺不计无字
+            fan_bit(NO_HONORS)
+            // 其余番种没有不计的
+        };
+    };
+
+    template <bool strict_98>
+    constexpr fan_bits_t fan_exclusion_table_t<strict_98>::rows[FAN_TABLE_SIZE];
+}
+
+#undef STRICT_98_EXCLUDE
+
+// 不计之外还需要修正计数的番种
+static constexpr fan_bits_t fan_count_adjusting_bits = fan_bit(NINE_GATES) | fan_bit(FOUR_CONCEALED_PUNGS) | fan_bit(BIG_THREE_WINDS);
+
+// 从第i个番种开始，有不计或者需要修正计数的番种
+static constexpr fan_bits_t fan_rule_bits(const fan_bits_t *rows, int i) {
+    return i == FAN_TABLE_SIZE ? fan_count_adjusting_bits
+        : ((rows[i].words[0] | rows[i].words[1]) != 0 ? fan_bit(static_cast<fan_t>(i)) : fan_bits_t{{0, 0}}) | fan_rule_bits(rows, i + 1);
+}
+
+// 修正番种的计数，并同步到集合
+static FORCE_INLINE void set_fan_count(fan_t fan, uint16_t cnt, fan_table_t &fan_table, fan_bits_t &present, fan_bits_t &counted) {
+    fan_table[fan] = cnt;
+    const fan_bits_t bit = fan_bit(fan);
+    if (cnt != 0) {
+        present = present | bit;
+        counted = counted | bit;
     }
-    // 双箭刻不计箭刻
-    if (fan_table[TWO_DRAGONS_PUNGS]) {
-        fan_table[DRAGON_PUNG] = 0;
+    else {
+        present.words[0] &= ~bit.words[0];
+        present.words[1] &= ~bit.words[1];
     }
+}
 
-    // 不求人不计自摸
-    if (fan_table[FULLY_CONCEALED_HAND]) {
-        fan_table[SELF_DRAWN] = 0;
-    }
-    // 双明杠不计明杠
-    if (fan_table[TWO_MELDED_KONGS]) {
-        fan_table[MELDED_KONG] = 0;
+// 修正计数的几个特例，在番种自身的不计生效之前调用
+static void adjust_fan_count(fan_t fan, fan_table_t &fan_table, fan_bits_t &present, fan_bits_t &counted) {
+    const uint16_t terminal_pung_cnt = fan_bits_contains(present, PUNG_OF_TERMINALS_OR_HONORS) ? fan_table[PUNG_OF_TERMINALS_OR_HONORS] : 0;
+
+    switch (fan) {
+    case NINE_GATES:
+        // 九莲宝灯减计1个幺九刻
+        set_fan_count(PUNG_OF_TERMINALS_OR_HONORS, static_cast<uint16_t>(terminal_pung_cnt - 1), fan_table, present, counted);
+        // fallthrough
+    case FOUR_CONCEALED_PUNGS:
+        // 九莲宝灯、四暗刻把不求人修正为自摸
+        if (fan_bits_contains(present, FULLY_CONCEALED_HAND)) {
+            set_fan_count(FULLY_CONCEALED_HAND, 0, fan_table, present, counted);
+            set_fan_count(SELF_DRAWN, 1, fan_table, present, counted);
+        }
+        break;
+    case BIG_THREE_WINDS:
+        // 如果不是字一色或混幺九，则三风刻要减去3个幺九刻
+        if (!fan_bits_contains(present, ALL_HONORS) && !fan_bits_contains(present, ALL_TERMINALS_AND_HONORS)) {
+            assert(terminal_pung_cnt >= 3);
+            set_fan_count(PUNG_OF_TERMINALS_OR_HONORS, static_cast<uint16_t>(terminal_pung_cnt - 3), fan_table, present, counted);
+        }
+        break;
+    default:
+        break;
     }
+}
 
-    // 平和不计无字
-    if (fan_table[ALL_CHOWS]) {
-        fan_table[NO_HONORS] = 0;
+// 统一调整一些不计的
+template <class rules_t>
+static void adjust_fan_table(fan_table_t &fan_table) {
+    typedef fan_exclusion_table_t<rules_t::strict_98> exclusion_t;
+    static constexpr fan_bits_t rule_bits = fan_rule_bits(exclusion_t::rows, 0);
+
+    fan_bits_t present = fan_table_to_bits(fan_table);
+    fan_bits_t counted = present;
+
+    // 按番种编号从小到大处理存在的番种，每个番种排除掉它不计的番种
+    for (int w = 0; w < 2; ++w) {
+        uint64_t rest = present.words[w] & rule_bits.words[w];
+        while (rest != 0) {
+            const fan_t fan = static_cast<fan_t>(w * 64 + lowest_bit_index(rest));
+            if (fan_bits_contains(fan_count_adjusting_bits, fan)) {
+                adjust_fan_count(fan, fan_table, present, counted);
+            }
+            present.words[0] &= ~exclusion_t::rows[fan].words[0];
+            present.words[1] &= ~exclusion_t::rows[fan].words[1];
+            rest &= (rest - 1) & present.words[w];
+        }
     }
-    // 断幺不计无字
-    if (fan_table[ALL_SIMPLES]) {
-        fan_table[NO_HONORS] = 0;
+
+    // 清除被排除掉的番种
+    for (int w = 0; w < 2; ++w) {
+        for (uint64_t removed = counted.words[w] & ~present.words[w]; removed != 0; removed &= removed - 1) {
+            fan_table[w * 64 + lowest_bit_index(removed)] = 0;
+        }
     }
 }
 
-
 // 调整圈风刻、门风刻
 static void adjust_by_winds(tile_t tile, wind_t prevalent_wind, wind_t seat_wind, fan_table_t &fan_table) {
     // 三风刻、混幺九、字一色、小四喜，这些番种已经扣除过幺九刻了
@@ -1575,7 +1576,9 @@ static void adjust_by_win_flag(win_flag_t win_flag, fan_table_t &fan_table) {
 }
 
 // 基本和型算番
-static void calculate_basic_form_fan(const pack_t (&packs)[5], const calculate_param_t *calculate_param, win_flag_t win_flag, fan_table_t &fan_table) {
+template <class rules_t>
+static void calculate_basic_form_fan(const pack_t (&packs)[5], const calculate_param_t *calculate_param, win_flag_t win_flag,
+    bool waiting_for_one_tile, fan_table_t &fan_table) {
     pack_t pair_pack = 0;
     pack_t chow_packs[4];
     pack_t pung_packs[4];
@@ -1617,7 +1620,7 @@ static void calculate_basic_form_fan(const pack_t (&packs)[5], const calculate_p
     }
 
     if (pung_cnt > 0) { // 有刻子
-        calculate_kongs(pung_packs, pung_cnt, fan_table);
+        calculate_kongs<rules_t>(pung_packs, pung_cnt, fan_table);
     }
 
     switch (chow_cnt) {
@@ -1722,19 +1725,19 @@ static void calculate_basic_form_fan(const pack_t (&packs)[5], const calculate_p
     // 根据花色调整——涉及番种：无字、缺一门、混一色、清一色、五门齐
     adjust_by_suits(tiles, tile_cnt, fan_table);
     // 根据牌特性调整——涉及番种：断幺、推不倒、绿一色、字一色、清幺九、混幺九
-    adjust_by_tiles_traits(tiles, tile_cnt, fan_table);
+    adjust_by_tiles_traits<rules_t>(tiles, tile_cnt, fan_table);
     // 根据数牌的范围调整——涉及番种：大于五、小于五、全大、全中、全小
-    adjust_by_rank_range(tiles, tile_cnt, fan_table);
+    adjust_by_rank_range<rules_t>(tiles, tile_cnt, fan_table);
     // 四归一调整
     adjust_by_tiles_hog(tiles, tile_cnt, fan_table);
 
     if (!heaven_win) {
         // 根据听牌方式调整——涉及番种：边张、嵌张、单钓将
-        adjust_by_waiting_form(packs + fixed_cnt, 5 - fixed_cnt, standing_tiles, standing_cnt, win_tile, fan_table);
+        adjust_by_waiting_form(packs + fixed_cnt, 5 - fixed_cnt, waiting_for_one_tile, win_tile, fan_table);
     }
 
     // 统一调整一些不计的
-    adjust_fan_table(fan_table);
+    adjust_fan_table<rules_t>(fan_table);
 
     // 调整圈风刻、门风刻（大四喜不计圈风刻、门风刻）
     if (fan_table[BIG_FOUR_WINDS] == 0) {
@@ -1753,6 +1756,7 @@ static void calculate_basic_form_fan(const pack_t (&packs)[5], const calculate_p
 }
 
 // “组合龙+面子+雀头”和型算番
+template <class rules_t>
 static bool calculate_knitted_straight_fan(const calculate_param_t *calculate_param, win_flag_t win_flag, fan_table_t &fan_table) {
     const hand_tiles_t *hand_tiles = &calculate_param->hand_tiles;
     tile_t win_tile = calculate_param->win_tile;
@@ -1798,7 +1802,7 @@ static bool calculate_knitted_straight_fan(const calculate_param_t *calculate_pa
     if (fixed_cnt == 1) {
         work_division.packs[3] = fixed_packs[0];
     }
-    divide_recursively(cnt_table, fixed_cnt + 3, 0, &work_division, &result);
+    divide_recursively(cnt_table, fixed_cnt + 3, 0, 0, 0, &work_division, &result);
     if (result.count != 1) {
         return false;
     }
@@ -1813,7 +1817,7 @@ static bool calculate_knitted_straight_fan(const calculate_param_t *calculate_pa
         }
     }
     else {
-        calculate_kongs(&packs[3], 1, fan_table);
+        calculate_kongs<rules_t>(&packs[3], 1, fan_table);
     }
 
     adjust_by_win_flag(win_flag, fan_table);
@@ -1848,7 +1852,7 @@ static bool calculate_knitted_straight_fan(const calculate_param_t *calculate_pa
             intptr_t cnt = table_to_tiles(cnt_table, temp, 4);
 
             // 根据听牌方式调整——涉及番种：边张、嵌张、单钓将
-            adjust_by_waiting_form(packs + 3, 2, temp, cnt, win_tile, fan_table);
+            adjust_by_waiting_form(packs + 3, 2, is_waiting_for_one_tile(temp, cnt, false), win_tile, fan_table);
         }
         else {
             // 非门清状态如果听牌不在组合龙范围内，必然是单钓将
@@ -1857,7 +1861,7 @@ static bool calculate_knitted_straight_fan(const calculate_param_t *calculate_pa
     }
 
     // 统一调整一些不计的
-    adjust_fan_table(fan_table);
+    adjust_fan_table<rules_t>(fan_table);
 
     // 调整圈风刻、门风刻
     tile_t tile = pack_get_tile(packs[3]);
@@ -1910,6 +1914,7 @@ static bool calculate_honors_and_knitted_tiles(const tile_t (&standing_tiles)[14
 }
 
 // 特殊和型算番
+template <class rules_t>
 static bool calculate_special_form_fan(const tile_t (&standing_tiles)[14], win_flag_t win_flag, fan_table_t &fan_table) {
     // 七对
     if (standing_tiles[0] == standing_tiles[1]
@@ -1929,7 +1934,7 @@ static bool calculate_special_form_fan(const tile_t (&standing_tiles)[14], win_f
             && standing_tiles[10] + 1 == standing_tiles[12]) {
             // 连七对
             fan_table[SEVEN_SHIFTED_PAIRS] = 1;
-            adjust_by_tiles_traits(standing_tiles, 14, fan_table);
+            adjust_by_tiles_traits<rules_t>(standing_tiles, 14, fan_table);
         }
         else {
             // 普通七对
@@ -1938,9 +1943,9 @@ static bool calculate_special_form_fan(const tile_t (&standing_tiles)[14], win_f
             // 根据花色调整——涉及番种：无字、缺一门、混一色、清一色、五门齐
             adjust_by_suits(standing_tiles, 14, fan_table);
             // 根据牌特性调整——涉及番种：断幺、推不倒、绿一色、字一色、清幺九、混幺九
-            adjust_by_tiles_traits(standing_tiles, 14, fan_table);
+            adjust_by_tiles_traits<rules_t>(standing_tiles, 14, fan_table);
             // 根据数牌的范围调整——涉及番种：大于五、小于五、全大、全中、全小
-            adjust_by_rank_range(standing_tiles, 14, fan_table);
+            adjust_by_rank_range<rules_t>(standing_tiles, 14, fan_table);
             // 四归一调整
             adjust_by_tiles_hog(standing_tiles, 14, fan_table);
         }
@@ -1958,7 +1963,7 @@ static bool calculate_special_form_fan(const tile_t (&standing_tiles)[14], win_f
 
     adjust_by_win_flag(win_flag, fan_table);
     // 统一调整一些不计的，根据风调整就没必要了，这些特殊和型都没有面子，不存在圈风刻、门风刻
-    adjust_fan_table(fan_table);
+    adjust_fan_table<rules_t>(fan_table);
 
     return true;
 }
@@ -2030,22 +2035,21 @@ int check_calculator_input(const hand_tiles_t *hand_tiles, tile_t win_tile) {
     return 0;
 }
 
-////////////////////////////////////////////////////////////////////////////////////////////////////////
-// 算番
-//
-int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table) {
-    const hand_tiles_t *hand_tiles = &calculate_param->hand_tiles;
-    tile_t win_tile = calculate_param->win_tile;
-    win_flag_t win_flag = calculate_param->win_flag;
+namespace {
 
-    if (int ret = check_calculator_input(hand_tiles, win_tile)) {
-        return ret;
-    }
+    // 同一手牌同一和牌张多次算番时共享的划分结果
+    struct division_cache_t {
+        bool divided;  // 是否已经划分过
+        bool success;  // 能否按基本和型划分
+        division_result_t result;  // 划分结果
+    };
+}
 
+// 校正和牌标记
+static win_flag_t correct_win_flag(const hand_tiles_t *hand_tiles, tile_t win_tile, win_flag_t win_flag) {
     intptr_t fixed_cnt = hand_tiles->pack_count;
     intptr_t standing_cnt = hand_tiles->tile_count;
 
-    // 校正和牌标记
     // 如果立牌包含和牌，则必然不是和绝张
     const bool standing_tiles_contains_win_tile = is_standing_tiles_contains_win_tile(hand_tiles->standing_tiles, standing_cnt, win_tile);
     if (standing_tiles_contains_win_tile) {
@@ -2074,11 +2078,21 @@ int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_tab
         }
     }
 
-    // 合并立牌与和牌，并排序，最多为14张
-    tile_t standing_tiles[14];
-    memcpy(standing_tiles, hand_tiles->standing_tiles, standing_cnt * sizeof(tile_t));
-    standing_tiles[standing_cnt] = win_tile;
-    std::sort(standing_tiles, standing_tiles + standing_cnt + 1);
+    return win_flag;
+}
+
+// 算番的主体
+// 立牌与和牌已合并排序，和牌标记已校正。划分结果和是否只听一张（-1为尚未计算）可以在多次调用之间共享
+// target_fan大于0时只判断番数（含花牌）能否达到它：一旦达到立即返回，返回值不小于target_fan；
+// 番数的上界达不到时也立即返回，返回值小于target_fan，但不一定是准确的番数
+template <class rules_t>
+static int calculate_fan_sorted(const calculate_param_t *calculate_param, const tile_t (&standing_tiles)[14], win_flag_t win_flag,
+        division_cache_t &division_cache, int &waiting_state, int target_fan, fan_table_t *fan_table) {
+    const hand_tiles_t *hand_tiles = &calculate_param->hand_tiles;
+    tile_t win_tile = calculate_param->win_tile;
+    intptr_t fixed_cnt = hand_tiles->pack_count;
+    intptr_t standing_cnt = hand_tiles->tile_count;
+    const int flower_cnt = calculate_param->flower_count;
 
     // 最大番标记
     int max_fan = 0;
@@ -2087,21 +2101,24 @@ int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_tab
     // 特殊和型的番
     fan_table_t special_fan_table = { 0 };
 
+    // 基本和型各种划分的番，选中的番表在最后才复制出去，所以要放在这一层
+    fan_table_t fan_tables[MAX_DIVISION_CNT] = { { 0 } };
+
     // 先判断各种特殊和型
     if (fixed_cnt == 0) {  // 门清状态，有可能是基本和型组合龙
-        if (calculate_knitted_straight_fan(calculate_param, win_flag, special_fan_table)) {
+        if (calculate_knitted_straight_fan<rules_t>(calculate_param, win_flag, special_fan_table)) {
             max_fan = get_fan_by_table(special_fan_table);
             selected_fan_table = &special_fan_table;
             LOG("fan = %d\n\n", max_fan);
         }
-        else if (calculate_special_form_fan(standing_tiles, win_flag, special_fan_table)) {
+        else if (calculate_special_form_fan<rules_t>(standing_tiles, win_flag, special_fan_table)) {
             max_fan = get_fan_by_table(special_fan_table);
             selected_fan_table = &special_fan_table;
             LOG("fan = %d\n\n", max_fan);
         }
     }
     else if (fixed_cnt == 1) {  // 1副露状态，有可能是基本和型组合龙
-        if (calculate_knitted_straight_fan(calculate_param, win_flag, special_fan_table)) {
+        if (calculate_knitted_straight_fan<rules_t>(calculate_param, win_flag, special_fan_table)) {
             max_fan = get_fan_by_table(special_fan_table);
             selected_fan_table = &special_fan_table;
             LOG("fan = %d\n\n", max_fan);
@@ -2109,28 +2126,117 @@ int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_tab
     }
 
     // 无法构成特殊和型或者为七对
-    // 七对也要按基本和型划分，因为极端情况下，基本和型的番会超过七对的番
-    if (selected_fan_table == nullptr || special_fan_table[SEVEN_PAIRS] == 1) {
+    // 七对也要按基本和型划分，因为极端情况下，基本和型的番会超过七对的番，但已经达到目标番数时就不必了
+    if (selected_fan_table == nullptr
+        || (special_fan_table[SEVEN_PAIRS] == 1 && !(target_fan > 0 && max_fan + flower_cnt >= target_fan))) {
         // 划分
-        division_result_t result;
-        if (divide_win_hand(standing_tiles, hand_tiles->fixed_packs, fixed_cnt, &result)) {
-            fan_table_t fan_tables[MAX_DIVISION_CNT] = { { 0 } };
-
-            // 遍历各种划分方式，分别算番，找出最大的番的划分方式
+        if (!division_cache.divided) {
+            division_cache.success = divide_win_hand(standing_tiles, hand_tiles->fixed_packs, fixed_cnt, &division_cache.result);
+            division_cache.divided = true;
+        }
+        const division_result_t &result = division_cache.result;
+        if (division_cache.success) {
+            int fans[MAX_DIVISION_CNT];  // 不计听牌方式的番数
+            int upper_bounds[MAX_DIVISION_CNT];  // 番数的上界
+            intptr_t order[MAX_DIVISION_CNT];  // 计算的顺序
+
+            // 先不计边张、嵌张、单钓将，算出每种划分的番数
+            // 判断是否只听一张的开销远大于算番，而听牌方式最多只影响1番，所以和牌张的位置可能计这几种番时，上界为番数+1
+            // 天和不计边张、嵌张、单钓将
+            const bool heaven_win = (win_flag & (WIN_FLAG_INIT | WIN_FLAG_SELF_DRAWN)) == (WIN_FLAG_INIT | WIN_FLAG_SELF_DRAWN);
+            intptr_t best_idx = -1;
+            int best_fan = max_fan;
+            intptr_t division_cnt = result.count;  // 需要比较的划分数
             for (intptr_t i = 0; i < result.count; ++i) {
 #if 0  // Debug
                 char str[64];
                 packs_to_string(result.divisions[i].packs, 5, str, sizeof(str));
                 puts(str);
 #endif
-                calculate_basic_form_fan(result.divisions[i].packs, calculate_param, win_flag, fan_tables[i]);
-                int current_fan = get_fan_by_table(fan_tables[i]);
-                if (current_fan > max_fan) {
-                    max_fan = current_fan;
-                    selected_fan_table = &fan_tables[i];
+                const pack_t (&packs)[5] = result.divisions[i].packs;
+                calculate_basic_form_fan<rules_t>(packs, calculate_param, win_flag, false, fan_tables[i]);
+                fans[i] = get_fan_by_table(fan_tables[i]);
+                upper_bounds[i] = fans[i];
+                if (!heaven_win && get_waiting_position(packs + fixed_cnt, 5 - fixed_cnt, win_tile) != 0) {
+                    ++upper_bounds[i];
+                }
+                order[i] = i;
+
+                // 不计听牌方式已经达到目标番数（这时必然大于特殊和型的番），其他划分都不必比较了
+                if (target_fan > 0 && fans[i] + flower_cnt >= target_fan) {
+                    best_idx = i;
+                    best_fan = fans[i];
+                    division_cnt = 0;
+                    break;
+                }
+            }
+
+            // 按上界从大到小的顺序计算，上界相同时保持划分的顺序
+            std::stable_sort(order, order + division_cnt, [&upper_bounds](intptr_t a, intptr_t b) { return upper_bounds[a] > upper_bounds[b]; });
+
+            // 找出最大的番的划分方式，番数相同时取划分顺序靠前的，与逐个计算的结果一致
+            // 划分的番数必须大于特殊和型的番才会被选中
+            for (intptr_t k = 0; k < division_cnt; ++k) {
+                intptr_t i = order[k];
+                if (upper_bounds[i] < best_fan) {  // 后面的上界都不会更大了
+                    break;
+                }
+                if (target_fan > 0 && upper_bounds[i] + flower_cnt < target_fan) {  // 后面的都达不到目标番数
+                    break;
+                }
+                if (upper_bounds[i] == best_fan && (best_idx < 0 || i > best_idx)) {  // 不可能被选中，剪枝
+                    continue;
+                }
+
+                int current_fan = fans[i];
+                if (upper_bounds[i] != fans[i]) {  // 可能计边张、嵌张、单钓将，这时才判断是否只听一张
+                    if (waiting_state < 0) {
+                        waiting_state = is_waiting_for_one_tile(hand_tiles->standing_tiles, standing_cnt, fixed_cnt == 0) ? 1 : 0;
+                    }
+                    if (waiting_state == 1) {
+                        memset(fan_tables[i], 0, sizeof(fan_tables[i]));
+                        calculate_basic_form_fan<rules_t>(result.divisions[i].packs, calculate_param, win_flag, true, fan_tables[i]);
+                        current_fan = get_fan_by_table(fan_tables[i]);
+                    }
                 }
                 LOG("fan = %d\n\n", current_fan);
+
+                if (current_fan > best_fan || (current_fan == best_fan && best_idx >= 0 && i < best_idx)) {
+                    best_fan = current_fan;
+                    best_idx = i;
+                }
+                if (target_fan > 0 && best_fan + flower_cnt >= target_fan) {  // 已经达到目标番数
+                    break;
+                }
             }
+
+            if (best_idx >= 0) {
+                max_fan = best_fan;
+                selected_fan_table = &fan_tables[best_idx];
+            }
+
+#ifdef VERIFY_DIVISION_PRUNING
+            // 校验：逐个划分完整地计算，结果应与剪枝的一致
+            if (target_fan <= 0) {
+                const bool waiting_for_one_tile = !heaven_win
+                    && is_waiting_for_one_tile(hand_tiles->standing_tiles, standing_cnt, fixed_cnt == 0);
+                const int special_fan = best_idx >= 0 || selected_fan_table == nullptr ? 0 : max_fan;
+                int verify_fan = special_fan;
+                intptr_t verify_idx = -1;
+                fan_table_t verify_tables[MAX_DIVISION_CNT] = { { 0 } };
+                for (intptr_t i = 0; i < result.count; ++i) {
+                    calculate_basic_form_fan<rules_t>(result.divisions[i].packs, calculate_param, win_flag, waiting_for_one_tile, verify_tables[i]);
+                    int current_fan = get_fan_by_table(verify_tables[i]);
+                    if (current_fan > verify_fan) {
+                        verify_fan = current_fan;
+                        verify_idx = i;
+                    }
+                }
+                assert(verify_idx == best_idx);
+                assert(verify_idx < 0 || (verify_fan == best_fan
+                    && memcmp(verify_tables[verify_idx], fan_tables[best_idx], sizeof(fan_table_t)) == 0));
+            }
+#endif
         }
     }
 
@@ -2139,7 +2245,7 @@ int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_tab
     }
 
     // 加花牌
-    max_fan += calculate_param->flower_count;
+    max_fan += flower_cnt;
 
     if (fan_table != nullptr) {
         memcpy(*fan_table, *selected_fan_table, sizeof(*fan_table));
@@ -2149,4 +2255,179 @@ int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_tab
     return max_fan;
 }
 
+// 合并立牌与和牌，并排序，最多为14张
+static void merge_standing_tiles(const hand_tiles_t *hand_tiles, tile_t win_tile, tile_t (&standing_tiles)[14]) {
+    intptr_t standing_cnt = hand_tiles->tile_count;
+    memcpy(standing_tiles, hand_tiles->standing_tiles, standing_cnt * sizeof(tile_t));
+    standing_tiles[standing_cnt] = win_tile;
+    std::sort(standing_tiles, standing_tiles + standing_cnt + 1);
+}
+
+// 校验输入后算番，target_fan见calculate_fan_sorted
+template <class rules_t>
+static int calculate_fan_with_target(const calculate_param_t *calculate_param, int target_fan, fan_table_t *fan_table) {
+    const hand_tiles_t *hand_tiles = &calculate_param->hand_tiles;
+    tile_t win_tile = calculate_param->win_tile;
+
+    if (int ret = check_calculator_input(hand_tiles, win_tile)) {
+        return ret;
+    }
+
+    win_flag_t win_flag = correct_win_flag(hand_tiles, win_tile, calculate_param->win_flag);
+
+    tile_t standing_tiles[14];
+    merge_standing_tiles(hand_tiles, win_tile, standing_tiles);
+
+    division_cache_t division_cache;
+    division_cache.divided = false;
+    int waiting_state = -1;
+    return calculate_fan_sorted<rules_t>(calculate_param, standing_tiles, win_flag, division_cache, waiting_state, target_fan, fan_table);
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////////
+// 算番
+//
+template <class rules_t>
+int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table) {
+    return calculate_fan_with_target<rules_t>(calculate_param, 0, fan_table);
+}
+
+// 预定义的规则集
+template int calculate_fan<rules_default_t>(const calculate_param_t *calculate_param, fan_table_t *fan_table);
+template int calculate_fan<rules_98_strict_t>(const calculate_param_t *calculate_param, fan_table_t *fan_table);
+
+// 算番（通行计法）
+int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table) {
+    return calculate_fan<rules_default_t>(calculate_param, fan_table);
+}
+
+// 按运行时指定的规则集算番
+int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table, rule_set_t rule_set) {
+    switch (rule_set) {
+    case rule_set_t::STRICT_98: return calculate_fan<rules_98_strict_t>(calculate_param, fan_table);
+    default: return calculate_fan<rules_default_t>(calculate_param, fan_table);
+    }
+}
+
+// 判断番数能否达到起和番
+template <class rules_t>
+bool reaches_min_fan(const calculate_param_t *calculate_param, int min_fan) {
+    // 和牌至少1番，所以不大于1番的目标等同于判断是否和牌
+    int fan = calculate_fan_with_target<rules_t>(calculate_param, std::max(min_fan, 1), nullptr);
+    return fan > 0 && fan >= min_fan;
+}
+
+template bool reaches_min_fan<rules_default_t>(const calculate_param_t *calculate_param, int min_fan);
+template bool reaches_min_fan<rules_98_strict_t>(const calculate_param_t *calculate_param, int min_fan);
+
+// 判断番数能否达到起和番（通行计法）
+bool reaches_min_fan(const calculate_param_t *calculate_param, int min_fan) {
+    return reaches_min_fan<rules_default_t>(calculate_param, min_fan);
+}
+
+// 听牌时对所有和牌张算番
+template <class rules_t>
+intptr_t calculate_fan_for_waits(const calculate_param_t *calculate_param, const win_flag_t *win_flags, intptr_t flag_cnt,
+        waiting_fan_t *results, intptr_t max_cnt) {
+    const hand_tiles_t *hand_tiles = &calculate_param->hand_tiles;
+
+    tile_table_t cnt_table;
+    if (!map_hand_tiles(hand_tiles, &cnt_table)) {
+        return ERROR_WRONG_TILES_COUNT;
+    }
+    if (std::any_of(std::begin(cnt_table), std::end(cnt_table), [](int cnt) { return cnt > 4; })) {
+        return ERROR_TILE_COUNT_GREATER_THAN_4;
+    }
+
+    // 听哪些牌，已经用了4枚的牌不可能和
+    useful_table_t waiting_table;
+    if (!is_waiting(*hand_tiles, &waiting_table)) {
+        return 0;
+    }
+    tile_set_t waiting_set = table_to_tile_set(waiting_table);
+    for (tile_set_t rest = waiting_set; rest != 0; rest &= rest - 1) {
+        tile_t t = tile_set_first(rest);
+        if (cnt_table[t] >= 4) {
+            waiting_set &= ~tile_set_of(t);
+        }
+    }
+
+    // 立牌只排序一次，每张和牌张插入到相应位置
+    intptr_t standing_cnt = hand_tiles->tile_count;
+    tile_t sorted_tiles[13];
+    memcpy(sorted_tiles, hand_tiles->standing_tiles, standing_cnt * sizeof(tile_t));
+    std::sort(sorted_tiles, sorted_tiles + standing_cnt);
+
+    // 是否只听一张与和牌张无关，所有和牌张共享
+    int waiting_state = -1;
+
+    calculate_param_t param;
+    memcpy(&param, calculate_param, sizeof(param));
+
+    intptr_t result_cnt = 0;
+    for (tile_set_t rest = waiting_set; rest != 0; rest &= rest - 1) {
+        if ((result_cnt + 1) * flag_cnt > max_cnt) {
+            break;
+        }
+
+        tile_t win_tile = tile_set_first(rest);
+        tile_t standing_tiles[14];
+        intptr_t pos = std::upper_bound(sorted_tiles, sorted_tiles + standing_cnt, win_tile) - sorted_tiles;
+        memcpy(standing_tiles, sorted_tiles, pos * sizeof(tile_t));
+        standing_tiles[pos] = win_tile;
+        memcpy(standing_tiles + pos + 1, sorted_tiles + pos, (standing_cnt - pos) * sizeof(tile_t));
+
+        // 划分结果与和牌标记无关，各个和牌标记共享
+        division_cache_t division_cache;
+        division_cache.divided = false;
+        param.win_tile = win_tile;
+        for (intptr_t i = 0; i < flag_cnt; ++i) {
+            waiting_fan_t &result = results[result_cnt * flag_cnt + i];
+            result.win_tile = win_tile;
+            result.win_flag = win_flags[i];
+            param.win_flag = win_flags[i];
+            win_flag_t win_flag = correct_win_flag(hand_tiles, win_tile, win_flags[i]);
+            result.fan = calculate_fan_sorted<rules_t>(&param, standing_tiles, win_flag, division_cache, waiting_state, 0, &result.fan_table);
+        }
+        ++result_cnt;
+    }
+
+    return tile_set_count(waiting_set);
+}
+
+template intptr_t calculate_fan_for_waits<rules_default_t>(const calculate_param_t *calculate_param, const win_flag_t *win_flags, intptr_t flag_cnt,
+    waiting_fan_t *results, intptr_t max_cnt);
+template intptr_t calculate_fan_for_waits<rules_98_strict_t>(const calculate_param_t *calculate_param, const win_flag_t *win_flags, intptr_t flag_cnt,
+    waiting_fan_t *results, intptr_t max_cnt);
+
+// 听牌时对所有和牌张算番（通行计法）
+intptr_t calculate_fan_for_waits(const calculate_param_t *calculate_param, const win_flag_t *win_flags, intptr_t flag_cnt,
+        waiting_fan_t *results, intptr_t max_cnt) {
+    return calculate_fan_for_waits<rules_default_t>(calculate_param, win_flags, flag_cnt, results, max_cnt);
+}
+
+namespace {
+    // 批量算番的参数
+    struct fan_batch_t {
+        const calculate_param_t *calculate_params;
+        fan_table_t *fan_tables;
+        int *fans;
+    };
+}
+
+// 计算一段手牌
+static void calculate_fan_range(void *context, size_t begin, size_t end) {
+    const fan_batch_t *batch = static_cast<const fan_batch_t *>(context);
+    for (size_t i = begin; i < end; ++i) {
+        batch->fans[i] = calculate_fan(&batch->calculate_params[i], batch->fan_tables != nullptr ? &batch->fan_tables[i] : nullptr);
+    }
+}
+
+// 批量算番
+void calculate_fan_batch(const calculate_param_t *calculate_params, size_t count, fan_table_t *fan_tables, int *fans, int thread_cnt) {
+    fan_batch_t batch = { calculate_params, fan_tables, fans };
+    // 每次领取一小段，减少原子操作
+    parallel_for(count, 64, thread_cnt, &batch, &calculate_fan_range);
+}
+
 }
@@ -206,8 +206,47 @@ struct calculate_param_t {
  */
 typedef uint16_t fan_table_t[FAN_TABLE_SIZE];
 
+/**
+ * @name rule sets
+ *  规则集作为算番的模板参数，在编译期确定，同一进程中可以同时使用多种规则。
+ *  concealed_kong_and_melded_kong只在SUPPORT_CONCEALED_KONG_AND_MELDED_KONG为1（番表中有明暗杠）时生效
+ * @{
+ */
+
+/**
+ * @brief 通行计法
+ */
+struct rules_default_t {
+    static constexpr bool strict_98 = false;  ///< 是否严格98规则
+    static constexpr bool concealed_kong_and_melded_kong = true;  ///< 1明杠1暗杠是否计明暗杠（否则计明杠+暗杠）
+};
+
+/**
+ * @brief 严格98规则
+ *  七对不叠加绿一色、字一色、清幺九、混幺九以及大于五、小于五、全大、全中、全小；
+ *  大三元、小三元、一色四同顺、一色四节高、一色四步高、三风刻不计缺一门；清幺九不计三同刻；
+ *  98规则没有明暗杠，1明杠1暗杠计明杠+暗杠
+ */
+struct rules_98_strict_t {
+    static constexpr bool strict_98 = true;  ///< 是否严格98规则
+    static constexpr bool concealed_kong_and_melded_kong = false;  ///< 1明杠1暗杠是否计明暗杠（否则计明杠+暗杠）
+};
+
+/**
+ * @brief 运行时选择的规则集
+ */
+enum class rule_set_t {
+    DEFAULT,    ///< 通行计法，对应rules_default_t
+    STRICT_98   ///< 严格98规则，对应rules_98_strict_t
+};
+
+/**
+ * @}
+ */
+
 /**
  * @brief 算番
+ *  只对预定义的规则集rules_default_t和rules_98_strict_t实例化
  *
  * @param [in] calculate_param 算番参数
  * @param [out] fan_table 番表，当有某种番时，相应的会设置为这种番出现的次数
@@ -216,8 +255,93 @@ typedef uint16_t fan_table_t[FAN_TABLE_SIZE];
  * @retval ERROR_TILE_COUNT_GREATER_THAN_4 某张牌出现超过4枚
  * @retval ERROR_NOT_WIN 没和牌
  */
+template <class rules_t>
+int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table);
+
+/**
+ * @brief 算番（通行计法），同calculate_fan<rules_default_t>
+ *
+ * @param [in] calculate_param 算番参数
+ * @param [out] fan_table 番表，当有某种番时，相应的会设置为这种番出现的次数
+ * @return int 番数或者错误码，同calculate_fan<rules_default_t>
+ */
 int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table);
 
+/**
+ * @brief 按运行时指定的规则集算番
+ *
+ * @param [in] calculate_param 算番参数
+ * @param [out] fan_table 番表，当有某种番时，相应的会设置为这种番出现的次数
+ * @param [in] rule_set 规则集
+ * @return int 番数或者错误码，同calculate_fan<rules_t>
+ */
+int calculate_fan(const calculate_param_t *calculate_param, fan_table_t *fan_table, rule_set_t rule_set);
+
+/**
+ * @brief 判断番数能否达到起和番
+ *  不计算准确的番数：已算出的番数达到起和番时立即返回，番数的上界达不到时也不再判断听牌方式。
+ *  和牌时结果与calculate_fan(calculate_param, nullptr) >= min_fan一致
+ *  只对预定义的规则集rules_default_t和rules_98_strict_t实例化
+ *
+ * @param [in] calculate_param 算番参数
+ * @param [in] min_fan 起和番（含花牌），如8番
+ * @return bool 能否达到，输入不合法或者没和牌时为false
+ */
+template <class rules_t>
+bool reaches_min_fan(const calculate_param_t *calculate_param, int min_fan);
+
+/**
+ * @brief 判断番数能否达到起和番（通行计法），同reaches_min_fan<rules_default_t>
+ */
+bool reaches_min_fan(const calculate_param_t *calculate_param, int min_fan);
+
+/**
+ * @brief 听牌时一张和牌张在一种和牌标记下的算番结果
+ */
+struct waiting_fan_t {
+    tile_t win_tile;        ///< 和牌张
+    win_flag_t win_flag;    ///< 和牌标记（传入的原值）
+    int fan;                ///< 番数，取值同calculate_fan的返回值
+    fan_table_t fan_table;  ///< 番表
+};
+
+/**
+ * @brief 听牌时对所有和牌张算番
+ *  立牌只排序一次，是否只听一张只判断一次，每张和牌张的划分在各个和牌标记之间共享。
+ *  结果与对每张和牌张、每个和牌标记分别调用calculate_fan完全一致
+ *  只对预定义的规则集rules_default_t和rules_98_strict_t实例化
+ *
+ * @param [in] calculate_param 算番参数，其中的和牌张与和牌标记不使用
+ * @param [in] win_flags 和牌标记数组
+ * @param [in] flag_cnt 和牌标记数
+ * @param [out] results 结果数组，按和牌张从小到大排列，每张和牌张连续flag_cnt个结果，依次对应win_flags
+ * @param [in] max_cnt 结果数组的容量，容纳不下的和牌张不计算
+ * @retval >=0 和牌张数（已经用了4枚的牌不算），为0表示没听牌
+ * @retval ERROR_WRONG_TILES_COUNT 错误的张数
+ * @retval ERROR_TILE_COUNT_GREATER_THAN_4 某张牌出现超过4枚
+ */
+template <class rules_t>
+intptr_t calculate_fan_for_waits(const calculate_param_t *calculate_param, const win_flag_t *win_flags, intptr_t flag_cnt,
+    waiting_fan_t *results, intptr_t max_cnt);
+
+/**
+ * @brief 听牌时对所有和牌张算番（通行计法），同calculate_fan_for_waits<rules_default_t>
+ */
+intptr_t calculate_fan_for_waits(const calculate_param_t *calculate_param, const win_flag_t *win_flags, intptr_t flag_cnt,
+    waiting_fan_t *results, intptr_t max_cnt);
+
+/**
+ * @brief 批量算番
+ *  多个线程同时计算，每手牌的结果与单独调用calculate_fan完全一致
+ *
+ * @param [in] calculate_params 算番参数数组
+ * @param [in] count 手牌数
+ * @param [out] fan_tables 番表数组（可为null，此时只计算番数）
+ * @param [out] fans 番数数组，每个元素的取值同calculate_fan的返回值
+ * @param [in] thread_cnt 线程数（包括调用者的线程），不大于0时使用硬件支持的并发线程数
+ */
+void calculate_fan_batch(const calculate_param_t *calculate_params, size_t count, fan_table_t *fan_tables, int *fans, int thread_cnt);
+
 #if 0
 
 /**
@@ -0,0 +1,251 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#include "hand_code.h"
+#include <string.h>
+#include <algorithm>
+
+namespace mahjong {
+
+// 副露的编号：种类*8+供牌信息，种类0~20为顺子（按花色、中间张），21~54为刻子，55~88为杠
+#define PACK_KIND_CNT 89
+#define PACK_ID_CNT (PACK_KIND_CNT * 8)
+#define WIN_TILE_CNT 35  // 0表示没有和牌张，1~34为各种牌
+
+namespace {
+    // 各段的起始编码以及小组合数表
+    struct code_table_t {
+        uint64_t tile_binomial[48][14];  // C(n, k)，立牌的组合用
+        uint64_t segment_begin[5][14];   // 各副露组数、立牌数的段的起始编码
+        uint64_t segment_end;
+
+        code_table_t() {
+            memset(tile_binomial, 0, sizeof(tile_binomial));
+            for (int n = 0; n < 48; ++n) {
+                tile_binomial[n][0] = 1;
+                for (int k = 1; k < 14 && k <= n; ++k) {
+                    tile_binomial[n][k] = tile_binomial[n - 1][k - 1] + (k < n ? tile_binomial[n - 1][k] : 0);
+                }
+            }
+
+            uint64_t begin = 0;
+            for (int pack_cnt = 0; pack_cnt < 5; ++pack_cnt) {
+                for (int tile_cnt = 0; tile_cnt < 14; ++tile_cnt) {
+                    segment_begin[pack_cnt][tile_cnt] = begin;
+                    if (tile_cnt <= 13 - pack_cnt * 3) {
+                        begin += pack_combination_count(pack_cnt) * tile_binomial[34 + tile_cnt - 1][tile_cnt] * WIN_TILE_CNT;
+                    }
+                }
+            }
+            segment_end = begin;
+        }
+
+        // 可重复地取pack_cnt组副露的组合数
+        static uint64_t pack_combination_count(int pack_cnt) {
+            return pack_binomial(PACK_ID_CNT + pack_cnt - 1, pack_cnt);
+        }
+
+        // 副露用的组合数，k不超过4，直接连乘
+        static uint64_t pack_binomial(uint64_t n, int k) {
+            if (static_cast<int64_t>(n) < k) {
+                return 0;
+            }
+            uint64_t ret = 1;
+            for (int i = 0; i < k; ++i) {
+                ret = ret * (n - i) / (i + 1);
+            }
+            return ret;
+        }
+    };
+
+    static const code_table_t code_table;
+}
+
+// 牌在all_tiles中的下标，不合法时返回-1
+static FORCE_INLINE int tile_to_index(tile_t tile) {
+    if (is_numbered_suit(tile)) {
+        return (tile_get_suit(tile) - 1) * 9 + tile_get_rank(tile) - 1;
+    }
+    if (is_honor(tile)) {
+        return 27 + tile_get_rank(tile) - 1;
+    }
+    return -1;
+}
+
+// 副露的编号，不合法时返回-1
+static int pack_to_id(pack_t pack) {
+    if (pack & 0x8000) {
+        return -1;
+    }
+    int offer = (pack >> 12) & 7;
+    tile_t tile = pack_get_tile(pack);
+    int idx = tile_to_index(tile);
+    if (idx < 0) {
+        return -1;
+    }
+    switch (pack_get_type(pack)) {
+    case PACK_TYPE_CHOW: {
+        rank_t rank = tile_get_rank(tile);
+        if (!is_numbered_suit(tile) || rank < 2 || rank > 8) {
+            return -1;
+        }
+        return ((tile_get_suit(tile) - 1) * 7 + rank - 2) * 8 + offer;
+    }
+    case PACK_TYPE_PUNG:
+        return (21 + idx) * 8 + offer;
+    case PACK_TYPE_KONG:
+        return (55 + idx) * 8 + offer;
+    default:
+        return -1;
+    }
+}
+
+static pack_t id_to_pack(int id) {
+    int kind = id / 8;
+    uint8_t offer = static_cast<uint8_t>(id % 8);
+    pack_t pack;
+    if (kind < 21) {
+        pack = make_pack(0, PACK_TYPE_CHOW, make_tile(static_cast<suit_t>(kind / 7 + 1), static_cast<rank_t>(kind % 7 + 2)));
+    }
+    else if (kind < 55) {
+        pack = make_pack(0, PACK_TYPE_PUNG, all_tiles[kind - 21]);
+    }
+    else {
+        pack = make_pack(0, PACK_TYPE_KONG, all_tiles[kind - 55]);
+    }
+    return static_cast<pack_t>(pack | (offer << 12));
+}
+
+// 编码手牌
+bool encode_hand(const hand_tiles_t *hand_tiles, tile_t win_tile, hand_code_t *code) {
+    const intptr_t pack_cnt = hand_tiles->pack_count;
+    const intptr_t tile_cnt = hand_tiles->tile_count;
+    if (pack_cnt < 0 || pack_cnt > 4 || tile_cnt < 0 || tile_cnt > 13 - pack_cnt * 3) {
+        return false;
+    }
+
+    int win_idx = 0;
+    if (win_tile != 0) {
+        win_idx = tile_to_index(win_tile) + 1;
+        if (win_idx == 0) {
+            return false;
+        }
+    }
+
+    // 副露的组合：编号排序后第i个加上i，变成严格递增的序列，再用组合数系统编号
+    int ids[4];
+    for (intptr_t i = 0; i < pack_cnt; ++i) {
+        ids[i] = pack_to_id(hand_tiles->fixed_packs[i]);
+        if (ids[i] < 0) {
+            return false;
+        }
+    }
+    std::sort(ids, ids + pack_cnt);
+    uint64_t pack_rank = 0;
+    for (intptr_t i = 0; i < pack_cnt; ++i) {
+        pack_rank += code_table_t::pack_binomial(ids[i] + i, static_cast<int>(i + 1));
+    }
+
+    // 立牌的组合，同上
+    int idx[13];
+    for (intptr_t i = 0; i < tile_cnt; ++i) {
+        idx[i] = tile_to_index(hand_tiles->standing_tiles[i]);
+        if (idx[i] < 0) {
+            return false;
+        }
+    }
+    std::sort(idx, idx + tile_cnt);
+    uint64_t tile_rank = 0;
+    for (intptr_t i = 0; i < tile_cnt; ++i) {
+        tile_rank += code_table.tile_binomial[idx[i] + i][i + 1];
+    }
+
+    const uint64_t tile_combination_cnt = code_table.tile_binomial[34 + tile_cnt - 1][tile_cnt];
+    *code = code_table.segment_begin[pack_cnt][tile_cnt] + (pack_rank * tile_combination_cnt + tile_rank) * WIN_TILE_CNT + win_idx;
+    return true;
+}
+
+// 组合数系统的逆：求严格递增的序列，各项都小于limit，binomial(n, k)为组合数
+template <class binomial_t>
+static void unrank_combination(uint64_t rank, int cnt, int limit, int *seq, binomial_t binomial) {
+    for (int k = cnt; k > 0; --k) {
+        // 二分查找最大的n使得C(n, k)不超过rank
+        int lo = k - 1, hi = limit - 1;
+        while (lo < hi) {
+            int mid = (lo + hi + 1) / 2;
+            if (binomial(mid, k) <= rank) {
+                lo = mid;
+            }
+            else {
+                hi = mid - 1;
+            }
+        }
+        seq[k - 1] = lo;
+        rank -= binomial(lo, k);
+        limit = lo;
+    }
+}
+
+// 解码手牌
+bool decode_hand(hand_code_t code, hand_tiles_t *hand_tiles, tile_t *win_tile) {
+    if (code >= code_table.segment_end) {
+        return false;
+    }
+
+    // 找到所在的段
+    int pack_cnt = 0, tile_cnt = 0;
+    for (int p = 0; p < 5; ++p) {
+        for (int t = 0; t <= 13 - p * 3; ++t) {
+            if (code_table.segment_begin[p][t] <= code) {
+                pack_cnt = p;
+                tile_cnt = t;
+            }
+        }
+    }
+    code -= code_table.segment_begin[pack_cnt][tile_cnt];
+
+    const int win_idx = static_cast<int>(code % WIN_TILE_CNT);
+    code /= WIN_TILE_CNT;
+    const uint64_t tile_combination_cnt = code_table.tile_binomial[34 + tile_cnt - 1][tile_cnt];
+    const uint64_t tile_rank = code % tile_combination_cnt;
+    const uint64_t pack_rank = code / tile_combination_cnt;
+
+    int seq[13];
+    unrank_combination(pack_rank, pack_cnt, PACK_ID_CNT + pack_cnt - 1, seq, [](int n, int k) { return code_table_t::pack_binomial(n, k); });
+    for (int i = 0; i < pack_cnt; ++i) {
+        hand_tiles->fixed_packs[i] = id_to_pack(seq[i] - i);
+    }
+    hand_tiles->pack_count = pack_cnt;
+
+    unrank_combination(tile_rank, tile_cnt, 34 + tile_cnt - 1, seq, [](int n, int k) { return code_table.tile_binomial[n][k]; });
+    for (int i = 0; i < tile_cnt; ++i) {
+        hand_tiles->standing_tiles[i] = all_tiles[seq[i] - i];
+    }
+    hand_tiles->tile_count = tile_cnt;
+
+    if (win_tile != nullptr) {
+        *win_tile = win_idx == 0 ? 0 : all_tiles[win_idx - 1];
+    }
+    return true;
+}
+
+}
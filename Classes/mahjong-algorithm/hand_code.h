@@ -0,0 +1,100 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__HAND_CODE_H__
+#define __MAHJONG_ALGORITHM__HAND_CODE_H__
+
+#include "tile.h"
+
+namespace mahjong {
+
+/**
+ * @addtogroup tile
+ * @{
+ */
+
+/**
+ * @brief 手牌编码
+ *  手牌结构加上和牌张的定长二进制编码，立牌与副露的顺序不影响编码，所以可以直接比较相等以及作为哈希表的键。
+ *  依次按副露组数、立牌数分段；段内按副露的组合、立牌的组合、和牌张做混合进制，组合用组合数系统编号。
+ *  副露按类型、牌、供牌信息（含加杠位，共3位）编号，所有合法的手牌编码都小于2^50
+ */
+typedef uint64_t hand_code_t;
+
+/**
+ * @brief 编码手牌
+ *
+ * @param [in] hand_tiles 手牌结构（副露不超过4组，立牌不超过13-3*副露组数张）
+ * @param [in] win_tile 和牌张（可为0）
+ * @param [out] code 编码
+ * @return bool 能否编码（有非法的牌或者牌组、张数超出范围时返回false）
+ */
+bool encode_hand(const hand_tiles_t *hand_tiles, tile_t win_tile, hand_code_t *code);
+
+/**
+ * @brief 解码手牌
+ *  立牌按从小到大排列，副露按编号排列
+ *
+ * @param [in] code 编码
+ * @param [out] hand_tiles 手牌结构
+ * @param [out] win_tile 和牌张（可为null）
+ * @return bool 是否为合法的编码
+ */
+bool decode_hand(hand_code_t code, hand_tiles_t *hand_tiles, tile_t *win_tile);
+
+/**
+ * @brief 两个编码是否为同一手牌
+ */
+static FORCE_INLINE bool is_same_hand_code(hand_code_t a, hand_code_t b) {
+    return a == b;
+}
+
+/**
+ * @brief 编码的哈希值
+ *  编码的高位几乎总是0，低位也很规整，所以先打散再用
+ */
+static FORCE_INLINE uint64_t hand_code_hash(hand_code_t code) {
+    code ^= code >> 33;
+    code *= UINT64_C(0xFF51AFD7ED558CCD);
+    code ^= code >> 33;
+    code *= UINT64_C(0xC4CEB9FE1A85EC53);
+    code ^= code >> 33;
+    return code;
+}
+
+/**
+ * @brief 用于std::unordered_map等容器的哈希函数对象
+ */
+struct hand_code_hasher_t {
+    size_t operator()(hand_code_t code) const {
+        return static_cast<size_t>(hand_code_hash(code));
+    }
+};
+
+/**
+ * end group
+ * @}
+ */
+
+}
+
+#endif
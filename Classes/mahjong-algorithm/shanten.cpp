@@ -26,7 +26,13 @@
 #include <limits>
 #include <algorithm>
 #include <iterator>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
 #include "standard_tiles.h"
+#include "win_table.h"
+#include "worker_pool.h"
 
 namespace mahjong {
 
@@ -76,16 +82,15 @@ void map_tiles(const tile_t *tiles, intptr_t cnt, tile_table_t *cnt_table) {
     }
 }
 
-// 将手牌打表
-bool map_hand_tiles(const hand_tiles_t *hand_tiles, tile_table_t *cnt_table) {
+// 将手牌的副露和立牌都恢复成牌，手牌结构不正确时返回0
+static intptr_t hand_tiles_to_all_tiles(const hand_tiles_t *hand_tiles, tile_t (&tiles)[18]) {
     // 将每一组副露当作3张牌来算，那么总张数=13
     if (hand_tiles->tile_count <= 0 || hand_tiles->pack_count < 0 || hand_tiles->pack_count > 4
         || hand_tiles->pack_count * 3 + hand_tiles->tile_count != 13) {
-        return false;
+        return 0;
     }
 
     // 将副露恢复成牌
-    tile_t tiles[18];
     intptr_t tile_cnt = 0;
     if (hand_tiles->pack_count == 0) {
         memcpy(tiles, hand_tiles->standing_tiles, 13 * sizeof(tile_t));
@@ -96,12 +101,34 @@ bool map_hand_tiles(const hand_tiles_t *hand_tiles, tile_table_t *cnt_table) {
         memcpy(tiles + tile_cnt, hand_tiles->standing_tiles, hand_tiles->tile_count * sizeof(tile_t));
         tile_cnt += hand_tiles->tile_count;
     }
+    return tile_cnt;
+}
+
+// 将手牌打表
+bool map_hand_tiles(const hand_tiles_t *hand_tiles, tile_table_t *cnt_table) {
+    tile_t tiles[18];
+    intptr_t tile_cnt = hand_tiles_to_all_tiles(hand_tiles, tiles);
+    if (tile_cnt == 0) {
+        return false;
+    }
 
     // 打表
     map_tiles(tiles, tile_cnt, cnt_table);
     return true;
 }
 
+// 将手牌打表到紧凑牌表
+bool map_hand_tiles_to_counts(const hand_tiles_t *hand_tiles, tile_counts_t *counts) {
+    tile_t tiles[18];
+    intptr_t tile_cnt = hand_tiles_to_all_tiles(hand_tiles, tiles);
+    if (tile_cnt == 0) {
+        return false;
+    }
+
+    map_tiles_to_counts(tiles, tile_cnt, counts);
+    return true;
+}
+
 // 将表转换成牌
 intptr_t table_to_tiles(const tile_table_t &cnt_table, tile_t *tiles, intptr_t max_cnt) {
     intptr_t cnt = 0;
@@ -137,64 +164,105 @@ namespace {
 #define UNIT_TYPE(unit_) (((unit_) >> 8) & 0xFF)
 #define UNIT_TILE(unit_) ((unit_) & 0xFF)
 
-#define MAX_STATE 512
 #define UNIT_SIZE 7
+#define STATE_INLINE_CAPACITY 1024
 
     // 一条路径
     struct work_path_t {
         path_unit_t units[UNIT_SIZE];  // 14/2=7最多7个搭子
-        uint16_t depth;  // 当前路径深度
     };
 
     // 当前工作状态
+    // 路径的签名为其所有单元编码排序后依次拼接而成的64位整数，见is_basic_form_branch_exist
+    // 单元相同、仅顺序不同的路径，削减后剩下的牌完全一样，只需要计算一次
+    // 集合采用开放定址，容量不够时自动扩大，没有数量上限
     struct work_state_t {
-        work_path_t paths[MAX_STATE];  // 所有路径
-        intptr_t count;  // 路径数量
+        uint64_t *slots;  // 签名集合，0表示空位
+        size_t capacity;  // 容量，为2的幂
+        size_t count;  // 签名数量
+        uint64_t inline_slots[STATE_INLINE_CAPACITY];  // 路径较少时不需要分配内存
+
+        work_state_t() : slots(inline_slots), capacity(STATE_INLINE_CAPACITY), count(0) {
+            memset(inline_slots, 0, sizeof(inline_slots));
+        }
+
+        ~work_state_t() {
+            if (slots != inline_slots) {
+                delete [] slots;
+            }
+        }
+
+        work_state_t(const work_state_t &) = delete;
+        work_state_t &operator=(const work_state_t &) = delete;
     };
 }
 
-// 路径是否来过了
-static bool is_basic_form_branch_exist(const intptr_t fixed_cnt, const work_path_t *work_path, const work_state_t *work_state) {
-    if (work_state->count <= 0 || work_path->depth == 0) {
-        return false;
-    }
+// 路径单元的编码，类型3位+牌的序号6位，不会为0
+static FORCE_INLINE uint64_t path_unit_code(path_unit_t unit) {
+    const tile_t t = static_cast<tile_t>(UNIT_TILE(unit));
+    return (static_cast<uint64_t>(UNIT_TYPE(unit)) << 6) | static_cast<uint64_t>((tile_get_suit(t) - 1) * 9 + tile_get_rank(t) - 1);
+}
 
-    // depth处有信息，所以按stl风格的end应该要+1
-    const uint16_t depth = static_cast<uint16_t>(work_path->depth + 1);
-
-    // std::includes要求有序，但又不能破坏当前数据
-    work_path_t temp;
-    std::copy(&work_path->units[fixed_cnt], &work_path->units[depth], &temp.units[fixed_cnt]);
-    std::sort(&temp.units[fixed_cnt], &temp.units[depth]);
-
-    return std::any_of(&work_state->paths[0], &work_state->paths[work_state->count],
-        [&temp, fixed_cnt, depth](const work_path_t &path) {
-        return std::includes(&path.units[fixed_cnt], &path.units[path.depth], &temp.units[fixed_cnt], &temp.units[depth]);
-    });
-}
-
-// 保存路径
-static void save_work_path(const intptr_t fixed_cnt, const work_path_t *work_path, work_state_t *work_state) {
-    // 复制一份数据，不破坏当前数据
-    work_path_t temp;
-    temp.depth = work_path->depth;
-    std::copy(&work_path->units[fixed_cnt], &work_path->units[temp.depth + 1], &temp.units[fixed_cnt]);
-    std::sort(&temp.units[fixed_cnt], &temp.units[temp.depth + 1]);
-
-    // 判断是否重复
-    if (std::none_of(&work_state->paths[0], &work_state->paths[work_state->count],
-        [&temp, fixed_cnt](const work_path_t &path) {
-        return (path.depth == temp.depth && std::equal(&path.units[fixed_cnt], &path.units[path.depth + 1], &temp.units[fixed_cnt]));
-    })) {
-        if (work_state->count < MAX_STATE) {
-            work_path_t &path = work_state->paths[work_state->count++];
-            path.depth = temp.depth;
-            std::copy(&temp.units[fixed_cnt], &temp.units[temp.depth + 1], &path.units[fixed_cnt]);
+// 签名在集合中的位置
+static FORCE_INLINE size_t signature_slot(uint64_t signature, size_t capacity) {
+    return static_cast<size_t>((signature * UINT64_C(0x9E3779B97F4A7C15)) >> 32) & (capacity - 1);
+}
+
+// 扩大集合的容量
+static void work_state_grow(work_state_t *work_state) {
+    const size_t capacity = work_state->capacity * 2;
+    uint64_t *slots = new uint64_t[capacity]();
+    for (size_t k = 0; k < work_state->capacity; ++k) {
+        uint64_t s = work_state->slots[k];
+        if (s != 0) {
+            size_t i = signature_slot(s, capacity);
+            while (slots[i] != 0) {
+                i = (i + 1) & (capacity - 1);
+            }
+            slots[i] = s;
         }
-        else {
-            assert(0 && "too many state!");
+    }
+    if (work_state->slots != work_state->inline_slots) {
+        delete [] work_state->slots;
+    }
+    work_state->slots = slots;
+    work_state->capacity = capacity;
+}
+
+// 将签名加入集合，已存在时返回false
+static bool work_state_insert(work_state_t *work_state, uint64_t signature) {
+    size_t i = signature_slot(signature, work_state->capacity);
+    while (work_state->slots[i] != 0) {
+        if (work_state->slots[i] == signature) {
+            return false;
         }
+        i = (i + 1) & (work_state->capacity - 1);
+    }
+    work_state->slots[i] = signature;
+
+    // 装载率超过一半时扩容
+    if (++work_state->count * 2 > work_state->capacity) {
+        work_state_grow(work_state);
     }
+    return true;
+}
+
+// 路径是否来过了，没来过的记录下来
+static bool is_basic_form_branch_exist(const intptr_t fixed_cnt, const intptr_t depth, const work_path_t *work_path, work_state_t *work_state) {
+    // 排序后依次拼接，最多6个单元，6*9=54位，不同的路径签名不会相同
+    // depth处有信息，所以按stl风格的end应该要+1
+    uint64_t codes[UNIT_SIZE];
+    intptr_t cnt = 0;
+    for (intptr_t i = fixed_cnt; i <= depth; ++i) {
+        codes[cnt++] = path_unit_code(work_path->units[i]);
+    }
+    std::sort(&codes[0], &codes[cnt]);
+
+    uint64_t signature = 0;
+    for (intptr_t i = 0; i < cnt; ++i) {
+        signature |= codes[i] << (i * 9);
+    }
+    return !work_state_insert(work_state, signature);
 }
 
 // 递归计算基本和型上听数
@@ -243,12 +311,10 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
 
     // 当前路径深度
     const unsigned depth = pack_cnt + incomplete_cnt + has_pair;
-    work_path->depth = static_cast<uint16_t>(depth);
 
     int result = max_ret;
 
     if (pack_cnt + incomplete_cnt > 4) {  // 搭子超载
-        save_work_path(fixed_cnt, work_path, work_state);
         return max_ret;
     }
 
@@ -261,7 +327,7 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
         // 雀头
         if (!has_pair && cnt_table[t] > 1) {
             work_path->units[depth] = MAKE_UNIT(UNIT_TYPE_PAIR, t);  // 记录雀头
-            if (!is_basic_form_branch_exist(fixed_cnt, work_path, work_state)) {
+            if (!is_basic_form_branch_exist(fixed_cnt, depth, work_path, work_state)) {
                 // 削减雀头，递归
                 cnt_table[t] -= 2;
                 int ret = basic_form_shanten_recursively(cnt_table, true, pack_cnt, incomplete_cnt,
@@ -275,7 +341,7 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
         // 刻子
         if (cnt_table[t] > 2) {
             work_path->units[depth] = MAKE_UNIT(UNIT_TYPE_PUNG, t);  // 记录刻子
-            if (!is_basic_form_branch_exist(fixed_cnt, work_path, work_state)) {
+            if (!is_basic_form_branch_exist(fixed_cnt, depth, work_path, work_state)) {
                 // 削减这组刻子，递归
                 cnt_table[t] -= 3;
                 int ret = basic_form_shanten_recursively(cnt_table, has_pair, pack_cnt + 1, incomplete_cnt,
@@ -291,7 +357,7 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
         // 顺子t t+1 t+2，显然t不能是8点以上的数牌
         if (is_numbered && tile_get_rank(t) < 8 && cnt_table[t + 1] && cnt_table[t + 2]) {
             work_path->units[depth] = MAKE_UNIT(UNIT_TYPE_CHOW, t);  // 记录顺子
-            if (!is_basic_form_branch_exist(fixed_cnt, work_path, work_state)) {
+            if (!is_basic_form_branch_exist(fixed_cnt, depth, work_path, work_state)) {
                 // 削减这组顺子，递归
                 --cnt_table[t];
                 --cnt_table[t + 1];
@@ -314,7 +380,7 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
         // 刻子搭子
         if (cnt_table[t] > 1) {
             work_path->units[depth] = MAKE_UNIT(UNIT_TYPE_INCOMPLETE_PUNG, t);  // 记录刻子搭子
-            if (!is_basic_form_branch_exist(fixed_cnt, work_path, work_state)) {
+            if (!is_basic_form_branch_exist(fixed_cnt, depth, work_path, work_state)) {
                 // 削减刻子搭子，递归
                 cnt_table[t] -= 2;
                 int ret = basic_form_shanten_recursively(cnt_table, has_pair, pack_cnt, incomplete_cnt + 1,
@@ -330,7 +396,7 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
             // 两面或者边张搭子t t+1，显然t不能是9点以上的数牌
             if (tile_get_rank(t) < 9 && cnt_table[t + 1]) {  // 两面或者边张
                 work_path->units[depth] = MAKE_UNIT(UNIT_TYPE_CHOW_OPEN_END, t);  // 记录两面或者边张搭子
-                if (!is_basic_form_branch_exist(fixed_cnt, work_path, work_state)) {
+                if (!is_basic_form_branch_exist(fixed_cnt, depth, work_path, work_state)) {
                     // 削减搭子，递归
                     --cnt_table[t];
                     --cnt_table[t + 1];
@@ -345,7 +411,7 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
             // 嵌张搭子t t+2，显然t不能是8点以上的数牌
             if (tile_get_rank(t) < 8 && cnt_table[t + 2]) {  // 嵌张
                 work_path->units[depth] = MAKE_UNIT(UNIT_TYPE_CHOW_CLOSED, t);  // 记录嵌张搭子
-                if (!is_basic_form_branch_exist(fixed_cnt, work_path, work_state)) {
+                if (!is_basic_form_branch_exist(fixed_cnt, depth, work_path, work_state)) {
                     // 削减搭子，递归
                     --cnt_table[t];
                     --cnt_table[t + 2];
@@ -360,10 +426,6 @@ static int basic_form_shanten_recursively(tile_table_t &cnt_table, const bool ha
         }
     }
 
-    if (result == max_ret) {
-        save_work_path(fixed_cnt, work_path, work_state);
-    }
-
     return result;
 }
 
@@ -377,20 +439,466 @@ static bool numbered_tile_has_neighbor(const tile_table_t &cnt_table, tile_t t)
     return false;
 }
 
-// 以表格为参数计算基本和型上听数
-static int basic_form_shanten_from_table(tile_table_t &cnt_table, intptr_t fixed_cnt, useful_table_t *useful_table) {
-    // 计算上听数
+// 一次拆解过程中计算有效牌
+//
+// 多摸一张牌最多使上听数减少1。设摸到t后的某种最优拆解中，t属于单元u，将t从u中拿走，
+// 就得到当前手牌的一种拆解，可以证明它一定是当前手牌的最优拆解，并且只有以下三种情况：
+//   1. u是面子，拿走t后剩下搭子，即t能将最优拆解中的某个搭子补成面子（面子不足4组时）
+//   2. u是搭子，拿走t后剩下孤张，即t能与最优拆解中的某个孤张组成搭子（搭子未超载时）
+//   3. u是雀头，拿走t后剩下孤张，即t能与最优拆解中的某个孤张组成雀头（无雀头时）
+// 所以只需枚举当前手牌的所有最优拆解，汇总这三种情况的牌，而不必对每张牌都重新计算一遍上听数
+//
+// 为了每种拆解只枚举一次，总是先处理序号最小的牌：要么作为孤张，要么与其后的牌组成面子、雀头、搭子
+// 牌的标记采用tile_set_t，每门数牌连续占9位，所以与相邻的牌组成搭子时要按点数屏蔽掉跨门的移位
+
+#define NUMBERED_TILE_SET ((UINT64_C(1) << 27) - 1)
+#define NUMBERED_RANK_SET(rank_bits_) (UINT64_C(rank_bits_) | (UINT64_C(rank_bits_) << 9) | (UINT64_C(rank_bits_) << 18))
+
+namespace {
+    // 拆解的工作状态
+    struct useful_search_t {
+        tile_table_t *cnt_table;  // 剩余的牌
+        int best;  // 目前为止的最小上听数
+        tile_set_t useful_set;  // 上听数为best的所有拆解中的有效牌
+    };
+}
+
+// 剩余left_cnt张牌时，能达到的最小上听数的下界，不考虑具体是什么牌，只考虑张数
+static int basic_form_shanten_lower_bound(int pack_cnt, int incomplete_cnt, bool has_pair, int left_cnt) {
+    int ret = std::numeric_limits<int>::max();
+    for (int a = 0; a * 3 <= left_cnt && pack_cnt + a <= 4; ++a) {
+        for (int p = 0; p <= (has_pair ? 0 : 1) && a * 3 + p * 2 <= left_cnt; ++p) {
+            int b = (left_cnt - a * 3 - p * 2) / 2;
+            int m = pack_cnt + a;
+            ret = std::min(ret, 8 - m * 2 - std::min(incomplete_cnt + b, 4 - m) - (has_pair || p ? 1 : 0));
+        }
+    }
+    return ret;
+}
+
+// 递归枚举拆解
+// 参数说明：
+//   idx当前处理的牌的序号（all_tiles的下标），序号小于它的牌都已经拆解过了
+//   pack_cnt完成的面子数（含副露）
+//   incomplete_cnt搭子数
+//   has_pair是否有雀头
+//   left_cnt剩余牌的张数
+//   completion_set能将已有搭子补成面子的牌
+//   isolated_set孤张
+static void basic_form_useful_recursively(int idx, int pack_cnt, int incomplete_cnt, bool has_pair, int left_cnt,
+    tile_set_t completion_set, tile_set_t isolated_set, useful_search_t *state) {
+    // 剪枝：不可能达到目前的最小上听数
+    if (basic_form_shanten_lower_bound(pack_cnt, incomplete_cnt, has_pair, left_cnt) > state->best) {
+        return;
+    }
+
+    tile_table_t &cnt_table = *state->cnt_table;
+    while (idx < 34 && cnt_table[all_tiles[idx]] == 0) {
+        ++idx;
+    }
+
+    if (idx == 34) {  // 拆解完成
+        int ret = 8 - pack_cnt * 2 - std::min(incomplete_cnt, 4 - pack_cnt) - (has_pair ? 1 : 0);
+        if (ret > state->best) {
+            return;
+        }
+        if (ret < state->best) {
+            state->best = ret;
+            state->useful_set = 0;
+        }
+
+        tile_set_t set = 0;
+        if (pack_cnt < 4) {  // 将搭子补成面子
+            set |= completion_set;
+        }
+        if (!has_pair) {  // 孤张组成雀头
+            set |= isolated_set;
+        }
+        if (pack_cnt + incomplete_cnt < 4) {  // 孤张组成搭子
+            tile_set_t numbered = isolated_set & NUMBERED_TILE_SET;
+            set |= isolated_set
+                | ((numbered & NUMBERED_RANK_SET(0x0FF)) << 1) | ((numbered & NUMBERED_RANK_SET(0x07F)) << 2)
+                | ((numbered & NUMBERED_RANK_SET(0x1FE)) >> 1) | ((numbered & NUMBERED_RANK_SET(0x1FC)) >> 2);
+        }
+        state->useful_set |= set;
+        return;
+    }
+
+    const tile_t t = all_tiles[idx];
+    const bool is_numbered = is_numbered_suit_quick(t);
+    const rank_t r = tile_get_rank(t);
+
+    // 先尝试面子，以便尽早得到较小的上听数，提高剪枝效率
+    if (pack_cnt < 4) {
+        // 刻子
+        if (cnt_table[t] > 2) {
+            cnt_table[t] -= 3;
+            basic_form_useful_recursively(idx, pack_cnt + 1, incomplete_cnt, has_pair, left_cnt - 3,
+                completion_set, isolated_set, state);
+            cnt_table[t] += 3;
+        }
+
+        // 顺子
+        if (is_numbered && r < 8 && cnt_table[t + 1] && cnt_table[t + 2]) {
+            --cnt_table[t];
+            --cnt_table[t + 1];
+            --cnt_table[t + 2];
+            basic_form_useful_recursively(idx, pack_cnt + 1, incomplete_cnt, has_pair, left_cnt - 3,
+                completion_set, isolated_set, state);
+            ++cnt_table[t];
+            ++cnt_table[t + 1];
+            ++cnt_table[t + 2];
+        }
+    }
+
+    if (cnt_table[t] > 1) {
+        // 雀头
+        if (!has_pair) {
+            cnt_table[t] -= 2;
+            basic_form_useful_recursively(idx, pack_cnt, incomplete_cnt, true, left_cnt - 2,
+                completion_set, isolated_set, state);
+            cnt_table[t] += 2;
+        }
+
+        // 刻子搭子
+        cnt_table[t] -= 2;
+        basic_form_useful_recursively(idx, pack_cnt, incomplete_cnt + 1, has_pair, left_cnt - 2,
+            completion_set | tile_set_of(t), isolated_set, state);
+        cnt_table[t] += 2;
+    }
+
+    if (is_numbered) {
+        // 两面或者边张搭子
+        if (r < 9 && cnt_table[t + 1]) {
+            tile_set_t set = (r > 1 ? tile_set_of(t - 1) : 0) | (r < 8 ? tile_set_of(t + 2) : 0);
+            --cnt_table[t];
+            --cnt_table[t + 1];
+            basic_form_useful_recursively(idx, pack_cnt, incomplete_cnt + 1, has_pair, left_cnt - 2,
+                completion_set | set, isolated_set, state);
+            ++cnt_table[t];
+            ++cnt_table[t + 1];
+        }
+
+        // 嵌张搭子
+        if (r < 8 && cnt_table[t + 2]) {
+            --cnt_table[t];
+            --cnt_table[t + 2];
+            basic_form_useful_recursively(idx, pack_cnt, incomplete_cnt + 1, has_pair, left_cnt - 2,
+                completion_set | tile_set_of(t + 1), isolated_set, state);
+            ++cnt_table[t];
+            ++cnt_table[t + 2];
+        }
+    }
+
+    // 孤张
+    --cnt_table[t];
+    basic_form_useful_recursively(idx, pack_cnt, incomplete_cnt, has_pair, left_cnt - 1,
+        completion_set, isolated_set | tile_set_of(t), state);
+    ++cnt_table[t];
+}
+
+// 一次拆解同时计算基本和型上听数和有效牌
+static int basic_form_shanten_with_useful(tile_table_t &cnt_table, intptr_t fixed_cnt, useful_table_t *useful_table) {
+    int left_cnt = 0;
+    for (int i = 0; i < 34; ++i) {
+        left_cnt += cnt_table[all_tiles[i]];
+    }
+
+    useful_search_t state;
+    state.cnt_table = &cnt_table;
+    state.best = std::numeric_limits<int>::max();
+    state.useful_set = 0;
+    basic_form_useful_recursively(0, static_cast<int>(fixed_cnt), 0, false, left_cnt, 0, 0, &state);
+
+    for (tile_set_t set = state.useful_set; set != 0; set &= set - 1) {
+        tile_t t = tile_set_first(set);
+        // 已经有4张的牌，除非已经听牌，否则不算有效牌
+        if (!(cnt_table[t] == 4 && state.best > 0)) {
+            (*useful_table)[t] = true;
+        }
+    }
+
+    return state.best;
+}
+
+//-------------------------------- 查表法 --------------------------------
+
+// 基本和型的上听数只取决于面子数、搭子数、有无雀头，而各门牌之间的拆解互不影响，
+// 所以可以对每一门牌预先算好所有拆解方式的最优结果，计算时查表再合并即可
+
+namespace {
+
+    // 一门牌的拆解结果
+    // 对于有无雀头p(0~1)、面子数m(0~4)的每种组合，记录能得到的最多搭子数
+    // 每种组合占3位，0表示无法达成，1~5表示搭子数0~4（超过4个搭子不会再减少上听数，截断为4）
+    typedef uint32_t suit_entry_t;
+
+#define SUIT_ENTRY_SHIFT(p_, m_) (((p_) * 5 + (m_)) * 3)
+#define SUIT_ENTRY_FIELD(entry_, p_, m_) static_cast<int>(((entry_) >> SUIT_ENTRY_SHIFT(p_, m_)) & 7)
+#define SUIT_ENTRY_EMPTY 1U  // 无雀头、0面子、0搭子
+
+#define NUMBERED_TABLE_SIZE 1953125  // 5^9
+#define HONORS_TABLE_SIZE 78125  // 5^7
+
+    // 查找表，数牌按5进制将1~9的张数编码为下标，字牌同理
+    struct basic_form_lookup_t {
+        suit_entry_t numbered[NUMBERED_TABLE_SIZE];
+        suit_entry_t honors[HONORS_TABLE_SIZE];
+    };
+
+    static const uint32_t pow5_table[] = { 1, 5, 25, 125, 625, 3125, 15625, 78125, 390625, 1953125 };
+}
+
+// 合并两种拆解结果，取每种组合的最多搭子数
+static suit_entry_t suit_entry_merge(suit_entry_t a, suit_entry_t b) {
+    suit_entry_t ret = 0;
+    for (int i = 0; i < 10; ++i) {
+        suit_entry_t x = (a >> (i * 3)) & 7, y = (b >> (i * 3)) & 7;
+        ret |= std::max(x, y) << (i * 3);
+    }
+    return ret;
+}
+
+// 拆解结果增加一组面子
+static FORCE_INLINE suit_entry_t suit_entry_add_pack(suit_entry_t entry) {
+    // 每一段整体左移一个字段，丢弃面子数为4的，并清掉面子数为0的
+    return (entry << 3) & ~((7U << SUIT_ENTRY_SHIFT(0, 0)) | (7U << SUIT_ENTRY_SHIFT(1, 0))) & 0x3FFFFFFFU;
+}
+
+// 拆解结果增加雀头
+static FORCE_INLINE suit_entry_t suit_entry_add_pair(suit_entry_t entry) {
+    // 只有无雀头的才能增加雀头
+    return (entry & 0x7FFFU) << SUIT_ENTRY_SHIFT(1, 0);
+}
+
+// 拆解结果增加一组搭子
+static suit_entry_t suit_entry_add_incomplete(suit_entry_t entry) {
+    suit_entry_t ret = 0;
+    for (int i = 0; i < 10; ++i) {
+        suit_entry_t x = (entry >> (i * 3)) & 7;
+        if (x != 0 && x < 5) {
+            ++x;
+        }
+        ret |= x << (i * 3);
+    }
+    return ret;
+}
+
+// 生成一门牌的查找表
+// 由于削减牌之后下标一定变小，所以按下标从小到大递推即可
+// 每次只考虑最小的一张牌：要么作为孤张，要么与其后的牌组成面子、雀头或者搭子
+static void build_suit_table(suit_entry_t *table, int kinds, bool is_numbered) {
+    table[0] = SUIT_ENTRY_EMPTY;
+    const uint32_t size = pow5_table[kinds];
+    int cnt[9] = { 0 };  // 下标对应的各张数，按5进制逐个累加
+    for (uint32_t key = 1; key < size; ++key) {
+        for (int i = 0; ++cnt[i] == 5; ++i) {
+            cnt[i] = 0;
+        }
+
+        int r = 0;
+        while (cnt[r] == 0) {
+            ++r;
+        }
+        const uint32_t w0 = pow5_table[r];
+        const uint32_t w1 = r + 1 < kinds ? pow5_table[r + 1] : 0;
+        const uint32_t w2 = r + 2 < kinds ? pow5_table[r + 2] : 0;
+
+        // 孤张
+        suit_entry_t entry = table[key - w0];
+
+        // 雀头、刻子搭子
+        if (cnt[r] > 1) {
+            suit_entry_t sub = table[key - w0 * 2];
+            entry = suit_entry_merge(entry, suit_entry_add_pair(sub));
+            entry = suit_entry_merge(entry, suit_entry_add_incomplete(sub));
+        }
+
+        // 刻子
+        if (cnt[r] > 2) {
+            entry = suit_entry_merge(entry, suit_entry_add_pack(table[key - w0 * 3]));
+        }
+
+        // 顺子和顺子搭子（只能是数牌）
+        if (is_numbered) {
+            bool has_1 = (r + 1 < kinds && cnt[r + 1] > 0);
+            bool has_2 = (r + 2 < kinds && cnt[r + 2] > 0);
+            if (has_1) {  // 两面或者边张
+                entry = suit_entry_merge(entry, suit_entry_add_incomplete(table[key - w0 - w1]));
+            }
+            if (has_2) {  // 嵌张
+                entry = suit_entry_merge(entry, suit_entry_add_incomplete(table[key - w0 - w2]));
+            }
+            if (has_1 && has_2) {  // 顺子
+                entry = suit_entry_merge(entry, suit_entry_add_pack(table[key - w0 - w1 - w2]));
+            }
+        }
+
+        table[key] = entry;
+    }
+}
+
+// 获取查找表，首次调用时生成
+static const basic_form_lookup_t *get_basic_form_lookup() {
+    // C++11保证局部静态变量的初始化是线程安全的
+    static const basic_form_lookup_t *lookup = []() {
+        basic_form_lookup_t *ret = new basic_form_lookup_t;
+        build_suit_table(ret->numbered, 9, true);
+        build_suit_table(ret->honors, 7, false);
+        return ret;
+    }();
+    return lookup;
+}
+
+// 计算各门牌的下标，有超过4张的牌时返回false
+static bool get_suit_keys(const tile_table_t &cnt_table, uint32_t (&keys)[4]) {
+    for (int s = 0; s < 4; ++s) {
+        const int kinds = s < 3 ? 9 : 7;
+        const tile_t first = make_tile(static_cast<suit_t>(s + 1), 1);
+        uint32_t key = 0;
+        for (int i = 0; i < kinds; ++i) {
+            uint16_t n = cnt_table[first + i];
+            if (n > 4) {
+                return false;
+            }
+            key += n * pow5_table[i];
+        }
+        keys[s] = key;
+    }
+    return true;
+}
+
+// 从紧凑牌表计算各门牌的下标，有超过4张的牌时返回false
+static bool get_suit_keys(const tile_counts_t &counts, uint32_t (&keys)[4]) {
+    for (int s = 0; s < 4; ++s) {
+        const int kinds = s < 3 ? 9 : 7;
+        const uint8_t *p = &counts.counts[s * 9];
+        uint32_t key = 0;
+        for (int i = kinds - 1; i >= 0; --i) {
+            if (p[i] > 4) {
+                return false;
+            }
+            key = key * 5 + p[i];
+        }
+        keys[s] = key;
+    }
+    return true;
+}
+
+namespace {
+    // 若干门牌合并后的拆解结果
+    // best[p][m]：有无雀头、面子数对应的最多搭子数（截断为4），-1表示无法达成
+    struct suit_combined_t {
+        int best[2][5];
+    };
+}
+
+// 只有一门牌时的结果
+static FORCE_INLINE void suit_combined_from_entry(suit_entry_t entry, suit_combined_t *combined) {
+    for (int p = 0; p < 2; ++p) {
+        for (int m = 0; m < 5; ++m) {
+            combined->best[p][m] = SUIT_ENTRY_FIELD(entry, p, m) - 1;
+        }
+    }
+}
+
+// 合并两组牌的结果，搭子数截断为4不影响合并的先后顺序
+static void suit_combined_merge(const suit_combined_t &a, const suit_combined_t &b, int max_pack, suit_combined_t *out) {
+    std::fill(&out->best[0][0], &out->best[0][0] + 10, -1);
+    for (int p1 = 0; p1 < 2; ++p1) {
+        for (int m1 = 0; m1 <= max_pack; ++m1) {
+            if (a.best[p1][m1] < 0) {
+                continue;
+            }
+            for (int p2 = 0; p1 + p2 < 2; ++p2) {
+                for (int m2 = 0; m1 + m2 <= max_pack; ++m2) {
+                    if (b.best[p2][m2] < 0) {
+                        continue;
+                    }
+                    int t = std::min(a.best[p1][m1] + b.best[p2][m2], 4);
+                    int &dst = out->best[p1 + p2][m1 + m2];
+                    dst = std::max(dst, t);
+                }
+            }
+        }
+    }
+}
+
+// 由合并后的结果计算上听数
+// 上听数=8-完成的面子数*2-有效的搭子数-有无雀头，其中有效的搭子数不超过缺少的面子数
+static int suit_combined_shanten(const suit_combined_t &combined, intptr_t fixed_cnt) {
+    const int max_pack = 4 - static_cast<int>(fixed_cnt);
+    int result = std::numeric_limits<int>::max();
+    for (int p = 0; p < 2; ++p) {
+        for (int m = 0; m <= max_pack; ++m) {
+            if (combined.best[p][m] >= 0) {
+                int pack_cnt = m + static_cast<int>(fixed_cnt);
+                result = std::min(result, 8 - pack_cnt * 2 - std::min(combined.best[p][m], 4 - pack_cnt) - p);
+            }
+        }
+    }
+    return result;
+}
+
+// 其他各门合并的结果为rest时，一门牌的拆解结果要使上听数小于result，各字段至少需要的值
+// need[p][m]为0表示这一字段无论多大都不够
+//
+// 设rest中的一种组合为(p1, m1, r)，这一门的字段为(p2, m2, f)，合并后面子数n=m1+m2+fixed_cnt，有无雀头p=p1+p2，
+// 搭子数为min(r+f-1, 4)，上听数为8-2n-min(r+f-1, 4-n)-p。要使其小于result：
+// 需要n>=5-p-result，此时f>=10-result-2n-p-r，即f>=base-2*m2-p2，其中base=10-result-2*fixed_cnt-2*m1-p1-r只与rest有关
+static void suit_combined_need(const suit_combined_t &rest, intptr_t fixed_cnt, int result, int (&need)[2][5]) {
+    const int max_pack = 4 - static_cast<int>(fixed_cnt);
+    const int fixed = static_cast<int>(fixed_cnt);
+    for (int p2 = 0; p2 < 2; ++p2) {
+        for (int m2 = 0; m2 < 5; ++m2) {
+            int min_base = std::numeric_limits<int>::max();
+            for (int p1 = 0; p1 + p2 < 2; ++p1) {
+                const int lo = std::max(5 - result - p1 - p2 - m2 - fixed, 0);
+                for (int m1 = lo; m1 + m2 <= max_pack; ++m1) {
+                    const int r = rest.best[p1][m1];
+                    if (r >= 0) {
+                        min_base = std::min(min_base, 10 - result - 2 * fixed - 2 * m1 - p1 - r);
+                    }
+                }
+            }
+            need[p2][m2] = min_base != std::numeric_limits<int>::max() ? std::max(min_base - 2 * m2 - p2, 1) : 0;
+        }
+    }
+}
+
+// 合并各门牌的拆解结果，计算上听数
+static int basic_form_shanten_from_entries(const suit_entry_t (&entries)[4], intptr_t fixed_cnt) {
+    const int max_pack = 4 - static_cast<int>(fixed_cnt);
+    suit_combined_t combined, single, temp;
+    suit_combined_from_entry(entries[0], &combined);
+    for (int s = 1; s < 4; ++s) {
+        suit_combined_from_entry(entries[s], &single);
+        suit_combined_merge(combined, single, max_pack, &temp);
+        combined = temp;
+    }
+    return suit_combined_shanten(combined, fixed_cnt);
+}
+
+// 从头开始递归计算基本和型上听数
+static int basic_form_shanten_recursively(tile_table_t &cnt_table, intptr_t fixed_cnt) {
     work_path_t work_path;
     work_state_t work_state;
-    work_state.count = 0;
-    int result = basic_form_shanten_recursively(cnt_table, false, static_cast<uint16_t>(fixed_cnt), 0,
+    return basic_form_shanten_recursively(cnt_table, false, static_cast<uint16_t>(fixed_cnt), 0,
         fixed_cnt, &work_path, &work_state);
+}
 
-    if (useful_table == nullptr) {
-        return result;
-    }
-
-    // 穷举所有的牌，获取能减少上听数的牌
+// 根据各门牌的拆解结果获取有效牌，每张牌只影响它所在的那一门
+static void basic_form_useful_from_entries(const tile_table_t &cnt_table, const uint32_t (&keys)[4], const suit_entry_t (&entries)[4],
+    intptr_t fixed_cnt, int result, useful_table_t *useful_table) {
+    const basic_form_lookup_t *lookup = get_basic_form_lookup();
+    const int max_pack = 4 - static_cast<int>(fixed_cnt);
+
+    // 穷举所有的牌，先取出摸到各张牌之后那一门的拆解结果
+    // 这些读取互不依赖，集中在一起可以同时等待缓存缺失
+    tile_t candidate_tiles[34];
+    suit_entry_t candidate_entries[34];
+    int candidate_cnt = 0;
+    unsigned candidate_suits = 0;
     for (int i = 0; i < 34; ++i) {
         tile_t t = all_tiles[i];
         if (cnt_table[t] == 4 && result > 0) {
@@ -404,19 +912,116 @@ static int basic_form_shanten_from_table(tile_table_t &cnt_table, intptr_t fixed
             }
         }
 
-        ++cnt_table[t];
-        work_state.count = 0;
-        int temp = basic_form_shanten_recursively(cnt_table, false, static_cast<uint16_t>(fixed_cnt), 0,
-            fixed_cnt, &work_path, &work_state);
-        if (temp < result) {
-            (*useful_table)[t] = true;  // 标记为有效牌
+        if (cnt_table[t] < 4) {
+            const int s = tile_get_suit(t) - 1;
+            const uint32_t key = keys[s] + pow5_table[tile_get_rank(t) - 1];
+            candidate_tiles[candidate_cnt] = t;
+            candidate_entries[candidate_cnt] = s < 3 ? lookup->numbered[key] : lookup->honors[key];
+            ++candidate_cnt;
+            candidate_suits |= 1U << s;
+        }
+        else {  // 第5张牌超出了查找表的范围
+            tile_table_t temp_table;
+            memcpy(&temp_table, &cnt_table, sizeof(temp_table));
+            ++temp_table[t];
+            if (basic_form_shanten_recursively(temp_table, fixed_cnt) < result) {
+                (*useful_table)[t] = true;
+            }
+        }
+    }
+
+    // 其他三门合并的结果对同一门的牌都一样，由前缀与后缀各合并一次得到
+    // prefix[s]为第0~s门合并的结果，suffix[s]为第s~3门合并的结果
+    suit_combined_t single[4], prefix[3], suffix[4], rest;
+    for (int s = 0; s < 4; ++s) {
+        suit_combined_from_entry(entries[s], &single[s]);
+    }
+    prefix[0] = single[0];
+    suit_combined_merge(prefix[0], single[1], max_pack, &prefix[1]);
+    suit_combined_merge(prefix[1], single[2], max_pack, &prefix[2]);
+    suffix[3] = single[3];
+    suit_combined_merge(single[2], suffix[3], max_pack, &suffix[2]);
+    suit_combined_merge(single[1], suffix[2], max_pack, &suffix[1]);
+
+    // 摸到的牌要使上听数减少，它所在那一门的拆解结果各字段至少需要的值
+    int need[4][2][5];
+    for (int s = 0; s < 4; ++s) {
+        if ((candidate_suits & (1U << s)) == 0) {
+            continue;
+        }
+        if (s == 0) {
+            rest = suffix[1];
+        }
+        else if (s == 3) {
+            rest = prefix[2];
         }
-        --cnt_table[t];
+        else {
+            suit_combined_merge(prefix[s - 1], suffix[s + 1], max_pack, &rest);
+        }
+        suit_combined_need(rest, fixed_cnt, result, need[s]);
+    }
+
+    // 获取能减少上听数的牌，只需逐个字段比较
+    for (int i = 0; i < candidate_cnt; ++i) {
+        const tile_t t = candidate_tiles[i];
+        const int (&suit_need)[2][5] = need[tile_get_suit(t) - 1];
+        for (int k = 0; k < 10; ++k) {
+            const int n = suit_need[k / 5][k % 5];
+            if (n != 0 && SUIT_ENTRY_FIELD(candidate_entries[i], k / 5, k % 5) >= n) {
+                (*useful_table)[t] = true;  // 标记为有效牌
+                break;
+            }
+        }
+    }
+}
+
+// 查表法计算基本和型上听数
+static int basic_form_shanten_by_lookup(tile_table_t &cnt_table, intptr_t fixed_cnt, useful_table_t *useful_table) {
+    uint32_t keys[4];
+    if (!get_suit_keys(cnt_table, keys)) {  // 超出查找表的范围，改用递归
+        return useful_table != nullptr ? basic_form_shanten_with_useful(cnt_table, fixed_cnt, useful_table)
+            : basic_form_shanten_recursively(cnt_table, fixed_cnt);
     }
 
+    const basic_form_lookup_t *lookup = get_basic_form_lookup();
+    suit_entry_t entries[4] = {
+        lookup->numbered[keys[0]], lookup->numbered[keys[1]], lookup->numbered[keys[2]], lookup->honors[keys[3]]
+    };
+    int result = basic_form_shanten_from_entries(entries, fixed_cnt);
+
+    if (useful_table != nullptr) {
+        basic_form_useful_from_entries(cnt_table, keys, entries, fixed_cnt, result, useful_table);
+    }
     return result;
 }
 
+// 基本和型上听数的计算方式
+// 两种方式结果一致，其他线程读到旧值也不影响结果，所以只需保证读写本身无竞争
+static std::atomic<int> s_basic_form_engine(BASIC_FORM_DEFAULT_ENGINE);
+
+void set_basic_form_engine(int engine) {
+    s_basic_form_engine.store(engine, std::memory_order_relaxed);
+}
+
+int get_basic_form_engine() {
+    return s_basic_form_engine.load(std::memory_order_relaxed);
+}
+
+// 以表格为参数计算基本和型上听数
+static int basic_form_shanten_from_table(tile_table_t &cnt_table, intptr_t fixed_cnt, useful_table_t *useful_table) {
+    if (get_basic_form_engine() == BASIC_FORM_ENGINE_TABLE) {
+        return basic_form_shanten_by_lookup(cnt_table, fixed_cnt, useful_table);
+    }
+
+    // 只计算上听数
+    if (useful_table == nullptr) {
+        return basic_form_shanten_recursively(cnt_table, fixed_cnt);
+    }
+
+    // 计算上听数的同时获取有效牌
+    return basic_form_shanten_with_useful(cnt_table, fixed_cnt, useful_table);
+}
+
 // 基本和型上听数
 int basic_form_shanten(const tile_t *standing_tiles, intptr_t standing_cnt, useful_table_t *useful_table) {
     if (standing_tiles == nullptr || (standing_cnt != 13
@@ -434,6 +1039,39 @@ int basic_form_shanten(const tile_t *standing_tiles, intptr_t standing_cnt, usef
     return basic_form_shanten_from_table(cnt_table, (13 - standing_cnt) / 3, useful_table);
 }
 
+// 基本和型上听数（紧凑牌表）
+int basic_form_shanten_counts(const tile_counts_t &counts, useful_table_t *useful_table) {
+    const int standing_cnt = sum_tile_counts(counts);
+    if (standing_cnt != 13 && standing_cnt != 10 && standing_cnt != 7 && standing_cnt != 4 && standing_cnt != 1) {
+        return std::numeric_limits<int>::max();
+    }
+    const intptr_t fixed_cnt = (13 - standing_cnt) / 3;
+
+    if (useful_table != nullptr) {
+        memset(*useful_table, 0, sizeof(*useful_table));
+    }
+
+    // 查表法直接从紧凑牌表计算各门牌的下标
+    uint32_t keys[4];
+    if (get_basic_form_engine() == BASIC_FORM_ENGINE_TABLE && get_suit_keys(counts, keys)) {
+        const basic_form_lookup_t *lookup = get_basic_form_lookup();
+        suit_entry_t entries[4] = {
+            lookup->numbered[keys[0]], lookup->numbered[keys[1]], lookup->numbered[keys[2]], lookup->honors[keys[3]]
+        };
+        int result = basic_form_shanten_from_entries(entries, fixed_cnt);
+        if (useful_table != nullptr) {
+            tile_table_t cnt_table;
+            tile_counts_to_table(counts, &cnt_table);
+            basic_form_useful_from_entries(cnt_table, keys, entries, fixed_cnt, result, useful_table);
+        }
+        return result;
+    }
+
+    tile_table_t cnt_table;
+    tile_counts_to_table(counts, &cnt_table);
+    return basic_form_shanten_from_table(cnt_table, fixed_cnt, useful_table);
+}
+
 // 基本和型判断1张是否听牌
 static bool is_basic_form_wait_1(tile_table_t &cnt_table, useful_table_t *waiting_table) {
     for (int i = 0; i < 34; ++i) {
@@ -662,15 +1300,143 @@ static bool is_basic_form_win_recursively(tile_table_t &cnt_table, intptr_t left
     return false;
 }
 
+// 根据各门牌的下标判断基本和型是否和牌
+// 各门牌之间互不影响，每门数牌都必须能拆成面子或者面子加雀头，字牌只能是刻子或雀头，并且整手牌恰好有一组雀头
+static bool is_basic_form_win_by_keys(const uint32_t (&keys)[4]) {
+    int pair_cnt = 0;
+    for (int s = 0; s < 3; ++s) {
+        if (std::binary_search(std::begin(win_table_melds), std::end(win_table_melds), keys[s])) {
+            continue;
+        }
+        if (std::binary_search(std::begin(win_table_melds_and_pair), std::end(win_table_melds_and_pair), keys[s])) {
+            ++pair_cnt;
+            continue;
+        }
+        return false;
+    }
+
+    // 字牌的下标中，每一位是一种字牌的张数
+    for (uint32_t key = keys[3]; key != 0; key /= 5) {
+        uint32_t n = key % 5;
+        if (n == 2) {
+            ++pair_cnt;
+        }
+        else if (n != 0 && n != 3) {
+            return false;
+        }
+    }
+    return pair_cnt == 1;
+}
+
 // 基本和型是否和牌
 bool is_basic_form_win(const tile_t *standing_tiles, intptr_t standing_cnt, tile_t test_tile) {
     // 对立牌的种类进行打表
     tile_table_t cnt_table;
     map_tiles(standing_tiles, standing_cnt, &cnt_table);
     ++cnt_table[test_tile];  // 添加测试的牌
+
+    // 查表，超出查找表的范围时改用递归
+    uint32_t keys[4];
+    if (standing_cnt < 14 && get_suit_keys(cnt_table, keys)) {
+        return is_basic_form_win_by_keys(keys);
+    }
     return is_basic_form_win_recursively(cnt_table, standing_cnt + 1);
 }
 
+// 基本和型是否和牌（紧凑牌表）
+bool is_basic_form_win_counts(const tile_counts_t &counts) {
+    const int total = sum_tile_counts(counts);
+    uint32_t keys[4];
+    if (total <= 14 && get_suit_keys(counts, keys)) {
+        return is_basic_form_win_by_keys(keys);
+    }
+
+    tile_table_t cnt_table;
+    tile_counts_to_table(counts, &cnt_table);
+    return is_basic_form_win_recursively(cnt_table, total);
+}
+
+//-------------------------------- 增量计算器 --------------------------------
+
+basic_form_analyzer_t::basic_form_analyzer_t() {
+    reset(nullptr, 0);
+}
+
+// 重新计算一门牌的拆解结果及上听数
+void basic_form_analyzer_t::update_suit(int suit_idx) {
+    const basic_form_lookup_t *lookup = get_basic_form_lookup();
+    _entries[suit_idx] = suit_idx < 3 ? lookup->numbered[_keys[suit_idx]] : lookup->honors[_keys[suit_idx]];
+    _shanten = basic_form_shanten_from_entries(_entries, 4 - _standing_cnt / 3);
+}
+
+// 重新设置立牌
+bool basic_form_analyzer_t::reset(const tile_t *standing_tiles, intptr_t standing_cnt) {
+    memset(_cnt_table, 0, sizeof(_cnt_table));
+    memset(_keys, 0, sizeof(_keys));
+    _standing_cnt = 0;
+
+    bool ret = (standing_cnt <= 14);
+    for (intptr_t i = 0; ret && i < standing_cnt; ++i) {
+        tile_t t = standing_tiles[i];
+        if ((!is_numbered_suit(t) && !is_honor(t)) || _cnt_table[t] == 4) {
+            ret = false;
+            break;
+        }
+        ++_cnt_table[t];
+        _keys[tile_get_suit(t) - 1] += pow5_table[tile_get_rank(t) - 1];
+        ++_standing_cnt;
+    }
+
+    if (!ret) {  // 失败时清空
+        memset(_cnt_table, 0, sizeof(_cnt_table));
+        memset(_keys, 0, sizeof(_keys));
+        _standing_cnt = 0;
+    }
+
+    const basic_form_lookup_t *lookup = get_basic_form_lookup();
+    for (int s = 0; s < 4; ++s) {
+        _entries[s] = s < 3 ? lookup->numbered[_keys[s]] : lookup->honors[_keys[s]];
+    }
+    _shanten = basic_form_shanten_from_entries(_entries, 4 - _standing_cnt / 3);
+    return ret;
+}
+
+// 增加一张牌，只重新计算这张牌所在的那一门
+bool basic_form_analyzer_t::add_tile(tile_t tile) {
+    if ((!is_numbered_suit(tile) && !is_honor(tile)) || _cnt_table[tile] == 4 || _standing_cnt == 14) {
+        return false;
+    }
+
+    const int s = tile_get_suit(tile) - 1;
+    ++_cnt_table[tile];
+    _keys[s] += pow5_table[tile_get_rank(tile) - 1];
+    ++_standing_cnt;
+    update_suit(s);
+    return true;
+}
+
+// 减少一张牌，只重新计算这张牌所在的那一门
+bool basic_form_analyzer_t::remove_tile(tile_t tile) {
+    if ((!is_numbered_suit(tile) && !is_honor(tile)) || _cnt_table[tile] == 0) {
+        return false;
+    }
+
+    const int s = tile_get_suit(tile) - 1;
+    --_cnt_table[tile];
+    _keys[s] -= pow5_table[tile_get_rank(tile) - 1];
+    --_standing_cnt;
+    update_suit(s);
+    return true;
+}
+
+// 有效牌
+int basic_form_analyzer_t::useful(useful_table_t *useful_table) const {
+    memset(*useful_table, 0, sizeof(*useful_table));
+    basic_form_useful_from_entries(_cnt_table, _keys, _entries,
+        4 - _standing_cnt / 3, _shanten, useful_table);
+    return _shanten;
+}
+
 //-------------------------------- 七对 --------------------------------
 
 // 七对上听数
@@ -916,9 +1682,8 @@ int knitted_straight_shanten(const tile_t *standing_tiles, intptr_t standing_cnt
 
     // 需要获取有效牌时，计算上听数的同时就获取有效牌了
     if (useful_table != nullptr) {
-        memset(*useful_table, 0, sizeof(*useful_table));
-
         useful_table_t temp_table;
+        tile_set_t useful_set = 0;
 
         // 6种组合龙分别计算
         for (int i = 0; i < 6; ++i) {
@@ -926,13 +1691,13 @@ int knitted_straight_shanten(const tile_t *standing_tiles, intptr_t standing_cnt
             int st = basic_form_shanten_specified(cnt_table, standard_knitted_straight[i], 9, fixed_cnt, &temp_table);
             if (st < ret) {  // 上听数小的，直接覆盖数据
                 ret = st;
-                memcpy(*useful_table, temp_table, sizeof(*useful_table));  // 直接覆盖原来的有效牌数据
+                useful_set = table_to_tile_set(temp_table);  // 直接覆盖原来的有效牌数据
             }
             else if (st == ret) {  // 两种不同组合龙上听数如果相等的话，直接合并有效牌
-                std::transform(std::begin(*useful_table), std::end(*useful_table), std::begin(temp_table),
-                    std::begin(*useful_table), [](bool u, bool t) { return u || t; });
+                useful_set |= table_to_tile_set(temp_table);
             }
         }
+        tile_set_to_table(useful_set, useful_table);
     }
     else {
         // 6种组合龙分别计算
@@ -1033,22 +1798,21 @@ int honors_and_knitted_tiles_shanten(const tile_t *standing_tiles, intptr_t stan
 
     // 需要获取有效牌时，计算上听数的同时就获取有效牌了
     if (useful_table != nullptr) {
-        memset(*useful_table, 0, sizeof(*useful_table));
-
         useful_table_t temp_table;
+        tile_set_t useful_set = 0;
 
         // 6种组合龙分别计算
         for (int i = 0; i < 6; ++i) {
             int st = honors_and_knitted_tiles_shanten_1(standing_tiles, standing_cnt, i, &temp_table);
             if (st < ret) {  // 上听数小的，直接覆盖数据
                 ret = st;
-                memcpy(*useful_table, temp_table, sizeof(*useful_table));  // 直接覆盖原来的有效牌数据
+                useful_set = table_to_tile_set(temp_table);  // 直接覆盖原来的有效牌数据
             }
             else if (st == ret) {  // 两种不同组合龙上听数如果相等的话，直接合并有效牌
-                std::transform(std::begin(*useful_table), std::end(*useful_table), std::begin(temp_table),
-                    std::begin(*useful_table), [](bool u, bool t) { return u || t; });
+                useful_set |= table_to_tile_set(temp_table);
             }
         }
+        tile_set_to_table(useful_set, useful_table);
     }
     else {
         // 6种组合龙分别计算
@@ -1132,6 +1896,75 @@ bool is_waiting(const hand_tiles_t &hand_tiles, useful_table_t *useful_table) {
     return (spcial_waiting || basic_waiting);
 }
 
+//-------------------------------- 牌集合版本 --------------------------------
+
+typedef int (*shanten_func_t)(const tile_t *standing_tiles, intptr_t standing_cnt, useful_table_t *useful_table);
+
+// 计算上听数，并将有效牌标记表转换成集合
+static int shanten_to_bits(shanten_func_t shanten_func, const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set) {
+    if (useful_set == nullptr) {
+        return shanten_func(standing_tiles, standing_cnt, nullptr);
+    }
+
+    useful_table_t useful_table;
+    int ret = shanten_func(standing_tiles, standing_cnt, &useful_table);
+    *useful_set = ret != std::numeric_limits<int>::max() ? table_to_tile_set(useful_table) : 0;
+    return ret;
+}
+
+int basic_form_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set) {
+    return shanten_to_bits(&basic_form_shanten, standing_tiles, standing_cnt, useful_set);
+}
+
+int seven_pairs_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set) {
+    return shanten_to_bits(&seven_pairs_shanten, standing_tiles, standing_cnt, useful_set);
+}
+
+int thirteen_orphans_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set) {
+    return shanten_to_bits(&thirteen_orphans_shanten, standing_tiles, standing_cnt, useful_set);
+}
+
+int knitted_straight_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set) {
+    return shanten_to_bits(&knitted_straight_shanten, standing_tiles, standing_cnt, useful_set);
+}
+
+int honors_and_knitted_tiles_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set) {
+    return shanten_to_bits(&honors_and_knitted_tiles_shanten, standing_tiles, standing_cnt, useful_set);
+}
+
+bool is_waiting_bits(const hand_tiles_t &hand_tiles, tile_set_t *waiting_set) {
+    bool waiting = false;
+    tile_set_t set = 0;
+    useful_table_t temp_table;
+
+    // 特殊和型只取第一个听牌的，与is_waiting一致
+    if (hand_tiles.tile_count == 13) {
+        if (is_thirteen_orphans_wait(hand_tiles.standing_tiles, 13, &temp_table)
+            || is_honors_and_knitted_tiles_wait(hand_tiles.standing_tiles, 13, &temp_table)
+            || is_seven_pairs_wait(hand_tiles.standing_tiles, 13, &temp_table)
+            || is_knitted_straight_wait(hand_tiles.standing_tiles, 13, &temp_table)) {
+            waiting = true;
+            set = table_to_tile_set(temp_table);
+        }
+    }
+    else if (hand_tiles.tile_count == 10) {
+        if (is_knitted_straight_wait(hand_tiles.standing_tiles, 10, &temp_table)) {
+            waiting = true;
+            set = table_to_tile_set(temp_table);
+        }
+    }
+
+    if (is_basic_form_wait(hand_tiles.standing_tiles, hand_tiles.tile_count, &temp_table)) {
+        waiting = true;
+        set |= table_to_tile_set(temp_table);
+    }
+
+    if (waiting_set != nullptr) {
+        *waiting_set = set;
+    }
+    return waiting;
+}
+
 //-------------------------------- 枚举打牌 --------------------------------
 
 // 枚举打哪张牌1次
@@ -1139,18 +1972,21 @@ static bool enum_discard_tile_1(const hand_tiles_t *hand_tiles, tile_t discard_t
     void *context, enum_callback_t enum_callback) {
     enum_result_t result;
     result.discard_tile = discard_tile;
-    result.form_flag = FORM_FLAG_BASIC_FORM;
-    result.shanten = basic_form_shanten(hand_tiles->standing_tiles, hand_tiles->tile_count, &result.useful_table);
-    if (result.shanten == 0 && result.useful_table[discard_tile]) {  // 0上听，并且打出的牌是有效牌，则修正为和了
-        result.shanten = -1;
-    }
-    if (!enum_callback(context, &result)) {
-        return false;
+
+    if (form_flag & FORM_FLAG_BASIC_FORM) {
+        result.form_flag = FORM_FLAG_BASIC_FORM;
+        result.shanten = basic_form_shanten(hand_tiles->standing_tiles, hand_tiles->tile_count, &result.useful_table);
+        if (result.shanten == 0 && result.useful_table[discard_tile]) {  // 0上听，并且打出的牌是有效牌，则修正为和了
+            result.shanten = -1;
+        }
+        if (!enum_callback(context, &result)) {
+            return false;
+        }
     }
 
     // 立牌有13张时，才需要计算特殊和型
     if (hand_tiles->tile_count == 13) {
-        if (form_flag | FORM_FLAG_SEVEN_PAIRS) {
+        if (form_flag & FORM_FLAG_SEVEN_PAIRS) {
             result.form_flag = FORM_FLAG_SEVEN_PAIRS;
             result.shanten = seven_pairs_shanten(hand_tiles->standing_tiles, hand_tiles->tile_count, &result.useful_table);
             if (result.shanten == 0 && result.useful_table[discard_tile]) {  // 0上听，并且打出的牌是有效牌，则修正为和了
@@ -1161,7 +1997,7 @@ static bool enum_discard_tile_1(const hand_tiles_t *hand_tiles, tile_t discard_t
             }
         }
 
-        if (form_flag | FORM_FLAG_THIRTEEN_ORPHANS) {
+        if (form_flag & FORM_FLAG_THIRTEEN_ORPHANS) {
             result.form_flag = FORM_FLAG_THIRTEEN_ORPHANS;
             result.shanten = thirteen_orphans_shanten(hand_tiles->standing_tiles, hand_tiles->tile_count, &result.useful_table);
             if (result.shanten == 0 && result.useful_table[discard_tile]) {  // 0上听，并且打出的牌是有效牌，则修正为和了
@@ -1172,7 +2008,7 @@ static bool enum_discard_tile_1(const hand_tiles_t *hand_tiles, tile_t discard_t
             }
         }
 
-        if (form_flag | FORM_FLAG_HONORS_AND_KNITTED_TILES) {
+        if (form_flag & FORM_FLAG_HONORS_AND_KNITTED_TILES) {
             result.form_flag = FORM_FLAG_HONORS_AND_KNITTED_TILES;
             result.shanten = honors_and_knitted_tiles_shanten(hand_tiles->standing_tiles, hand_tiles->tile_count, &result.useful_table);
             if (result.shanten == 0 && result.useful_table[discard_tile]) {  // 0上听，并且打出的牌是有效牌，则修正为和了
@@ -1186,7 +2022,7 @@ static bool enum_discard_tile_1(const hand_tiles_t *hand_tiles, tile_t discard_t
 
     // 立牌有13张或者10张时，才需要计算组合龙
     if (hand_tiles->tile_count == 13 || hand_tiles->tile_count == 10) {
-        if (form_flag | FORM_FLAG_KNITTED_STRAIGHT) {
+        if (form_flag & FORM_FLAG_KNITTED_STRAIGHT) {
             result.form_flag = FORM_FLAG_KNITTED_STRAIGHT;
             result.shanten = knitted_straight_shanten(hand_tiles->standing_tiles, hand_tiles->tile_count, &result.useful_table);
             if (result.shanten == 0 && result.useful_table[discard_tile]) {  // 0上听，并且打出的牌是有效牌，则修正为和了
@@ -1243,4 +2079,172 @@ void enum_discard_tile(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint
     }
 }
 
+
+namespace {
+    // 一种打法的计算任务
+    struct discard_task_t {
+        hand_tiles_t hand_tiles;  // 打牌之后的手牌
+        tile_t discard_tile;  // 打这张牌
+        enum_result_t results[5];  // 计算结果，每种和型一个
+        int result_cnt;  // 计算结果数
+        bool done;  // 是否计算完成
+        std::atomic<bool> *cancelled;  // 是否已取消
+    };
+
+    // 多线程计算的共享状态
+    struct discard_task_queue_t {
+        std::vector<discard_task_t> tasks;
+        uint8_t form_flag;
+        std::atomic<size_t> next_idx;  // 下一个未领取的任务
+        std::atomic<bool> cancelled;
+        std::mutex mutex;
+        std::condition_variable done_cond;
+    };
+}
+
+// 收集计算结果的回调
+static bool collect_enum_result(void *context, const enum_result_t *result) {
+    discard_task_t *task = static_cast<discard_task_t *>(context);
+    if (task->cancelled->load(std::memory_order_relaxed)) {
+        return false;
+    }
+    task->results[task->result_cnt++] = *result;
+    return true;
+}
+
+// 领取并计算下一个任务，没有任务可领取时返回false
+static bool run_next_discard_task(discard_task_queue_t *queue) {
+    if (queue->cancelled.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    size_t idx = queue->next_idx.fetch_add(1);
+    if (idx >= queue->tasks.size()) {
+        return false;
+    }
+
+    discard_task_t &task = queue->tasks[idx];
+    enum_discard_tile_1(&task.hand_tiles, task.discard_tile, queue->form_flag, &task, &collect_enum_result);
+
+    {
+        std::lock_guard<std::mutex> lock(queue->mutex);
+        task.done = true;
+    }
+    queue->done_cond.notify_all();
+    return true;
+}
+
+// 工作线程反复领取任务来计算
+static void run_discard_tasks(void *context) {
+    discard_task_queue_t *queue = static_cast<discard_task_queue_t *>(context);
+    while (run_next_discard_task(queue)) {
+        continue;
+    }
+}
+
+// 多线程枚举打哪张牌
+void enum_discard_tile_parallel(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_callback_t enum_callback, int thread_cnt) {
+    discard_task_queue_t queue;
+    queue.form_flag = form_flag;
+    queue.next_idx = 0;
+    queue.cancelled = false;
+
+    // 按enum_discard_tile的顺序列出所有打法，先是摸切的
+    queue.tasks.reserve(35);
+    discard_task_t task;
+    memcpy(&task.hand_tiles, hand_tiles, sizeof(task.hand_tiles));
+    task.discard_tile = serving_tile;
+    task.result_cnt = 0;
+    task.done = false;
+    task.cancelled = &queue.cancelled;
+    queue.tasks.push_back(task);
+
+    if (serving_tile != 0) {
+        tile_table_t cnt_table;
+        map_tiles(hand_tiles->standing_tiles, hand_tiles->tile_count, &cnt_table);
+
+        // 依次尝试打手中的立牌
+        for (int i = 0; i < 34; ++i) {
+            tile_t t = all_tiles[i];
+            if (cnt_table[t] && t != serving_tile && cnt_table[serving_tile] < 4) {
+                --cnt_table[t];  // 打这张牌
+                ++cnt_table[serving_tile];  // 上这张牌
+                table_to_tiles(cnt_table, task.hand_tiles.standing_tiles, task.hand_tiles.tile_count);
+                task.discard_tile = t;
+                queue.tasks.push_back(task);
+                --cnt_table[serving_tile];
+                ++cnt_table[t];
+            }
+        }
+    }
+
+    // 调用者的线程也参与计算，所以只需另用thread_cnt-1个工作线程
+    size_t worker_cnt = std::min(static_cast<size_t>(parallel_thread_count(thread_cnt) - 1), queue.tasks.size() - 1);
+    parallel_job_t job(&run_discard_tasks, &queue);
+    job.start(worker_cnt);
+
+    // 按顺序回调，等待时顺便领取任务来计算
+    for (size_t i = 0, cnt = queue.tasks.size(); i < cnt; ++i) {
+        const discard_task_t &current = queue.tasks[i];
+        for (;;) {
+            {
+                std::lock_guard<std::mutex> lock(queue.mutex);
+                if (current.done) {
+                    break;
+                }
+            }
+            if (!run_next_discard_task(&queue)) {
+                std::unique_lock<std::mutex> lock(queue.mutex);
+                queue.done_cond.wait(lock, [&current]() { return current.done; });
+                break;
+            }
+        }
+
+        for (int k = 0; k < current.result_cnt; ++k) {
+            if (!enum_callback(context, &current.results[k])) {
+                queue.cancelled = true;  // 取消尚未开始的计算
+                break;
+            }
+        }
+        if (queue.cancelled) {
+            break;
+        }
+    }
+
+    job.wait();
+}
+
+namespace {
+    // 将标记表版本的计算结果转交给牌集合版本的回调
+    struct enum_bits_adapter_t {
+        void *context;
+        enum_bits_callback_t enum_callback;
+    };
+}
+
+// 转换计算结果的回调
+static bool enum_result_to_bits(void *context, const enum_result_t *result) {
+    const enum_bits_adapter_t *adapter = static_cast<const enum_bits_adapter_t *>(context);
+    enum_result_bits_t result_bits;
+    result_bits.discard_tile = result->discard_tile;
+    result_bits.form_flag = result->form_flag;
+    result_bits.shanten = result->shanten;
+    result_bits.useful_set = result->shanten != std::numeric_limits<int>::max() ? table_to_tile_set(result->useful_table) : 0;
+    return adapter->enum_callback(adapter->context, &result_bits);
+}
+
+// 枚举打哪张牌（牌集合版本）
+void enum_discard_tile_bits(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_bits_callback_t enum_callback) {
+    enum_bits_adapter_t adapter = { context, enum_callback };
+    enum_discard_tile(hand_tiles, serving_tile, form_flag, &adapter, &enum_result_to_bits);
+}
+
+// 多线程枚举打哪张牌（牌集合版本）
+void enum_discard_tile_parallel_bits(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_bits_callback_t enum_callback, int thread_cnt) {
+    enum_bits_adapter_t adapter = { context, enum_callback };
+    enum_discard_tile_parallel(hand_tiles, serving_tile, form_flag, &adapter, &enum_result_to_bits, thread_cnt);
+}
+
 }
@@ -24,6 +24,8 @@
 #define __MAHJONG_ALGORITHM__SHANTEN_H__
 
 #include "tile.h"
+#include "tile_counts.h"
+#include "tile_set.h"
 
 namespace mahjong {
 
@@ -56,6 +58,15 @@ void map_tiles(const tile_t *tiles, intptr_t cnt, tile_table_t *cnt_table);
  */
 bool map_hand_tiles(const hand_tiles_t *hand_tiles, tile_table_t *cnt_table);
 
+/**
+ * @brief 将手牌打表到紧凑牌表
+ *
+ * @param [in] hand_tiles 手牌
+ * @param [out] counts 紧凑牌表
+ * @return bool 手牌结构是否正确。即是否符合：副露组数*3+立牌数=13
+ */
+bool map_hand_tiles_to_counts(const hand_tiles_t *hand_tiles, tile_counts_t *counts);
+
 /**
  * @brief 将表转换成牌
  *
@@ -81,6 +92,41 @@ typedef bool useful_table_t[TILE_TABLE_SIZE];
  * @{
  */
 
+/**
+ * @name basic form engines
+ * @{
+ *  基本和型上听数的计算方式
+ */
+#define BASIC_FORM_ENGINE_RECURSIVE 0  ///< 递归搜索
+#define BASIC_FORM_ENGINE_TABLE     1  ///< 查表，首次使用时生成约8MB的查找表
+/**
+ * @}
+ */
+
+#ifndef BASIC_FORM_DEFAULT_ENGINE
+/**
+ * @brief 默认的计算方式，可在编译时指定
+ *  查表在只求上听数和同时求有效牌时都比递归快，但要在堆上占用约8MB内存，
+ *  且首次使用时需要生成查找表，内存紧张时可指定为BASIC_FORM_ENGINE_RECURSIVE
+ */
+#define BASIC_FORM_DEFAULT_ENGINE BASIC_FORM_ENGINE_TABLE
+#endif
+
+/**
+ * @brief 设置基本和型上听数的计算方式
+ *  两种方式计算结果完全一致，可在任意线程随时设置
+ *
+ * @param [in] engine 计算方式，见BASIC_FORM_ENGINE_*
+ */
+void set_basic_form_engine(int engine);
+
+/**
+ * @brief 获取基本和型上听数的计算方式
+ *
+ * @return int 计算方式，见BASIC_FORM_ENGINE_*
+ */
+int get_basic_form_engine();
+
 /**
  * @brief 基本和型上听数
  *
@@ -91,6 +137,16 @@ typedef bool useful_table_t[TILE_TABLE_SIZE];
  */
 int basic_form_shanten(const tile_t *standing_tiles, intptr_t standing_cnt, useful_table_t *useful_table);
 
+/**
+ * @brief 基本和型上听数（紧凑牌表）
+ *  使用查表法时直接从紧凑牌表计算下标，省去打表
+ *
+ * @param [in] counts 立牌的紧凑牌表，总张数须为13、10、7、4或1
+ * @param [out] useful_table 有效牌标记表（可为null）
+ * @return int 上听数
+ */
+int basic_form_shanten_counts(const tile_counts_t &counts, useful_table_t *useful_table);
+
 /**
  * @brief 基本和型是否听牌
  *
@@ -111,6 +167,88 @@ bool is_basic_form_wait(const tile_t *standing_tiles, intptr_t standing_cnt, use
  */
 bool is_basic_form_win(const tile_t *standing_tiles, intptr_t standing_cnt, tile_t test_tile);
 
+/**
+ * @brief 基本和型是否和牌（紧凑牌表）
+ *
+ * @param [in] counts 包含和牌张在内的紧凑牌表
+ * @return bool 是否和牌
+ */
+bool is_basic_form_win_counts(const tile_counts_t &counts);
+
+/**
+ * @brief 基本和型上听数的增量计算器
+ *  记录立牌及各门牌的拆解结果，增减一张牌时只重新计算这张牌所在的那一门，
+ *  适合连续试摸、试打的场合。使用查表法，首次使用时生成查找表
+ */
+class basic_form_analyzer_t {
+public:
+    basic_form_analyzer_t();
+
+    /**
+     * @brief 重新设置立牌
+     *  副露组数按立牌数推算：4-立牌数/3
+     *
+     * @param [in] standing_tiles 立牌
+     * @param [in] standing_cnt 立牌数（不超过14）
+     * @return bool 是否设置成功。立牌数超过14或者某种牌超过4张时失败，此时立牌被清空
+     */
+    bool reset(const tile_t *standing_tiles, intptr_t standing_cnt);
+
+    /**
+     * @brief 增加一张牌
+     *
+     * @param [in] tile 牌
+     * @return bool 是否成功。已有14张牌或者这种牌已有4张时失败
+     */
+    bool add_tile(tile_t tile);
+
+    /**
+     * @brief 减少一张牌
+     *
+     * @param [in] tile 牌
+     * @return bool 是否成功。没有这张牌时失败
+     */
+    bool remove_tile(tile_t tile);
+
+    /**
+     * @brief 立牌数
+     *
+     * @return intptr_t 立牌数
+     */
+    intptr_t tile_count() const { return _standing_cnt; }
+
+    /**
+     * @brief 牌的数量表
+     *
+     * @return const tile_table_t & 牌的数量表
+     */
+    const tile_table_t &cnt_table() const { return _cnt_table; }
+
+    /**
+     * @brief 上听数
+     *
+     * @return int 上听数
+     */
+    int shanten() const { return _shanten; }
+
+    /**
+     * @brief 有效牌
+     *
+     * @param [out] useful_table 有效牌标记表
+     * @return int 上听数
+     */
+    int useful(useful_table_t *useful_table) const;
+
+private:
+    void update_suit(int suit_idx);
+
+    tile_table_t _cnt_table;    ///< 牌的数量表
+    intptr_t _standing_cnt;     ///< 立牌数
+    uint32_t _keys[4];          ///< 各门牌在查找表中的下标
+    uint32_t _entries[4];       ///< 各门牌的拆解结果
+    int _shanten;               ///< 上听数
+};
+
 /**
  * end group
  * @}
@@ -285,6 +423,21 @@ bool is_honors_and_knitted_tiles_win(const tile_t *standing_tiles, intptr_t stan
  */
 bool is_waiting(const hand_tiles_t &hand_tiles, useful_table_t *useful_table);
 
+/**
+ * @name tile set variants
+ * @{
+ *  以下各函数与去掉_bits后缀的同名函数相同，只是有效牌（听牌）以牌的集合表示
+ */
+int basic_form_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set);
+int seven_pairs_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set);
+int thirteen_orphans_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set);
+int knitted_straight_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set);
+int honors_and_knitted_tiles_shanten_bits(const tile_t *standing_tiles, intptr_t standing_cnt, tile_set_t *useful_set);
+bool is_waiting_bits(const hand_tiles_t &hand_tiles, tile_set_t *waiting_set);
+/**
+ * @}
+ */
+
 /**
  * end group
  * @}
@@ -330,13 +483,61 @@ typedef bool (*enum_callback_t)(void *context, const enum_result_t *result);
  *
  * @param [in] hand_tiles 手牌结构
  * @param [in] serving_tile 上牌（可为0，此时仅计算手牌的信息）
- * @param [in] form_flag 计算哪些和型
+ * @param [in] form_flag 计算哪些和型，见FORM_FLAG_*，未指定的和型既不计算也不回调
  * @param [in] context 用户自定义参数，将原样从回调函数传回
  * @param [in] enum_callback 回调函数
  */
 void enum_discard_tile(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
     void *context, enum_callback_t enum_callback);
 
+/**
+ * @brief 多线程枚举打哪张牌
+ *  各种打法分给多个线程同时计算，回调的次数与顺序都和enum_discard_tile完全一致，
+ *  并且回调函数只在调用者的线程中执行，无需考虑线程安全。回调函数返回false时，尚未开始的计算将被取消
+ *
+ * @param [in] hand_tiles 手牌结构
+ * @param [in] serving_tile 上牌（可为0，此时仅计算手牌的信息）
+ * @param [in] form_flag 计算哪些和型，见FORM_FLAG_*，未指定的和型既不计算也不回调
+ * @param [in] context 用户自定义参数，将原样从回调函数传回
+ * @param [in] enum_callback 回调函数
+ * @param [in] thread_cnt 线程数（包括调用者的线程），不大于0时使用硬件支持的并发线程数
+ */
+void enum_discard_tile_parallel(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_callback_t enum_callback, int thread_cnt);
+
+/**
+ * @brief 枚举打哪张牌的计算结果信息（牌集合版本）
+ *  只占16字节，合并两个结果的有效牌只需一次按位或
+ */
+struct enum_result_bits_t {
+    tile_t discard_tile;                    ///< 打这张牌
+    uint8_t form_flag;                      ///< 和牌形式
+    int shanten;                            ///< 上听数
+    tile_set_t useful_set;                  ///< 有效牌集合
+};
+
+/**
+ * @brief 枚举打哪张牌的计算回调函数（牌集合版本）
+ *
+ * @param [in] context 从enum_discard_tile_bits传过来的context原样传回
+ * @param [in] result 计算结果
+ * @retval true 继续枚举
+ * @retval false 结束枚举
+ */
+typedef bool (*enum_bits_callback_t)(void *context, const enum_result_bits_t *result);
+
+/**
+ * @brief 枚举打哪张牌，同enum_discard_tile，计算结果以牌集合表示
+ */
+void enum_discard_tile_bits(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_bits_callback_t enum_callback);
+
+/**
+ * @brief 多线程枚举打哪张牌，同enum_discard_tile_parallel，计算结果以牌集合表示
+ */
+void enum_discard_tile_parallel_bits(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_bits_callback_t enum_callback, int thread_cnt);
+
 }
 
 /**
@@ -0,0 +1,349 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#include "shanten_cache.h"
+#include <string.h>
+#include <limits>
+#include <algorithm>
+#include <vector>
+#include "standard_tiles.h"
+#include "tile_counts.h"
+
+namespace mahjong {
+
+// 键的布局：0~46位立牌，47~52位上牌，53~57位和型，58~59位计算类型
+#define CACHE_KEY_SERVING_SHIFT 47
+#define CACHE_KEY_FORM_SHIFT 53
+#define CACHE_KEY_QUERY_SHIFT 58
+
+#define CACHE_QUERY_BASIC_FORM_SHANTEN 1
+#define CACHE_QUERY_IS_WAITING 2
+#define CACHE_QUERY_ENUM_DISCARD_TILE 3
+
+namespace {
+    // 所有的12种变换
+    static const tile_transform_t all_transforms[12] = {
+        { { 0, 1, 2 }, false }, { { 0, 2, 1 }, false }, { { 1, 0, 2 }, false },
+        { { 1, 2, 0 }, false }, { { 2, 0, 1 }, false }, { { 2, 1, 0 }, false },
+        { { 0, 1, 2 }, true }, { { 0, 2, 1 }, true }, { { 1, 0, 2 }, true },
+        { { 1, 2, 0 }, true }, { { 2, 0, 1 }, true }, { { 2, 1, 0 }, true }
+    };
+}
+
+// 一条缓存，牌都是规范编码对应的牌
+struct shanten_cache_t::result_t {
+    // 枚举打哪张牌的结果
+    struct enum_item_t {
+        tile_t discard_tile;
+        uint8_t form_flag;
+        int shanten;
+        tile_set_t useful_bits;  // 有效牌
+    };
+
+    int shanten;  // 上听数，或者是否听牌
+    tile_set_t useful_bits;  // 有效牌
+    std::vector<enum_item_t> enum_results;
+};
+
+// 是否为合法的牌
+static FORCE_INLINE bool is_tile_valid(tile_t tile) {
+    return is_numbered_suit(tile) || is_honor(tile);
+}
+
+// 变换一张牌
+tile_t transform_tile(const tile_transform_t &transform, tile_t tile) {
+    if (!is_numbered_suit(tile)) {
+        return tile;
+    }
+    suit_t suit = static_cast<suit_t>(transform.suit_map[tile_get_suit(tile) - 1] + 1);
+    rank_t rank = transform.reflect ? static_cast<rank_t>(10 - tile_get_rank(tile)) : tile_get_rank(tile);
+    return make_tile(suit, rank);
+}
+
+// 逆变换一张牌
+tile_t inverse_transform_tile(const tile_transform_t &transform, tile_t tile) {
+    if (!is_numbered_suit(tile)) {
+        return tile;
+    }
+    int s = 0;
+    while (transform.suit_map[s] != tile_get_suit(tile) - 1) {
+        ++s;
+    }
+    rank_t rank = transform.reflect ? static_cast<rank_t>(10 - tile_get_rank(tile)) : tile_get_rank(tile);
+    return make_tile(static_cast<suit_t>(s + 1), rank);
+}
+
+// 计算立牌的规范编码
+uint64_t canonical_hand_code(const tile_t *standing_tiles, intptr_t standing_cnt, tile_t serving_tile, tile_transform_t *transform) {
+    if (standing_tiles == nullptr || standing_cnt < 0 || standing_cnt > 13) {
+        return 0;
+    }
+    if (serving_tile != 0 && !is_tile_valid(serving_tile)) {
+        return 0;
+    }
+
+    tile_table_t cnt_table = { 0 };
+    for (intptr_t i = 0; i < standing_cnt; ++i) {
+        tile_t t = standing_tiles[i];
+        if (!is_tile_valid(t) || cnt_table[t] == 4) {
+            return 0;
+        }
+        ++cnt_table[t];
+    }
+
+    uint64_t ret = std::numeric_limits<uint64_t>::max();
+    for (int k = 0; k < 12; ++k) {
+        const tile_transform_t &tf = all_transforms[k];
+
+        // 变换后各种牌的张数
+        uint16_t cnts[34];
+        for (int i = 0; i < 34; ++i) {
+            tile_t t = all_tiles[i];
+            cnts[tile_counts_index(transform_tile(tf, t))] = cnt_table[t];
+        }
+
+        // 每种牌写入张数个0，再写入一个1
+        uint64_t code = 0;
+        int pos = 0;
+        for (int i = 0; i < 34; ++i) {
+            pos += cnts[i];
+            code |= UINT64_C(1) << pos;
+            ++pos;
+        }
+        if (serving_tile != 0) {
+            code |= static_cast<uint64_t>(tile_counts_index(transform_tile(tf, serving_tile)) + 1) << CACHE_KEY_SERVING_SHIFT;
+        }
+
+        if (code < ret) {
+            ret = code;
+            if (transform != nullptr) {
+                *transform = tf;
+            }
+        }
+    }
+    return ret;
+}
+
+// 位转成有效牌标记表，同时逆变换回实际的牌
+static void bits_to_useful_table(tile_set_t bits, const tile_transform_t &transform, useful_table_t *useful_table) {
+    memset(*useful_table, 0, sizeof(*useful_table));
+    for (; bits != 0; bits &= bits - 1) {
+        (*useful_table)[inverse_transform_tile(transform, tile_set_first(bits))] = true;
+    }
+}
+
+// 变换手牌的立牌
+static void transform_hand_tiles(const tile_transform_t &transform, const hand_tiles_t *hand_tiles, hand_tiles_t *dst) {
+    memcpy(dst, hand_tiles, sizeof(*dst));
+    for (intptr_t i = 0; i < hand_tiles->tile_count; ++i) {
+        dst->standing_tiles[i] = transform_tile(transform, hand_tiles->standing_tiles[i]);
+    }
+    std::sort(&dst->standing_tiles[0], &dst->standing_tiles[dst->tile_count]);
+}
+
+shanten_cache_t::shanten_cache_t(size_t capacity, size_t shard_cnt)
+    : _shard_cnt(std::max<size_t>(shard_cnt, 1)) {
+    _shard_capacity = (capacity + _shard_cnt - 1) / _shard_cnt;
+    _shards.reset(new shard_t[_shard_cnt]);
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        _shards[i].hit_cnt = 0;
+        _shards[i].miss_cnt = 0;
+    }
+}
+
+// 键所在的分片，规范编码的低位变化不均匀，先混合再取高位
+shanten_cache_t::shard_t &shanten_cache_t::shard_of(uint64_t key) {
+    return _shards[((key * UINT64_C(0x9E3779B97F4A7C15)) >> 32) % _shard_cnt];
+}
+
+// 查找缓存，命中时移到最前
+shanten_cache_t::result_ptr_t shanten_cache_t::find(uint64_t key) {
+    shard_t &shard = shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+        ++shard.miss_cnt;
+        return result_ptr_t();
+    }
+    ++shard.hit_cnt;
+    shard.lru_list.splice(shard.lru_list.begin(), shard.lru_list, it->second);
+    return it->second->second;
+}
+
+// 加入缓存，超出容量时淘汰最久未使用的
+void shanten_cache_t::insert(uint64_t key, const result_ptr_t &result) {
+    shard_t &shard = shard_of(key);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (_shard_capacity == 0 || shard.index.find(key) != shard.index.end()) {  // 其他线程可能已经算好了
+        return;
+    }
+    shard.lru_list.push_front(std::make_pair(key, result));
+    shard.index[key] = shard.lru_list.begin();
+    if (shard.index.size() > _shard_capacity) {
+        shard.index.erase(shard.lru_list.back().first);
+        shard.lru_list.pop_back();
+    }
+}
+
+void shanten_cache_t::clear() {
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        shard_t &shard = _shards[i];
+        std::lock_guard<std::mutex> lock(shard.mutex);
+        shard.lru_list.clear();
+        shard.index.clear();
+        shard.hit_cnt = shard.miss_cnt = 0;
+    }
+}
+
+size_t shanten_cache_t::hit_count() const {
+    size_t cnt = 0;
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        std::lock_guard<std::mutex> lock(_shards[i].mutex);
+        cnt += _shards[i].hit_cnt;
+    }
+    return cnt;
+}
+
+size_t shanten_cache_t::miss_count() const {
+    size_t cnt = 0;
+    for (size_t i = 0; i < _shard_cnt; ++i) {
+        std::lock_guard<std::mutex> lock(_shards[i].mutex);
+        cnt += _shards[i].miss_cnt;
+    }
+    return cnt;
+}
+
+// 基本和型上听数
+int shanten_cache_t::basic_form_shanten(const tile_t *standing_tiles, intptr_t standing_cnt, useful_table_t *useful_table) {
+    tile_transform_t transform;
+    uint64_t key = canonical_hand_code(standing_tiles, standing_cnt, 0, &transform);
+    if (key == 0) {  // 不合法的立牌不缓存
+        return mahjong::basic_form_shanten(standing_tiles, standing_cnt, useful_table);
+    }
+    key |= static_cast<uint64_t>(CACHE_QUERY_BASIC_FORM_SHANTEN) << CACHE_KEY_QUERY_SHIFT;
+
+    result_ptr_t result = find(key);
+    if (!result) {
+        tile_t tiles[13];
+        for (intptr_t i = 0; i < standing_cnt; ++i) {
+            tiles[i] = transform_tile(transform, standing_tiles[i]);
+        }
+        std::shared_ptr<result_t> temp = std::make_shared<result_t>();
+        useful_table_t temp_table;
+        temp->shanten = mahjong::basic_form_shanten(tiles, standing_cnt, &temp_table);
+        temp->useful_bits = temp->shanten != std::numeric_limits<int>::max() ? table_to_tile_set(temp_table) : 0;
+        result = temp;
+        insert(key, result);
+    }
+
+    if (useful_table != nullptr) {
+        bits_to_useful_table(result->useful_bits, transform, useful_table);
+    }
+    return result->shanten;
+}
+
+// 是否听牌
+bool shanten_cache_t::is_waiting(const hand_tiles_t &hand_tiles, useful_table_t *useful_table) {
+    tile_transform_t transform;
+    uint64_t key = canonical_hand_code(hand_tiles.standing_tiles, hand_tiles.tile_count, 0, &transform);
+    if (key == 0) {  // 不合法的立牌不缓存
+        return mahjong::is_waiting(hand_tiles, useful_table);
+    }
+    key |= static_cast<uint64_t>(CACHE_QUERY_IS_WAITING) << CACHE_KEY_QUERY_SHIFT;
+
+    result_ptr_t result = find(key);
+    if (!result) {
+        hand_tiles_t temp_hand;
+        transform_hand_tiles(transform, &hand_tiles, &temp_hand);
+        std::shared_ptr<result_t> temp = std::make_shared<result_t>();
+        useful_table_t temp_table;
+        temp->shanten = mahjong::is_waiting(temp_hand, &temp_table) ? 1 : 0;
+        temp->useful_bits = temp->shanten ? table_to_tile_set(temp_table) : 0;
+        result = temp;
+        insert(key, result);
+    }
+
+    // 与is_waiting一致，不听牌时不修改有效牌标记表
+    if (result->shanten && useful_table != nullptr) {
+        bits_to_useful_table(result->useful_bits, transform, useful_table);
+    }
+    return result->shanten != 0;
+}
+
+// 枚举打哪张牌
+void shanten_cache_t::enum_discard_tile(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+    void *context, enum_callback_t enum_callback) {
+    tile_transform_t transform;
+    uint64_t key = canonical_hand_code(hand_tiles->standing_tiles, hand_tiles->tile_count, serving_tile, &transform);
+    if (key == 0) {  // 不合法的立牌不缓存
+        mahjong::enum_discard_tile(hand_tiles, serving_tile, form_flag, context, enum_callback);
+        return;
+    }
+    key |= static_cast<uint64_t>(form_flag & 0x1F) << CACHE_KEY_FORM_SHIFT;
+    key |= static_cast<uint64_t>(CACHE_QUERY_ENUM_DISCARD_TILE) << CACHE_KEY_QUERY_SHIFT;
+
+    result_ptr_t result = find(key);
+    if (!result) {
+        hand_tiles_t temp_hand;
+        transform_hand_tiles(transform, hand_tiles, &temp_hand);
+        std::shared_ptr<result_t> temp = std::make_shared<result_t>();
+        temp->shanten = 0;
+        temp->useful_bits = 0;
+        mahjong::enum_discard_tile(&temp_hand, transform_tile(transform, serving_tile), form_flag, &temp->enum_results,
+            [](void *context, const enum_result_t *r) {
+            std::vector<result_t::enum_item_t> *items = static_cast<std::vector<result_t::enum_item_t> *>(context);
+            result_t::enum_item_t item;
+            item.discard_tile = r->discard_tile;
+            item.form_flag = r->form_flag;
+            item.shanten = r->shanten;
+            item.useful_bits = r->shanten != std::numeric_limits<int>::max() ? table_to_tile_set(r->useful_table) : 0;
+            items->push_back(item);
+            return true;
+        });
+        result = temp;
+        insert(key, result);
+    }
+
+    // 逆变换回实际的牌
+    const std::vector<result_t::enum_item_t> &cached = result->enum_results;
+    std::vector<enum_result_t> results(cached.size());
+    for (size_t i = 0; i < cached.size(); ++i) {
+        results[i].discard_tile = inverse_transform_tile(transform, cached[i].discard_tile);
+        results[i].form_flag = cached[i].form_flag;
+        results[i].shanten = cached[i].shanten;
+        bits_to_useful_table(cached[i].useful_bits, transform, &results[i].useful_table);
+    }
+
+    // 变换会打乱打牌的顺序，恢复成先摸切、再按牌从小到大的顺序
+    auto first_other = std::find_if(results.begin(), results.end(),
+        [serving_tile](const enum_result_t &r) { return r.discard_tile != serving_tile; });
+    std::stable_sort(first_other, results.end(),
+        [](const enum_result_t &a, const enum_result_t &b) { return a.discard_tile < b.discard_tile; });
+
+    for (const enum_result_t &r : results) {
+        if (!enum_callback(context, &r)) {
+            return;
+        }
+    }
+}
+
+}
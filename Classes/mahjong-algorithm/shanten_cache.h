@@ -0,0 +1,155 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__SHANTEN_CACHE_H__
+#define __MAHJONG_ALGORITHM__SHANTEN_CACHE_H__
+
+#include "shanten.h"
+#include <list>
+#include <unordered_map>
+#include <memory>
+#include <mutex>
+
+namespace mahjong {
+
+/**
+ * @addtogroup shanten
+ * @{
+ */
+
+/**
+ * @brief 牌的变换
+ *  三门数牌之间任意交换，以及所有数牌同时按点数翻转（1~9变成9~1），都不改变上听数与有效牌的结构
+ */
+struct tile_transform_t {
+    uint8_t suit_map[3];  ///< 万条饼分别变换成哪一门（0~2）
+    bool reflect;         ///< 是否翻转点数
+};
+
+/**
+ * @brief 变换一张牌
+ *
+ * @param [in] transform 变换
+ * @param [in] tile 牌（可为0，此时返回0）
+ * @return tile_t 变换后的牌
+ */
+tile_t transform_tile(const tile_transform_t &transform, tile_t tile);
+
+/**
+ * @brief 逆变换一张牌
+ *
+ * @param [in] transform 变换
+ * @param [in] tile 变换后的牌（可为0，此时返回0）
+ * @return tile_t 变换前的牌
+ */
+tile_t inverse_transform_tile(const tile_transform_t &transform, tile_t tile);
+
+/**
+ * @brief 计算立牌的规范编码
+ *  对12种变换后的立牌分别编码，取最小者。每种牌依次写入与张数相同个数的0再写入一个1，共34+立牌数位。
+ *  上牌另占6位，放在第47位开始
+ *
+ * @param [in] standing_tiles 立牌
+ * @param [in] standing_cnt 立牌数（不超过13）
+ * @param [in] serving_tile 上牌（可为0）
+ * @param [out] transform 从实际的牌到规范编码对应的牌的变换
+ * @return uint64_t 规范编码，立牌不合法时返回0
+ */
+uint64_t canonical_hand_code(const tile_t *standing_tiles, intptr_t standing_cnt, tile_t serving_tile, tile_transform_t *transform);
+
+/**
+ * @brief 上听数计算结果的缓存
+ *  以规范编码为键，牌型等价（交换花色或者翻转点数）的手牌共享同一条缓存，取出时再变换回实际的牌。
+ *  按键分成若干片，每片有独立的锁与LRU链表，容量满时淘汰该片最久未使用的结果。所有接口都是线程安全的
+ */
+class shanten_cache_t {
+public:
+    /**
+     * @brief 构造
+     *
+     * @param [in] capacity 最多缓存多少条结果，平均分给各片
+     * @param [in] shard_cnt 分片数（为0时按1处理），多个线程同时查询时应大于线程数
+     */
+    explicit shanten_cache_t(size_t capacity, size_t shard_cnt = 1);
+
+    /**
+     * @brief 基本和型上听数，同basic_form_shanten
+     */
+    int basic_form_shanten(const tile_t *standing_tiles, intptr_t standing_cnt, useful_table_t *useful_table);
+
+    /**
+     * @brief 是否听牌，同is_waiting
+     */
+    bool is_waiting(const hand_tiles_t &hand_tiles, useful_table_t *useful_table);
+
+    /**
+     * @brief 枚举打哪张牌，同enum_discard_tile
+     *  未命中时总是完整地计算所有打法，以便缓存
+     */
+    void enum_discard_tile(const hand_tiles_t *hand_tiles, tile_t serving_tile, uint8_t form_flag,
+        void *context, enum_callback_t enum_callback);
+
+    /**
+     * @brief 清空缓存
+     */
+    void clear();
+
+    /**
+     * @brief 命中次数
+     */
+    size_t hit_count() const;
+
+    /**
+     * @brief 未命中次数
+     */
+    size_t miss_count() const;
+
+private:
+    struct result_t;
+    typedef std::shared_ptr<const result_t> result_ptr_t;
+    typedef std::list<std::pair<uint64_t, result_ptr_t> > lru_list_t;
+
+    struct shard_t {
+        size_t hit_cnt;
+        size_t miss_cnt;
+        lru_list_t lru_list;  ///< 最近使用的在前
+        std::unordered_map<uint64_t, lru_list_t::iterator> index;
+        mutable std::mutex mutex;
+    };
+
+    shard_t &shard_of(uint64_t key);
+    result_ptr_t find(uint64_t key);
+    void insert(uint64_t key, const result_ptr_t &result);
+
+    size_t _shard_capacity;
+    size_t _shard_cnt;
+    std::unique_ptr<shard_t[]> _shards;
+};
+
+/**
+ * end group
+ * @}
+ */
+
+}
+
+#endif
@@ -24,6 +24,7 @@
 #include <string.h>
 #include <algorithm>
 #include <iterator>
+#include "shanten.h"
 
 namespace mahjong {
 
@@ -131,50 +132,47 @@ intptr_t parse_tiles(const char *str, tile_t *tiles, intptr_t max_cnt) {
 
 // 生成副露
 static intptr_t make_fixed_pack(const tile_t *tiles, intptr_t tile_cnt, pack_t *pack, uint8_t offer) {
-    if (tile_cnt > 0) {
-        if (tile_cnt != 3 && tile_cnt != 4) {
-            return PARSE_ERROR_WRONG_TILES_COUNT_FOR_FIXED_PACK;
+    if (tile_cnt != 3 && tile_cnt != 4) {  // 包括[]中没有牌的情况
+        return PARSE_ERROR_WRONG_TILES_COUNT_FOR_FIXED_PACK;
+    }
+    if (tile_cnt == 3) {
+        if (offer == 0) {
+            offer = 1;
+        }
+        if (tiles[0] == tiles[1] && tiles[1] == tiles[2]) {
+            *pack = make_pack(offer, PACK_TYPE_PUNG, tiles[0]);
         }
-        if (tile_cnt == 3) {
-            if (offer == 0) {
-                offer = 1;
+        else {
+            if (tiles[0] + 1 == tiles[1] && tiles[1] + 1 == tiles[2]) {
+                *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[1]);
             }
-            if (tiles[0] == tiles[1] && tiles[1] == tiles[2]) {
-                *pack = make_pack(offer, PACK_TYPE_PUNG, tiles[0]);
+            else if (tiles[0] + 1 == tiles[2] && tiles[2] + 1 == tiles[1]) {
+                *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[2]);
             }
-            else {
-                if (tiles[0] + 1 == tiles[1] && tiles[1] + 1 == tiles[2]) {
-                    *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[1]);
-                }
-                else if (tiles[0] + 1 == tiles[2] && tiles[2] + 1 == tiles[1]) {
-                    *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[2]);
-                }
-                else if (tiles[1] + 1 == tiles[0] && tiles[0] + 1 == tiles[2]) {
-                    *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[0]);
-                }
-                else if (tiles[1] + 1 == tiles[2] && tiles[2] + 1 == tiles[0]) {
-                    *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[2]);
-                }
-                else if (tiles[2] + 1 == tiles[0] && tiles[0] + 1 == tiles[1]) {
-                    *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[0]);
-                }
-                else if (tiles[2] + 1 == tiles[1] && tiles[1] + 1 == tiles[0]) {
-                    *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[1]);
-                }
-                else {
-                    return PARSE_ERROR_CANNOT_MAKE_FIXED_PACK;
-                }
+            else if (tiles[1] + 1 == tiles[0] && tiles[0] + 1 == tiles[2]) {
+                *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[0]);
             }
-        }
-        else {
-            if (tiles[0] != tiles[1] || tiles[1] != tiles[2] || tiles[2] != tiles[3]) {
+            else if (tiles[1] + 1 == tiles[2] && tiles[2] + 1 == tiles[0]) {
+                *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[2]);
+            }
+            else if (tiles[2] + 1 == tiles[0] && tiles[0] + 1 == tiles[1]) {
+                *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[0]);
+            }
+            else if (tiles[2] + 1 == tiles[1] && tiles[1] + 1 == tiles[0]) {
+                *pack = make_pack(offer, PACK_TYPE_CHOW, tiles[1]);
+            }
+            else {
                 return PARSE_ERROR_CANNOT_MAKE_FIXED_PACK;
             }
-            *pack = make_pack(offer, PACK_TYPE_KONG, tiles[0]);
         }
-        return 1;
     }
-    return 0;
+    else {
+        if (tiles[0] != tiles[1] || tiles[1] != tiles[2] || tiles[2] != tiles[3]) {
+            return PARSE_ERROR_CANNOT_MAKE_FIXED_PACK;
+        }
+        *pack = make_pack(offer, PACK_TYPE_KONG, tiles[0]);
+    }
+    return 1;
 }
 
 // 字符串转换为手牌结构和上牌
@@ -202,21 +200,19 @@ intptr_t string_to_tiles(const char *str, hand_tiles_t *hand_tiles, tile_t *serv
         const char *q;
         switch (c) {
         case ',': {  // 副露来源
-            if (!in_brackets) {
-                return PARSE_ERROR_ILLEGAL_CHARACTER;
-            }
-            offer = static_cast<uint8_t>(*++p - '0');
-            q = ++p;
-            if (*p != ']') {
+            // 逗号后面必须是供牌信息和]，先检查再前进，避免以逗号结尾时越过结尾的\0
+            if (!in_brackets || p[1] == '\0' || p[2] != ']') {
                 return PARSE_ERROR_ILLEGAL_CHARACTER;
             }
+            offer = static_cast<uint8_t>(p[1] - '0');
+            q = p += 2;
             break;
         }
         case '[': {  // 开始一组副露
             if (in_brackets) {
                 return PARSE_ERROR_ILLEGAL_CHARACTER;
             }
-            if (pack_cnt > 4) {
+            if (pack_cnt >= 4) {
                 return PARSE_ERROR_TOO_MANY_FIXED_PACKS;
             }
             if (temp_cnt > 0) {  // 处理[]符号外面的牌
@@ -313,6 +309,304 @@ intptr_t string_to_tiles(const char *str, hand_tiles_t *hand_tiles, tile_t *serv
     return PARSE_NO_ERROR;
 }
 
+// 字符的类别，批量解析时查表代替逐个比较
+#define CHAR_CLASS_ILLEGAL  0
+#define CHAR_CLASS_DIGIT    1  // 值为点数
+#define CHAR_CLASS_SUFFIX   2  // 值为花色，即牌的高4位
+#define CHAR_CLASS_HONOR    3  // 值为牌
+#define CHAR_CLASS_COMMA    4
+#define CHAR_CLASS_OPEN     5
+#define CHAR_CLASS_CLOSE    6
+
+namespace {
+    // 字符分类表，各字符的类别与值
+    struct char_table_t {
+        uint8_t classes[256];
+        uint8_t values[256];
+
+        char_table_t() {
+            memset(classes, CHAR_CLASS_ILLEGAL, sizeof(classes));
+            memset(values, 0, sizeof(values));
+            for (int c = '1'; c <= '9'; ++c) {
+                set(c, CHAR_CLASS_DIGIT, static_cast<uint8_t>(c - '0'));
+            }
+            set('0', CHAR_CLASS_DIGIT, 5);
+            set('m', CHAR_CLASS_SUFFIX, 0x10);
+            set('s', CHAR_CLASS_SUFFIX, 0x20);
+            set('p', CHAR_CLASS_SUFFIX, 0x30);
+            set('z', CHAR_CLASS_SUFFIX, 0x40);
+            set('E', CHAR_CLASS_HONOR, TILE_E);
+            set('S', CHAR_CLASS_HONOR, TILE_S);
+            set('W', CHAR_CLASS_HONOR, TILE_W);
+            set('N', CHAR_CLASS_HONOR, TILE_N);
+            set('C', CHAR_CLASS_HONOR, TILE_C);
+            set('F', CHAR_CLASS_HONOR, TILE_F);
+            set('P', CHAR_CLASS_HONOR, TILE_P);
+            set(',', CHAR_CLASS_COMMA, 0);
+            set('[', CHAR_CLASS_OPEN, 0);
+            set(']', CHAR_CLASS_CLOSE, 0);
+        }
+
+        void set(int c, uint8_t cls, uint8_t value) {
+            classes[c] = cls;
+            values[c] = value;
+        }
+    };
+
+    static const char_table_t char_table;
+}
+
+static FORCE_INLINE uint8_t char_class(char c) {
+    return char_table.classes[static_cast<uint8_t>(c)];
+}
+
+static FORCE_INLINE uint8_t char_value(char c) {
+    return char_table.values[static_cast<uint8_t>(c)];
+}
+
+// 给末尾没有花色的数字加上花色，规则同parse_tiles_impl
+static FORCE_INLINE intptr_t set_suit_for_pending(tile_t *tiles, intptr_t pending_begin, intptr_t tile_cnt, uint8_t suit) {
+    for (intptr_t i = pending_begin; i < tile_cnt; ++i) {
+        if (suit == 0x40 && tiles[i] > 7) {
+            return PARSE_ERROR_ILLEGAL_CHARACTER;
+        }
+        tiles[i] |= suit;
+    }
+    return PARSE_NO_ERROR;
+}
+
+// 解析一串牌，规则与parse_tiles_impl完全相同，只是以end而不是\0为结尾
+// 返回错误码，*pos为结束或者出错的位置
+static intptr_t parse_tiles_range(const char **pos, const char *end, tile_t *tiles, intptr_t max_cnt, intptr_t *out_tile_cnt) {
+    const char *p = *pos;
+    intptr_t tile_cnt = 0;
+    intptr_t pending_begin = 0;  // 从这里开始的数字还没有花色
+
+    for (; tile_cnt < max_cnt && p != end; ++p) {
+        const char c = *p;
+        const uint8_t cls = char_class(c);
+        if (cls == CHAR_CLASS_DIGIT) {
+            tiles[tile_cnt++] = char_value(c);
+        }
+        else if (cls == CHAR_CLASS_SUFFIX) {
+            if (set_suit_for_pending(tiles, pending_begin, tile_cnt, char_value(c)) != PARSE_NO_ERROR) {
+                *pos = p;
+                return PARSE_ERROR_ILLEGAL_CHARACTER;
+            }
+            pending_begin = tile_cnt;
+        }
+        else if (cls == CHAR_CLASS_HONOR) {
+            if (pending_begin != tile_cnt) {
+                *pos = p;
+                return PARSE_ERROR_NO_SUFFIX_AFTER_DIGIT;
+            }
+            tiles[tile_cnt++] = char_value(c);
+            pending_begin = tile_cnt;
+        }
+        else {
+            break;
+        }
+    }
+
+    // 一连串数字+后缀，但已经超过容量，说明牌过多
+    if (pending_begin != tile_cnt) {
+        const char *p1 = p;
+        while (p1 != end && char_class(*p1) != CHAR_CLASS_SUFFIX) {
+            ++p1;
+        }
+        if (p1 == end) {
+            *pos = p;
+            return PARSE_ERROR_NO_SUFFIX_AFTER_DIGIT;
+        }
+        if (set_suit_for_pending(tiles, pending_begin, tile_cnt, char_value(*p1)) != PARSE_NO_ERROR) {
+            *pos = p1;
+            return PARSE_ERROR_ILLEGAL_CHARACTER;
+        }
+        if (p1 != p) {  // 放弃过中间的数字
+            *pos = p;
+            return PARSE_ERROR_TOO_MANY_TILES;
+        }
+        p = p1 + 1;
+    }
+
+    *pos = p;
+    *out_tile_cnt = tile_cnt;
+    return PARSE_NO_ERROR;
+}
+
+// 解析一行，规则与string_to_tiles完全相同，只是以end而不是\0为结尾，并且记录出错的位置
+static intptr_t parse_line(const char *begin, const char *end, parse_line_result_t *result, const char **error_pos) {
+    pack_t packs[4];
+    intptr_t pack_cnt = 0;
+    tile_t standing_tiles[14];
+    intptr_t standing_cnt = 0;
+
+    bool in_brackets = false;
+    tile_t temp_tiles[14];
+    intptr_t temp_cnt = 0;
+    intptr_t max_cnt = 14;
+    uint8_t offer = 0;
+
+    uint8_t cnt_table[TILE_TABLE_SIZE] = { 0 };
+
+#define FAIL(error_, pos_) do { *error_pos = (pos_); return (error_); } while (0)
+
+    const char *p = begin;
+    while (p != end) {
+        switch (char_class(*p)) {
+        case CHAR_CLASS_COMMA:  // 副露来源
+            if (!in_brackets || end - p < 3) {
+                FAIL(PARSE_ERROR_ILLEGAL_CHARACTER, p);
+            }
+            offer = static_cast<uint8_t>(p[1] - '0');
+            p += 2;
+            if (*p != ']') {
+                FAIL(PARSE_ERROR_ILLEGAL_CHARACTER, p);
+            }
+            break;
+        case CHAR_CLASS_OPEN:  // 开始一组副露
+            if (in_brackets) {
+                FAIL(PARSE_ERROR_ILLEGAL_CHARACTER, p);
+            }
+            if (pack_cnt >= 4) {
+                FAIL(PARSE_ERROR_TOO_MANY_FIXED_PACKS, p);
+            }
+            if (temp_cnt > 0) {  // 处理[]符号外面的牌
+                if (standing_cnt + temp_cnt >= max_cnt) {
+                    FAIL(PARSE_ERROR_TOO_MANY_TILES, p);
+                }
+                memcpy(&standing_tiles[standing_cnt], temp_tiles, temp_cnt * sizeof(tile_t));
+                standing_cnt += temp_cnt;
+                temp_cnt = 0;
+            }
+            ++p;
+            in_brackets = true;
+            offer = 0;
+            max_cnt = 4;
+            break;
+        case CHAR_CLASS_CLOSE: {  // 结束一副副露
+            if (!in_brackets) {
+                FAIL(PARSE_ERROR_ILLEGAL_CHARACTER, p);
+            }
+            intptr_t ret = make_fixed_pack(temp_tiles, temp_cnt, &packs[pack_cnt], offer);
+            if (ret < 0) {
+                FAIL(ret, p);
+            }
+            ++p;
+            temp_cnt = 0;
+            in_brackets = false;
+            ++pack_cnt;
+            max_cnt = 14 - standing_cnt - pack_cnt * 3;
+            break;
+        }
+        case CHAR_CLASS_ILLEGAL:
+            FAIL(PARSE_ERROR_ILLEGAL_CHARACTER, p);
+        default: {  // 牌
+            if (temp_cnt != 0) {  // 重复进入
+                FAIL(PARSE_ERROR_TOO_MANY_TILES, p);
+            }
+            if (max_cnt <= 0) {
+                FAIL(PARSE_ERROR_ILLEGAL_CHARACTER, p);
+            }
+            const char *q = p;
+            intptr_t ret = parse_tiles_range(&q, end, temp_tiles, max_cnt, &temp_cnt);
+            if (ret != PARSE_NO_ERROR) {
+                FAIL(ret, q);
+            }
+            for (intptr_t i = 0; i < temp_cnt; ++i) {
+                ++cnt_table[temp_tiles[i]];
+            }
+            p = q;
+            break;
+        }
+        }
+    }
+
+    max_cnt = 14 - pack_cnt * 3;
+    if (temp_cnt > 0) {  // 处理[]符号外面的牌
+        if (standing_cnt + temp_cnt > max_cnt) {
+            FAIL(PARSE_ERROR_TOO_MANY_TILES, end);
+        }
+        memcpy(&standing_tiles[standing_cnt], temp_tiles, temp_cnt * sizeof(tile_t));
+        standing_cnt += temp_cnt;
+    }
+    if (standing_cnt > max_cnt) {
+        FAIL(PARSE_ERROR_TOO_MANY_TILES, end);
+    }
+    for (int i = 0; i < TILE_TABLE_SIZE; ++i) {
+        if (cnt_table[i] > 4) {
+            FAIL(PARSE_ERROR_TILE_COUNT_GREATER_THAN_4, end);
+        }
+    }
+
+#undef FAIL
+
+    hand_tiles_t &hand_tiles = result->hand_tiles;
+    if (standing_cnt == max_cnt) {
+        memcpy(hand_tiles.standing_tiles, standing_tiles, (max_cnt - 1) * sizeof(tile_t));
+        hand_tiles.tile_count = max_cnt - 1;
+        result->serving_tile = standing_tiles[max_cnt - 1];
+    }
+    else {
+        memcpy(hand_tiles.standing_tiles, standing_tiles, standing_cnt * sizeof(tile_t));
+        hand_tiles.tile_count = standing_cnt;
+    }
+    memcpy(hand_tiles.fixed_packs, packs, pack_cnt * sizeof(pack_t));
+    hand_tiles.pack_count = pack_cnt;
+    return PARSE_NO_ERROR;
+}
+
+// 批量解析以换行分隔的手牌字符串
+size_t parse_hand_lines(const char *buffer, size_t size, bool is_final, void *context, parse_line_callback_t callback) {
+    parse_line_result_t result;
+    const char *const buffer_end = buffer + size;
+    const char *line = buffer;
+
+    while (line != buffer_end) {
+        const char *line_end = static_cast<const char *>(memchr(line, '\n', buffer_end - line));
+        const char *next = line_end != nullptr ? line_end + 1 : buffer_end;
+        if (line_end == nullptr) {
+            if (!is_final) {  // 不完整的一行留给下次
+                break;
+            }
+            line_end = buffer_end;
+        }
+        if (line_end != line && line_end[-1] == '\r') {
+            --line_end;
+        }
+
+        result.hand_tiles.tile_count = 0;
+        result.hand_tiles.pack_count = 0;
+        result.serving_tile = 0;
+        result.line_offset = static_cast<size_t>(line - buffer);
+        result.line_length = static_cast<size_t>(line_end - line);
+
+        const char *error_pos = line_end;
+        result.error = parse_line(line, line_end, &result, &error_pos);
+        if (result.error != PARSE_NO_ERROR) {
+            // 与string_to_tiles一致，整行有非法字符时优先报告非法字符
+            const char *p = line;
+            while (p != line_end && char_class(*p) != CHAR_CLASS_ILLEGAL) {
+                ++p;
+            }
+            if (p != line_end) {
+                result.error = PARSE_ERROR_ILLEGAL_CHARACTER;
+                error_pos = p;
+            }
+            result.hand_tiles.tile_count = 0;
+            result.hand_tiles.pack_count = 0;
+            result.serving_tile = 0;
+        }
+        result.error_offset = static_cast<size_t>(error_pos - buffer);
+
+        line = next;
+        if (!callback(context, &result)) {
+            break;
+        }
+    }
+    return static_cast<size_t>(line - buffer);
+}
+
 // 牌转换为字符串
 intptr_t tiles_to_string(const tile_t *tiles, intptr_t tile_cnt, char *str, intptr_t max_size) {
     bool tenhon = false;
@@ -437,4 +731,215 @@ intptr_t hand_tiles_to_string(const hand_tiles_t *hand_tiles, char *str, intptr_
     return static_cast<intptr_t>(p - str);
 }
 
+namespace {
+    // 字形表，各种牌的字符与花色（1~4，不合法的牌为0）
+    struct glyph_table_t {
+        char text[256];
+        uint8_t suits[256];
+
+        glyph_table_t() {
+            static const char honor_text[] = "ESWNCFP";
+            memset(text, 0, sizeof(text));
+            memset(suits, 0, sizeof(suits));
+            for (int s = 1; s <= 3; ++s) {
+                for (int r = 1; r <= 9; ++r) {
+                    tile_t t = make_tile(static_cast<suit_t>(s), static_cast<rank_t>(r));
+                    text[t] = static_cast<char>('0' + r);
+                    suits[t] = static_cast<uint8_t>(s);
+                }
+            }
+            for (int r = 1; r <= 7; ++r) {
+                tile_t t = make_tile(TILE_SUIT_HONORS, static_cast<rank_t>(r));
+                text[t] = honor_text[r - 1];
+                suits[t] = 4;
+            }
+        }
+    };
+
+    static const glyph_table_t glyph_table;
+}
+
+// 各种长度的上限，格式化前按此预留空间，写入时不再检查
+#define MAX_TILES_TEXT_SIZE(cnt_) ((cnt_) * 2)      // 每张牌1个字符，最多再加1个后缀
+#define MAX_PACK_TEXT_SIZE 9                        // 如[1111m,5]
+#define MAX_INT_TEXT_SIZE 11                        // 如-2147483648
+
+// 写入牌，结果与tiles_to_string相同
+static char *write_tiles(char *p, const tile_t *tiles, intptr_t tile_cnt) {
+    static const char suffix[] = " msp";
+    uint8_t last_suit = 0;
+    for (intptr_t i = 0; i < tile_cnt; ++i) {
+        const tile_t t = tiles[i];
+        const uint8_t s = glyph_table.suits[t];
+        if (s == 0) {
+            continue;
+        }
+        if (s != last_suit && last_suit != 0 && last_suit != 4) {  // 花色变了，加后缀
+            *p++ = suffix[last_suit];
+        }
+        *p++ = glyph_table.text[t];
+        last_suit = s;
+    }
+    if (last_suit != 0 && last_suit != 4) {
+        *p++ = suffix[last_suit];
+    }
+    return p;
+}
+
+// 写入牌组，结果与packs_to_string相同
+static char *write_packs(char *p, const pack_t *packs, intptr_t pack_cnt) {
+    tile_t temp[4];
+    for (intptr_t i = 0; i < pack_cnt; ++i) {
+        const pack_t pack = packs[i];
+        const tile_t t = pack_get_tile(pack);
+        uint8_t o = pack_get_offer(pack);
+        intptr_t cnt;
+        switch (pack_get_type(pack)) {
+        case PACK_TYPE_CHOW:
+            temp[0] = static_cast<tile_t>(t - 1); temp[1] = t; temp[2] = static_cast<tile_t>(t + 1);
+            cnt = 3;
+            break;
+        case PACK_TYPE_PUNG:
+            temp[0] = temp[1] = temp[2] = t;
+            cnt = 3;
+            break;
+        case PACK_TYPE_KONG:
+            temp[0] = temp[1] = temp[2] = temp[3] = t;
+            cnt = 4;
+            if (is_promoted_kong(pack)) {
+                o |= 0x4;
+            }
+            break;
+        case PACK_TYPE_PAIR:
+            temp[0] = temp[1] = t;
+            p = write_tiles(p, temp, 2);
+            continue;
+        default:
+            continue;
+        }
+        *p++ = '[';
+        p = write_tiles(p, temp, cnt);
+        *p++ = ',';
+        *p++ = static_cast<char>('0' + o);
+        *p++ = ']';
+    }
+    return p;
+}
+
+// 写入整数
+static char *write_int(char *p, int value) {
+    unsigned u = static_cast<unsigned>(value);
+    if (value < 0) {
+        *p++ = '-';
+        u = 0U - u;
+    }
+    char temp[10];
+    int n = 0;
+    do {
+        temp[n++] = static_cast<char>('0' + u % 10);
+        u /= 10;
+    } while (u != 0);
+    while (n > 0) {
+        *p++ = temp[--n];
+    }
+    return p;
+}
+
+// 写入字符串常量
+template <size_t N>
+static FORCE_INLINE char *write_literal(char *p, const char (&str)[N]) {
+    memcpy(p, str, N - 1);
+    return p + N - 1;
+}
+
+// 确保缓冲区在used之后还有size字节可写，按倍数扩大以减少分配次数
+static FORCE_INLINE char *reserve_buffer(std::vector<char> &buffer, size_t used, size_t size) {
+    if (used + size > buffer.size()) {
+        buffer.resize(std::max(buffer.size() * 2, used + size));
+    }
+    return &buffer[used];
+}
+
+// 一手牌的长度上限，包括上牌
+static FORCE_INLINE size_t max_hand_text_size(const hand_tiles_t &hand_tiles) {
+    return static_cast<size_t>(hand_tiles.pack_count) * MAX_PACK_TEXT_SIZE + MAX_TILES_TEXT_SIZE(static_cast<size_t>(hand_tiles.tile_count) + 1);
+}
+
+// 批量将手牌转换为字符串，每行一手
+size_t hands_to_lines(const hand_tiles_t *hands, const tile_t *serving_tiles, size_t count, std::vector<char> &buffer) {
+    const size_t begin = buffer.size();
+    size_t used = begin;
+    for (size_t i = 0; i < count; ++i) {
+        const hand_tiles_t &hand_tiles = hands[i];
+        char *const start = reserve_buffer(buffer, used, max_hand_text_size(hand_tiles) + 1);
+        char *p = write_packs(start, hand_tiles.fixed_packs, hand_tiles.pack_count);
+        p = write_tiles(p, hand_tiles.standing_tiles, hand_tiles.tile_count);
+        if (serving_tiles != nullptr) {
+            p = write_tiles(p, &serving_tiles[i], 1);
+        }
+        *p++ = '\n';
+        used += static_cast<size_t>(p - start);
+    }
+    buffer.resize(used);
+    return used - begin;
+}
+
+// 批量将手牌转换为NDJSON，每行一个对象
+size_t hands_to_ndjson(const hand_tiles_t *hands, const tile_t *serving_tiles, const int *fans, size_t count, std::vector<char> &buffer) {
+    const size_t begin = buffer.size();
+    size_t used = begin;
+    for (size_t i = 0; i < count; ++i) {
+        const hand_tiles_t &hand_tiles = hands[i];
+        char *const start = reserve_buffer(buffer, used, max_hand_text_size(hand_tiles) + MAX_INT_TEXT_SIZE + 48);
+        char *p = write_literal(start, "{\"hand\":\"");
+        p = write_packs(p, hand_tiles.fixed_packs, hand_tiles.pack_count);
+        p = write_tiles(p, hand_tiles.standing_tiles, hand_tiles.tile_count);
+        *p++ = '"';
+        if (serving_tiles != nullptr) {
+            p = write_literal(p, ",\"serving_tile\":\"");
+            p = write_tiles(p, &serving_tiles[i], 1);
+            *p++ = '"';
+        }
+        if (fans != nullptr) {
+            p = write_literal(p, ",\"fan\":");
+            p = write_int(p, fans[i]);
+        }
+        *p++ = '}';
+        *p++ = '\n';
+        used += static_cast<size_t>(p - start);
+    }
+    buffer.resize(used);
+    return used - begin;
+}
+
+// 批量将打哪张牌的结果转换为NDJSON，每行一个对象
+size_t enum_results_to_ndjson(const enum_result_t *results, size_t count, std::vector<char> &buffer) {
+    const size_t begin = buffer.size();
+    size_t used = begin;
+    tile_t useful_tiles[34];
+    for (size_t i = 0; i < count; ++i) {
+        const enum_result_t &result = results[i];
+        intptr_t useful_cnt = 0;
+        for (tile_t t : all_tiles) {
+            if (result.useful_table[t]) {
+                useful_tiles[useful_cnt++] = t;
+            }
+        }
+
+        char *const start = reserve_buffer(buffer, used, MAX_TILES_TEXT_SIZE(useful_cnt + 1) + MAX_INT_TEXT_SIZE * 2 + 64);
+        char *p = write_literal(start, "{\"discard_tile\":\"");
+        p = write_tiles(p, &result.discard_tile, 1);
+        p = write_literal(p, "\",\"form_flag\":");
+        p = write_int(p, result.form_flag);
+        p = write_literal(p, ",\"shanten\":");
+        p = write_int(p, result.shanten);
+        p = write_literal(p, ",\"useful_tiles\":\"");
+        p = write_tiles(p, useful_tiles, useful_cnt);
+        p = write_literal(p, "\"}\n");
+        used += static_cast<size_t>(p - start);
+    }
+    buffer.resize(used);
+    return used - begin;
+}
+
 }
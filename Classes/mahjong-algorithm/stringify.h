@@ -24,9 +24,12 @@
 #define __MAHJONG_ALGORITHM__STRINGIFY_H__
 
 #include "tile.h"
+#include <vector>
 
 namespace mahjong {
 
+struct enum_result_t;
+
 /**
  * @brief 字符串格式：
  * - 数牌：万=m 条=s 饼=p。后缀使用小写字母，一连串同花色的数牌可合并使用用一个后缀，如123m、678s等等。
@@ -93,6 +96,42 @@ intptr_t parse_tiles(const char *str, tile_t *tiles, intptr_t max_cnt);
  */
 intptr_t string_to_tiles(const char *str, hand_tiles_t *hand_tiles, tile_t *serving_tile);
 
+/**
+ * @brief 批量解析的一行结果
+ */
+struct parse_line_result_t {
+    hand_tiles_t hand_tiles;  ///< 手牌结构，出错时为空
+    tile_t serving_tile;      ///< 上的牌，出错时为0
+    intptr_t error;           ///< 错误码，与对这一行调用string_to_tiles的返回值相同
+    size_t line_offset;       ///< 行首相对于缓冲区起始的字节偏移
+    size_t line_length;       ///< 行的长度，不包括换行符
+    size_t error_offset;      ///< 出错的字符相对于缓冲区起始的字节偏移，无错误时无意义
+};
+
+/**
+ * @brief 批量解析的回调函数
+ *
+ * @param [in] context 从parse_hand_lines传过来的context原样传回
+ * @param [in] result 一行的解析结果
+ * @retval true 继续解析
+ * @retval false 结束解析
+ */
+typedef bool (*parse_line_callback_t)(void *context, const parse_line_result_t *result);
+
+/**
+ * @brief 批量解析以换行分隔的手牌字符串
+ *  缓冲区不需要以\0结尾，可以直接传入内存映射的文件。行尾的\r会被忽略，空行也回调一次。
+ *  逐字符查表分类，不为每行分配内存
+ *
+ * @param [in] buffer 缓冲区
+ * @param [in] size 缓冲区字节数
+ * @param [in] is_final 是否为最后一块数据，否则末尾不完整的一行不解析，由调用者拼接到下一块数据的开头
+ * @param [in] context 用户自定义参数，将原样从回调函数传回
+ * @param [in] callback 回调函数，每行调用一次
+ * @return size_t 已经解析的字节数，即下一行的起始位置
+ */
+size_t parse_hand_lines(const char *buffer, size_t size, bool is_final, void *context, parse_line_callback_t callback);
+
 /**
  * @brief 牌转换为字符串
  * @param [in] tiles 牌
@@ -122,6 +161,48 @@ intptr_t packs_to_string(const pack_t *packs, intptr_t pack_cnt, char *str, intp
  */
 intptr_t hand_tiles_to_string(const hand_tiles_t *hand_tiles, char *str, intptr_t max_size);
 
+/**
+ * @name bulk formatting
+ *  批量格式化，追加到调用者提供的缓冲区末尾，预留空间后逐字符查表写入，不构造中间字符串。
+ *  牌与牌组的格式与tiles_to_string、packs_to_string相同
+ * @{
+ */
+
+/**
+ * @brief 批量将手牌转换为字符串，每行一手，可以直接用parse_hand_lines解析
+ * @param [in] hands 手牌结构数组
+ * @param [in] serving_tiles 上牌数组（可为null，元素也可为0），写在每手牌的末尾
+ * @param [in] count 手牌数
+ * @param [in,out] buffer 缓冲区
+ * @return size_t 追加的字节数
+ */
+size_t hands_to_lines(const hand_tiles_t *hands, const tile_t *serving_tiles, size_t count, std::vector<char> &buffer);
+
+/**
+ * @brief 批量将手牌转换为NDJSON，每行一个对象，如{"hand":"[123m,1]45m","serving_tile":"6m","fan":8}
+ * @param [in] hands 手牌结构数组
+ * @param [in] serving_tiles 上牌数组（可为null，此时不输出serving_tile）
+ * @param [in] fans 番数数组（可为null，此时不输出fan）
+ * @param [in] count 手牌数
+ * @param [in,out] buffer 缓冲区
+ * @return size_t 追加的字节数
+ */
+size_t hands_to_ndjson(const hand_tiles_t *hands, const tile_t *serving_tiles, const int *fans, size_t count, std::vector<char> &buffer);
+
+/**
+ * @brief 批量将打哪张牌的结果转换为NDJSON，每行一个对象，
+ *  如{"discard_tile":"5m","form_flag":1,"shanten":0,"useful_tiles":"36m"}
+ * @param [in] results 打哪张牌的结果数组，见enum_discard_tile
+ * @param [in] count 结果数
+ * @param [in,out] buffer 缓冲区
+ * @return size_t 追加的字节数
+ */
+size_t enum_results_to_ndjson(const enum_result_t *results, size_t count, std::vector<char> &buffer);
+
+/**
+ * @}
+ */
+
 /**
  * end group
  * @}
@@ -0,0 +1,292 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__TILE_COUNTS_H__
+#define __MAHJONG_ALGORITHM__TILE_COUNTS_H__
+
+#include "tile.h"
+#include <string.h>
+
+// 选择SIMD指令集，定义TILE_COUNTS_NO_SIMD可强制使用标量实现
+#if !defined(TILE_COUNTS_NO_SIMD)
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define TILE_COUNTS_SSE2
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define TILE_COUNTS_NEON
+#include <arm_neon.h>
+#endif
+#endif
+
+namespace mahjong {
+
+/**
+ * @brief 紧凑牌表的大小
+ *  34种牌按all_tiles的顺序排列，补齐到16的倍数以便SIMD处理，多出的位置始终为0
+ */
+#define TILE_COUNTS_SIZE 48
+
+/**
+ * @brief 紧凑牌表类型
+ *  与tile_table_t相比，去掉了各门之间的空洞，每种牌只占1字节，共48字节
+ */
+struct tile_counts_t {
+    alignas(16) uint8_t counts[TILE_COUNTS_SIZE];  ///< 各种牌的张数，下标见tile_counts_index
+};
+
+/**
+ * @brief 牌在紧凑牌表中的下标，即在all_tiles中的下标
+ *  函数不检查输入的合法性。如果输入不合法的值，将无法保证合法返回值的合法性
+ * @param [in] tile 牌
+ * @return int 下标
+ */
+static FORCE_INLINE int tile_counts_index(tile_t tile) {
+    return ((tile >> 4) - 1) * 9 + (tile & 0xF) - 1;
+}
+
+/**
+ * @brief 清空紧凑牌表
+ * @param [out] counts 紧凑牌表
+ */
+static FORCE_INLINE void clear_tile_counts(tile_counts_t *counts) {
+#if defined(TILE_COUNTS_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    _mm_store_si128(reinterpret_cast<__m128i *>(&counts->counts[0]), zero);
+    _mm_store_si128(reinterpret_cast<__m128i *>(&counts->counts[16]), zero);
+    _mm_store_si128(reinterpret_cast<__m128i *>(&counts->counts[32]), zero);
+#elif defined(TILE_COUNTS_NEON)
+    uint8x16_t zero = vdupq_n_u8(0);
+    vst1q_u8(&counts->counts[0], zero);
+    vst1q_u8(&counts->counts[16], zero);
+    vst1q_u8(&counts->counts[32], zero);
+#else
+    memset(counts->counts, 0, sizeof(counts->counts));
+#endif
+}
+
+/**
+ * @brief 将牌打表到紧凑牌表
+ *  牌数很少，逐张累加比SIMD比较计数更快，这里只用SIMD清空
+ * @param [in] tiles 牌
+ * @param [in] cnt 牌的数量
+ * @param [out] counts 紧凑牌表
+ */
+static FORCE_INLINE void map_tiles_to_counts(const tile_t *tiles, intptr_t cnt, tile_counts_t *counts) {
+    clear_tile_counts(counts);
+    for (intptr_t i = 0; i < cnt; ++i) {
+        ++counts->counts[tile_counts_index(tiles[i])];
+    }
+}
+
+/**
+ * @brief 紧凑牌表中某一块（16种牌）哪些位置有牌
+ * @param [in] counts 紧凑牌表
+ * @param [in] block 块的起始下标，0、16或者32
+ * @return unsigned 第i位表示block+i处是否有牌
+ */
+static FORCE_INLINE unsigned tile_counts_nonzero_mask(const tile_counts_t &counts, int block) {
+#if defined(TILE_COUNTS_SSE2)
+    __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(&counts.counts[block]));
+    return ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, _mm_setzero_si128()))) & 0xFFFFU;
+#else
+#if defined(TILE_COUNTS_NEON)
+    uint64x2_t v = vreinterpretq_u64_u8(vld1q_u8(&counts.counts[block]));
+    if ((vgetq_lane_u64(v, 0) | vgetq_lane_u64(v, 1)) == 0) {
+        return 0;
+    }
+#endif
+    unsigned mask = 0;
+    for (int i = 0; i < 16; ++i) {
+        if (counts.counts[block + i] != 0) {
+            mask |= 1U << i;
+        }
+    }
+    return mask;
+#endif
+}
+
+/**
+ * @brief 将紧凑牌表转换成牌
+ *  整块跳过没有牌的位置
+ * @param [in] counts 紧凑牌表
+ * @param [out] tiles 牌
+ * @param [in] max_cnt 牌的最大数量
+ * @return intptr_t 牌的实际数量
+ */
+static inline intptr_t tile_counts_to_tiles(const tile_counts_t &counts, tile_t *tiles, intptr_t max_cnt) {
+    intptr_t cnt = 0;
+    for (int block = 0; block < TILE_COUNTS_SIZE; block += 16) {
+        unsigned mask = tile_counts_nonzero_mask(counts, block);
+        for (int i = block; mask != 0; ++i, mask >>= 1) {
+            if ((mask & 1) == 0) {
+                continue;
+            }
+            for (int n = counts.counts[i]; n > 0; --n) {
+                if (cnt == max_cnt) {
+                    return cnt;
+                }
+                tiles[cnt++] = all_tiles[i];
+            }
+        }
+    }
+    return cnt;
+}
+
+/**
+ * @brief 牌表转换成紧凑牌表
+ * @param [in] cnt_table 牌表
+ * @param [out] counts 紧凑牌表
+ */
+static FORCE_INLINE void table_to_tile_counts(const tile_table_t &cnt_table, tile_counts_t *counts) {
+    clear_tile_counts(counts);
+    for (int i = 0; i < 34; ++i) {
+        counts->counts[i] = static_cast<uint8_t>(cnt_table[all_tiles[i]]);
+    }
+}
+
+/**
+ * @brief 紧凑牌表转换成牌表
+ * @param [in] counts 紧凑牌表
+ * @param [out] cnt_table 牌表
+ */
+static FORCE_INLINE void tile_counts_to_table(const tile_counts_t &counts, tile_table_t *cnt_table) {
+    memset(*cnt_table, 0, sizeof(*cnt_table));
+    for (int i = 0; i < 34; ++i) {
+        (*cnt_table)[all_tiles[i]] = counts.counts[i];
+    }
+}
+
+/**
+ * @brief 计算剩余的牌
+ *  每种牌4张减去已使用的张数，不足0时为0
+ * @param [in] used 已使用的牌
+ * @param [out] remain 剩余的牌
+ */
+static FORCE_INLINE void remaining_tile_counts(const tile_counts_t &used, tile_counts_t *remain) {
+#if defined(TILE_COUNTS_SSE2)
+    __m128i four = _mm_set1_epi8(4);
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(&used.counts[b]));
+        _mm_store_si128(reinterpret_cast<__m128i *>(&remain->counts[b]), _mm_subs_epu8(four, v));
+    }
+#elif defined(TILE_COUNTS_NEON)
+    uint8x16_t four = vdupq_n_u8(4);
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        vst1q_u8(&remain->counts[b], vqsubq_u8(four, vld1q_u8(&used.counts[b])));
+    }
+#else
+    for (int i = 0; i < TILE_COUNTS_SIZE; ++i) {
+        remain->counts[i] = used.counts[i] < 4 ? static_cast<uint8_t>(4 - used.counts[i]) : 0;
+    }
+#endif
+    memset(&remain->counts[34], 0, TILE_COUNTS_SIZE - 34);  // 多出的位置保持为0
+}
+
+/**
+ * @brief 有效牌标记表转换成紧凑的掩码
+ *  有效牌的位置为0xFF，其余为0
+ * @param [in] useful_table 有效牌标记表
+ * @param [out] mask 掩码
+ */
+static FORCE_INLINE void useful_table_to_tile_mask(const bool (&useful_table)[TILE_TABLE_SIZE], tile_counts_t *mask) {
+    // 标记表中各门牌是连续的，整段复制到紧凑的位置
+    clear_tile_counts(mask);
+    memcpy(&mask->counts[0], &useful_table[TILE_1m], 9);
+    memcpy(&mask->counts[9], &useful_table[TILE_1s], 9);
+    memcpy(&mask->counts[18], &useful_table[TILE_1p], 9);
+    memcpy(&mask->counts[27], &useful_table[TILE_E], 7);
+
+    // bool只有0和1，取负即得0或0xFF
+#if defined(TILE_COUNTS_SSE2)
+    __m128i zero = _mm_setzero_si128();
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(&mask->counts[b]));
+        _mm_store_si128(reinterpret_cast<__m128i *>(&mask->counts[b]), _mm_sub_epi8(zero, v));
+    }
+#elif defined(TILE_COUNTS_NEON)
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        vst1q_u8(&mask->counts[b], vreinterpretq_u8_s8(vnegq_s8(vreinterpretq_s8_u8(vld1q_u8(&mask->counts[b])))));
+    }
+#else
+    for (int i = 0; i < 34; ++i) {
+        mask->counts[i] = static_cast<uint8_t>(0 - mask->counts[i]);
+    }
+#endif
+}
+
+/**
+ * @brief 掩码选中的牌的总张数
+ * @param [in] counts 紧凑牌表
+ * @param [in] mask 掩码，选中的位置为0xFF
+ * @return int 总张数
+ */
+static FORCE_INLINE int sum_tile_counts_masked(const tile_counts_t &counts, const tile_counts_t &mask) {
+#if defined(TILE_COUNTS_SSE2)
+    __m128i sum = _mm_setzero_si128();
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        __m128i v = _mm_and_si128(_mm_load_si128(reinterpret_cast<const __m128i *>(&counts.counts[b])),
+            _mm_load_si128(reinterpret_cast<const __m128i *>(&mask.counts[b])));
+        sum = _mm_add_epi64(sum, _mm_sad_epu8(v, _mm_setzero_si128()));  // 每8字节求和
+    }
+    return _mm_cvtsi128_si32(sum) + _mm_cvtsi128_si32(_mm_srli_si128(sum, 8));
+#elif defined(TILE_COUNTS_NEON)
+    uint64x2_t sum = vdupq_n_u64(0);
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        uint8x16_t v = vandq_u8(vld1q_u8(&counts.counts[b]), vld1q_u8(&mask.counts[b]));
+        sum = vaddq_u64(sum, vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(v))));
+    }
+    return static_cast<int>(vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1));
+#else
+    int sum = 0;
+    for (int i = 0; i < TILE_COUNTS_SIZE; ++i) {
+        sum += counts.counts[i] & mask.counts[i];
+    }
+    return sum;
+#endif
+}
+
+/**
+ * @brief 紧凑牌表的总张数
+ * @param [in] counts 紧凑牌表
+ * @return int 总张数
+ */
+static FORCE_INLINE int sum_tile_counts(const tile_counts_t &counts) {
+    tile_counts_t all;
+    memset(all.counts, 0xFF, sizeof(all.counts));
+    return sum_tile_counts_masked(counts, all);
+}
+
+/**
+ * @brief 有效牌的剩余总张数
+ * @param [in] remain 剩余的牌
+ * @param [in] useful_table 有效牌标记表
+ * @return int 总张数
+ */
+static FORCE_INLINE int count_useful_tiles(const tile_counts_t &remain, const bool (&useful_table)[TILE_TABLE_SIZE]) {
+    tile_counts_t mask;
+    useful_table_to_tile_mask(useful_table, &mask);
+    return sum_tile_counts_masked(remain, mask);
+}
+
+}
+
+#endif
@@ -0,0 +1,208 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__TILE_SET_H__
+#define __MAHJONG_ALGORITHM__TILE_SET_H__
+
+#include "tile_counts.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+#include <intrin.h>
+#endif
+
+namespace mahjong {
+
+/**
+ * @brief 牌的集合类型
+ *  第i位表示all_tiles[i]是否在集合中，共34位。并集、交集、差集直接用|、&、&~运算
+ */
+typedef uint64_t tile_set_t;
+
+/**
+ * @brief 全部34种牌的集合
+ */
+#define TILE_SET_ALL ((UINT64_C(1) << 34) - 1)
+
+/**
+ * @brief 只含一种牌的集合
+ * @param [in] tile 牌
+ * @return tile_set_t 集合
+ */
+static FORCE_INLINE tile_set_t tile_set_of(tile_t tile) {
+    return UINT64_C(1) << tile_counts_index(tile);
+}
+
+/**
+ * @brief 集合中是否有这种牌
+ * @param [in] set 集合
+ * @param [in] tile 牌
+ * @return bool 是否有这种牌
+ */
+static FORCE_INLINE bool tile_set_contains(tile_set_t set, tile_t tile) {
+    return (set & tile_set_of(tile)) != 0;
+}
+
+/**
+ * @brief 集合中牌的种数
+ * @param [in] set 集合
+ * @return int 种数
+ */
+static FORCE_INLINE int tile_set_count(tile_set_t set) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(set);
+#else
+    set = set - ((set >> 1) & UINT64_C(0x5555555555555555));
+    set = (set & UINT64_C(0x3333333333333333)) + ((set >> 2) & UINT64_C(0x3333333333333333));
+    set = (set + (set >> 4)) & UINT64_C(0x0F0F0F0F0F0F0F0F);
+    return static_cast<int>((set * UINT64_C(0x0101010101010101)) >> 56);
+#endif
+}
+
+/**
+ * @brief 集合中下标最小的牌
+ *  配合set &= set - 1即可按all_tiles的顺序遍历集合：
+ *  for (tile_set_t s = set; s != 0; s &= s - 1) { tile_t t = tile_set_first(s); ... }
+ * @param [in] set 集合（不可为空）
+ * @return tile_t 牌
+ */
+static FORCE_INLINE tile_t tile_set_first(tile_set_t set) {
+#if defined(__GNUC__) || defined(__clang__)
+    return all_tiles[__builtin_ctzll(set)];
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long idx;
+    _BitScanForward64(&idx, set);
+    return all_tiles[idx];
+#else
+    return all_tiles[tile_set_count((set & (~set + 1)) - 1)];
+#endif
+}
+
+/**
+ * @brief 将集合转换成牌
+ * @param [in] set 集合
+ * @param [out] tiles 牌
+ * @param [in] max_cnt 牌的最大数量
+ * @return intptr_t 牌的实际数量
+ */
+static inline intptr_t tile_set_to_tiles(tile_set_t set, tile_t *tiles, intptr_t max_cnt) {
+    intptr_t cnt = 0;
+    for (; set != 0 && cnt < max_cnt; set &= set - 1) {
+        tiles[cnt++] = tile_set_first(set);
+    }
+    return cnt;
+}
+
+/**
+ * @brief 集合转换成紧凑的掩码
+ *  集合中的牌的位置为0xFF，其余为0，可直接用于sum_tile_counts_masked
+ * @param [in] set 集合
+ * @param [out] mask 掩码
+ */
+static FORCE_INLINE void tile_set_to_tile_mask(tile_set_t set, tile_counts_t *mask) {
+    set &= TILE_SET_ALL;
+#if defined(TILE_COUNTS_SSE2)
+    // 每次取16位，低8位铺满前8字节、高8位铺满后8字节，再由各字节检查自己对应的位
+    const __m128i bit = _mm_set_epi8(-128, 64, 32, 16, 8, 4, 2, 1, -128, 64, 32, 16, 8, 4, 2, 1);
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        __m128i v = _mm_cvtsi32_si128(static_cast<int>((set >> b) & 0xFFFF));
+        v = _mm_unpacklo_epi8(v, v);
+        v = _mm_unpacklo_epi16(v, v);
+        v = _mm_unpacklo_epi32(v, v);
+        _mm_store_si128(reinterpret_cast<__m128i *>(&mask->counts[b]), _mm_cmpeq_epi8(_mm_and_si128(v, bit), bit));
+    }
+#elif defined(TILE_COUNTS_NEON)
+    static const uint8_t bits[16] = { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+    const uint8x16_t bit = vld1q_u8(bits);
+    for (int b = 0; b < TILE_COUNTS_SIZE; b += 16) {
+        uint8x16_t v = vcombine_u8(vdup_n_u8(static_cast<uint8_t>(set >> b)), vdup_n_u8(static_cast<uint8_t>(set >> (b + 8))));
+        vst1q_u8(&mask->counts[b], vtstq_u8(v, bit));
+    }
+#else
+    clear_tile_counts(mask);
+    for (int i = 0; i < 34; ++i) {
+        mask->counts[i] = ((set >> i) & 1) ? 0xFF : 0;
+    }
+#endif
+}
+
+/**
+ * @brief 集合中的牌在紧凑牌表中的总张数
+ *  例如传入剩余的牌，即得到有效牌的枚数
+ * @param [in] set 集合
+ * @param [in] counts 紧凑牌表
+ * @return int 总张数
+ */
+static FORCE_INLINE int tile_set_weighted_count(tile_set_t set, const tile_counts_t &counts) {
+#if defined(TILE_COUNTS_SSE2) || defined(TILE_COUNTS_NEON)
+    tile_counts_t mask;
+    tile_set_to_tile_mask(set, &mask);
+    return sum_tile_counts_masked(counts, mask);
+#else
+    int sum = 0;
+    for (; set != 0; set &= set - 1) {
+        sum += counts.counts[tile_counts_index(tile_set_first(set))];
+    }
+    return sum;
+#endif
+}
+
+/**
+ * @brief 标记表转换成集合
+ * @param [in] table 标记表，如useful_table_t
+ * @return tile_set_t 集合
+ */
+static FORCE_INLINE tile_set_t table_to_tile_set(const bool (&table)[TILE_TABLE_SIZE]) {
+    tile_set_t set = 0;
+#if defined(TILE_COUNTS_SSE2)
+    // 每门数牌在表中占0x10开始的16字节，bool只有0和1，左移7位后取各字节最高位
+    for (int s = 0; s < 3; ++s) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(&table[0x10 * (s + 1)]));
+        unsigned mask = static_cast<unsigned>(_mm_movemask_epi8(_mm_slli_epi16(v, 7)));
+        set |= static_cast<tile_set_t>((mask >> 1) & 0x1FF) << (s * 9);
+    }
+    // 字牌后面不足16字节，逐个处理
+    for (int i = 27; i < 34; ++i) {
+        set |= static_cast<tile_set_t>(table[all_tiles[i]]) << i;
+    }
+#else
+    for (int i = 0; i < 34; ++i) {
+        set |= static_cast<tile_set_t>(table[all_tiles[i]]) << i;
+    }
+#endif
+    return set;
+}
+
+/**
+ * @brief 集合转换成标记表
+ * @param [in] set 集合
+ * @param [out] table 标记表，如useful_table_t
+ */
+static FORCE_INLINE void tile_set_to_table(tile_set_t set, bool (*table)[TILE_TABLE_SIZE]) {
+    memset(*table, 0, sizeof(*table));
+    for (; set != 0; set &= set - 1) {
+        (*table)[tile_set_first(set)] = true;
+    }
+}
+
+}
+
+#endif
@@ -2,15 +2,33 @@
 #include "shanten.h"
 #include "stringify.h"
 #include "fan_calculator.h"
+#include "shanten_cache.h"
+#include "fan_cache.h"
+#include "hand_code.h"
+#include "win_rate.h"
+#include "worker_pool.h"
 
 #include <stdio.h>
 #include <iostream>
 #include <limits>
 #include <assert.h>
 #include <time.h>
+#include <string.h>
+#include <math.h>
+#include <random>
+#include <algorithm>
+#include <vector>
+#include <string>
+#include <set>
+#include <numeric>
+#include <chrono>
+#include <atomic>
 
 using namespace mahjong;
 
+// 各项测试中不一致的总数，不为0时main返回1
+static int mismatch_total = 0;
+
 static int count_useful_tile(const tile_table_t &used_table, const useful_table_t &useful_table) {
     int cnt = 0;
     for (int i = 0; i < 34; ++i) {
@@ -142,11 +160,1715 @@ void test_shanten(const char *str) {
     puts("\n");
 }
 
+// 从洗好的牌墙中取出若干张牌
+static void random_tiles(std::mt19937 &rng, tile_t *tiles, intptr_t cnt) {
+    tile_t wall[136];
+    for (int i = 0; i < 136; ++i) {
+        wall[i] = all_tiles[i / 4];
+    }
+    std::shuffle(std::begin(wall), std::end(wall), rng);
+    memcpy(tiles, wall, cnt * sizeof(tile_t));
+}
+
+// 比较递归搜索与查表两种计算方式的上听数与有效牌
+void test_basic_form_engine(int count) {
+    std::mt19937 rng(20190101);
+    static const intptr_t standing_cnts[] = { 13, 10, 7, 4, 1 };
+    std::vector<tile_t> hands(count * 13);
+    for (int i = 0; i < count; ++i) {
+        random_tiles(rng, &hands[i * 13], standing_cnts[i % 5]);
+    }
+
+    // 查找表在首次使用时生成，单独计时
+    set_basic_form_engine(BASIC_FORM_ENGINE_TABLE);
+    clock_t build_start = clock();
+    const tile_t warm_up = TILE_1m;
+    basic_form_shanten(&warm_up, 1, nullptr);
+    clock_t elapsed_build = clock() - build_start;
+
+    // 两种方式各自整批计算，分别计时只算上听数与同时获取有效牌
+    struct result_t {
+        int shanten;
+        int shanten_with_useful;
+        useful_table_t useful_table;
+    };
+    std::vector<result_t> results[2];
+    clock_t elapsed[2], elapsed_useful[2];
+    for (int k = 0; k < 2; ++k) {
+        set_basic_form_engine(k == 0 ? BASIC_FORM_ENGINE_RECURSIVE : BASIC_FORM_ENGINE_TABLE);
+        results[k].resize(count);
+        clock_t start = clock();
+        for (int i = 0; i < count; ++i) {
+            results[k][i].shanten = basic_form_shanten(&hands[i * 13], standing_cnts[i % 5], nullptr);
+        }
+        clock_t mid = clock();
+        for (int i = 0; i < count; ++i) {
+            results[k][i].shanten_with_useful = basic_form_shanten(&hands[i * 13], standing_cnts[i % 5], &results[k][i].useful_table);
+        }
+        elapsed[k] = mid - start;
+        elapsed_useful[k] = clock() - mid;
+    }
+    set_basic_form_engine(BASIC_FORM_DEFAULT_ENGINE);
+
+    int mismatch = 0;
+    for (int i = 0; i < count; ++i) {
+        const result_t &a = results[0][i], &b = results[1][i];
+        if (a.shanten != b.shanten || a.shanten_with_useful != a.shanten || b.shanten_with_useful != a.shanten
+            || memcmp(a.useful_table, b.useful_table, sizeof(useful_table_t)) != 0) {
+            char buf[64];
+            tiles_to_string(&hands[i * 13], standing_cnts[i % 5], buf, sizeof(buf));
+            printf("mismatch: %s %d %d\n", buf, a.shanten, b.shanten);
+            ++mismatch;
+        }
+    }
+
+    printf("%d hands, %d mismatch, table warm-up %ld ms, shanten: recursive %ld ms, table %ld ms, with useful tiles: recursive %ld ms, table %ld ms\n",
+        count, mismatch, static_cast<long>(elapsed_build * 1000 / CLOCKS_PER_SEC),
+        static_cast<long>(elapsed[0] * 1000 / CLOCKS_PER_SEC), static_cast<long>(elapsed[1] * 1000 / CLOCKS_PER_SEC),
+        static_cast<long>(elapsed_useful[0] * 1000 / CLOCKS_PER_SEC), static_cast<long>(elapsed_useful[1] * 1000 / CLOCKS_PER_SEC));
+    mismatch_total += mismatch;
+}
+
+// 增量计算器模拟摸打，与从头计算的结果比较
+void test_basic_form_analyzer(int count) {
+    std::mt19937 rng(20190102);
+    int mismatch = 0;
+
+    tile_t tiles[14];
+    random_tiles(rng, tiles, 13);
+    basic_form_analyzer_t analyzer;
+    analyzer.reset(tiles, 13);
+
+    for (int i = 0; i < count; ++i) {
+        // 摸一张牌，再随机打出一张
+        tile_t draw;
+        do {
+            draw = all_tiles[rng() % 34];
+        } while (!analyzer.add_tile(draw));
+        intptr_t cnt = table_to_tiles(analyzer.cnt_table(), tiles, 14);
+        analyzer.remove_tile(tiles[rng() % cnt]);
+        cnt = table_to_tiles(analyzer.cnt_table(), tiles, 14);
+
+        useful_table_t useful_table[2];
+        int ret0 = basic_form_shanten(tiles, cnt, &useful_table[0]);
+        int ret1 = analyzer.useful(&useful_table[1]);
+        if (ret0 != ret1 || ret1 != analyzer.shanten() || memcmp(useful_table[0], useful_table[1], sizeof(useful_table_t)) != 0) {
+            char buf[64];
+            tiles_to_string(tiles, cnt, buf, sizeof(buf));
+            printf("mismatch: %s %d %d\n", buf, ret0, ret1);
+            ++mismatch;
+        }
+    }
+
+    printf("%d steps, %d mismatch\n", count, mismatch);
+    mismatch_total += mismatch;
+}
+
+// 记录回调结果，达到上限后停止枚举
+struct enum_record_t {
+    std::vector<enum_result_t> results;
+    size_t limit;
+};
+
+static bool record_enum_result(void *context, const enum_result_t *result) {
+    enum_record_t *record = static_cast<enum_record_t *>(context);
+    record->results.push_back(*result);
+    return record->results.size() < record->limit;
+}
+
+static bool is_enum_record_equal(const enum_record_t &a, const enum_record_t &b) {
+    if (a.results.size() != b.results.size()) return false;
+    for (size_t i = 0; i < a.results.size(); ++i) {
+        const enum_result_t &x = a.results[i], &y = b.results[i];
+        if (x.discard_tile != y.discard_tile || x.form_flag != y.form_flag || x.shanten != y.shanten
+            || memcmp(x.useful_table, y.useful_table, sizeof(useful_table_t)) != 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 比较单线程与多线程枚举打哪张牌的回调顺序与结果，包括中途取消的情况
+void test_enum_discard_tile_parallel(int count) {
+    std::mt19937 rng(20190103);
+    int mismatch = 0;
+    std::chrono::steady_clock::duration elapsed[2] = {};  // 多线程时clock统计的是总的CPU时间，所以改用墙上时间
+
+    for (int i = 0; i < count; ++i) {
+        tile_t tiles[14];
+        random_tiles(rng, tiles, 14);
+        hand_tiles_t hand_tiles;
+        memset(&hand_tiles, 0, sizeof(hand_tiles));
+        memcpy(hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        hand_tiles.tile_count = 13;
+
+        // 一半完整枚举，一半随机在中途取消
+        size_t limit = (i & 1) ? rng() % 40 + 1 : std::numeric_limits<size_t>::max();
+        enum_record_t record[2];
+        record[0].limit = record[1].limit = limit;
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+        enum_discard_tile(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record[0], &record_enum_result);
+        elapsed[0] += std::chrono::steady_clock::now() - start;
+
+        start = std::chrono::steady_clock::now();
+        enum_discard_tile_parallel(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record[1], &record_enum_result, 4);
+        elapsed[1] += std::chrono::steady_clock::now() - start;
+
+        if (!is_enum_record_equal(record[0], record[1])) {
+            char buf[64];
+            tiles_to_string(tiles, 14, buf, sizeof(buf));
+            printf("mismatch: %s %d %d\n", buf, static_cast<int>(record[0].results.size()), static_cast<int>(record[1].results.size()));
+            ++mismatch;
+        }
+    }
+
+    printf("%d hands, %d mismatch, serial %ld ms, 4 threads %ld ms\n", count, mismatch,
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed[0]).count()),
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed[1]).count()));
+    mismatch_total += mismatch;
+}
+
+// 统计回调次数
+static bool count_enum_result(void *context, const enum_result_t *result) {
+    (void)result;
+    ++*static_cast<int *>(context);
+    return true;
+}
+
+// 不同和型组合下枚举打哪张牌的耗时
+void test_enum_discard_tile_form_flag(int count) {
+    static const uint8_t form_flags[] = {
+        FORM_FLAG_BASIC_FORM,
+        FORM_FLAG_BASIC_FORM | FORM_FLAG_SEVEN_PAIRS,
+        FORM_FLAG_BASIC_FORM | FORM_FLAG_KNITTED_STRAIGHT,
+        FORM_FLAG_SEVEN_PAIRS | FORM_FLAG_THIRTEEN_ORPHANS | FORM_FLAG_HONORS_AND_KNITTED_TILES,
+        FORM_FLAG_ALL
+    };
+
+    for (uint8_t form_flag : form_flags) {
+        std::mt19937 rng(20190104);  // 每种组合使用同样的手牌
+        int callback_cnt = 0;
+        clock_t start = clock();
+        for (int i = 0; i < count; ++i) {
+            tile_t tiles[14];
+            random_tiles(rng, tiles, 14);
+            hand_tiles_t hand_tiles;
+            memset(&hand_tiles, 0, sizeof(hand_tiles));
+            memcpy(hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+            hand_tiles.tile_count = 13;
+            enum_discard_tile(&hand_tiles, tiles[13], form_flag, &callback_cnt, &count_enum_result);
+        }
+        printf("form flag 0x%02X: %d callbacks, %ld ms\n", form_flag, callback_cnt,
+            static_cast<long>((clock() - start) * 1000 / CLOCKS_PER_SEC));
+    }
+}
+
+// 比较缓存与直接计算的结果，同一手牌再随机变换一次，应当命中缓存
+void test_shanten_cache(int count) {
+    std::mt19937 rng(20190105);
+    shanten_cache_t cache(1024);
+    shanten_cache_t sharded_cache(1024, 8);
+    int mismatch = 0;
+    tile_t tiles[14];
+
+    for (int i = 0; i < count * 2; ++i) {
+        if (i & 1) {  // 把上一手牌随机变换一下
+            tile_transform_t transform;
+            static const uint8_t perms[6][3] = { { 0, 1, 2 }, { 0, 2, 1 }, { 1, 0, 2 }, { 1, 2, 0 }, { 2, 0, 1 }, { 2, 1, 0 } };
+            memcpy(transform.suit_map, perms[rng() % 6], 3);
+            transform.reflect = (rng() & 1) != 0;
+            for (int k = 0; k < 14; ++k) {
+                tiles[k] = transform_tile(transform, tiles[k]);
+            }
+        }
+        else {
+            random_tiles(rng, tiles, 14);
+        }
+        hand_tiles_t hand_tiles;
+        memset(&hand_tiles, 0, sizeof(hand_tiles));
+        memcpy(hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        hand_tiles.tile_count = 13;
+
+        useful_table_t useful_table[2];
+        int ret0 = basic_form_shanten(tiles, 13, &useful_table[0]);
+        int ret1 = cache.basic_form_shanten(tiles, 13, &useful_table[1]);
+        bool equal = (ret0 == ret1 && memcmp(useful_table[0], useful_table[1], sizeof(useful_table_t)) == 0);
+
+        memset(useful_table, 0, sizeof(useful_table));
+        bool waiting0 = is_waiting(hand_tiles, &useful_table[0]);
+        bool waiting1 = cache.is_waiting(hand_tiles, &useful_table[1]);
+        equal = equal && waiting0 == waiting1 && memcmp(useful_table[0], useful_table[1], sizeof(useful_table_t)) == 0;
+
+        enum_record_t record[2];
+        record[0].limit = record[1].limit = std::numeric_limits<size_t>::max();
+        enum_discard_tile(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record[0], &record_enum_result);
+        cache.enum_discard_tile(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record[1], &record_enum_result);
+        equal = equal && is_enum_record_equal(record[0], record[1]);
+
+        // 分片的缓存结果相同
+        record[1].results.clear();
+        sharded_cache.enum_discard_tile(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record[1], &record_enum_result);
+        equal = equal && is_enum_record_equal(record[0], record[1]);
+
+        if (!equal) {
+            char buf[64];
+            tiles_to_string(tiles, 14, buf, sizeof(buf));
+            printf("mismatch: %s\n", buf);
+            ++mismatch;
+        }
+    }
+
+    printf("%d hands, %d mismatch, %d hits, %d misses, sharded %d hits\n", count * 2, mismatch,
+        static_cast<int>(cache.hit_count()), static_cast<int>(cache.miss_count()), static_cast<int>(sharded_cache.hit_count()));
+    mismatch_total += mismatch;
+}
+
+// 递归判断基本和型是否和牌，定义在shanten.cpp中
+namespace mahjong {
+    static bool is_basic_form_win_recursively(tile_table_t &cnt_table, intptr_t left_cnt);
+}
+
+// 查表与递归两种方式判断基本和型是否和牌
+// 对一门数牌的每种张数组合（不超过14张），放到某一门，再用字牌的刻子、雀头或者孤张补足14张，
+// 由于查表时各门牌互不影响，这样即可覆盖每门牌的所有情况
+void test_basic_form_win_table() {
+    int cnt[9] = { 0 };
+    int total = 0, win = 0, mismatch = 0;
+    clock_t start = clock();
+    for (uint32_t key = 0; key < 1953125; ++key) {
+        if (key > 0) {
+            for (int i = 0; ++cnt[i] == 5; ++i) {
+                cnt[i] = 0;
+            }
+        }
+
+        int sum = 0;
+        for (int i = 0; i < 9; ++i) {
+            sum += cnt[i];
+        }
+        if (sum > 14) {
+            continue;
+        }
+
+        tile_t tiles[14];
+        intptr_t tile_cnt = 0;
+        suit_t suit = static_cast<suit_t>(key % 3 + 1);
+        for (int i = 0; i < 9; ++i) {
+            for (int k = 0; k < cnt[i]; ++k) {
+                tiles[tile_cnt++] = make_tile(suit, static_cast<rank_t>(i + 1));
+            }
+        }
+
+        // 用字牌补足14张：余2张时补刻子，余0张时补雀头和刻子，余1张时补孤张和刻子
+        int left = 14 - sum;
+        rank_t honor = 1;
+        if (left % 3 == 2) {
+            tiles[tile_cnt++] = make_tile(TILE_SUIT_HONORS, honor);
+            tiles[tile_cnt++] = make_tile(TILE_SUIT_HONORS, honor);
+            ++honor;
+        }
+        else if (left % 3 == 1) {
+            tiles[tile_cnt++] = make_tile(TILE_SUIT_HONORS, honor);
+            ++honor;
+        }
+        while (tile_cnt < 14) {
+            for (int k = 0; k < 3; ++k) {
+                tiles[tile_cnt++] = make_tile(TILE_SUIT_HONORS, honor);
+            }
+            ++honor;
+        }
+
+        tile_table_t cnt_table;
+        map_tiles(tiles, 14, &cnt_table);
+        bool ret0 = is_basic_form_win_recursively(cnt_table, 14);
+        bool ret1 = is_basic_form_win(tiles, 13, tiles[13]);
+        ++total;
+        if (ret1) ++win;
+        if (ret0 != ret1) {
+            char buf[64];
+            tiles_to_string(tiles, 14, buf, sizeof(buf));
+            printf("mismatch: %s %d %d\n", buf, ret0, ret1);
+            ++mismatch;
+        }
+    }
+
+    printf("%d hands, %d win, %d mismatch, %ld ms\n", total, win, mismatch,
+        static_cast<long>((clock() - start) * 1000 / CLOCKS_PER_SEC));
+    mismatch_total += mismatch;
+}
+
+// 紧凑牌表的各项操作与牌的数量表的结果比较
+void test_tile_counts(int count) {
+    std::mt19937 rng(20190103);
+    static const intptr_t standing_cnts[] = { 13, 10, 7, 4, 1 };
+    int mismatch = 0;
+
+    for (int i = 0; i < count; ++i) {
+        tile_t tiles[14];
+        intptr_t cnt = standing_cnts[i % 5];
+        random_tiles(rng, tiles, cnt + 1);
+
+        tile_table_t cnt_table, cnt_table2;
+        map_tiles(tiles, cnt, &cnt_table);
+        tile_counts_t counts;
+        map_tiles_to_counts(tiles, cnt, &counts);
+        tile_counts_to_table(counts, &cnt_table2);
+
+        tile_counts_t counts2;
+        table_to_tile_counts(cnt_table, &counts2);
+
+        tile_t tiles1[14], tiles2[14];
+        intptr_t cnt1 = table_to_tiles(cnt_table, tiles1, 14);
+        intptr_t cnt2 = tile_counts_to_tiles(counts, tiles2, 14);
+
+        bool ok = memcmp(cnt_table, cnt_table2, sizeof(tile_table_t)) == 0
+            && memcmp(counts.counts, counts2.counts, sizeof(counts.counts)) == 0
+            && cnt1 == cnt2 && memcmp(tiles1, tiles2, cnt1 * sizeof(tile_t)) == 0
+            && sum_tile_counts(counts) == cnt;
+
+        // 两种计算方式的上听数和有效牌
+        int ret = 0;
+        useful_table_t useful_table;
+        for (int k = 0; k < 2 && ok; ++k) {
+            set_basic_form_engine(k == 0 ? BASIC_FORM_ENGINE_RECURSIVE : BASIC_FORM_ENGINE_TABLE);
+            useful_table_t useful_table2;
+            ret = basic_form_shanten(tiles, cnt, &useful_table);
+            ok = basic_form_shanten_counts(counts, &useful_table2) == ret
+                && memcmp(useful_table, useful_table2, sizeof(useful_table_t)) == 0;
+        }
+
+        // 有效牌的剩余张数
+        tile_counts_t remain;
+        remaining_tile_counts(counts, &remain);
+        ok = ok && count_useful_tiles(remain, useful_table) == count_useful_tile(cnt_table, useful_table);
+
+        // 加上一张牌判断和牌
+        ++counts.counts[tile_counts_index(tiles[cnt])];
+        ok = ok && is_basic_form_win_counts(counts) == is_basic_form_win(tiles, cnt, tiles[cnt]);
+
+        if (!ok) {
+            char buf[64];
+            tiles_to_string(tiles, cnt + 1, buf, sizeof(buf));
+            printf("mismatch: %s\n", buf);
+            ++mismatch;
+        }
+    }
+    set_basic_form_engine(BASIC_FORM_DEFAULT_ENGINE);
+
+    // 和牌的判断多测一些和牌型：随机组成4组面子加1组雀头，再随机换掉一张
+    int win_cnt = 0;
+    for (int i = 0; i < count; ++i) {
+        tile_t tiles[14];
+        intptr_t cnt = 0;
+        for (int k = 0; k < 5; ++k) {
+            tile_t t = all_tiles[rng() % 34];
+            if (k == 4) {
+                tiles[cnt++] = t;
+                tiles[cnt++] = t;
+            }
+            else if (is_numbered_suit_quick(t) && tile_get_rank(t) <= 7 && rng() % 2 == 0) {
+                tiles[cnt++] = t;
+                tiles[cnt++] = t + 1;
+                tiles[cnt++] = t + 2;
+            }
+            else {
+                tiles[cnt++] = t;
+                tiles[cnt++] = t;
+                tiles[cnt++] = t;
+            }
+        }
+        if (rng() % 2 == 0) {
+            tiles[rng() % 14] = all_tiles[rng() % 34];
+        }
+
+        tile_counts_t counts;
+        map_tiles_to_counts(tiles, 14, &counts);
+        bool win = is_basic_form_win(tiles, 13, tiles[13]);
+        if (is_basic_form_win_counts(counts) != win) {
+            char buf[64];
+            tiles_to_string(tiles, 14, buf, sizeof(buf));
+            printf("mismatch: %s\n", buf);
+            ++mismatch;
+        }
+        win_cnt += win;
+    }
+
+    printf("%d hands, %d wins, %d mismatch\n", count * 2, win_cnt, mismatch);
+    mismatch_total += mismatch;
+}
+
+// 随机组成4组面子加1组雀头，再随机选一张作为最后一张，前13张即为听牌的立牌
+static void random_win_tiles(std::mt19937 &rng, tile_t (&tiles)[14]) {
+    tile_table_t cnt_table;
+    do {
+        intptr_t cnt = 0;
+        for (int k = 0; k < 5; ++k) {
+            tile_t t = all_tiles[rng() % 34];
+            if (k == 4) {
+                tiles[cnt++] = t;
+                tiles[cnt++] = t;
+            }
+            else if (is_numbered_suit_quick(t) && tile_get_rank(t) <= 7 && rng() % 2 == 0) {
+                tiles[cnt++] = t;
+                tiles[cnt++] = t + 1;
+                tiles[cnt++] = t + 2;
+            }
+            else {
+                tiles[cnt++] = t;
+                tiles[cnt++] = t;
+                tiles[cnt++] = t;
+            }
+        }
+        map_tiles(tiles, 14, &cnt_table);
+    } while (std::any_of(std::begin(cnt_table), std::end(cnt_table), [](int n) { return n > 4; }));
+    std::swap(tiles[rng() % 14], tiles[13]);
+}
+
+static bool record_enum_result_bits(void *context, const enum_result_bits_t *result) {
+    static_cast<std::vector<enum_result_bits_t> *>(context)->push_back(*result);
+    return true;
+}
+
+// 牌集合版本的各接口与标记表版本的结果比较
+void test_tile_set(int count) {
+    typedef int (*shanten_func_t)(const tile_t *, intptr_t, useful_table_t *);
+    typedef int (*shanten_bits_func_t)(const tile_t *, intptr_t, tile_set_t *);
+    static const shanten_func_t funcs[] = {
+        &basic_form_shanten, &seven_pairs_shanten, &thirteen_orphans_shanten,
+        &knitted_straight_shanten, &honors_and_knitted_tiles_shanten
+    };
+    static const shanten_bits_func_t bits_funcs[] = {
+        &basic_form_shanten_bits, &seven_pairs_shanten_bits, &thirteen_orphans_shanten_bits,
+        &knitted_straight_shanten_bits, &honors_and_knitted_tiles_shanten_bits
+    };
+
+    std::mt19937 rng(20190104);
+    int mismatch = 0, waiting_cnt = 0;
+
+    for (int i = 0; i < count; ++i) {
+        tile_t tiles[14];
+        if (i % 2 == 0) {
+            random_tiles(rng, tiles, 14);
+        }
+        else {
+            random_win_tiles(rng, tiles);
+        }
+        tile_table_t cnt_table;
+        map_tiles(tiles, 13, &cnt_table);
+        bool ok = true;
+
+        // 各和型的上听数与有效牌
+        for (int k = 0; k < 5 && ok; ++k) {
+            useful_table_t useful_table;
+            tile_set_t useful_set;
+            int ret = funcs[k](tiles, 13, &useful_table);
+            ok = bits_funcs[k](tiles, 13, &useful_set) == ret;
+            if (ok && ret != std::numeric_limits<int>::max()) {
+                useful_table_t temp_table;
+                tile_set_to_table(useful_set, &temp_table);
+                tile_t useful_tiles[34];
+                intptr_t useful_cnt = tile_set_to_tiles(useful_set, useful_tiles, 34);
+                tile_counts_t counts, remain, masks[2];
+                map_tiles_to_counts(tiles, 13, &counts);
+                remaining_tile_counts(counts, &remain);
+                tile_set_to_tile_mask(useful_set, &masks[0]);
+                useful_table_to_tile_mask(useful_table, &masks[1]);
+                ok = memcmp(useful_table, temp_table, sizeof(useful_table_t)) == 0
+                    && memcmp(&masks[0], &masks[1], sizeof(tile_counts_t)) == 0
+                    && useful_cnt == tile_set_count(useful_set)
+                    && useful_cnt == std::count(std::begin(useful_table), std::end(useful_table), true)
+                    && tile_set_weighted_count(useful_set, remain) == count_useful_tile(cnt_table, useful_table);
+            }
+        }
+
+        // 是否听牌
+        hand_tiles_t hand_tiles;
+        hand_tiles.pack_count = 0;
+        memcpy(hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        hand_tiles.tile_count = 13;
+        if (ok) {
+            useful_table_t waiting_table;
+            tile_set_t waiting_set;
+            bool waiting = is_waiting(hand_tiles, &waiting_table);
+            ok = is_waiting_bits(hand_tiles, &waiting_set) == waiting
+                && (!waiting || waiting_set == table_to_tile_set(waiting_table));
+            waiting_cnt += waiting;
+        }
+
+        // 枚举打哪张牌
+        if (ok) {
+            enum_record_t record;
+            record.limit = static_cast<size_t>(-1);
+            std::vector<enum_result_bits_t> results;
+            enum_discard_tile(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record, &record_enum_result);
+            enum_discard_tile_bits(&hand_tiles, tiles[13], FORM_FLAG_ALL, &results, &record_enum_result_bits);
+            ok = record.results.size() == results.size();
+            for (size_t k = 0; k < results.size() && ok; ++k) {
+                const enum_result_t &x = record.results[k];
+                const enum_result_bits_t &y = results[k];
+                ok = x.discard_tile == y.discard_tile && x.form_flag == y.form_flag && x.shanten == y.shanten
+                    && (x.shanten == std::numeric_limits<int>::max() || table_to_tile_set(x.useful_table) == y.useful_set);
+            }
+        }
+
+        if (!ok) {
+            char buf[64];
+            tiles_to_string(tiles, 14, buf, sizeof(buf));
+            printf("mismatch: %s\n", buf);
+            ++mismatch;
+        }
+    }
+
+    printf("%d hands, %d waiting, %d mismatch, sizeof(enum_result_t) %d, sizeof(enum_result_bits_t) %d\n", count, waiting_cnt, mismatch,
+        static_cast<int>(sizeof(enum_result_t)), static_cast<int>(sizeof(enum_result_bits_t)));
+    mismatch_total += mismatch;
+}
+
+// 多种划分的清一色手牌反复算番，看每种划分都要计算听牌方式时的耗时
+void test_calculate_fan_many_divisions(int count) {
+    static const char *strs[] = {
+        "1122233334444s2s", "1122233334444s1s", "1112222333344s4s", "1112223334445s5s",
+        "2223334445556s6s", "1112345678999s5s", "2233445566778s8s", "3334445556667s7s",
+    };
+    for (const char *str : strs) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        string_to_tiles(str, &param.hand_tiles, &param.win_tile);
+        param.prevalent_wind = wind_t::EAST;
+        param.seat_wind = wind_t::EAST;
+
+        int fan = 0;
+        clock_t start = clock();
+        for (int i = 0; i < count; ++i) {
+            fan_table_t fan_table;
+            fan = calculate_fan(&param, &fan_table);
+        }
+        clock_t elapsed = clock() - start;
+        printf("%s: %d fan, %d times %ld ms\n", str, fan, count, static_cast<long>(elapsed * 1000 / CLOCKS_PER_SEC));
+    }
+}
+
+// 批量算番与逐个算番的结果比较
+void test_calculate_fan_batch(int count) {
+    std::mt19937 rng(20190105);
+    std::vector<calculate_param_t> params(count);
+    for (calculate_param_t &param : params) {
+        memset(&param, 0, sizeof(param));
+        tile_t tiles[14];
+        random_win_tiles(rng, tiles);
+        memcpy(param.hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        param.hand_tiles.tile_count = 13;
+        param.win_tile = tiles[13];
+        param.win_flag = static_cast<win_flag_t>(rng() % 16);
+        param.prevalent_wind = static_cast<wind_t>(rng() % 4);
+        param.seat_wind = static_cast<wind_t>(rng() % 4);
+    }
+
+    std::vector<int> fans[3];
+    std::unique_ptr<fan_table_t[]> fan_tables[2] = { std::unique_ptr<fan_table_t[]>(new fan_table_t[count]),
+        std::unique_ptr<fan_table_t[]>(new fan_table_t[count]) };
+    for (int k = 0; k < 3; ++k) {
+        fans[k].resize(count);
+    }
+
+    clock_t start = clock();
+    for (int i = 0; i < count; ++i) {
+        fans[0][i] = calculate_fan(&params[i], &fan_tables[0][i]);
+    }
+    clock_t elapsed = clock() - start;
+
+    auto wall_start = std::chrono::steady_clock::now();
+    calculate_fan_batch(&params[0], count, &fan_tables[1][0], &fans[1][0], 4);
+    auto wall_elapsed = std::chrono::steady_clock::now() - wall_start;
+    calculate_fan_batch(&params[0], count, nullptr, &fans[2][0], 0);
+
+    int mismatch = 0;
+    for (int i = 0; i < count; ++i) {
+        if (fans[0][i] != fans[1][i] || fans[0][i] != fans[2][i]
+            || (fans[0][i] > 0 && memcmp(fan_tables[0][i], fan_tables[1][i], sizeof(fan_table_t)) != 0)) {
+            ++mismatch;
+        }
+    }
+    printf("%d hands, %d mismatch, serial %ld ms, 4 threads %ld ms\n", count, mismatch,
+        static_cast<long>(elapsed * 1000 / CLOCKS_PER_SEC),
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(wall_elapsed).count()));
+    mismatch_total += mismatch;
+}
+
+// 各规则集的算番，以及运行时选择规则集的结果与直接实例化的一致
+void test_rule_sets(int count) {
+    static const char *strs[] = {
+        "112233m112233s1p1p", "1199m1199s1199p1z1z", "123m123s123p789p1z1z",
+        "[1111m][2222s,1]345p678s9p9p",  // 明暗杠只在通行计法中计
+    };
+    for (const char *str : strs) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        string_to_tiles(str, &param.hand_tiles, &param.win_tile);
+        param.prevalent_wind = wind_t::EAST;
+        param.seat_wind = wind_t::EAST;
+        printf("%s: default %d fan, strict 98 %d fan\n", str, calculate_fan<rules_default_t>(&param, nullptr),
+            calculate_fan<rules_98_strict_t>(&param, nullptr));
+    }
+
+    std::mt19937 rng(20261017);
+    int mismatch = 0, differ = 0;
+    for (int n = 0; n < count; ++n) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        tile_t tiles[14];
+        random_win_tiles(rng, tiles);
+        memcpy(param.hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        param.hand_tiles.tile_count = 13;
+        param.win_tile = tiles[13];
+        param.win_flag = static_cast<win_flag_t>(rng() % 16);
+        param.prevalent_wind = static_cast<wind_t>(rng() % 4);
+        param.seat_wind = static_cast<wind_t>(rng() % 4);
+
+        fan_table_t fan_tables[4];
+        int fans[5];
+        fans[0] = calculate_fan<rules_default_t>(&param, &fan_tables[0]);
+        fans[1] = calculate_fan(&param, &fan_tables[1], rule_set_t::DEFAULT);
+        fans[2] = calculate_fan<rules_98_strict_t>(&param, &fan_tables[2]);
+        fans[3] = calculate_fan(&param, &fan_tables[3], rule_set_t::STRICT_98);
+        fans[4] = calculate_fan(&param, nullptr);
+        if (fans[0] != fans[1] || fans[0] != fans[4] || fans[2] != fans[3]
+            || (fans[0] > 0 && memcmp(fan_tables[0], fan_tables[1], sizeof(fan_table_t)) != 0)
+            || (fans[2] > 0 && memcmp(fan_tables[2], fan_tables[3], sizeof(fan_table_t)) != 0)) {
+            ++mismatch;
+        }
+        if (fans[0] != fans[2]) {
+            ++differ;
+        }
+    }
+    printf("%d hands, %d mismatch, %d differ between rule sets\n", count, mismatch, differ);
+    mismatch_total += mismatch;
+}
+
+// 听牌时一次算出所有和牌张的番，与逐张逐个和牌标记调用calculate_fan的结果比较
+void test_calculate_fan_for_waits(int count) {
+    win_flag_t win_flags[32];
+    for (int i = 0; i < 32; ++i) {
+        win_flags[i] = static_cast<win_flag_t>(i);
+    }
+
+    std::mt19937 rng(20261018);
+    std::vector<calculate_param_t> params;
+    for (int n = 0; n < count; ++n) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        tile_t tiles[14];
+        random_win_tiles(rng, tiles);
+        param.prevalent_wind = static_cast<wind_t>(rng() % 4);
+        param.seat_wind = static_cast<wind_t>(rng() % 4);
+
+        // 一半的手牌把前3张作为副露
+        if (n % 2 == 1 && (tiles[0] == tiles[1] ? tiles[1] == tiles[2] : (tiles[1] == tiles[0] + 1 && tiles[2] == tiles[0] + 2))) {
+            param.hand_tiles.fixed_packs[0] = make_pack(1, tiles[0] == tiles[1] ? PACK_TYPE_PUNG : PACK_TYPE_CHOW, tiles[1]);
+            param.hand_tiles.pack_count = 1;
+            memcpy(param.hand_tiles.standing_tiles, tiles + 3, 10 * sizeof(tile_t));
+            param.hand_tiles.tile_count = 10;
+        }
+        else {
+            memcpy(param.hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+            param.hand_tiles.tile_count = 13;
+        }
+        params.push_back(param);
+    }
+
+    int total = 0, mismatch = 0;
+    std::vector<waiting_fan_t> results(34 * 32);
+    clock_t elapsed_waits = 0, elapsed_each = 0;
+    for (const calculate_param_t &param : params) {
+        clock_t start = clock();
+        intptr_t wait_cnt = calculate_fan_for_waits(&param, win_flags, 32, &results[0], static_cast<intptr_t>(results.size()));
+        elapsed_waits += clock() - start;
+
+        start = clock();
+        useful_table_t waiting_table;
+        is_waiting(param.hand_tiles, &waiting_table);
+        intptr_t k = 0;
+        for (int i = 0; i < 34; ++i) {
+            tile_t t = all_tiles[i];
+            if (!waiting_table[t] || check_calculator_input(&param.hand_tiles, t) != 0) {
+                continue;
+            }
+            calculate_param_t temp = param;
+            temp.win_tile = t;
+            for (int f = 0; f < 32; ++f, ++k) {
+                temp.win_flag = win_flags[f];
+                fan_table_t fan_table;
+                int fan = calculate_fan(&temp, &fan_table);
+                const waiting_fan_t &result = results[k];
+                ++total;
+                if (result.win_tile != t || result.win_flag != win_flags[f] || result.fan != fan
+                    || (fan > 0 && memcmp(result.fan_table, fan_table, sizeof(fan_table_t)) != 0)) {
+                    ++mismatch;
+                }
+            }
+        }
+        elapsed_each += clock() - start;
+        if (k != wait_cnt * 32) {
+            ++mismatch;
+        }
+    }
+
+    printf("%d hands, %d results, %d mismatch, one call %ld ms, separate calls %ld ms\n", count, total, mismatch,
+        static_cast<long>(elapsed_waits * 1000 / CLOCKS_PER_SEC), static_cast<long>(elapsed_each * 1000 / CLOCKS_PER_SEC));
+    mismatch_total += mismatch;
+}
+
+// 能否达到起和番与完整算番的结果比较
+void test_reaches_min_fan(int count) {
+    static const int thresholds[] = { 0, 1, 8, 9, 12, 16, 24, 32, 48, 64, 88 };
+    static const char *strs[] = {
+        "1122233334444s2s", "1112223334445s5s", "1112345678999s5s", "2233445566778s8s", "112233m112233s1p1p",
+    };
+
+    std::mt19937 rng(20261019);
+    std::vector<calculate_param_t> params;
+    for (const char *str : strs) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        string_to_tiles(str, &param.hand_tiles, &param.win_tile);
+        params.push_back(param);
+    }
+    for (int n = 0; n < count; ++n) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        tile_t tiles[14];
+        random_win_tiles(rng, tiles);
+        memcpy(param.hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        param.hand_tiles.tile_count = 13;
+        // 少数不和牌的
+        param.win_tile = n % 16 == 0 ? all_tiles[rng() % 34] : tiles[13];
+        param.flower_count = static_cast<uint8_t>(rng() % 3 == 0 ? rng() % 9 : 0);
+        param.win_flag = static_cast<win_flag_t>(rng() % 32);
+        param.prevalent_wind = static_cast<wind_t>(rng() % 4);
+        param.seat_wind = static_cast<wind_t>(rng() % 4);
+        params.push_back(param);
+    }
+
+    int mismatch = 0, reached = 0, total = 0;
+    for (const calculate_param_t &param : params) {
+        int fans[2] = { calculate_fan<rules_default_t>(&param, nullptr), calculate_fan<rules_98_strict_t>(&param, nullptr) };
+        for (int threshold : thresholds) {
+            bool results[2] = { reaches_min_fan<rules_default_t>(&param, threshold), reaches_min_fan<rules_98_strict_t>(&param, threshold) };
+            for (int k = 0; k < 2; ++k) {
+                ++total;
+                if (results[k] != (fans[k] > 0 && fans[k] >= threshold)) {
+                    ++mismatch;
+                }
+                if (results[k]) {
+                    ++reached;
+                }
+            }
+        }
+    }
+
+    // 起和番为8番时与完整算番的耗时
+    clock_t start = clock();
+    int cnt = 0;
+    for (const calculate_param_t &param : params) {
+        cnt += reaches_min_fan(&param, 8) ? 1 : 0;
+    }
+    clock_t elapsed_reach = clock() - start;
+    start = clock();
+    for (const calculate_param_t &param : params) {
+        cnt -= calculate_fan(&param, nullptr) >= 8 ? 1 : 0;
+    }
+    clock_t elapsed_full = clock() - start;
+
+    printf("%d checks, %d reached, %d mismatch, diff %d, reaches_min_fan %ld ms, calculate_fan %ld ms\n", total, reached, mismatch, cnt,
+        static_cast<long>(elapsed_reach * 1000 / CLOCKS_PER_SEC), static_cast<long>(elapsed_full * 1000 / CLOCKS_PER_SEC));
+    mismatch_total += mismatch;
+}
+
+// 算番缓存与直接算番的结果比较，立牌与副露顺序不同的同一手牌应当命中
+void test_fan_cache(int count) {
+    static const char *strs[] = {
+        "[234s][234s][234s][234s]6s6s", "[123m][789p]789s1299p3p", "[2222s][3333s][5555p,1]67mEE8m", "[EEE][WWW][NNN]11sSS1s",
+    };
+
+    std::mt19937 rng(20261020);
+    std::vector<calculate_param_t> uniques;
+    for (const char *str : strs) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        string_to_tiles(str, &param.hand_tiles, &param.win_tile);
+        uniques.push_back(param);
+    }
+    for (int n = 0; n < count; ++n) {
+        calculate_param_t param;
+        memset(&param, 0, sizeof(param));
+        tile_t tiles[14];
+        random_win_tiles(rng, tiles);
+        memcpy(param.hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        param.hand_tiles.tile_count = 13;
+        param.win_tile = tiles[13];
+        param.flower_count = static_cast<uint8_t>(rng() % 3);
+        param.win_flag = static_cast<win_flag_t>(rng() % 16);
+        param.prevalent_wind = static_cast<wind_t>(rng() % 4);
+        param.seat_wind = static_cast<wind_t>(rng() % 4);
+        uniques.push_back(param);
+    }
+
+    // 每手牌重复4次，打乱立牌与副露的顺序
+    std::vector<calculate_param_t> params;
+    for (const calculate_param_t &param : uniques) {
+        for (int k = 0; k < 4; ++k) {
+            calculate_param_t temp = param;
+            std::shuffle(temp.hand_tiles.standing_tiles, temp.hand_tiles.standing_tiles + temp.hand_tiles.tile_count, rng);
+            std::shuffle(temp.hand_tiles.fixed_packs, temp.hand_tiles.fixed_packs + temp.hand_tiles.pack_count, rng);
+            params.push_back(temp);
+        }
+    }
+    std::shuffle(params.begin(), params.end(), rng);
+
+    fan_cache_t cache(params.size(), 16);
+    int mismatch = 0;
+    for (const calculate_param_t &param : params) {
+        fan_table_t fan_tables[2] = { { 0 }, { 0 } };
+        int fans[2] = { calculate_fan(&param, &fan_tables[0]), cache.calculate_fan(&param, &fan_tables[1]) };
+        if (fans[0] != fans[1] || memcmp(fan_tables[0], fan_tables[1], sizeof(fan_table_t)) != 0) {
+            ++mismatch;
+        }
+    }
+    size_t hit = cache.hit_count(), miss = cache.miss_count();
+    if (miss != uniques.size() || hit != params.size() - uniques.size()) {
+        ++mismatch;
+    }
+
+    // 批量算番经过缓存，此时应当全部命中
+    const size_t size = params.size();
+    std::vector<int> fans[2] = { std::vector<int>(size), std::vector<int>(size) };
+    std::unique_ptr<fan_table_t[]> fan_tables[2] = { std::unique_ptr<fan_table_t[]>(new fan_table_t[size]),
+        std::unique_ptr<fan_table_t[]>(new fan_table_t[size]) };
+    calculate_fan_batch(&params[0], size, &fan_tables[0][0], &fans[0][0], 4);
+    clock_t start = clock();
+    calculate_fan_batch(&params[0], size, &fan_tables[1][0], &fans[1][0], 4, &cache);
+    clock_t elapsed = clock() - start;
+    for (size_t i = 0; i < size; ++i) {
+        if (fans[0][i] != fans[1][i] || (fans[0][i] > 0 && memcmp(fan_tables[0][i], fan_tables[1][i], sizeof(fan_table_t)) != 0)) {
+            ++mismatch;
+        }
+    }
+    if (cache.hit_count() != hit + size || cache.miss_count() != miss) {
+        ++mismatch;
+    }
+
+    // 容量很小时淘汰旧的结果，结果仍然正确
+    fan_cache_t small_cache(64, 4);
+    for (const calculate_param_t &param : params) {
+        if (small_cache.calculate_fan(&param, nullptr) != calculate_fan(&param, nullptr)) {
+            ++mismatch;
+        }
+    }
+
+    printf("%zu hands, %zu unique, %zu hit, %zu miss, %d mismatch, cached batch %ld ms, small cache %zu hit\n", size, uniques.size(),
+        hit, miss, mismatch, static_cast<long>(elapsed * 1000 / CLOCKS_PER_SEC), small_cache.hit_count());
+    mismatch_total += mismatch;
+}
+
+// 批量解析的结果收集
+struct parse_lines_context_t {
+    std::vector<parse_line_result_t> results;
+    size_t base;  // 分块解析时这一块在整个缓冲区中的偏移
+};
+
+static bool collect_parse_line(void *context, const parse_line_result_t *result) {
+    parse_lines_context_t *ctx = static_cast<parse_lines_context_t *>(context);
+    ctx->results.push_back(*result);
+    ctx->results.back().line_offset += ctx->base;
+    ctx->results.back().error_offset += ctx->base;
+    return true;
+}
+
+static bool is_same_parse_result(const parse_line_result_t &a, const parse_line_result_t &b) {
+    return a.error == b.error && a.line_offset == b.line_offset && a.line_length == b.line_length
+        && (a.error == PARSE_NO_ERROR || a.error_offset == b.error_offset)
+        && a.serving_tile == b.serving_tile && a.hand_tiles.tile_count == b.hand_tiles.tile_count
+        && a.hand_tiles.pack_count == b.hand_tiles.pack_count
+        && memcmp(a.hand_tiles.standing_tiles, b.hand_tiles.standing_tiles, a.hand_tiles.tile_count * sizeof(tile_t)) == 0
+        && memcmp(a.hand_tiles.fixed_packs, b.hand_tiles.fixed_packs, a.hand_tiles.pack_count * sizeof(pack_t)) == 0;
+}
+
+// 批量解析与逐行调用string_to_tiles的结果比较，以及分块解析与整块解析的结果比较
+void test_parse_hand_lines(int count) {
+    static const char alphabet[] = "0123456789mpszESWNCFP,[]";
+    std::mt19937 rng(20261021);
+
+    // 随机的副露加立牌，以及随机字符
+    std::string buffer;
+    std::vector<std::string> lines;
+    for (int n = 0; n < count; ++n) {
+        char str[64];
+        if (n % 4 != 3) {
+            hand_tiles_t hand_tiles;
+            memset(&hand_tiles, 0, sizeof(hand_tiles));
+            hand_tiles.pack_count = static_cast<intptr_t>(rng() % 5);
+            for (intptr_t i = 0; i < hand_tiles.pack_count; ++i) {
+                uint8_t type = static_cast<uint8_t>(rng() % 3 + PACK_TYPE_CHOW);
+                tile_t tile = type == PACK_TYPE_CHOW ? make_tile(static_cast<suit_t>(rng() % 3 + 1), static_cast<rank_t>(rng() % 7 + 2))
+                    : all_tiles[rng() % 34];
+                hand_tiles.fixed_packs[i] = make_pack(static_cast<uint8_t>(rng() % 4), type, tile);
+            }
+            hand_tiles.tile_count = 13 - hand_tiles.pack_count * 3;
+            for (intptr_t i = 0; i < hand_tiles.tile_count; ++i) {
+                hand_tiles.standing_tiles[i] = all_tiles[rng() % 34];
+            }
+            intptr_t len = hand_tiles_to_string(&hand_tiles, str, sizeof(str));
+            tiles_to_string(&all_tiles[rng() % 34], 1, str + len, sizeof(str) - len);
+        }
+        else {
+            int len = static_cast<int>(rng() % 24);
+            for (int i = 0; i < len; ++i) {
+                str[i] = rng() % 50 == 0 ? " x#"[rng() % 3] : alphabet[rng() % (sizeof(alphabet) - 1)];
+            }
+            str[len] = '\0';
+        }
+        lines.push_back(str);
+        buffer += str;
+        buffer += n % 7 == 0 ? "\r\n" : "\n";
+    }
+    buffer.pop_back();  // 最后一行没有换行符
+
+    // 逐行调用string_to_tiles
+    std::vector<parse_line_result_t> expected(count);
+    size_t offset = 0;
+    for (int n = 0; n < count; ++n) {
+        // 按实际长度复制，越过结尾的读取能被AddressSanitizer发现
+        std::vector<char> str(lines[n].c_str(), lines[n].c_str() + lines[n].length() + 1);
+        parse_line_result_t &r = expected[n];
+        memset(&r, 0, sizeof(r));
+        r.error = string_to_tiles(&str[0], &r.hand_tiles, &r.serving_tile);
+        if (r.error != PARSE_NO_ERROR) {
+            r.hand_tiles.tile_count = 0;
+            r.hand_tiles.pack_count = 0;
+            r.serving_tile = 0;
+        }
+        r.line_offset = offset;
+        r.line_length = lines[n].length();
+        offset += lines[n].length() + (n % 7 == 0 ? 2 : 1);
+    }
+
+    // 整块解析
+    parse_lines_context_t whole;
+    whole.base = 0;
+    size_t consumed = parse_hand_lines(buffer.data(), buffer.size(), true, &whole, collect_parse_line);
+
+    // 随机大小分块，不完整的一行拼到下一块
+    parse_lines_context_t chunked;
+    std::string carry;
+    size_t pos = 0;
+    while (pos < buffer.size() || !carry.empty()) {
+        size_t len = std::min<size_t>(rng() % 256, buffer.size() - pos);
+        std::string chunk = carry + buffer.substr(pos, len);
+        chunked.base = pos - carry.size();
+        pos += len;
+        bool is_final = pos == buffer.size();
+        size_t used = parse_hand_lines(chunk.data(), chunk.size(), is_final, &chunked, collect_parse_line);
+        carry = chunk.substr(used);
+        if (is_final) {
+            break;
+        }
+    }
+
+    int mismatch = 0, errors = 0, bad_offset = 0;
+    if (consumed != buffer.size() || whole.results.size() != expected.size() || chunked.results.size() != expected.size()) {
+        ++mismatch;
+    }
+
+    // 以逗号结尾的副露
+    static const char *truncated_strs[] = { "[123m,", "[123m,1", "1m[123m," };
+    for (const char *truncated : truncated_strs) {
+        std::vector<char> str(truncated, truncated + strlen(truncated) + 1);
+        hand_tiles_t hand_tiles;
+        tile_t serving_tile;
+        if (string_to_tiles(&str[0], &hand_tiles, &serving_tile) != PARSE_ERROR_ILLEGAL_CHARACTER) {
+            ++mismatch;
+        }
+    }
+    for (size_t i = 0; i < std::min(whole.results.size(), expected.size()); ++i) {
+        const parse_line_result_t &r = whole.results[i];
+        // string_to_tiles不报告出错位置，这里只检查在行内
+        parse_line_result_t e = expected[i];
+        e.error_offset = r.error_offset;
+        if (!is_same_parse_result(r, e)) {
+            ++mismatch;
+        }
+        if (r.error != PARSE_NO_ERROR) {
+            ++errors;
+            if (r.error_offset < r.line_offset || r.error_offset > r.line_offset + r.line_length) {
+                ++bad_offset;
+            }
+        }
+        if (i < chunked.results.size() && !is_same_parse_result(r, chunked.results[i])) {
+            ++mismatch;
+        }
+    }
+
+    // 耗时：只有合法的行，与逐行复制再调用string_to_tiles比较
+    std::string valid;
+    for (int n = 0; n < count; ++n) {
+        if (n % 4 != 3) {
+            valid += lines[n];
+            valid += '\n';
+        }
+    }
+    size_t total = 0;
+    clock_t start = clock();
+    for (int k = 0; k < 10; ++k) {
+        parse_lines_context_t ctx;
+        ctx.results.reserve(count);
+        ctx.base = 0;
+        parse_hand_lines(valid.data(), valid.size(), true, &ctx, collect_parse_line);
+        total += ctx.results.size();
+    }
+    clock_t elapsed_bulk = clock() - start;
+    start = clock();
+    for (int k = 0; k < 10; ++k) {
+        std::vector<parse_line_result_t> results;
+        results.reserve(count);
+        const char *p = valid.data(), *end = p + valid.size();
+        while (p != end) {
+            const char *q = static_cast<const char *>(memchr(p, '\n', end - p));
+            char str[64];
+            memcpy(str, p, q - p);
+            str[q - p] = '\0';
+            results.emplace_back();
+            parse_line_result_t &r = results.back();
+            r.error = string_to_tiles(str, &r.hand_tiles, &r.serving_tile);
+            p = q + 1;
+        }
+        total -= results.size();
+    }
+    clock_t elapsed_loop = clock() - start;
+
+    printf("%d lines, %d errors, %d mismatch, %d bad offset, diff %d, bulk %ld ms, string_to_tiles %ld ms\n", count, errors, mismatch,
+        bad_offset, static_cast<int>(total), static_cast<long>(elapsed_bulk * 1000 / CLOCKS_PER_SEC),
+        static_cast<long>(elapsed_loop * 1000 / CLOCKS_PER_SEC));
+    mismatch_total += mismatch + bad_offset;
+}
+
+// 随机的手牌，副露的供牌信息取全部8种
+static void random_hand_for_code(std::mt19937 &rng, hand_tiles_t *hand_tiles, tile_t *win_tile) {
+    memset(hand_tiles, 0, sizeof(*hand_tiles));
+    hand_tiles->pack_count = static_cast<intptr_t>(rng() % 5);
+    for (intptr_t i = 0; i < hand_tiles->pack_count; ++i) {
+        uint8_t type = static_cast<uint8_t>(rng() % 3 + PACK_TYPE_CHOW);
+        tile_t tile = type == PACK_TYPE_CHOW ? make_tile(static_cast<suit_t>(rng() % 3 + 1), static_cast<rank_t>(rng() % 7 + 2))
+            : all_tiles[rng() % 34];
+        hand_tiles->fixed_packs[i] = static_cast<pack_t>(make_pack(0, type, tile) | (rng() % 8) << 12);
+    }
+    intptr_t max_cnt = 13 - hand_tiles->pack_count * 3;
+    hand_tiles->tile_count = rng() % 4 == 0 ? static_cast<intptr_t>(rng() % (max_cnt + 1)) : max_cnt;
+    for (intptr_t i = 0; i < hand_tiles->tile_count; ++i) {
+        hand_tiles->standing_tiles[i] = all_tiles[rng() % 34];
+    }
+    *win_tile = rng() % 8 == 0 ? 0 : all_tiles[rng() % 34];
+}
+
+// 排序后的立牌与副露，用于比较两手牌是否相同
+static std::string sorted_hand_key(const hand_tiles_t &hand_tiles, tile_t win_tile) {
+    std::vector<tile_t> tiles(hand_tiles.standing_tiles, hand_tiles.standing_tiles + hand_tiles.tile_count);
+    std::vector<pack_t> packs(hand_tiles.fixed_packs, hand_tiles.fixed_packs + hand_tiles.pack_count);
+    std::sort(tiles.begin(), tiles.end());
+    std::sort(packs.begin(), packs.end());
+    std::string key(tiles.begin(), tiles.end());
+    key += '|';
+    for (pack_t pack : packs) {
+        key += static_cast<char>(pack >> 8);
+        key += static_cast<char>(pack & 0xFF);
+    }
+    key += '|';
+    key += static_cast<char>(win_tile);
+    return key;
+}
+
+// 手牌编码：编码后解码得到同一手牌，打乱顺序不改变编码，不同的手牌编码不同
+void test_hand_code(int count) {
+    std::mt19937 rng(20261022);
+    std::vector<hand_tiles_t> hands(count);
+    std::vector<tile_t> win_tiles(count);
+    std::vector<hand_code_t> codes(count);
+    std::set<std::string> unique_hands;
+    std::set<hand_code_t> unique_codes;
+    int mismatch = 0;
+    hand_code_t max_code = 0;
+
+    for (int n = 0; n < count; ++n) {
+        hand_tiles_t &hand_tiles = hands[n];
+        random_hand_for_code(rng, &hand_tiles, &win_tiles[n]);
+        if (!encode_hand(&hand_tiles, win_tiles[n], &codes[n])) {
+            ++mismatch;
+            continue;
+        }
+        max_code = std::max(max_code, codes[n]);
+        unique_hands.insert(sorted_hand_key(hand_tiles, win_tiles[n]));
+        unique_codes.insert(codes[n]);
+
+        hand_tiles_t decoded;
+        tile_t decoded_win_tile;
+        if (!decode_hand(codes[n], &decoded, &decoded_win_tile)
+            || sorted_hand_key(decoded, decoded_win_tile) != sorted_hand_key(hand_tiles, win_tiles[n])) {
+            ++mismatch;
+        }
+
+        hand_tiles_t shuffled = hand_tiles;
+        std::shuffle(shuffled.standing_tiles, shuffled.standing_tiles + shuffled.tile_count, rng);
+        std::shuffle(shuffled.fixed_packs, shuffled.fixed_packs + shuffled.pack_count, rng);
+        hand_code_t code;
+        if (!encode_hand(&shuffled, win_tiles[n], &code) || !is_same_hand_code(code, codes[n])
+            || hand_code_hash(code) != hand_code_hash(codes[n])) {
+            ++mismatch;
+        }
+    }
+    if (unique_hands.size() != unique_codes.size()) {
+        ++mismatch;
+    }
+
+    // 不合法的输入
+    hand_tiles_t hand_tiles;
+    tile_t win_tile;
+    random_hand_for_code(rng, &hand_tiles, &win_tile);
+    hand_code_t code;
+    hand_tiles_t bad = hand_tiles;
+    bad.tile_count = 14 - bad.pack_count * 3;
+    mismatch += encode_hand(&bad, win_tile, &code);
+    bad = hand_tiles;
+    bad.pack_count = 5;
+    mismatch += encode_hand(&bad, win_tile, &code);
+    mismatch += encode_hand(&hand_tiles, 0x48, &code);
+    mismatch += decode_hand(UINT64_C(1) << 50, &bad, &win_tile);
+
+    // 编解码的耗时
+    clock_t start = clock();
+    uint64_t sum = 0;
+    for (int k = 0; k < 10; ++k) {
+        for (int n = 0; n < count; ++n) {
+            encode_hand(&hands[n], win_tiles[n], &code);
+            sum += code;
+        }
+    }
+    clock_t elapsed_encode = clock() - start;
+    start = clock();
+    for (int n = 0; n < count; ++n) {
+        decode_hand(codes[n], &hand_tiles, &win_tile);
+        sum += hand_tiles.tile_count;
+    }
+    clock_t elapsed_decode = clock() - start;
+
+    printf("%d hands, %d unique, %d mismatch, max code 0x%llX, %d encodes %ld ms, %d decodes %ld ms (%u)\n", count,
+        static_cast<int>(unique_codes.size()), mismatch, static_cast<unsigned long long>(max_code), count * 10,
+        static_cast<long>(elapsed_encode * 1000 / CLOCKS_PER_SEC), count, static_cast<long>(elapsed_decode * 1000 / CLOCKS_PER_SEC),
+        static_cast<unsigned>(sum & 1));
+    mismatch_total += mismatch;
+}
+
+// 批量格式化与逐个调用hand_tiles_to_string、tiles_to_string的结果比较，并用parse_hand_lines解析回来
+void test_bulk_format(int count) {
+    std::mt19937 rng(20261023);
+    std::vector<hand_tiles_t> hands(count);
+    std::vector<tile_t> serving_tiles(count);
+    std::vector<int> fans(count);
+    for (int n = 0; n < count; ++n) {
+        random_hand_for_code(rng, &hands[n], &serving_tiles[n]);
+        fans[n] = static_cast<int>(rng() % 400) - 8;
+    }
+
+    // 逐个调用的结果
+    std::string expected_lines, expected_ndjson;
+    for (int n = 0; n < count; ++n) {
+        char hand_str[64], serving_str[8], line[128];
+        hand_tiles_to_string(&hands[n], hand_str, sizeof(hand_str));
+        tiles_to_string(&serving_tiles[n], serving_tiles[n] != 0, serving_str, sizeof(serving_str));
+        expected_lines += hand_str;
+        expected_lines += serving_str;
+        expected_lines += '\n';
+        snprintf(line, sizeof(line), "{\"hand\":\"%s\",\"serving_tile\":\"%s\",\"fan\":%d}\n", hand_str, serving_str, fans[n]);
+        expected_ndjson += line;
+    }
+
+    int mismatch = 0;
+    std::vector<char> buffer(1, '#');  // 追加到已有内容之后
+    size_t len = hands_to_lines(&hands[0], &serving_tiles[0], count, buffer);
+    if (len != expected_lines.size() || buffer.size() != len + 1 || memcmp(&buffer[1], expected_lines.data(), len) != 0) {
+        ++mismatch;
+    }
+
+    // 解析回来。解析时会规范化副露的供牌信息，张数不足时上牌算作立牌，所以只比较张数足够的手牌的牌
+    parse_lines_context_t parsed;
+    parsed.base = 0;
+    parse_hand_lines(&buffer[1], len, true, &parsed, collect_parse_line);
+    if (parsed.results.size() != static_cast<size_t>(count)) {
+        ++mismatch;
+    }
+    int parsed_cnt = 0;
+    for (size_t i = 0; i < parsed.results.size(); ++i) {
+        const parse_line_result_t &r = parsed.results[i];
+        const hand_tiles_t &h = hands[i];
+        if (r.error != PARSE_NO_ERROR || h.tile_count != 13 - h.pack_count * 3 || serving_tiles[i] == 0) {
+            continue;
+        }
+        ++parsed_cnt;
+        bool same = r.hand_tiles.pack_count == h.pack_count && r.hand_tiles.tile_count == h.tile_count && r.serving_tile == serving_tiles[i]
+            && memcmp(r.hand_tiles.standing_tiles, h.standing_tiles, h.tile_count * sizeof(tile_t)) == 0;
+        for (intptr_t k = 0; same && k < h.pack_count; ++k) {
+            same = pack_get_type(r.hand_tiles.fixed_packs[k]) == pack_get_type(h.fixed_packs[k])
+                && pack_get_tile(r.hand_tiles.fixed_packs[k]) == pack_get_tile(h.fixed_packs[k]);
+        }
+        if (!same) {
+            ++mismatch;
+        }
+    }
+
+    buffer.clear();
+    len = hands_to_ndjson(&hands[0], &serving_tiles[0], &fans[0], count, buffer);
+    if (len != expected_ndjson.size() || memcmp(&buffer[0], expected_ndjson.data(), len) != 0) {
+        ++mismatch;
+    }
+
+    // 打哪张牌的结果
+    enum_record_t record;
+    record.limit = SIZE_MAX;
+    for (int n = 0; n < 200; ++n) {
+        hand_tiles_t hand_tiles;
+        memset(&hand_tiles, 0, sizeof(hand_tiles));
+        tile_t tiles[14];
+        random_tiles(rng, tiles, 14);
+        memcpy(hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        hand_tiles.tile_count = 13;
+        enum_discard_tile(&hand_tiles, tiles[13], FORM_FLAG_ALL, &record, record_enum_result);
+    }
+    std::string expected_results;
+    for (const enum_result_t &r : record.results) {
+        tile_t useful_tiles[34];
+        intptr_t useful_cnt = 0;
+        for (tile_t t : all_tiles) {
+            if (r.useful_table[t]) {
+                useful_tiles[useful_cnt++] = t;
+            }
+        }
+        char discard_str[8], useful_str[80], line[160];
+        tiles_to_string(&r.discard_tile, r.discard_tile != 0, discard_str, sizeof(discard_str));
+        tiles_to_string(useful_tiles, useful_cnt, useful_str, sizeof(useful_str));
+        snprintf(line, sizeof(line), "{\"discard_tile\":\"%s\",\"form_flag\":%d,\"shanten\":%d,\"useful_tiles\":\"%s\"}\n",
+            discard_str, r.form_flag, r.shanten, useful_str);
+        expected_results += line;
+    }
+    buffer.clear();
+    len = enum_results_to_ndjson(record.results.data(), record.results.size(), buffer);
+    if (len != expected_results.size() || memcmp(&buffer[0], expected_results.data(), len) != 0) {
+        ++mismatch;
+    }
+
+    // 耗时：复用同一缓冲区，与逐个调用再拼接比较
+    size_t total = 0;
+    clock_t start = clock();
+    for (int k = 0; k < 10; ++k) {
+        buffer.clear();
+        total += hands_to_lines(&hands[0], &serving_tiles[0], count, buffer);
+    }
+    clock_t elapsed_bulk = clock() - start;
+    start = clock();
+    for (int k = 0; k < 10; ++k) {
+        std::string out;
+        for (int n = 0; n < count; ++n) {
+            char str[64];
+            intptr_t l = hand_tiles_to_string(&hands[n], str, sizeof(str));
+            l += tiles_to_string(&serving_tiles[n], serving_tiles[n] != 0, str + l, sizeof(str) - l);
+            out.append(str, l);
+            out += '\n';
+        }
+        total -= out.size();
+    }
+    clock_t elapsed_loop = clock() - start;
+
+    printf("%d hands, %d parsed, %d results, %d mismatch, diff %d, bulk %ld ms, hand_tiles_to_string %ld ms\n", count,
+        parsed_cnt, static_cast<int>(record.results.size()), mismatch, static_cast<int>(total),
+        static_cast<long>(elapsed_bulk * 1000 / CLOCKS_PER_SEC), static_cast<long>(elapsed_loop * 1000 / CLOCKS_PER_SEC));
+    mismatch_total += mismatch;
+}
+
+// 由手牌与上牌得到完整牌墙中其余的牌
+static void make_wall_table(const hand_tiles_t &hand_tiles, tile_t serving_tile, tile_table_t &wall_table) {
+    tile_table_t cnt_table;
+    map_hand_tiles(&hand_tiles, &cnt_table);
+    ++cnt_table[serving_tile];
+    memset(wall_table, 0, sizeof(wall_table));
+    for (tile_t t : all_tiles) {
+        wall_table[t] = static_cast<uint16_t>(4 - cnt_table[t]);
+    }
+}
+
+// 只摸一张时与精确值比较，并比较不同线程数的结果
+// bench为true时多摸几张、多模拟一些，用于测量耗时
+void test_win_rate(int count, bool bench) {
+    int mismatch = 0;
+    monte_carlo_option_t option;
+    option.max_samples = 4096;
+    option.round_samples = 256;
+    option.z = 3.29;
+    option.seed = 20261024;
+
+    // 123m456s789p2345p打E听2p、5p，打2p或5p单钓E，打其他牌不听
+    win_rate_param_t param;
+    memset(&param, 0, sizeof(param));
+    string_to_tiles("123m456s789p2345pE", &param.hand_tiles, &param.serving_tile);
+    make_wall_table(param.hand_tiles, param.serving_tile, param.wall_table);
+    param.draw_count = 1;
+    param.min_fan = 0;
+    param.form_flag = FORM_FLAG_BASIC_FORM;
+    param.prevalent_wind = wind_t::EAST;
+    param.seat_wind = wind_t::EAST;
+
+    win_rate_result_t results[34];
+    intptr_t cnt = estimate_win_rate(&param, &option, results, 34, 4);
+    int wall_cnt = 0;
+    for (tile_t t : all_tiles) {
+        wall_cnt += param.wall_table[t];
+    }
+    for (intptr_t i = 0; i < cnt; ++i) {
+        const win_rate_result_t &r = results[i];
+        hand_tiles_t hand_tiles = param.hand_tiles;
+        if (r.discard_tile != param.serving_tile) {
+            *std::find(hand_tiles.standing_tiles, hand_tiles.standing_tiles + 13, r.discard_tile) = param.serving_tile;
+        }
+        int win_cnt = 0;
+        for (tile_t t : all_tiles) {
+            if (is_basic_form_win(hand_tiles.standing_tiles, 13, t)) {
+                win_cnt += param.wall_table[t];
+            }
+        }
+        double exact = static_cast<double>(win_cnt) / wall_cnt;
+        if (exact < r.lower || exact > r.upper || r.win_count != r.qualified_count) {
+            ++mismatch;
+        }
+    }
+    if (cnt != 14 || results[0].discard_tile != TILE_E) {
+        ++mismatch;
+    }
+
+    // 随机手牌，多摸几张，达到8番才算和牌，单线程与多线程的结果应完全相同
+    std::mt19937 rng(20261024);
+    option.max_samples = bench ? 1024 : 128;
+    option.z = 2.58;
+    param.draw_count = bench ? 12 : 6;
+    param.min_fan = 8;
+    param.form_flag = FORM_FLAG_ALL;
+    size_t samples = 0, settled = 0;
+    std::chrono::steady_clock::duration elapsed_single(0), elapsed_multi(0);
+    for (int n = 0; n < count; ++n) {
+        tile_t tiles[14];
+        random_tiles(rng, tiles, 14);
+        memset(&param.hand_tiles, 0, sizeof(param.hand_tiles));
+        memcpy(param.hand_tiles.standing_tiles, tiles, 13 * sizeof(tile_t));
+        param.hand_tiles.tile_count = 13;
+        param.serving_tile = tiles[13];
+        make_wall_table(param.hand_tiles, param.serving_tile, param.wall_table);
+
+        win_rate_result_t single[34], multi[34];
+        auto start = std::chrono::steady_clock::now();
+        intptr_t single_cnt = estimate_win_rate(&param, &option, single, 34, 1);
+        auto mid = std::chrono::steady_clock::now();
+        intptr_t multi_cnt = estimate_win_rate(&param, &option, multi, 34, 0);
+        elapsed_single += mid - start;
+        elapsed_multi += std::chrono::steady_clock::now() - mid;
+
+        if (single_cnt != multi_cnt || memcmp(single, multi, single_cnt * sizeof(win_rate_result_t)) != 0) {
+            ++mismatch;
+        }
+        for (intptr_t i = 0; i < single_cnt; ++i) {
+            samples += single[i].sample_count;
+            settled += single[i].sample_count < option.max_samples ? 1 : 0;
+            if (single[i].qualified_count > single[i].win_count || single[i].lower > single[i].upper) {
+                ++mismatch;
+            }
+        }
+    }
+
+    printf("%d hands, %d mismatch, %llu samples, %d settled early, single thread %ld ms, multi thread %ld ms\n", count, mismatch,
+        static_cast<unsigned long long>(samples), static_cast<int>(settled),
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed_single).count()),
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed_multi).count()));
+    mismatch_total += mismatch;
+}
+
+// win_expectation_t有填充字节，逐字段比较
+static bool same_expectations(const win_expectation_t *a, const win_expectation_t *b, intptr_t cnt) {
+    for (intptr_t i = 0; i < cnt; ++i) {
+        if (a[i].discard_tile != b[i].discard_tile || a[i].shanten != b[i].shanten
+            || a[i].win_rate != b[i].win_rate || a[i].expected_fan != b[i].expected_fan) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// 穷举每次摸到的牌，牌墙的每种牌都如实扣除，计算和牌率与番数期望，只考虑基本和型，用于验证calculate_win_rate
+static void brute_force_win_rate(const win_rate_param_t &param, const hand_tiles_t &hand_tiles, tile_table_t &wall_table,
+        int wall_cnt, int draw_left, double *win_rate, double *expected_fan) {
+    *win_rate = 0.0;
+    *expected_fan = 0.0;
+    if (draw_left == 0 || wall_cnt == 0) {
+        return;
+    }
+
+    useful_table_t useful_table;
+    const int shanten = basic_form_shanten(hand_tiles.standing_tiles, hand_tiles.tile_count, &useful_table);
+    for (tile_t t : all_tiles) {
+        if (wall_table[t] == 0) {
+            continue;
+        }
+        const double p = static_cast<double>(wall_table[t]) / wall_cnt;
+        --wall_table[t];
+        double w = 0.0, f = 0.0;
+        if (!useful_table[t]) {
+            brute_force_win_rate(param, hand_tiles, wall_table, wall_cnt - 1, draw_left - 1, &w, &f);
+        }
+        else {
+            int fan = -1;
+            if (shanten == 0) {
+                calculate_param_t calculate_param;
+                memcpy(&calculate_param.hand_tiles, &hand_tiles, sizeof(hand_tiles_t));
+                calculate_param.win_tile = t;
+                calculate_param.flower_count = param.flower_count;
+                calculate_param.win_flag = WIN_FLAG_SELF_DRAWN;
+                calculate_param.prevalent_wind = param.prevalent_wind;
+                calculate_param.seat_wind = param.seat_wind;
+                fan = calculate_fan(&calculate_param, nullptr);
+            }
+            if (fan >= std::max(param.min_fan, 0)) {
+                w = 1.0;
+                f = fan;
+            }
+            else {
+                // 在上听数最小的打法中选和牌率最高、相同时番数期望最高的
+                tile_table_t cnt_table;
+                map_tiles(hand_tiles.standing_tiles, hand_tiles.tile_count, &cnt_table);
+                ++cnt_table[t];
+                hand_tiles_t next;
+                memcpy(&next, &hand_tiles, sizeof(next));
+                int levels[34];
+                int min_level = std::numeric_limits<int>::max();
+                for (int k = 0; k < 34; ++k) {
+                    levels[k] = std::numeric_limits<int>::max();
+                    if (cnt_table[all_tiles[k]] > 0) {
+                        --cnt_table[all_tiles[k]];
+                        table_to_tiles(cnt_table, next.standing_tiles, next.tile_count);
+                        levels[k] = basic_form_shanten(next.standing_tiles, next.tile_count, nullptr);
+                        ++cnt_table[all_tiles[k]];
+                        min_level = std::min(min_level, levels[k]);
+                    }
+                }
+                for (int k = 0; k < 34; ++k) {
+                    if (levels[k] != min_level) {
+                        continue;
+                    }
+                    --cnt_table[all_tiles[k]];
+                    table_to_tiles(cnt_table, next.standing_tiles, next.tile_count);
+                    ++cnt_table[all_tiles[k]];
+                    double nw, nf;
+                    brute_force_win_rate(param, next, wall_table, wall_cnt - 1, draw_left - 1, &nw, &nf);
+                    if (nw > w || (nw == w && nf > f)) {
+                        w = nw;
+                        f = nf;
+                    }
+                }
+            }
+        }
+        ++wall_table[t];
+        *win_rate += p * w;
+        *expected_fan += p * f;
+    }
+}
+
+// 听牌时与手算的结果比较，不同内存上限的结果应完全相同，并与蒙特卡洛模拟的结果比较
+// bench为true时多摸几张、内存上限更小，用于测量内存上限对耗时的影响
+void test_exact_win_rate(bool bench) {
+    int mismatch = 0;
+    win_rate_param_t param;
+    memset(&param, 0, sizeof(param));
+    string_to_tiles("123m456s789p2345pE", &param.hand_tiles, &param.serving_tile);
+    make_wall_table(param.hand_tiles, param.serving_tile, param.wall_table);
+    param.min_fan = 0;
+    param.form_flag = FORM_FLAG_BASIC_FORM;
+    param.prevalent_wind = wind_t::EAST;
+    param.seat_wind = wind_t::EAST;
+
+    // 打E听2p、5p共6张，牌墙122张：摸1张和牌率为6/122，摸2张为6/122+(116/122)*(6/121)
+    win_expectation_t results[34];
+    param.draw_count = 1;
+    intptr_t cnt = calculate_win_rate(&param, 1 << 20, results, 34);
+    if (cnt != 14 || results[0].discard_tile != TILE_E || fabs(results[0].win_rate - 6.0 / 122) > 1e-12) {
+        ++mismatch;
+    }
+    param.draw_count = 2;
+    cnt = calculate_win_rate(&param, 1 << 20, results, 34);
+    if (cnt != 14 || results[0].discard_tile != TILE_E || fabs(results[0].win_rate - (6.0 / 122 + 116.0 / 122 * 6.0 / 121)) > 1e-12) {
+        ++mismatch;
+    }
+
+    // 一上听
+    string_to_tiles("123m45s789p2346p1sE", &param.hand_tiles, &param.serving_tile);
+    make_wall_table(param.hand_tiles, param.serving_tile, param.wall_table);
+    param.draw_count = bench ? 8 : 5;
+    param.form_flag = FORM_FLAG_ALL;
+    const size_t small_budget = bench ? 1024 : 64 << 10;  // 都远小于所需，表中的结果会不断被覆盖
+    win_expectation_t small[34];
+    auto start = std::chrono::steady_clock::now();
+    intptr_t small_cnt = calculate_win_rate(&param, small_budget, small, 34);
+    auto mid = std::chrono::steady_clock::now();
+    cnt = calculate_win_rate(&param, 16 << 20, results, 34);
+    auto end = std::chrono::steady_clock::now();
+    if (small_cnt != cnt || !same_expectations(small, results, cnt)) {
+        ++mismatch;
+    }
+
+    monte_carlo_option_t option;
+    option.max_samples = 4096;
+    option.round_samples = 4096;
+    option.z = 3.29;
+    option.seed = 20261025;
+    win_rate_result_t estimated[34];
+    const double best_rate = results[0].win_rate;
+    intptr_t estimated_cnt = estimate_win_rate(&param, &option, estimated, 34, 0);
+    if (estimated_cnt != cnt) {
+        ++mismatch;
+    }
+    double max_diff = 0.0;
+    for (intptr_t i = 0; i < estimated_cnt; ++i) {
+        const win_rate_result_t &r = estimated[i];
+        const win_expectation_t *e = std::find_if(results, results + cnt,
+            [&r](const win_expectation_t &x) { return x.discard_tile == r.discard_tile; });
+        if (e == results + cnt) {
+            ++mismatch;
+            continue;
+        }
+        const double rate = static_cast<double>(r.qualified_count) / r.sample_count;
+        max_diff = std::max(max_diff, fabs(rate - e->win_rate));
+        if (e->win_rate < r.lower || e->win_rate > r.upper) {
+            ++mismatch;
+        }
+    }
+
+    // 小牌墙上与穷举比较。摸切的牌也要从牌墙扣除，否则第一例的和牌率会超过1
+    static const struct {
+        const char *hand;
+        const char *wall;
+        int draw_count;
+        int min_fan;
+    } brute_cases[] = {
+        { "12345678m12399p5s", "9m9m9m3m3m6m6m", 7, 0 },
+        { "12345678m12399p5s", "9m9m9m3m3m6m6m", 4, 0 },
+        { "1234567m2399p56sE", "1m4m7m9p4s7s", 4, 0 },
+        { "1234567m2399p56sE", "1m4m7m9p4s7s", 3, 8 },
+        { "123m456p789sEEWCP", "EWWCF", 4, 6 },
+    };
+    int brute_cnt = 0;
+    param.form_flag = FORM_FLAG_BASIC_FORM;
+    for (const auto &c : brute_cases) {
+        hand_tiles_t wall_tiles;
+        tile_t dummy;
+        string_to_tiles(c.hand, &param.hand_tiles, &param.serving_tile);
+        string_to_tiles(c.wall, &wall_tiles, &dummy);
+        map_tiles(wall_tiles.standing_tiles, wall_tiles.tile_count, &param.wall_table);
+        param.draw_count = c.draw_count;
+        param.min_fan = c.min_fan;
+        cnt = calculate_win_rate(&param, 1 << 20, results, 34);
+        // 内存上限不足一项时不缓存，结果不变
+        small_cnt = calculate_win_rate(&param, 0, small, 34);
+        if (small_cnt != cnt || !same_expectations(small, results, cnt)) {
+            ++mismatch;
+        }
+        for (intptr_t i = 0; i < cnt; ++i) {
+            tile_table_t cnt_table;
+            map_tiles(param.hand_tiles.standing_tiles, param.hand_tiles.tile_count, &cnt_table);
+            ++cnt_table[param.serving_tile];
+            --cnt_table[results[i].discard_tile];
+            hand_tiles_t hand_tiles;
+            memcpy(&hand_tiles, &param.hand_tiles, sizeof(hand_tiles));
+            table_to_tiles(cnt_table, hand_tiles.standing_tiles, hand_tiles.tile_count);
+            double w, f;
+            brute_force_win_rate(param, hand_tiles, param.wall_table, static_cast<int>(wall_tiles.tile_count), c.draw_count, &w, &f);
+            if (results[i].win_rate > 1.0 || fabs(results[i].win_rate - w) > 1e-12 || fabs(results[i].expected_fan - f) > 1e-9) {
+                ++mismatch;
+            }
+            ++brute_cnt;
+        }
+    }
+
+
+    printf("%d mismatch, best %.4f, max diff %.4f, %d discards brute-forced, memo %dKB %ld ms, memo 16MB %ld ms\n", mismatch, best_rate,
+        max_diff, brute_cnt, static_cast<int>(small_budget >> 10), static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(mid - start).count()),
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(end - mid).count()));
+    mismatch_total += mismatch;
+}
+
+// 共享线程池：每个下标恰好处理一次，嵌套使用不死锁，反复调用不再创建线程
+namespace {
+    struct pool_test_context_t {
+        std::vector<std::atomic<int> > *visits;
+        bool nested;
+    };
+}
+
+static void pool_test_range(void *context, size_t begin, size_t end) {
+    pool_test_context_t *ctx = static_cast<pool_test_context_t *>(context);
+    for (size_t i = begin; i < end; ++i) {
+        (*ctx->visits)[i].fetch_add(1);
+        if (ctx->nested && i % 64 == 0) {
+            std::vector<std::atomic<int> > inner(100);
+            pool_test_context_t inner_ctx = { &inner, false };
+            parallel_for(inner.size(), 7, 4, &inner_ctx, &pool_test_range);
+            for (std::atomic<int> &v : inner) {
+                if (v.load() != 1) {
+                    (*ctx->visits)[i].fetch_add(100);
+                }
+            }
+        }
+    }
+}
+
+void test_worker_pool(int count) {
+    int mismatch = 0;
+    for (int k = 0; k < 2; ++k) {
+        std::vector<std::atomic<int> > visits(count);
+        pool_test_context_t ctx = { &visits, k == 1 };
+        parallel_for(visits.size(), 16, 4, &ctx, &pool_test_range);
+        for (std::atomic<int> &v : visits) {
+            if (v.load() != 1) {
+                ++mismatch;
+            }
+        }
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 1000; ++i) {
+        std::vector<std::atomic<int> > visits(64);
+        pool_test_context_t ctx = { &visits, false };
+        parallel_for(visits.size(), 1, 4, &ctx, &pool_test_range);
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    printf("%d indices, %d mismatch, 1000 calls %ld ms\n", count, mismatch,
+        static_cast<long>(std::chrono::duration_cast<std::chrono::milliseconds>(elapsed).count()));
+    mismatch_total += mismatch;
+}
+
+void test_division_count();
+
+void test_fan_exclusion_table(int count);
+
 int main(int argc, const char *argv[]) {
 #ifdef _MSC_VER
     system("chcp 65001");
 #endif
 
+    // 加--bench参数时，耗时较长的测试用较大的规模运行
+    const bool bench = argc > 1 && strcmp(argv[1], "--bench") == 0;
+
     //test_shanten("19m19s22pESWCFPP");
     //test_shanten("278m3378s3779pEC");
     test_shanten("111m 5m12p1569sSWP");
@@ -501,9 +2223,531 @@ int main(int argc, const char *argv[]) {
     puts("==== test self drawn ====");
     test_points("[1111p,1][456s]2789s456p2s", WIN_FLAG_SELF_DRAWN, wind_t::EAST, wind_t::EAST);
 
-    return 0;
+    puts("==== test basic form engine ====");
+    test_basic_form_engine(5000);
+
+    puts("==== test basic form analyzer ====");
+    test_basic_form_analyzer(5000);
+
+    puts("==== test enum discard tile parallel ====");
+    test_enum_discard_tile_parallel(200);
+
+    puts("==== test enum discard tile form flag ====");
+    test_enum_discard_tile_form_flag(200);
+
+    puts("==== test shanten cache ====");
+    test_shanten_cache(500);
+
+    puts("==== test basic form win table ====");
+    test_basic_form_win_table();
+
+    puts("==== test tile counts ====");
+    test_tile_counts(20000);
+
+    puts("==== test tile set ====");
+    test_tile_set(2000);
+
+    puts("==== test division count ====");
+    test_division_count();
+
+    puts("==== test calculate fan many divisions ====");
+    test_calculate_fan_many_divisions(20000);
+
+    puts("==== test calculate fan batch ====");
+    test_calculate_fan_batch(20000);
+
+    puts("==== test fan exclusion table ====");
+    test_fan_exclusion_table(200000);
+
+    puts("==== test rule sets ====");
+    test_rule_sets(20000);
+
+    puts("==== test calculate fan for waits ====");
+    test_calculate_fan_for_waits(2000);
+
+    puts("==== test reaches min fan ====");
+    test_reaches_min_fan(50000);
+
+    puts("==== test fan cache ====");
+    test_fan_cache(5000);
+
+    puts("==== test parse hand lines ====");
+    test_parse_hand_lines(100000);
+
+    puts("==== test hand code ====");
+    test_hand_code(100000);
+
+    puts("==== test bulk format ====");
+    test_bulk_format(100000);
+
+    puts("==== test win rate ====");
+    test_win_rate(bench ? 3 : 2, bench);
+
+    puts("==== test exact win rate ====");
+    test_exact_win_rate(bench);
+
+    puts("==== test worker pool ====");
+    test_worker_pool(100000);
+
+    printf("%d mismatch in total\n", mismatch_total);
+    return mismatch_total != 0 ? 1 : 0;
 }
 
 #include "stringify.cpp"
 #include "shanten.cpp"
+#include "shanten_cache.cpp"
 #include "fan_calculator.cpp"
+#include "fan_cache.cpp"
+#include "hand_code.cpp"
+#include "win_rate.cpp"
+#include "worker_pool.cpp"
+
+// 以下测试用到fan_calculator.cpp中的内部类型，所以放在最后
+
+namespace mahjong {
+
+// 不限制顺序地拆出所有面子，排序后去重，作为划分数的参照
+static void collect_divisions_brute(tile_table_t &cnt_table, std::vector<pack_t> &packs, std::set<std::vector<pack_t> > &divisions) {
+    if (packs.size() == 4) {
+        for (int i = 0; i < 34; ++i) {
+            if (cnt_table[all_tiles[i]] == 2) {
+                std::vector<pack_t> temp(packs);
+                std::sort(temp.begin(), temp.end());
+                divisions.insert(temp);
+            }
+        }
+        return;
+    }
+    for (int i = 0; i < 34; ++i) {
+        tile_t t = all_tiles[i];
+        if (cnt_table[t] >= 3) {
+            cnt_table[t] -= 3;
+            packs.push_back(make_pack(0, PACK_TYPE_PUNG, t));
+            collect_divisions_brute(cnt_table, packs, divisions);
+            packs.pop_back();
+            cnt_table[t] += 3;
+        }
+        if (is_numbered_suit(t) && tile_get_rank(t) < 8 && cnt_table[t] && cnt_table[t + 1] && cnt_table[t + 2]) {
+            --cnt_table[t]; --cnt_table[t + 1]; --cnt_table[t + 2];
+            packs.push_back(make_pack(0, PACK_TYPE_CHOW, static_cast<tile_t>(t + 1)));
+            collect_divisions_brute(cnt_table, packs, divisions);
+            packs.pop_back();
+            ++cnt_table[t]; ++cnt_table[t + 1]; ++cnt_table[t + 2];
+        }
+    }
+}
+
+
+// 逐条判断不计的原始实现，作为不计矩阵的参照
+static void adjust_fan_table_sequential(fan_table_t &fan_table, bool strict_98) {
+    // 大四喜不计三风刻、碰碰和、圈风刻、门风刻、幺九刻
+    if (fan_table[BIG_FOUR_WINDS]) {
+        fan_table[BIG_THREE_WINDS] = 0;
+        fan_table[ALL_PUNGS] = 0;
+        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
+    }
+    // 大三元不计双箭刻、箭刻（严格98规则不计缺一门）
+    if (fan_table[BIG_THREE_DRAGONS]) {
+        fan_table[TWO_DRAGONS_PUNGS] = 0;
+        fan_table[DRAGON_PUNG] = 0;
+        if (strict_98) {
+            fan_table[ONE_VOIDED_SUIT] = 0;
+        }
+    }
+    // 绿一色不计混一色、缺一门
+    if (fan_table[ALL_GREEN]) {
+        fan_table[HALF_FLUSH] = 0;
+        fan_table[ONE_VOIDED_SUIT] = 0;
+    }
+    // 九莲宝灯不计清一色、门前清、缺一门、无字，减计1个幺九刻，把不求人修正为自摸
+    if (fan_table[NINE_GATES]) {
+        fan_table[FULL_FLUSH] = 0;
+        fan_table[CONCEALED_HAND] = 0;
+        --fan_table[PUNG_OF_TERMINALS_OR_HONORS];
+        fan_table[ONE_VOIDED_SUIT] = 0;
+        fan_table[NO_HONORS] = 0;
+        if (fan_table[FULLY_CONCEALED_HAND]) {
+            fan_table[FULLY_CONCEALED_HAND] = 0;
+            fan_table[SELF_DRAWN] = 1;
+        }
+    }
+    // 四杠不计单钓将
+    if (fan_table[FOUR_KONGS]) {
+        fan_table[SINGLE_WAIT] = 0;
+    }
+    // 连七对不计七对、清一色、门前清、缺一门、无字
+    if (fan_table[SEVEN_SHIFTED_PAIRS]) {
+        fan_table[SEVEN_PAIRS] = 0;
+        fan_table[FULL_FLUSH] = 0;
+        fan_table[CONCEALED_HAND] = 0;
+        fan_table[ONE_VOIDED_SUIT] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+    // 十三幺不计五门齐、门前清、单钓将
+    if (fan_table[THIRTEEN_ORPHANS]) {
+        fan_table[ALL_TYPES] = 0;
+        fan_table[CONCEALED_HAND] = 0;
+        fan_table[SINGLE_WAIT] = 0;
+    }
+
+    // 清幺九不计混幺九、碰碰胡、全带幺、幺九刻、无字（严格98规则不计双同刻、不计三同刻）
+    if (fan_table[ALL_TERMINALS]) {
+        fan_table[ALL_TERMINALS_AND_HONORS] = 0;
+        fan_table[ALL_PUNGS] = 0;
+        fan_table[OUTSIDE_HAND] = 0;
+        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
+        fan_table[NO_HONORS] = 0;
+        fan_table[DOUBLE_PUNG] = 0;  // 通行计法不计双同刻
+        if (strict_98) {
+            fan_table[TRIPLE_PUNG] = 0;
+            fan_table[DOUBLE_PUNG] = 0;
+        }
+    }
+
+    // 小四喜不计三风刻
+    if (fan_table[LITTLE_FOUR_WINDS]) {
+        fan_table[BIG_THREE_WINDS] = 0;
+        // 小四喜的第四组牌如果是19的刻子，则是混幺九；如果是箭刻则是字一色；这两种都是不计幺九刻的
+        // 如果是顺子或者2-8的刻子，则不存在多余的幺九刻
+        // 所以这里将幺九刻置为0
+        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
+    }
+
+    // 小三元不计双箭刻、箭刻（严格98规则不计缺一门）
+    if (fan_table[LITTLE_THREE_DRAGONS]) {
+        fan_table[TWO_DRAGONS_PUNGS] = 0;
+        fan_table[DRAGON_PUNG] = 0;
+        if (strict_98) {
+            fan_table[ONE_VOIDED_SUIT] = 0;
+        }
+    }
+
+    // 字一色不计混幺九、碰碰胡、全带幺、幺九刻、缺一门
+    if (fan_table[ALL_HONORS]) {
+        fan_table[ALL_TERMINALS_AND_HONORS] = 0;
+        fan_table[ALL_PUNGS] = 0;
+        fan_table[OUTSIDE_HAND] = 0;
+        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
+        fan_table[ONE_VOIDED_SUIT] = 0;
+    }
+    // 四暗刻不计碰碰和、门前清，把不求人修正为自摸
+    if (fan_table[FOUR_CONCEALED_PUNGS]) {
+        fan_table[ALL_PUNGS] = 0;
+        fan_table[CONCEALED_HAND] = 0;
+        if (fan_table[FULLY_CONCEALED_HAND]) {
+            fan_table[FULLY_CONCEALED_HAND] = 0;
+            fan_table[SELF_DRAWN] = 1;
+        }
+    }
+    // 一色双龙会不计七对、清一色、平和、一般高、老少副、缺一门、无字
+    if (fan_table[PURE_TERMINAL_CHOWS]) {
+        fan_table[SEVEN_PAIRS] = 0;
+        fan_table[FULL_FLUSH] = 0;
+        fan_table[ALL_CHOWS] = 0;
+        fan_table[PURE_DOUBLE_CHOW] = 0;
+        fan_table[TWO_TERMINAL_CHOWS] = 0;
+        fan_table[ONE_VOIDED_SUIT] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+
+    // 一色四同顺不计一色三同顺、一般高、四归一（严格98规则不计缺一门）
+    if (fan_table[QUADRUPLE_CHOW]) {
+        fan_table[PURE_SHIFTED_PUNGS] = 0;
+        fan_table[TILE_HOG] = 0;
+        fan_table[PURE_DOUBLE_CHOW] = 0;
+        if (strict_98) {
+            fan_table[ONE_VOIDED_SUIT] = 0;
+        }
+    }
+    // 一色四节高不计一色三节高、碰碰和（严格98规则不计缺一门）
+    if (fan_table[FOUR_PURE_SHIFTED_PUNGS]) {
+        fan_table[PURE_TRIPLE_CHOW] = 0;
+        fan_table[ALL_PUNGS] = 0;
+        if (strict_98) {
+            fan_table[ONE_VOIDED_SUIT] = 0;
+        }
+    }
+
+    // 一色四步高不计一色三步高、老少副、连六（严格98规则不计缺一门）
+    if (fan_table[FOUR_PURE_SHIFTED_CHOWS]) {
+        fan_table[PURE_SHIFTED_CHOWS] = 0;
+        fan_table[TWO_TERMINAL_CHOWS] = 0;
+        fan_table[SHORT_STRAIGHT] = 0;
+        if (strict_98) {
+            fan_table[ONE_VOIDED_SUIT] = 0;
+        }
+    }
+
+    // 混幺九不计碰碰和、全带幺、幺九刻
+    if (fan_table[ALL_TERMINALS_AND_HONORS]) {
+        fan_table[ALL_PUNGS] = 0;
+        fan_table[OUTSIDE_HAND] = 0;
+        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 0;
+    }
+
+    // 七对不计门前清、单钓将
+    if (fan_table[SEVEN_PAIRS]) {
+        fan_table[CONCEALED_HAND] = 0;
+        fan_table[SINGLE_WAIT] = 0;
+    }
+    // 七星不靠不计五门齐、门前清
+    if (fan_table[GREATER_HONORS_AND_KNITTED_TILES]) {
+        fan_table[ALL_TYPES] = 0;
+        fan_table[CONCEALED_HAND] = 0;
+    }
+    // 全双刻不计碰碰胡、断幺、无字
+    if (fan_table[ALL_EVEN_PUNGS]) {
+        fan_table[ALL_PUNGS] = 0;
+        fan_table[ALL_SIMPLES] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+    // 清一色不计缺一门、无字
+    if (fan_table[FULL_FLUSH]) {
+        fan_table[ONE_VOIDED_SUIT] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+    // 一色三同顺不计一色三节高、一般高
+    if (fan_table[PURE_TRIPLE_CHOW]) {
+        fan_table[PURE_SHIFTED_PUNGS] = 0;
+        fan_table[PURE_DOUBLE_CHOW] = 0;
+    }
+    // 一色三节高不计一色三同顺
+    if (fan_table[PURE_SHIFTED_PUNGS]) {
+        fan_table[PURE_TRIPLE_CHOW] = 0;
+    }
+    // 全大不计大于五、无字
+    if (fan_table[UPPER_TILES]) {
+        fan_table[UPPER_FOUR] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+    // 全中不计断幺
+    if (fan_table[MIDDLE_TILES]) {
+        fan_table[ALL_SIMPLES] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+    // 全小不计小于五、无字
+    if (fan_table[LOWER_TILES]) {
+        fan_table[LOWER_FOUR] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+
+    // 三色双龙会不计平和、无字、喜相逢、老少副
+    if (fan_table[THREE_SUITED_TERMINAL_CHOWS]) {
+        fan_table[ALL_CHOWS] = 0;
+        fan_table[NO_HONORS] = 0;
+        fan_table[MIXED_DOUBLE_CHOW] = 0;
+        fan_table[TWO_TERMINAL_CHOWS] = 0;
+    }
+    // 全带五不计断幺、无字
+    if (fan_table[ALL_FIVE]) {
+        fan_table[ALL_SIMPLES] = 0;
+        fan_table[NO_HONORS] = 0;
+    }
+
+    // 七星不靠不计五门齐、门前清
+    if (fan_table[LESSER_HONORS_AND_KNITTED_TILES]) {
+        fan_table[ALL_TYPES] = 0;
+        fan_table[CONCEALED_HAND] = 0;
+    }
+    // 大于五不计无字
+    if (fan_table[UPPER_FOUR]) {
+        fan_table[NO_HONORS] = 0;
+    }
+    // 小于五不计无字
+    if (fan_table[LOWER_FOUR]) {
+        fan_table[NO_HONORS] = 0;
+    }
+    // 三风刻内部不再计幺九刻（严格98规则不计缺一门）
+    if (fan_table[BIG_THREE_WINDS]) {
+        // 如果不是字一色或混幺九，则要减去3个幺九刻
+        if (!fan_table[ALL_HONORS] && !fan_table[ALL_TERMINALS_AND_HONORS]) {
+            assert(fan_table[PUNG_OF_TERMINALS_OR_HONORS] >= 3);
+            fan_table[PUNG_OF_TERMINALS_OR_HONORS] -= 3;
+        }
+        if (strict_98) {
+            fan_table[ONE_VOIDED_SUIT] = 0;
+        }
+    }
+
+    // 推不倒不计缺一门
+    if (fan_table[REVERSIBLE_TILES]) {
+        fan_table[ONE_VOIDED_SUIT] = 0;
+    }
+    // 妙手回春不计自摸
+    if (fan_table[LAST_TILE_DRAW]) {
+        fan_table[SELF_DRAWN] = 0;
+    }
+    // 杠上开花不计自摸
+    if (fan_table[OUT_WITH_REPLACEMENT_TILE]) {
+        fan_table[SELF_DRAWN] = 0;
+    }
+    // 抢杠和不计和绝张
+    if (fan_table[ROBBING_THE_KONG]) {
+        fan_table[LAST_TILE] = 0;
+    }
+    // 双暗杠不计暗杠
+    if (fan_table[TWO_CONCEALED_KONGS]) {
+        fan_table[CONCEALED_KONG] = 0;
+    }
+
+    // 混一色不计缺一门
+    if (fan_table[HALF_FLUSH]) {
+        fan_table[ONE_VOIDED_SUIT] = 0;
+    }
+    // 全求人不计单钓将
+    if (fan_table[MELDED_HAND]) {
+        fan_table[SINGLE_WAIT] = 0;
+    }
+    // 双箭刻不计箭刻
+    if (fan_table[TWO_DRAGONS_PUNGS]) {
+        fan_table[DRAGON_PUNG] = 0;
+    }
+
+    // 不求人不计自摸
+    if (fan_table[FULLY_CONCEALED_HAND]) {
+        fan_table[SELF_DRAWN] = 0;
+    }
+    // 双明杠不计明杠
+    if (fan_table[TWO_MELDED_KONGS]) {
+        fan_table[MELDED_KONG] = 0;
+    }
+
+    // 平和不计无字
+    if (fan_table[ALL_CHOWS]) {
+        fan_table[NO_HONORS] = 0;
+    }
+    // 断幺不计无字
+    if (fan_table[ALL_SIMPLES]) {
+        fan_table[NO_HONORS] = 0;
+    }
+}
+
+}
+
+// 穷举所有清一色门清和牌，划分数与参照一致，并且不超过MAX_DIVISION_CNT
+// 一门牌至少要8张才可能有多种划分，两门都有多种划分时超过14张，所以清一色时划分最多
+void test_division_count() {
+    int cnt[9] = { 0 };
+    int total = 0, mismatch = 0;
+    intptr_t max_cnt = 0;
+    char max_str[64] = "";
+    for (uint32_t key = 0; key < 1953125; ++key) {
+        if (key > 0) {
+            for (int i = 0; ++cnt[i] == 5; ++i) {
+                cnt[i] = 0;
+            }
+        }
+        if (std::accumulate(std::begin(cnt), std::end(cnt), 0) != 14) {
+            continue;
+        }
+
+        tile_t tiles[14];
+        intptr_t tile_cnt = 0;
+        for (int i = 0; i < 9; ++i) {
+            for (int k = 0; k < cnt[i]; ++k) {
+                tiles[tile_cnt++] = make_tile(TILE_SUIT_BAMBOO, static_cast<rank_t>(i + 1));
+            }
+        }
+
+        pack_t fixed_packs[1];
+        division_result_t result;
+        if (!divide_win_hand(tiles, fixed_packs, 0, &result)) {
+            continue;
+        }
+        ++total;
+
+        tile_table_t cnt_table;
+        map_tiles(tiles, 14, &cnt_table);
+        std::vector<pack_t> packs;
+        std::set<std::vector<pack_t> > divisions;
+        collect_divisions_brute(cnt_table, packs, divisions);
+        if (static_cast<intptr_t>(divisions.size()) != result.count) {
+            ++mismatch;
+        }
+
+        if (result.count > max_cnt) {
+            max_cnt = result.count;
+            tiles_to_string(tiles, 14, max_str, sizeof(max_str));
+        }
+    }
+
+    printf("%d hands, %d mismatch, max %d divisions (%s), MAX_DIVISION_CNT %d\n", total, mismatch,
+        static_cast<int>(max_cnt), max_str, MAX_DIVISION_CNT);
+    mismatch_total += mismatch;
+}
+
+// 原始实现中三风刻减计幺九刻时断言至少有3个，不满足的番表跳过
+static bool is_terminal_pung_deficient(const fan_table_t &fan_table) {
+    if (!fan_table[BIG_THREE_WINDS] || fan_table[BIG_FOUR_WINDS] || fan_table[LITTLE_FOUR_WINDS] || fan_table[ALL_HONORS]) {
+        return false;
+    }
+    if (fan_table[ALL_TERMINALS]) {
+        return true;
+    }
+    return !fan_table[ALL_TERMINALS_AND_HONORS] && fan_table[PUNG_OF_TERMINALS_OR_HONORS] < 3 + (fan_table[NINE_GATES] ? 1 : 0);
+}
+
+template <class rules_t>
+static bool check_fan_exclusion(const fan_table_t &fan_table) {
+    fan_table_t expected, actual;
+    memcpy(expected, fan_table, sizeof(fan_table_t));
+    memcpy(actual, fan_table, sizeof(fan_table_t));
+    adjust_fan_table_sequential(expected, rules_t::strict_98);
+    adjust_fan_table<rules_t>(actual);
+    return memcmp(expected, actual, sizeof(fan_table_t)) == 0;
+}
+
+static bool check_fan_exclusion(const fan_table_t &fan_table) {
+    return check_fan_exclusion<rules_default_t>(fan_table) && check_fan_exclusion<rules_98_strict_t>(fan_table);
+}
+
+// 不计矩阵与原始的逐条判断结果一致：穷举不超过3个番种的组合（分别在没有其他番种和有幺九刻、不求人的基础上），再加随机组合
+void test_fan_exclusion_table(int count) {
+    int total = 0, mismatch = 0;
+
+    for (int background = 0; background < 2; ++background) {
+        for (int i = 0; i < FAN_TABLE_SIZE; ++i) {
+            for (int j = i; j < FAN_TABLE_SIZE; ++j) {
+                for (int k = j; k < FAN_TABLE_SIZE; ++k) {
+                    fan_table_t fan_table = { 0 };
+                    if (background) {
+                        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 4;
+                        fan_table[FULLY_CONCEALED_HAND] = 1;
+                    }
+                    fan_table[i] = fan_table[j] = fan_table[k] = 1;
+                    fan_table[FAN_NONE] = 0;
+                    if (fan_table[PUNG_OF_TERMINALS_OR_HONORS] || fan_table[BIG_THREE_WINDS]) {
+                        fan_table[PUNG_OF_TERMINALS_OR_HONORS] = 4;
+                    }
+                    if (is_terminal_pung_deficient(fan_table)) {
+                        continue;
+                    }
+                    ++total;
+                    if (!check_fan_exclusion(fan_table)) {
+                        ++mismatch;
+                    }
+                }
+            }
+        }
+    }
+
+    std::mt19937 rng(20261016);
+    for (int n = 0; n < count; ++n) {
+        fan_table_t fan_table = { 0 };
+        for (int i = 1; i < FAN_TABLE_SIZE; ++i) {
+            if (rng() % 6 == 0) {
+                fan_table[i] = static_cast<uint16_t>(1 + rng() % 4);
+            }
+        }
+        if (is_terminal_pung_deficient(fan_table)) {
+            continue;
+        }
+        ++total;
+        if (!check_fan_exclusion(fan_table)) {
+            ++mismatch;
+        }
+    }
+
+    printf("%d fan tables, %d mismatch\n", total, mismatch);
+    mismatch_total += mismatch;
+}
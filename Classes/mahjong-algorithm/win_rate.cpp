@@ -0,0 +1,874 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#include "win_rate.h"
+#include "shanten_cache.h"
+#include "hand_code.h"
+#include "worker_pool.h"
+#include <string.h>
+#include <math.h>
+#include <algorithm>
+#include <atomic>
+#include <iterator>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace mahjong {
+
+// 每次蒙特卡洛估计使用的上听数缓存的容量
+#define SHANTEN_CACHE_CAPACITY 16384
+
+// 多线程模拟时上听数缓存的分片数
+#define SHANTEN_CACHE_SHARD_CNT 64
+
+namespace {
+    // 一种打法，同一张打出的牌的各和型合并为一条
+    struct discard_candidate_t {
+        tile_t discard_tile;            // 打这张牌
+        int shanten;                    // 各和型上听数的最小值
+        useful_table_t useful_table;    // 上听数最小的各和型有效牌的并集
+    };
+
+    // 枚举打哪张牌时收集的打法
+    struct candidate_list_t {
+        discard_candidate_t candidates[35];
+        intptr_t count;
+    };
+
+    // 模拟过程中的手牌状态
+    struct play_state_t {
+        hand_tiles_t hand_tiles;        // 手牌，不含上牌
+        int shanten;                    // 上听数，不小于0
+        useful_table_t useful_table;    // 有效牌
+    };
+
+    // 一批模拟的任务与统计
+    struct batch_task_t {
+        intptr_t candidate_idx;         // 哪种打法
+        size_t batch_idx;               // 这种打法的第几批
+        size_t sample_cnt;              // 模拟次数
+        size_t win_cnt;
+        size_t qualified_cnt;
+        uint64_t fan_sum;
+    };
+
+    // 各批次共享的只读数据
+    struct simulation_t {
+        const win_rate_param_t *param;
+        shanten_cache_t *shanten_cache;             // 模拟中的手牌大量重复，枚举打哪张牌经过缓存
+        uint64_t seed;
+        std::vector<tile_t> candidate_tiles;        // 各种打法打出的牌
+        std::vector<play_state_t> initial_states;   // 各种打法打出之后的手牌状态
+        tile_t wall[136];                           // 可摸到的牌
+        intptr_t wall_cnt;
+        intptr_t draw_cnt;                          // 每次模拟摸牌数
+    };
+}
+
+// 收集枚举结果，上听数为0与-1都视为听牌，合并其有效牌
+static bool collect_candidate(void *context, const enum_result_t *result) {
+    if (result->shanten == std::numeric_limits<int>::max()) {
+        return true;
+    }
+
+    candidate_list_t *list = static_cast<candidate_list_t *>(context);
+    discard_candidate_t *candidate = list->count > 0 ? &list->candidates[list->count - 1] : nullptr;
+    if (candidate == nullptr || candidate->discard_tile != result->discard_tile) {
+        candidate = &list->candidates[list->count++];
+        candidate->discard_tile = result->discard_tile;
+        candidate->shanten = result->shanten;
+        memcpy(candidate->useful_table, result->useful_table, sizeof(useful_table_t));
+        return true;
+    }
+
+    const int level = std::max(result->shanten, 0), current_level = std::max(candidate->shanten, 0);
+    if (level < current_level) {
+        memcpy(candidate->useful_table, result->useful_table, sizeof(useful_table_t));
+    }
+    else if (level == current_level) {
+        for (tile_t t : all_tiles) {
+            candidate->useful_table[t] |= result->useful_table[t];
+        }
+    }
+    candidate->shanten = std::min(candidate->shanten, result->shanten);
+    return true;
+}
+
+// 有效牌的剩余张数
+static int count_useful_tile(const useful_table_t &useful_table, const tile_table_t &unseen_table) {
+    int cnt = 0;
+    for (tile_t t : all_tiles) {
+        if (useful_table[t]) {
+            cnt += unseen_table[t];
+        }
+    }
+    return cnt;
+}
+
+// 选择上听数最小、有效牌剩余张数最多的打法，相同时取先枚举到的
+static intptr_t select_candidate(const candidate_list_t &list, const tile_table_t &unseen_table) {
+    intptr_t best_idx = -1;
+    int best_level = std::numeric_limits<int>::max(), best_cnt = -1;
+    for (intptr_t i = 0; i < list.count; ++i) {
+        const discard_candidate_t &candidate = list.candidates[i];
+        const int level = std::max(candidate.shanten, 0);
+        if (level > best_level) {
+            continue;
+        }
+        const int cnt = count_useful_tile(candidate.useful_table, unseen_table);
+        if (level < best_level || cnt > best_cnt) {
+            best_idx = i;
+            best_level = level;
+            best_cnt = cnt;
+        }
+    }
+    return best_idx;
+}
+
+// 按打法打出一张牌，serving_tile为上牌
+static void apply_candidate(const discard_candidate_t &candidate, tile_t serving_tile, play_state_t *state) {
+    if (candidate.discard_tile != serving_tile) {
+        tile_t *standing_tiles = state->hand_tiles.standing_tiles;
+        *std::find(standing_tiles, standing_tiles + state->hand_tiles.tile_count, candidate.discard_tile) = serving_tile;
+    }
+    state->shanten = std::max(candidate.shanten, 0);
+    memcpy(state->useful_table, candidate.useful_table, sizeof(useful_table_t));
+}
+
+// 判断是否和牌，只判断form_flag指定的和型
+static bool is_win(const hand_tiles_t &hand_tiles, tile_t win_tile, uint8_t form_flag) {
+    const tile_t *standing_tiles = hand_tiles.standing_tiles;
+    const intptr_t standing_cnt = hand_tiles.tile_count;
+    if ((form_flag & FORM_FLAG_BASIC_FORM) && is_basic_form_win(standing_tiles, standing_cnt, win_tile)) {
+        return true;
+    }
+    if (standing_cnt == 13) {
+        if ((form_flag & FORM_FLAG_SEVEN_PAIRS) && is_seven_pairs_win(standing_tiles, standing_cnt, win_tile)) {
+            return true;
+        }
+        if ((form_flag & FORM_FLAG_THIRTEEN_ORPHANS) && is_thirteen_orphans_win(standing_tiles, standing_cnt, win_tile)) {
+            return true;
+        }
+        if ((form_flag & FORM_FLAG_HONORS_AND_KNITTED_TILES) && is_honors_and_knitted_tiles_win(standing_tiles, standing_cnt, win_tile)) {
+            return true;
+        }
+    }
+    if (standing_cnt == 13 || standing_cnt == 10) {
+        if ((form_flag & FORM_FLAG_KNITTED_STRAIGHT) && is_knitted_straight_win(standing_tiles, standing_cnt, win_tile)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// 均匀地取[0, n)中的随机整数，n很小，偏差可以忽略
+static FORCE_INLINE intptr_t random_below(std::mt19937_64 &rng, intptr_t n) {
+    return static_cast<intptr_t>(((rng() >> 32) * static_cast<uint64_t>(n)) >> 32);
+}
+
+// 每批的随机数种子，只由总种子、打出的牌与批次决定
+static uint64_t batch_seed(uint64_t seed, tile_t discard_tile, size_t batch_idx) {
+    uint64_t x = seed ^ (static_cast<uint64_t>(discard_tile) << 48) ^ static_cast<uint64_t>(batch_idx);
+    // splitmix64
+    x += UINT64_C(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+
+// 模拟一次，wall为可摸到的牌，前draw_cnt张会被打乱
+static void simulate_once(const simulation_t &sim, const play_state_t &initial_state, tile_t *wall, std::mt19937_64 &rng,
+        batch_task_t *task) {
+    const win_rate_param_t *param = sim.param;
+    play_state_t state = initial_state;
+    tile_table_t unseen_table;
+    memcpy(unseen_table, param->wall_table, sizeof(unseen_table));
+    bool completed = false;
+
+    for (intptr_t i = 0; i < sim.draw_cnt; ++i) {
+        // 不放回地随机摸一张
+        std::swap(wall[i], wall[i + random_below(rng, sim.wall_cnt - i)]);
+        const tile_t t = wall[i];
+        --unseen_table[t];
+
+        // 不是有效牌，摸切
+        if (!state.useful_table[t]) {
+            continue;
+        }
+
+        if (state.shanten == 0 && is_win(state.hand_tiles, t, param->form_flag)) {
+            completed = true;
+            calculate_param_t calculate_param;
+            memcpy(&calculate_param.hand_tiles, &state.hand_tiles, sizeof(hand_tiles_t));
+            calculate_param.win_tile = t;
+            calculate_param.flower_count = param->flower_count;
+            calculate_param.win_flag = WIN_FLAG_SELF_DRAWN;
+            calculate_param.prevalent_wind = param->prevalent_wind;
+            calculate_param.seat_wind = param->seat_wind;
+            const int fan = calculate_fan(&calculate_param, nullptr);
+            if (fan >= std::max(param->min_fan, 0)) {
+                ++task->qualified_cnt;
+                task->fan_sum += static_cast<uint64_t>(fan);
+                break;
+            }
+            // 番数不足，继续打牌
+        }
+
+        candidate_list_t list;
+        list.count = 0;
+        sim.shanten_cache->enum_discard_tile(&state.hand_tiles, t, param->form_flag, &list, &collect_candidate);
+        const intptr_t idx = select_candidate(list, unseen_table);
+        if (idx >= 0) {
+            apply_candidate(list.candidates[idx], t, &state);
+        }
+    }
+
+    if (completed) {
+        ++task->win_cnt;
+    }
+}
+
+namespace {
+    // 一轮模拟的工作状态
+    struct round_context_t {
+        const simulation_t *sim;
+        std::vector<batch_task_t> *tasks;
+        std::atomic<size_t> next_idx;
+    };
+}
+
+// 执行一批模拟
+static void run_batch(const simulation_t &sim, std::mt19937_64 &rng, batch_task_t *task) {
+    // 每批从同样顺序的牌开始，保证结果与哪个线程执行无关
+    tile_t wall[136];
+    memcpy(wall, sim.wall, sizeof(tile_t) * sim.wall_cnt);
+    rng.seed(batch_seed(sim.seed, sim.candidate_tiles[task->candidate_idx], task->batch_idx));
+
+    const play_state_t &initial_state = sim.initial_states[task->candidate_idx];
+    for (size_t i = 0; i < task->sample_cnt; ++i) {
+        simulate_once(sim, initial_state, wall, rng, task);
+    }
+}
+
+// 反复领取批次来执行
+static void run_round_batches(void *context) {
+    round_context_t *round = static_cast<round_context_t *>(context);
+    std::mt19937_64 rng;  // 每个线程一个随机数引擎，每批重新设种子
+    for (;;) {
+        size_t idx = round->next_idx.fetch_add(1);
+        if (idx >= round->tasks->size()) {
+            break;
+        }
+        run_batch(*round->sim, rng, &(*round->tasks)[idx]);
+    }
+}
+
+// 多线程执行一轮的所有批次
+static void run_batches(const simulation_t &sim, std::vector<batch_task_t> &tasks, int thread_cnt) {
+    round_context_t round;
+    round.sim = &sim;
+    round.tasks = &tasks;
+    round.next_idx = 0;
+
+    // 调用者的线程也参与计算，所以只需另用thread_cnt-1个工作线程
+    size_t worker_cnt = std::min(static_cast<size_t>(thread_cnt - 1), tasks.size() - 1);
+    parallel_job_t job(&run_round_batches, &round);
+    job.start(worker_cnt);
+    run_round_batches(&round);
+    job.wait();
+}
+
+// 计算Wilson置信区间
+static void wilson_interval(size_t success_cnt, size_t sample_cnt, double z, double *lower, double *upper) {
+    if (sample_cnt == 0) {
+        *lower = 0.0;
+        *upper = 1.0;
+        return;
+    }
+    const double n = static_cast<double>(sample_cnt);
+    const double p = static_cast<double>(success_cnt) / n;
+    const double z2 = z * z;
+    const double denominator = 1.0 + z2 / n;
+    const double center = (p + z2 / (2.0 * n)) / denominator;
+    const double half = z * sqrt(p * (1.0 - p) / n + z2 / (4.0 * n * n)) / denominator;
+    *lower = std::max(center - half, 0.0);
+    *upper = std::min(center + half, 1.0);
+}
+
+// 用蒙特卡洛模拟估计各种打法的和牌率
+intptr_t estimate_win_rate(const win_rate_param_t *param, const monte_carlo_option_t *option,
+        win_rate_result_t *results, intptr_t max_cnt, int thread_cnt) {
+    static const size_t batch_size = 64;
+
+    const hand_tiles_t &hand_tiles = param->hand_tiles;
+    if (param->serving_tile == 0 || hand_tiles.tile_count != 13 - hand_tiles.pack_count * 3
+        || check_calculator_input(&hand_tiles, param->serving_tile) != 0) {
+        return 0;
+    }
+
+    thread_cnt = parallel_thread_count(thread_cnt);
+
+    simulation_t sim;
+    // 各线程同时查询，分片使其很少在同一把锁上等待
+    shanten_cache_t shanten_cache(SHANTEN_CACHE_CAPACITY, thread_cnt > 1 ? SHANTEN_CACHE_SHARD_CNT : 1);
+    sim.param = param;
+    sim.shanten_cache = &shanten_cache;
+    sim.seed = option->seed;
+    sim.wall_cnt = 0;
+    for (tile_t t : all_tiles) {
+        for (int i = 0; i < param->wall_table[t] && sim.wall_cnt < 136; ++i) {
+            sim.wall[sim.wall_cnt++] = t;
+        }
+    }
+    sim.draw_cnt = std::min(static_cast<intptr_t>(std::max(param->draw_count, 0)), sim.wall_cnt);
+
+    // 各种打法及打出之后的状态
+    candidate_list_t list;
+    list.count = 0;
+    enum_discard_tile(&hand_tiles, param->serving_tile, param->form_flag, &list, &collect_candidate);
+    std::vector<win_rate_result_t> stats(list.count);
+    for (intptr_t i = 0; i < list.count; ++i) {
+        const discard_candidate_t &candidate = list.candidates[i];
+        play_state_t state;
+        memcpy(&state.hand_tiles, &hand_tiles, sizeof(hand_tiles_t));
+        apply_candidate(candidate, param->serving_tile, &state);
+        sim.candidate_tiles.push_back(candidate.discard_tile);
+        sim.initial_states.push_back(state);
+
+        win_rate_result_t &stat = stats[i];
+        memset(&stat, 0, sizeof(stat));
+        stat.discard_tile = candidate.discard_tile;
+        stat.shanten = candidate.shanten;
+        stat.lower = 0.0;
+        stat.upper = 1.0;
+    }
+
+    // 每轮各打法模拟的批数固定，提前结束的判断与线程数无关
+    const size_t round_batches = std::max<size_t>((option->round_samples + batch_size - 1) / batch_size, 1);
+    std::vector<bool> active(list.count, option->max_samples > 0);
+    std::vector<size_t> batch_cnts(list.count, 0);
+    std::vector<batch_task_t> tasks;
+    for (;;) {
+        tasks.clear();
+        for (intptr_t i = 0; i < list.count; ++i) {
+            for (size_t k = 0; active[i] && k < round_batches; ++k) {
+                const size_t done = batch_cnts[i] * batch_size;
+                if (done >= option->max_samples) {
+                    break;
+                }
+                batch_task_t task;
+                memset(&task, 0, sizeof(task));
+                task.candidate_idx = i;
+                task.batch_idx = batch_cnts[i]++;
+                task.sample_cnt = std::min(batch_size, option->max_samples - done);
+                tasks.push_back(task);
+            }
+        }
+        if (tasks.empty()) {
+            break;
+        }
+
+        run_batches(sim, tasks, thread_cnt);
+
+        for (const batch_task_t &task : tasks) {
+            win_rate_result_t &stat = stats[task.candidate_idx];
+            stat.sample_count += task.sample_cnt;
+            stat.win_count += task.win_cnt;
+            stat.qualified_count += task.qualified_cnt;
+            stat.fan_sum += task.fan_sum;
+        }
+
+        // 更新置信区间，上界低于最好打法下界的打法不再模拟
+        double best_lower = 0.0;
+        for (win_rate_result_t &stat : stats) {
+            wilson_interval(stat.qualified_count, stat.sample_count, option->z, &stat.lower, &stat.upper);
+            best_lower = std::max(best_lower, stat.lower);
+        }
+        intptr_t active_cnt = 0;
+        for (intptr_t i = 0; i < list.count; ++i) {
+            if (active[i] && (stats[i].upper < best_lower || stats[i].sample_count >= option->max_samples)) {
+                active[i] = false;
+            }
+            active_cnt += active[i] ? 1 : 0;
+        }
+        if (active_cnt <= 1) {
+            break;
+        }
+    }
+
+    // 按达到起和番的和牌率从高到低排列，相同时上听数小的在前
+    std::stable_sort(stats.begin(), stats.end(), [](const win_rate_result_t &a, const win_rate_result_t &b) {
+        const double rate_a = a.sample_count > 0 ? static_cast<double>(a.qualified_count) / static_cast<double>(a.sample_count) : 0.0;
+        const double rate_b = b.sample_count > 0 ? static_cast<double>(b.qualified_count) / static_cast<double>(b.sample_count) : 0.0;
+        return rate_a != rate_b ? rate_a > rate_b : a.shanten < b.shanten;
+    });
+
+    const intptr_t cnt = std::min(static_cast<intptr_t>(stats.size()), max_cnt);
+    std::copy(stats.begin(), stats.begin() + cnt, results);
+    return cnt;
+}
+
+
+namespace {
+    // 和牌率与番数期望
+    struct expectation_t {
+        double win_rate;
+        double expected_fan;
+    };
+
+    // 立牌的上听数与有效牌
+    struct hand_eval_t {
+        int shanten;                // 各和型上听数的最小值，不小于0
+        tile_set_t useful_set;      // 上听数最小的各和型有效牌的并集
+    };
+
+    // 立牌摸进一张牌之后的打法
+    struct draw_eval_t {
+        int min_level;              // 打出之后上听数的最小值
+        tile_set_t discard_set;     // 打出之后上听数最小的牌
+    };
+
+    // 动态规划的键
+    struct solve_key_t {
+        uint64_t hand;              // 立牌张数向量、剩余摸牌数与和牌张，见MEMO_KEY_*
+        uint64_t drawn[2];          // 各种牌已摸走的张数，每种3位，只记录之后可能成为有效牌的
+    };
+}
+
+static FORCE_INLINE bool operator==(const solve_key_t &a, const solve_key_t &b) {
+    return a.hand == b.hand && a.drawn[0] == b.drawn[0] && a.drawn[1] == b.drawn[1];
+}
+
+// 记忆化表的键的哈希值与空位判断，立牌张数向量的编码不为0
+static FORCE_INLINE uint64_t memo_key_hash(uint64_t key) {
+    return hand_code_hash(key);
+}
+
+static FORCE_INLINE uint64_t memo_key_hash(const solve_key_t &key) {
+    return hand_code_hash(key.hand ^ hand_code_hash(key.drawn[0] ^ hand_code_hash(key.drawn[1])));
+}
+
+static FORCE_INLINE bool memo_key_empty(uint64_t key) {
+    return key == 0;
+}
+
+static FORCE_INLINE bool memo_key_empty(const solve_key_t &key) {
+    return key.hand == 0;
+}
+
+namespace {
+    // 记忆化表，开放寻址，表满时覆盖
+    template <class key_t, class value_t>
+    class memo_table_t {
+    public:
+        // 容量取不超过内存上限的最大的2的幂，连一项都放不下时不缓存
+        explicit memo_table_t(size_t budget) : _mask(0) {
+            if (budget < sizeof(entry_t)) {
+                return;
+            }
+            size_t capacity = 1;
+            while (capacity * 2 * sizeof(entry_t) <= budget) {
+                capacity *= 2;
+            }
+            _entries.resize(capacity);
+            memset(&_entries[0], 0, capacity * sizeof(entry_t));
+            _mask = capacity - 1;
+        }
+
+        bool find(const key_t &key, value_t *value) const {
+            if (_entries.empty()) {
+                return false;
+            }
+            const size_t home = static_cast<size_t>(memo_key_hash(key));
+            for (size_t i = 0; i < PROBE_COUNT; ++i) {
+                const entry_t &entry = _entries[(home + i) & _mask];
+                if (entry.key == key) {
+                    *value = entry.value;
+                    return true;
+                }
+                if (memo_key_empty(entry.key)) {
+                    break;
+                }
+            }
+            return false;
+        }
+
+        void insert(const key_t &key, const value_t &value) {
+            if (_entries.empty()) {
+                return;
+            }
+            const size_t home = static_cast<size_t>(memo_key_hash(key));
+            size_t slot = home & _mask;  // 探测范围内都被占用时，覆盖第一个位置
+            for (size_t i = 0; i < PROBE_COUNT; ++i) {
+                const size_t idx = (home + i) & _mask;
+                if (memo_key_empty(_entries[idx].key) || _entries[idx].key == key) {
+                    slot = idx;
+                    break;
+                }
+            }
+            _entries[slot].key = key;
+            _entries[slot].value = value;
+        }
+
+    private:
+        static const size_t PROBE_COUNT = 8;
+
+        struct entry_t {
+            key_t key;  // 全0表示空位
+            value_t value;
+        };
+
+        std::vector<entry_t> _entries;
+        size_t _mask;
+    };
+
+    // 动态规划的共享数据
+    struct solver_t {
+        const win_rate_param_t *param;
+        memo_table_t<solve_key_t, expectation_t> *memo;     // 和牌率与番数期望，以及和牌的番数
+        memo_table_t<uint64_t, hand_eval_t> *evals;         // 立牌的上听数与有效牌
+        memo_table_t<uint64_t, draw_eval_t> *draws;         // 立牌摸进一张牌之后的打法
+        memo_table_t<uint64_t, tile_set_t> *relevants;      // 立牌在剩余摸牌中可能成为有效牌的牌
+        intptr_t wall_cnt;          // 牌墙的初始张数
+        int draw_cnt;               // 最多摸牌数
+    };
+}
+
+// 记忆化的键：低48位为立牌张数向量（每种牌依次写入与张数相同个数的0再写入一个1），其上8位为剩余摸牌数，
+// 再上6位为和牌张的序号加1（仅用于记录番数）
+#define MEMO_KEY_DRAW_SHIFT 48
+#define MEMO_KEY_WIN_TILE_SHIFT 56
+
+// 立牌张数向量的编码
+static uint64_t count_vector_code(const tile_table_t &cnt_table) {
+    uint64_t code = 0;
+    for (tile_t t : all_tiles) {
+        code = (code << (cnt_table[t] + 1)) | 1;
+    }
+    return code;
+}
+
+// 听牌时摸到tile自摸和牌的番数，不能和牌时为-1。hand_tiles只提供副露，立牌由cnt_table给出，同一手牌同一和牌张只算一次
+static int self_drawn_fan(solver_t &solver, const hand_tiles_t &hand_tiles, const tile_table_t &cnt_table, uint64_t hand_code, tile_t tile) {
+    const solve_key_t key = { hand_code | static_cast<uint64_t>(tile_counts_index(tile) + 1) << MEMO_KEY_WIN_TILE_SHIFT, { 0, 0 } };
+    expectation_t value;
+    if (solver.memo->find(key, &value)) {
+        return static_cast<int>(value.expected_fan);
+    }
+
+    const win_rate_param_t *param = solver.param;
+    calculate_param_t calculate_param;
+    memcpy(&calculate_param.hand_tiles, &hand_tiles, sizeof(hand_tiles_t));
+    table_to_tiles(cnt_table, calculate_param.hand_tiles.standing_tiles, calculate_param.hand_tiles.tile_count);
+    int fan = -1;
+    if (is_win(calculate_param.hand_tiles, tile, param->form_flag)) {
+        calculate_param.win_tile = tile;
+        calculate_param.flower_count = param->flower_count;
+        calculate_param.win_flag = WIN_FLAG_SELF_DRAWN;
+        calculate_param.prevalent_wind = param->prevalent_wind;
+        calculate_param.seat_wind = param->seat_wind;
+        fan = calculate_fan(&calculate_param, nullptr);
+    }
+
+    value.win_rate = 0.0;
+    value.expected_fan = static_cast<double>(fan);
+    solver.memo->insert(key, value);
+    return fan;
+}
+
+// 是否更好：和牌率高，相同时番数期望高
+static FORCE_INLINE bool is_better(const expectation_t &a, const expectation_t &b) {
+    return a.win_rate != b.win_rate ? a.win_rate > b.win_rate : a.expected_fan > b.expected_fan;
+}
+
+// 计算立牌的上听数与有效牌，hand_tiles只提供副露，立牌由cnt_table给出，hand_code为其编码
+static hand_eval_t evaluate_hand(solver_t &solver, const hand_tiles_t &hand_tiles, const tile_table_t &cnt_table, uint64_t hand_code) {
+    hand_eval_t eval;
+    if (solver.evals->find(hand_code, &eval)) {
+        return eval;
+    }
+
+    hand_tiles_t temp;
+    memcpy(&temp, &hand_tiles, sizeof(temp));
+    table_to_tiles(cnt_table, temp.standing_tiles, temp.tile_count);
+
+    // 上牌为0时只计算手牌本身，结果只有一条
+    candidate_list_t list;
+    list.count = 0;
+    enum_discard_tile(&temp, 0, solver.param->form_flag, &list, &collect_candidate);
+    if (list.count > 0) {
+        eval.shanten = std::max(list.candidates[0].shanten, 0);
+        eval.useful_set = table_to_tile_set(list.candidates[0].useful_table);
+    }
+    else {
+        eval.shanten = std::numeric_limits<int>::max();
+        eval.useful_set = 0;
+    }
+    solver.evals->insert(hand_code, eval);
+    return eval;
+}
+
+// 立牌摸进tile之后打出哪些牌能使上听数最小，与牌墙无关，以立牌的编码与摸进的牌为键缓存
+static draw_eval_t evaluate_draw(solver_t &solver, const hand_tiles_t &hand_tiles, tile_table_t &cnt_table, uint64_t hand_code, tile_t tile) {
+    const uint64_t key = hand_code | static_cast<uint64_t>(tile_counts_index(tile) + 1) << MEMO_KEY_WIN_TILE_SHIFT;
+    draw_eval_t choice;
+    if (solver.draws->find(key, &choice)) {
+        return choice;
+    }
+
+    choice.min_level = std::numeric_limits<int>::max();
+    choice.discard_set = 0;
+    ++cnt_table[tile];
+    for (tile_t t : all_tiles) {
+        if (cnt_table[t] == 0) {
+            continue;
+        }
+        --cnt_table[t];
+        const int shanten = evaluate_hand(solver, hand_tiles, cnt_table, count_vector_code(cnt_table)).shanten;
+        ++cnt_table[t];
+        if (shanten < choice.min_level) {
+            choice.min_level = shanten;
+            choice.discard_set = tile_set_of(t);
+        }
+        else if (shanten == choice.min_level) {
+            choice.discard_set |= tile_set_of(t);
+        }
+    }
+    --cnt_table[tile];
+    solver.draws->insert(key, choice);
+    return choice;
+}
+
+// 还能摸draw_left张牌时，之后可能成为有效牌的牌：这手立牌的有效牌，以及摸到有效牌并打出之后，剩下的摸牌中
+// 可能成为有效牌的牌。摸到其余的牌只会摸切，它们被摸走多少张不影响之后的概率
+static tile_set_t relevant_tiles(solver_t &solver, const hand_tiles_t &hand_tiles, tile_table_t &cnt_table, uint64_t hand_code,
+        const hand_eval_t &eval, int draw_left) {
+    if (eval.shanten >= draw_left) {  // 摸不到和牌
+        return 0;
+    }
+
+    const uint64_t key = hand_code | static_cast<uint64_t>(draw_left) << MEMO_KEY_DRAW_SHIFT;
+    tile_set_t relevant_set;
+    if (solver.relevants->find(key, &relevant_set)) {
+        return relevant_set;
+    }
+
+    const int min_fan = std::max(solver.param->min_fan, 0);
+    if (draw_left == 1) {  // 听牌时只剩最后一张，只有达到起和番的和牌张有关
+        relevant_set = 0;
+        for (tile_set_t rest = eval.useful_set; rest != 0; rest &= rest - 1) {
+            const tile_t t = tile_set_first(rest);
+            if (self_drawn_fan(solver, hand_tiles, cnt_table, hand_code, t) >= min_fan) {
+                relevant_set |= tile_set_of(t);
+            }
+        }
+        solver.relevants->insert(key, relevant_set);
+        return relevant_set;
+    }
+
+    relevant_set = eval.useful_set;
+    for (tile_set_t rest = eval.useful_set; rest != 0; rest &= rest - 1) {
+        const tile_t t = tile_set_first(rest);
+        if (solver.param->wall_table[t] <= 0
+            || (eval.shanten == 0 && self_drawn_fan(solver, hand_tiles, cnt_table, hand_code, t) >= min_fan)) {
+            continue;
+        }
+
+        // 同solve，上听数最小的打法都要算上
+        const draw_eval_t choice = evaluate_draw(solver, hand_tiles, cnt_table, hand_code, t);
+        ++cnt_table[t];
+        for (tile_set_t discards = choice.discard_set; discards != 0; discards &= discards - 1) {
+            const tile_t d = tile_set_first(discards);
+            --cnt_table[d];
+            const uint64_t next_code = count_vector_code(cnt_table);
+            const hand_eval_t next_eval = evaluate_hand(solver, hand_tiles, cnt_table, next_code);
+            relevant_set |= relevant_tiles(solver, hand_tiles, cnt_table, next_code, next_eval, draw_left - 1);
+            ++cnt_table[d];
+        }
+        --cnt_table[t];
+    }
+
+    solver.relevants->insert(key, relevant_set);
+    return relevant_set;
+}
+
+// 还能摸draw_left张牌时的和牌率与番数期望。hand_tiles只提供副露，立牌由cnt_table给出，hand_code与eval为其编码、上听数与有效牌，
+// drawn_table为各种牌已从牌墙摸走的张数（无论摸进还是摸切）
+static expectation_t solve(solver_t &solver, const hand_tiles_t &hand_tiles, tile_table_t &cnt_table, uint64_t hand_code,
+        const hand_eval_t &eval, tile_table_t &drawn_table, int draw_left) {
+    expectation_t result = { 0.0, 0.0 };
+    if (eval.shanten >= draw_left) {  // 至少还要摸上听数+1张有效牌
+        return result;
+    }
+
+    const win_rate_param_t *param = solver.param;
+    const int min_fan = std::max(param->min_fan, 0);
+    const intptr_t remaining = solver.wall_cnt - (solver.draw_cnt - draw_left);
+
+    // 最后一张只看能否和牌，直接计算，不必记忆化
+    if (draw_left == 1) {
+        for (tile_set_t rest = eval.useful_set; rest != 0; rest &= rest - 1) {
+            const tile_t t = tile_set_first(rest);
+            const int left = param->wall_table[t] - drawn_table[t];
+            const int fan = left > 0 ? self_drawn_fan(solver, hand_tiles, cnt_table, hand_code, t) : -1;
+            if (fan >= min_fan) {
+                const double p = static_cast<double>(left) / static_cast<double>(remaining);
+                result.win_rate += p;
+                result.expected_fan += p * fan;
+            }
+        }
+        return result;
+    }
+
+    // 之后不会成为有效牌的牌摸走了多少张无关紧要，键中只记录可能成为有效牌的
+    const tile_set_t relevant_set = relevant_tiles(solver, hand_tiles, cnt_table, hand_code, eval, draw_left);
+    solve_key_t key = { hand_code | static_cast<uint64_t>(draw_left) << MEMO_KEY_DRAW_SHIFT, { 0, 0 } };
+    for (tile_set_t rest = relevant_set; rest != 0; rest &= rest - 1) {
+        const tile_t t = tile_set_first(rest);
+        const int i = tile_counts_index(t);
+        key.drawn[i / 17] |= static_cast<uint64_t>(drawn_table[t]) << (i % 17 * 3);
+    }
+    if (solver.memo->find(key, &result)) {
+        return result;
+    }
+
+    // 摸切的牌只有在剩下的摸牌中可能成为有效牌时才要分开计算，其余的与之后不会成为有效牌的牌合并
+    const tile_set_t branch_set = eval.useful_set | relevant_tiles(solver, hand_tiles, cnt_table, hand_code, eval, draw_left - 1);
+    intptr_t branch_left = 0;
+    for (tile_set_t rest = branch_set; rest != 0; rest &= rest - 1) {
+        const tile_t t = tile_set_first(rest);
+        const int left = param->wall_table[t] - drawn_table[t];
+        if (left <= 0) {
+            continue;
+        }
+        branch_left += left;
+        const double p = static_cast<double>(left) / static_cast<double>(remaining);
+
+        expectation_t value;
+        int fan = -1;
+        ++drawn_table[t];
+        if (!tile_set_contains(eval.useful_set, t)) {
+            // 摸切，手牌不变
+            value = solve(solver, hand_tiles, cnt_table, hand_code, eval, drawn_table, draw_left - 1);
+        }
+        else if (eval.shanten == 0 && (fan = self_drawn_fan(solver, hand_tiles, cnt_table, hand_code, t)) >= min_fan) {
+            value.win_rate = 1.0;
+            value.expected_fan = static_cast<double>(fan);
+        }
+        else {
+            // 番数不足时也继续打牌。在保持上听数最小的打法中选最好的
+            const draw_eval_t choice = evaluate_draw(solver, hand_tiles, cnt_table, hand_code, t);
+            value.win_rate = 0.0;
+            value.expected_fan = 0.0;
+            ++cnt_table[t];
+            for (tile_set_t discards = choice.discard_set; discards != 0; discards &= discards - 1) {
+                const tile_t d = tile_set_first(discards);
+                --cnt_table[d];
+                const uint64_t next_code = count_vector_code(cnt_table);
+                const hand_eval_t next_eval = evaluate_hand(solver, hand_tiles, cnt_table, next_code);
+                const expectation_t next_value = solve(solver, hand_tiles, cnt_table, next_code, next_eval, drawn_table, draw_left - 1);
+                ++cnt_table[d];
+                if (is_better(next_value, value)) {
+                    value = next_value;
+                }
+            }
+            --cnt_table[t];
+        }
+        --drawn_table[t];
+
+        result.win_rate += p * value.win_rate;
+        result.expected_fan += p * value.expected_fan;
+    }
+
+    // 其余的牌摸切，手牌不变，也不必记下摸走的是哪种
+    if (branch_left < remaining) {
+        const double p = static_cast<double>(remaining - branch_left) / static_cast<double>(remaining);
+        const expectation_t rest = solve(solver, hand_tiles, cnt_table, hand_code, eval, drawn_table, draw_left - 1);
+        result.win_rate += p * rest.win_rate;
+        result.expected_fan += p * rest.expected_fan;
+    }
+
+    solver.memo->insert(key, result);
+    return result;
+}
+
+// 精确计算各种打法的和牌率
+intptr_t calculate_win_rate(const win_rate_param_t *param, size_t memo_budget, win_expectation_t *results, intptr_t max_cnt) {
+    const hand_tiles_t &hand_tiles = param->hand_tiles;
+    if (param->serving_tile == 0 || hand_tiles.tile_count != 13 - hand_tiles.pack_count * 3
+        || check_calculator_input(&hand_tiles, param->serving_tile) != 0) {
+        return 0;
+    }
+
+    // 记忆化表占内存上限的1/2，立牌的上听数与有效牌、摸牌之后的打法、之后可能成为有效牌的牌各占1/6，此外不再另行缓存
+    memo_table_t<solve_key_t, expectation_t> memo(memo_budget / 2);
+    memo_table_t<uint64_t, hand_eval_t> evals(memo_budget / 6);
+    memo_table_t<uint64_t, draw_eval_t> draws(memo_budget / 6);
+    memo_table_t<uint64_t, tile_set_t> relevants(memo_budget / 6);
+    solver_t solver;
+    solver.param = param;
+    solver.memo = &memo;
+    solver.evals = &evals;
+    solver.draws = &draws;
+    solver.relevants = &relevants;
+    solver.wall_cnt = 0;
+    for (tile_t t : all_tiles) {
+        solver.wall_cnt += param->wall_table[t];
+    }
+    // 键中剩余摸牌数只有8位
+    solver.draw_cnt = static_cast<int>(std::min<intptr_t>(std::min<intptr_t>(std::max(param->draw_count, 0), solver.wall_cnt), 255));
+
+    candidate_list_t list;
+    list.count = 0;
+    enum_discard_tile(&hand_tiles, param->serving_tile, param->form_flag, &list, &collect_candidate);
+    std::vector<win_expectation_t> expectations(list.count);
+    for (intptr_t i = 0; i < list.count; ++i) {
+        const discard_candidate_t &candidate = list.candidates[i];
+        tile_table_t cnt_table;
+        map_tiles(hand_tiles.standing_tiles, hand_tiles.tile_count, &cnt_table);
+        ++cnt_table[param->serving_tile];
+        --cnt_table[candidate.discard_tile];
+        hand_eval_t eval;
+        eval.shanten = std::max(candidate.shanten, 0);
+        eval.useful_set = table_to_tile_set(candidate.useful_table);
+        tile_table_t drawn_table = { 0 };
+        const expectation_t value = solve(solver, hand_tiles, cnt_table, count_vector_code(cnt_table), eval, drawn_table, solver.draw_cnt);
+
+        win_expectation_t &expectation = expectations[i];
+        expectation.discard_tile = candidate.discard_tile;
+        expectation.shanten = candidate.shanten;
+        expectation.win_rate = value.win_rate;
+        expectation.expected_fan = value.expected_fan;
+    }
+
+    // 按和牌率从高到低排列，相同时番数期望高的在前
+    std::stable_sort(expectations.begin(), expectations.end(), [](const win_expectation_t &a, const win_expectation_t &b) {
+        return a.win_rate != b.win_rate ? a.win_rate > b.win_rate : a.expected_fan > b.expected_fan;
+    });
+
+    const intptr_t cnt = std::min(static_cast<intptr_t>(expectations.size()), max_cnt);
+    std::copy(expectations.begin(), expectations.begin() + cnt, results);
+    return cnt;
+}
+
+}
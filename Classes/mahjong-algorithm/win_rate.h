@@ -0,0 +1,124 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__WIN_RATE_H__
+#define __MAHJONG_ALGORITHM__WIN_RATE_H__
+
+#include "shanten.h"
+#include "fan_calculator.h"
+
+namespace mahjong {
+
+/**
+ * @addtogroup shanten
+ * @{
+ */
+
+/**
+ * @brief 和牌率计算的参数
+ */
+struct win_rate_param_t {
+    hand_tiles_t hand_tiles;    ///< 手牌（立牌数须为13-3*副露数）
+    tile_t serving_tile;        ///< 上牌
+    tile_table_t wall_table;    ///< 各种牌尚可摸到的张数，即场上未见的牌，不含手牌与上牌
+    int draw_count;             ///< 打牌之后最多再摸多少张牌（超过wall_table的总张数时按总张数算）
+    int min_fan;                ///< 起和番，不大于0时凑成和型即可
+    uint8_t form_flag;          ///< 计算哪些和型，见FORM_FLAG_*
+    uint8_t flower_count;       ///< 花牌数
+    wind_t prevalent_wind;      ///< 圈风
+    wind_t seat_wind;           ///< 门风
+};
+
+/**
+ * @brief 一种打法的和牌率
+ */
+struct win_rate_result_t {
+    tile_t discard_tile;        ///< 打这张牌
+    int shanten;                ///< 打这张牌之后各和型上听数的最小值，同enum_discard_tile
+    size_t sample_count;        ///< 模拟次数
+    size_t win_count;           ///< 凑成和型的次数（不论番数）
+    size_t qualified_count;     ///< 达到起和番的和牌次数
+    uint64_t fan_sum;           ///< 达到起和番的和牌的番数之和
+    double lower;               ///< 达到起和番的和牌率的置信下界
+    double upper;               ///< 达到起和番的和牌率的置信上界
+};
+
+/**
+ * @brief 蒙特卡洛模拟的选项
+ */
+struct monte_carlo_option_t {
+    size_t max_samples;         ///< 每种打法最多模拟多少次
+    size_t round_samples;       ///< 每轮每种打法模拟多少次，每轮之后检查置信区间
+    double z;                   ///< 置信区间的z值，如1.96对应95%，2.58对应99%
+    uint64_t seed;              ///< 随机数种子
+};
+
+/**
+ * @brief 用蒙特卡洛模拟估计各种打法的和牌率
+ *  每次模拟从wall_table中不放回地随机摸牌，摸到和牌张且番数达到起和番时自摸和牌，否则按上听数最小、
+ *  有效牌剩余张数最多的原则打牌（摸到的牌不是有效牌时摸切）。模拟分批进行，每批使用由种子、打法与批次决定的
+ *  独立随机数序列，所以结果与线程数无关，相同的参数总是得到相同的结果。
+ *  每轮之后计算各打法达到起和番的和牌率的Wilson置信区间，上界低于最好打法下界的打法停止模拟，只剩一种打法时提前结束
+ *
+ * @param [in] param 参数
+ * @param [in] option 模拟选项
+ * @param [out] results 各种打法的结果，按达到起和番的和牌率从高到低排列
+ * @param [in] max_cnt 结果的最大个数
+ * @param [in] thread_cnt 线程数（包括调用者的线程），不大于0时使用硬件支持的并发线程数
+ * @return intptr_t 结果的个数，参数不合法时返回0
+ */
+intptr_t estimate_win_rate(const win_rate_param_t *param, const monte_carlo_option_t *option,
+    win_rate_result_t *results, intptr_t max_cnt, int thread_cnt);
+
+/**
+ * @brief 一种打法的精确和牌率
+ */
+struct win_expectation_t {
+    tile_t discard_tile;        ///< 打这张牌
+    int shanten;                ///< 打这张牌之后各和型上听数的最小值，同enum_discard_tile
+    double win_rate;            ///< 达到起和番的和牌率
+    double expected_fan;        ///< 番数的期望，未和牌按0番计
+};
+
+/**
+ * @brief 精确计算各种打法的和牌率
+ *  对之后的摸牌与打牌做动态规划：摸到有效牌时在保持上听数最小的打法中选择和牌率最高（相同时番数期望最高）的，
+ *  摸到其他牌时摸切。摸到某种牌的概率为该牌剩余张数除以牌墙剩余张数，摸走的牌无论摸进还是摸切都从牌墙扣除。
+ *  以立牌的张数向量、剩余摸牌数以及之后可能成为有效牌的各种牌已摸走的张数为键记忆化，适合1~2上听的手牌。
+ *  起和番较高、听牌之后还要为凑番换牌时，状态数随摸牌数增长很快
+ *
+ * @param [in] param 参数
+ * @param [in] memo_budget 记忆化表占用内存的上限（字节），其中一半用于缓存立牌的上听数、摸牌之后的打法与之后可能成为有效牌的牌。各表的容量取不超过其份额的最大的2的幂，份额不足一项时该表不缓存，除此之外不占用其他缓存。表满时覆盖旧的结果，只影响速度，不影响结果
+ * @param [out] results 各种打法的结果，按和牌率从高到低排列
+ * @param [in] max_cnt 结果的最大个数
+ * @return intptr_t 结果的个数，参数不合法时返回0
+ */
+intptr_t calculate_win_rate(const win_rate_param_t *param, size_t memo_budget, win_expectation_t *results, intptr_t max_cnt);
+
+/**
+ * end group
+ * @}
+ */
+
+}
+
+#endif
@@ -0,0 +1,1833 @@
+﻿// 此文件由win_table_generator.cpp生成，请勿手动修改
+
+#ifndef __MAHJONG_ALGORITHM__WIN_TABLE_H__
+#define __MAHJONG_ALGORITHM__WIN_TABLE_H__
+
+#include <stdint.h>
+
+namespace mahjong {
+
+// 一门数牌能全部拆成面子的张数组合，按5进制将1~9的张数编码，升序排列
+static const uint32_t win_table_melds[2869] = {
+    0x000000, 0x000003, 0x00000F, 0x000012, 0x00001F, 0x000022, 0x00002E, 0x000031, 0x00003E, 0x00004B, 0x00004E, 0x00005A,
+    0x00005D, 0x00006A, 0x00006D, 0x000079, 0x00007C, 0x00009B, 0x00009E, 0x0000AA, 0x0000AD, 0x0000BA, 0x0000BD, 0x0000D9,
+    0x0000E6, 0x0000E9, 0x0000F5, 0x0000F8, 0x000136, 0x000139, 0x000155, 0x000158, 0x000174, 0x000177, 0x00017A, 0x000186,
+    0x000189, 0x000196, 0x000199, 0x0001A5, 0x0001A8, 0x0001B5, 0x0001C2, 0x0001C5, 0x0001D1, 0x0001D4, 0x0001E1, 0x0001E4,
+    0x0001F0, 0x000212, 0x000215, 0x000221, 0x000224, 0x000231, 0x000234, 0x000250, 0x00025D, 0x000260, 0x00026C, 0x000307,
+    0x00030A, 0x000316, 0x000319, 0x000326, 0x000329, 0x000335, 0x000338, 0x000345, 0x000352, 0x000355, 0x000361, 0x000364,
+    0x0003A2, 0x0003A5, 0x0003B1, 0x0003B4, 0x0003C1, 0x0003C4, 0x0003E0, 0x00043D, 0x000440, 0x00045C, 0x00047E, 0x000481,
+    0x00048D, 0x000490, 0x00049D, 0x0004A0, 0x0004AC, 0x0004BC, 0x0004C9, 0x0004CC, 0x0004D8, 0x00060E, 0x000611, 0x00061D,
+    0x000620, 0x00062D, 0x000630, 0x00063C, 0x00064C, 0x0006A9, 0x0006AC, 0x0006B8, 0x0006C8, 0x000744, 0x000753, 0x000756,
+    0x000762, 0x000765, 0x000772, 0x000775, 0x000781, 0x000784, 0x000791, 0x00079E, 0x0007A1, 0x0007AD, 0x0007B0, 0x0007BD,
+    0x0007C0, 0x0007CC, 0x0007EE, 0x0007F1, 0x0007FD, 0x000800, 0x00080D, 0x000810, 0x00082C, 0x000839, 0x00083C, 0x000848,
+    0x000889, 0x00088C, 0x0008A8, 0x0008CA, 0x0008CD, 0x0008D9, 0x0008DC, 0x0008E9, 0x0008EC, 0x0008F8, 0x000908, 0x000915,
+    0x000918, 0x000924, 0x000934, 0x000965, 0x000968, 0x000974, 0x000984, 0x0009B0, 0x000A5A, 0x000A5D, 0x000A69, 0x000A6C,
+    0x000A79, 0x000A7C, 0x000A88, 0x000A98, 0x000AA5, 0x000AA8, 0x000AB4, 0x000AF5, 0x000AF8, 0x000B04, 0x000B14, 0x000B90,
+    0x000BD1, 0x000BD4, 0x000BE0, 0x000BF0, 0x000C1C, 0x000F23, 0x000F26, 0x000F32, 0x000F35, 0x000F42, 0x000F45, 0x000F51,
+    0x000F54, 0x000F61, 0x000F6E, 0x000F71, 0x000F7D, 0x000F80, 0x000F8D, 0x000F90, 0x000F9C, 0x000FBE, 0x000FC1, 0x000FCD,
+    0x000FD0, 0x000FDD, 0x000FE0, 0x000FFC, 0x001009, 0x00100C, 0x001018, 0x001059, 0x00105C, 0x001078, 0x00109A, 0x00109D,
+    0x0010A9, 0x0010AC, 0x0010B9, 0x0010BC, 0x0010C8, 0x0010D8, 0x0010E5, 0x0010E8, 0x0010F4, 0x001104, 0x00122A, 0x00122D,
+    0x001239, 0x00123C, 0x001249, 0x00124C, 0x001258, 0x001268, 0x001275, 0x001278, 0x001284, 0x0012C5, 0x0012C8, 0x0012D4,
+    0x0012E4, 0x001360, 0x001531, 0x001534, 0x001540, 0x001550, 0x0015CC, 0x001676, 0x001679, 0x001685, 0x001688, 0x001695,
+    0x001698, 0x0016A4, 0x0016B4, 0x0016C1, 0x0016C4, 0x0016D0, 0x0016E0, 0x001711, 0x001714, 0x001720, 0x001730, 0x00175C,
+    0x0017AC, 0x0017ED, 0x0017F0, 0x0017FC, 0x00180C, 0x001838, 0x001E46, 0x001E49, 0x001E55, 0x001E58, 0x001E65, 0x001E68,
+    0x001E74, 0x001E84, 0x001E91, 0x001E94, 0x001EA0, 0x001EB0, 0x001EE1, 0x001EE4, 0x001EF0, 0x001F00, 0x001F2C, 0x001F7C,
+    0x00214D, 0x002150, 0x00215C, 0x00216C, 0x002198, 0x0021E8, 0x002454, 0x00249F, 0x0024A2, 0x0024AE, 0x0024B1, 0x0024BE,
+    0x0024C1, 0x0024CD, 0x0024D0, 0x0024DD, 0x0024EA, 0x0024ED, 0x0024F9, 0x0024FC, 0x002509, 0x00250C, 0x002518, 0x00253A,
+    0x00253D, 0x002549, 0x00254C, 0x002559, 0x00255C, 0x002578, 0x002585, 0x002588, 0x002594, 0x0025D5, 0x0025D8, 0x0025F4,
+    0x002616, 0x002619, 0x002625, 0x002628, 0x002635, 0x002638, 0x002644, 0x002654, 0x002661, 0x002664, 0x002670, 0x002680,
+    0x0026B1, 0x0026B4, 0x0026C0, 0x0026D0, 0x0026FC, 0x0027A6, 0x0027A9, 0x0027B5, 0x0027B8, 0x0027C5, 0x0027C8, 0x0027D4,
+    0x0027E4, 0x0027F1, 0x0027F4, 0x002800, 0x002841, 0x002844, 0x002850, 0x002860, 0x0028DC, 0x00291D, 0x002920, 0x00292C,
+    0x00293C, 0x002968, 0x002AAD, 0x002AB0, 0x002ABC, 0x002ACC, 0x002B48, 0x002BF2, 0x002BF5, 0x002C01, 0x002C04, 0x002C11,
+    0x002C14, 0x002C20, 0x002C30, 0x002C3D, 0x002C40, 0x002C4C, 0x002C5C, 0x002C8D, 0x002C90, 0x002C9C, 0x002CAC, 0x002CD8,
+    0x002D28, 0x002D69, 0x002D6C, 0x002D78, 0x002D88, 0x002DB4, 0x002E04, 0x002EF9, 0x002EFC, 0x002F08, 0x002F18, 0x002F44,
+    0x002F94, 0x003070, 0x0033C2, 0x0033C5, 0x0033D1, 0x0033D4, 0x0033E1, 0x0033E4, 0x0033F0, 0x003400, 0x00340D, 0x003410,
+    0x00341C, 0x00342C, 0x00345D, 0x003460, 0x00346C, 0x00347C, 0x0034A8, 0x0034F8, 0x003539, 0x00353C, 0x003548, 0x003558,
+    0x003584, 0x0036C9, 0x0036CC, 0x0036D8, 0x0036E8, 0x003714, 0x003764, 0x0039D0, 0x003B15, 0x003B18, 0x003B24, 0x003B34,
+    0x003B60, 0x003BB0, 0x003C8C, 0x004BAF, 0x004BB2, 0x004BBE, 0x004BC1, 0x004BCE, 0x004BD1, 0x004BDD, 0x004BE0, 0x004BED,
+    0x004BFA, 0x004BFD, 0x004C09, 0x004C0C, 0x004C19, 0x004C1C, 0x004C28, 0x004C4A, 0x004C4D, 0x004C59, 0x004C5C, 0x004C69,
+    0x004C6C, 0x004C88, 0x004C95, 0x004C98, 0x004CA4, 0x004CE5, 0x004CE8, 0x004D04, 0x004D26, 0x004D29, 0x004D35, 0x004D38,
+    0x004D45, 0x004D48, 0x004D54, 0x004D64, 0x004D71, 0x004D74, 0x004D80, 0x004D90, 0x004DC1, 0x004DC4, 0x004DD0, 0x004DE0,
+    0x004E0C, 0x004EB6, 0x004EB9, 0x004EC5, 0x004EC8, 0x004ED5, 0x004ED8, 0x004EE4, 0x004EF4, 0x004F01, 0x004F04, 0x004F10,
+    0x004F51, 0x004F54, 0x004F60, 0x004F70, 0x004FEC, 0x00502D, 0x005030, 0x00503C, 0x00504C, 0x005078, 0x0051BD, 0x0051C0,
+    0x0051CC, 0x0051DC, 0x005258, 0x005302, 0x005305, 0x005311, 0x005314, 0x005321, 0x005324, 0x005330, 0x005340, 0x00534D,
+    0x005350, 0x00535C, 0x00536C, 0x00539D, 0x0053A0, 0x0053AC, 0x0053BC, 0x0053E8, 0x005438, 0x005479, 0x00547C, 0x005488,
+    0x005498, 0x0054C4, 0x005514, 0x005AD2, 0x005AD5, 0x005AE1, 0x005AE4, 0x005AF1, 0x005AF4, 0x005B00, 0x005B10, 0x005B1D,
+    0x005B20, 0x005B2C, 0x005B3C, 0x005B6D, 0x005B70, 0x005B7C, 0x005B8C, 0x005BB8, 0x005C08, 0x005C49, 0x005C4C, 0x005C58,
+    0x005C68, 0x005C94, 0x005DD9, 0x005DDC, 0x005DE8, 0x005DF8, 0x005E24, 0x005E74, 0x0060E0, 0x0069F5, 0x0069F8, 0x006A04,
+    0x006A14, 0x006A40, 0x006A90, 0x006CFC, 0x00704E, 0x007051, 0x00705D, 0x007060, 0x00706D, 0x007070, 0x00707C, 0x00708C,
+    0x007099, 0x00709C, 0x0070A8, 0x0070B8, 0x0070E9, 0x0070EC, 0x0070F8, 0x007108, 0x007134, 0x007184, 0x0071C5, 0x0071C8,
+    0x0071D4, 0x0071E4, 0x007210, 0x007260, 0x007355, 0x007358, 0x007364, 0x007374, 0x0073A0, 0x0073F0, 0x0074CC, 0x00765C,
+    0x0077A1, 0x0077A4, 0x0077B0, 0x0077C0, 0x0077EC, 0x00783C, 0x007918, 0x00975E, 0x009761, 0x00976D, 0x009770, 0x00977D,
+    0x009780, 0x00978C, 0x00979C, 0x0097A9, 0x0097AC, 0x0097B8, 0x0097C8, 0x0097F9, 0x0097FC, 0x009808, 0x009818, 0x009844,
+    0x009894, 0x0098D5, 0x0098D8, 0x0098E4, 0x0098F4, 0x009920, 0x009970, 0x009A65, 0x009A68, 0x009A74, 0x009A84, 0x009AB0,
+    0x009B00, 0x009BDC, 0x009D6C, 0x00A681, 0x00A684, 0x00A690, 0x00A6A0, 0x00A6CC, 0x00A71C, 0x00A7F8, 0x00A988, 0x00B5A4,
+    0x00B71B, 0x00B71E, 0x00B72A, 0x00B72D, 0x00B73A, 0x00B73D, 0x00B749, 0x00B74C, 0x00B759, 0x00B766, 0x00B769, 0x00B775,
+    0x00B778, 0x00B785, 0x00B788, 0x00B794, 0x00B7B6, 0x00B7B9, 0x00B7C5, 0x00B7C8, 0x00B7D5, 0x00B7D8, 0x00B7F4, 0x00B801,
+    0x00B804, 0x00B810, 0x00B851, 0x00B854, 0x00B870, 0x00B892, 0x00B895, 0x00B8A1, 0x00B8A4, 0x00B8B1, 0x00B8B4, 0x00B8C0,
+    0x00B8D0, 0x00B8DD, 0x00B8E0, 0x00B8EC, 0x00B8FC, 0x00B92D, 0x00B930, 0x00B93C, 0x00B94C, 0x00B978, 0x00BA22, 0x00BA25,
+    0x00BA31, 0x00BA34, 0x00BA41, 0x00BA44, 0x00BA50, 0x00BA60, 0x00BA6D, 0x00BA70, 0x00BA7C, 0x00BABD, 0x00BAC0, 0x00BACC,
+    0x00BADC, 0x00BB58, 0x00BB99, 0x00BB9C, 0x00BBA8, 0x00BBB8, 0x00BBE4, 0x00BD29, 0x00BD2C, 0x00BD38, 0x00BD48, 0x00BDC4,
+    0x00BE6E, 0x00BE71, 0x00BE7D, 0x00BE80, 0x00BE8D, 0x00BE90, 0x00BE9C, 0x00BEAC, 0x00BEB9, 0x00BEBC, 0x00BEC8, 0x00BED8,
+    0x00BF09, 0x00BF0C, 0x00BF18, 0x00BF28, 0x00BF54, 0x00BFA4, 0x00BFE5, 0x00BFE8, 0x00BFF4, 0x00C004, 0x00C030, 0x00C080,
+    0x00C175, 0x00C178, 0x00C184, 0x00C194, 0x00C1C0, 0x00C210, 0x00C2EC, 0x00C63E, 0x00C641, 0x00C64D, 0x00C650, 0x00C65D,
+    0x00C660, 0x00C66C, 0x00C67C, 0x00C689, 0x00C68C, 0x00C698, 0x00C6A8, 0x00C6D9, 0x00C6DC, 0x00C6E8, 0x00C6F8, 0x00C724,
+    0x00C774, 0x00C7B5, 0x00C7B8, 0x00C7C4, 0x00C7D4, 0x00C800, 0x00C945, 0x00C948, 0x00C954, 0x00C964, 0x00C990, 0x00C9E0,
+    0x00CC4C, 0x00CD91, 0x00CD94, 0x00CDA0, 0x00CDB0, 0x00CDDC, 0x00CE2C, 0x00CF08, 0x00D561, 0x00D564, 0x00D570, 0x00D580,
+    0x00D5AC, 0x00D5FC, 0x00D868, 0x00DBBA, 0x00DBBD, 0x00DBC9, 0x00DBCC, 0x00DBD9, 0x00DBDC, 0x00DBE8, 0x00DBF8, 0x00DC05,
+    0x00DC08, 0x00DC14, 0x00DC24, 0x00DC55, 0x00DC58, 0x00DC64, 0x00DC74, 0x00DCA0, 0x00DCF0, 0x00DD31, 0x00DD34, 0x00DD40,
+    0x00DD50, 0x00DD7C, 0x00DDCC, 0x00DEC1, 0x00DEC4, 0x00DED0, 0x00DEE0, 0x00DF0C, 0x00DF5C, 0x00E038, 0x00E1C8, 0x00E30D,
+    0x00E310, 0x00E31C, 0x00E32C, 0x00E358, 0x00E3A8, 0x00E484, 0x00E614, 0x00EADD, 0x00EAE0, 0x00EAEC, 0x00EAFC, 0x00EB28,
+    0x00EB78, 0x00EC54, 0x00EDE4, 0x00F230, 0x0102CA, 0x0102CD, 0x0102D9, 0x0102DC, 0x0102E9, 0x0102EC, 0x0102F8, 0x010308,
+    0x010315, 0x010318, 0x010324, 0x010334, 0x010365, 0x010368, 0x010374, 0x010384, 0x0103B0, 0x010400, 0x010441, 0x010444,
+    0x010450, 0x010460, 0x01048C, 0x0104DC, 0x0105D1, 0x0105D4, 0x0105E0, 0x0105F0, 0x01061C, 0x01066C, 0x010748, 0x0108D8,
+    0x010A1D, 0x010A20, 0x010A2C, 0x010A3C, 0x010A68, 0x010AB8, 0x010B94, 0x0111ED, 0x0111F0, 0x0111FC, 0x01120C, 0x011238,
+    0x011288, 0x011364, 0x0114F4, 0x012110, 0x012769, 0x01276C, 0x012778, 0x012788, 0x0127B4, 0x012804, 0x0128E0, 0x012A70,
+    0x012EBC, 0x017A6B, 0x017A6E, 0x017A7A, 0x017A7D, 0x017A8A, 0x017A8D, 0x017A99, 0x017A9C, 0x017AA9, 0x017AB6, 0x017AB9,
+    0x017AC5, 0x017AC8, 0x017AD5, 0x017AD8, 0x017AE4, 0x017B06, 0x017B09, 0x017B15, 0x017B18, 0x017B25, 0x017B28, 0x017B44,
+    0x017B51, 0x017B54, 0x017B60, 0x017BA1, 0x017BA4, 0x017BC0, 0x017BE2, 0x017BE5, 0x017BF1, 0x017BF4, 0x017C01, 0x017C04,
+    0x017C10, 0x017C20, 0x017C2D, 0x017C30, 0x017C3C, 0x017C4C, 0x017C7D, 0x017C80, 0x017C8C, 0x017C9C, 0x017CC8, 0x017D72,
+    0x017D75, 0x017D81, 0x017D84, 0x017D91, 0x017D94, 0x017DA0, 0x017DB0, 0x017DBD, 0x017DC0, 0x017DCC, 0x017E0D, 0x017E10,
+    0x017E1C, 0x017E2C, 0x017EA8, 0x017EE9, 0x017EEC, 0x017EF8, 0x017F08, 0x017F34, 0x018079, 0x01807C, 0x018088, 0x018098,
+    0x018114, 0x0181BE, 0x0181C1, 0x0181CD, 0x0181D0, 0x0181DD, 0x0181E0, 0x0181EC, 0x0181FC, 0x018209, 0x01820C, 0x018218,
+    0x018228, 0x018259, 0x01825C, 0x018268, 0x018278, 0x0182A4, 0x0182F4, 0x018335, 0x018338, 0x018344, 0x018354, 0x018380,
+    0x0183D0, 0x0184C5, 0x0184C8, 0x0184D4, 0x0184E4, 0x018510, 0x018560, 0x01863C, 0x01898E, 0x018991, 0x01899D, 0x0189A0,
+    0x0189AD, 0x0189B0, 0x0189BC, 0x0189CC, 0x0189D9, 0x0189DC, 0x0189E8, 0x0189F8, 0x018A29, 0x018A2C, 0x018A38, 0x018A48,
+    0x018A74, 0x018AC4, 0x018B05, 0x018B08, 0x018B14, 0x018B24, 0x018B50, 0x018C95, 0x018C98, 0x018CA4, 0x018CB4, 0x018CE0,
+    0x018D30, 0x018F9C, 0x0190E1, 0x0190E4, 0x0190F0, 0x019100, 0x01912C, 0x01917C, 0x019258, 0x0198B1, 0x0198B4, 0x0198C0,
+    0x0198D0, 0x0198FC, 0x01994C, 0x019BB8, 0x019F0A, 0x019F0D, 0x019F19, 0x019F1C, 0x019F29, 0x019F2C, 0x019F38, 0x019F48,
+    0x019F55, 0x019F58, 0x019F64, 0x019F74, 0x019FA5, 0x019FA8, 0x019FB4, 0x019FC4, 0x019FF0, 0x01A040, 0x01A081, 0x01A084,
+    0x01A090, 0x01A0A0, 0x01A0CC, 0x01A11C, 0x01A211, 0x01A214, 0x01A220, 0x01A230, 0x01A25C, 0x01A2AC, 0x01A388, 0x01A518,
+    0x01A65D, 0x01A660, 0x01A66C, 0x01A67C, 0x01A6A8, 0x01A6F8, 0x01A7D4, 0x01A964, 0x01C61A, 0x01C61D, 0x01C629, 0x01C62C,
+    0x01C639, 0x01C63C, 0x01C648, 0x01C658, 0x01C665, 0x01C668, 0x01C674, 0x01C684, 0x01C6B5, 0x01C6B8, 0x01C6C4, 0x01C6D4,
+    0x01C700, 0x01C750, 0x01C791, 0x01C794, 0x01C7A0, 0x01C7B0, 0x01C7DC, 0x01C82C, 0x01C921, 0x01C924, 0x01C930, 0x01C940,
+    0x01C96C, 0x01C9BC, 0x01CA98, 0x01CC28, 0x01CD6D, 0x01CD70, 0x01CD7C, 0x01CD8C, 0x01CDB8, 0x01CE08, 0x01CEE4, 0x01D53D,
+    0x01D540, 0x01D54C, 0x01D55C, 0x01D588, 0x01D5D8, 0x01D6B4, 0x01D844, 0x01E460, 0x0211C9, 0x0211CC, 0x0211D8, 0x0211E8,
+    0x021214, 0x021264, 0x021340, 0x0214D0, 0x0220EC, 0x023186, 0x023189, 0x023195, 0x023198, 0x0231A5, 0x0231A8, 0x0231B4,
+    0x0231C4, 0x0231D1, 0x0231D4, 0x0231E0, 0x0231F0, 0x023221, 0x023224, 0x023230, 0x023240, 0x02326C, 0x0232BC, 0x0232FD,
+    0x023300, 0x02330C, 0x02331C, 0x023348, 0x023398, 0x02348D, 0x023490, 0x02349C, 0x0234AC, 0x0234D8, 0x023528, 0x023604,
+    0x023794, 0x0238D9, 0x0238DC, 0x0238E8, 0x0238F8, 0x023924, 0x023974, 0x023A50, 0x023BE0, 0x0240A9, 0x0240AC, 0x0240B8,
+    0x0240C8, 0x0240F4, 0x024144, 0x024220, 0x0243B0, 0x0247FC, 0x024FCC, 0x025625, 0x025628, 0x025634, 0x025644, 0x025670,
+    0x0256C0, 0x02579C, 0x02592C, 0x025D78, 0x02F4D6, 0x02F4D9, 0x02F4E5, 0x02F4E8, 0x02F4F5, 0x02F4F8, 0x02F504, 0x02F514,
+    0x02F521, 0x02F524, 0x02F530, 0x02F540, 0x02F571, 0x02F574, 0x02F580, 0x02F590, 0x02F5BC, 0x02F60C, 0x02F64D, 0x02F650,
+    0x02F65C, 0x02F66C, 0x02F698, 0x02F6E8, 0x02F7DD, 0x02F7E0, 0x02F7EC, 0x02F7FC, 0x02F828, 0x02F878, 0x02F954, 0x02FAE4,
+    0x02FC29, 0x02FC2C, 0x02FC38, 0x02FC48, 0x02FC74, 0x02FCC4, 0x02FDA0, 0x02FF30, 0x0303F9, 0x0303FC, 0x030408, 0x030418,
+    0x030444, 0x030494, 0x030570, 0x030700, 0x030B4C, 0x03131C, 0x034085, 0x034088, 0x034094, 0x0340A4, 0x0340D0, 0x034120,
+    0x0341FC, 0x03438C, 0x0347D8, 0x034FA8, 0x038C34, 0x039387, 0x03938A, 0x039396, 0x039399, 0x0393A6, 0x0393A9, 0x0393B5,
+    0x0393B8, 0x0393C5, 0x0393D2, 0x0393D5, 0x0393E1, 0x0393E4, 0x0393F1, 0x0393F4, 0x039400, 0x039422, 0x039425, 0x039431,
+    0x039434, 0x039441, 0x039444, 0x039460, 0x03946D, 0x039470, 0x03947C, 0x0394BD, 0x0394C0, 0x0394DC, 0x0394FE, 0x039501,
+    0x03950D, 0x039510, 0x03951D, 0x039520, 0x03952C, 0x03953C, 0x039549, 0x03954C, 0x039558, 0x039568, 0x039599, 0x03959C,
+    0x0395A8, 0x0395B8, 0x0395E4, 0x03968E, 0x039691, 0x03969D, 0x0396A0, 0x0396AD, 0x0396B0, 0x0396BC, 0x0396CC, 0x0396D9,
+    0x0396DC, 0x0396E8, 0x039729, 0x03972C, 0x039738, 0x039748, 0x0397C4, 0x039805, 0x039808, 0x039814, 0x039824, 0x039850,
+    0x039995, 0x039998, 0x0399A4, 0x0399B4, 0x039A30, 0x039ADA, 0x039ADD, 0x039AE9, 0x039AEC, 0x039AF9, 0x039AFC, 0x039B08,
+    0x039B18, 0x039B25, 0x039B28, 0x039B34, 0x039B44, 0x039B75, 0x039B78, 0x039B84, 0x039B94, 0x039BC0, 0x039C10, 0x039C51,
+    0x039C54, 0x039C60, 0x039C70, 0x039C9C, 0x039CEC, 0x039DE1, 0x039DE4, 0x039DF0, 0x039E00, 0x039E2C, 0x039E7C, 0x039F58,
+    0x03A2AA, 0x03A2AD, 0x03A2B9, 0x03A2BC, 0x03A2C9, 0x03A2CC, 0x03A2D8, 0x03A2E8, 0x03A2F5, 0x03A2F8, 0x03A304, 0x03A314,
+    0x03A345, 0x03A348, 0x03A354, 0x03A364, 0x03A390, 0x03A3E0, 0x03A421, 0x03A424, 0x03A430, 0x03A440, 0x03A46C, 0x03A5B1,
+    0x03A5B4, 0x03A5C0, 0x03A5D0, 0x03A5FC, 0x03A64C, 0x03A8B8, 0x03A9FD, 0x03AA00, 0x03AA0C, 0x03AA1C, 0x03AA48, 0x03AA98,
+    0x03AB74, 0x03B1CD, 0x03B1D0, 0x03B1DC, 0x03B1EC, 0x03B218, 0x03B268, 0x03B4D4, 0x03B826, 0x03B829, 0x03B835, 0x03B838,
+    0x03B845, 0x03B848, 0x03B854, 0x03B864, 0x03B871, 0x03B874, 0x03B880, 0x03B890, 0x03B8C1, 0x03B8C4, 0x03B8D0, 0x03B8E0,
+    0x03B90C, 0x03B95C, 0x03B99D, 0x03B9A0, 0x03B9AC, 0x03B9BC, 0x03B9E8, 0x03BA38, 0x03BB2D, 0x03BB30, 0x03BB3C, 0x03BB4C,
+    0x03BB78, 0x03BBC8, 0x03BCA4, 0x03BE34, 0x03BF79, 0x03BF7C, 0x03BF88, 0x03BF98, 0x03BFC4, 0x03C014, 0x03C0F0, 0x03C280,
+    0x03C749, 0x03C74C, 0x03C758, 0x03C768, 0x03C794, 0x03C7E4, 0x03C8C0, 0x03CA50, 0x03CE9C, 0x03DF36, 0x03DF39, 0x03DF45,
+    0x03DF48, 0x03DF55, 0x03DF58, 0x03DF64, 0x03DF74, 0x03DF81, 0x03DF84, 0x03DF90, 0x03DFA0, 0x03DFD1, 0x03DFD4, 0x03DFE0,
+    0x03DFF0, 0x03E01C, 0x03E06C, 0x03E0AD, 0x03E0B0, 0x03E0BC, 0x03E0CC, 0x03E0F8, 0x03E148, 0x03E23D, 0x03E240, 0x03E24C,
+    0x03E25C, 0x03E288, 0x03E2D8, 0x03E3B4, 0x03E544, 0x03E689, 0x03E68C, 0x03E698, 0x03E6A8, 0x03E6D4, 0x03E724, 0x03E800,
+    0x03EE59, 0x03EE5C, 0x03EE68, 0x03EE78, 0x03EEA4, 0x03EEF4, 0x03EFD0, 0x03F160, 0x03FD7C, 0x0403D5, 0x0403D8, 0x0403E4,
+    0x0403F4, 0x040420, 0x040470, 0x04054C, 0x0406DC, 0x040B28, 0x042AE5, 0x042AE8, 0x042AF4, 0x042B04, 0x042B30, 0x042B80,
+    0x042C5C, 0x042DEC, 0x043A08, 0x044AA2, 0x044AA5, 0x044AB1, 0x044AB4, 0x044AC1, 0x044AC4, 0x044AD0, 0x044AE0, 0x044AED,
+    0x044AF0, 0x044AFC, 0x044B0C, 0x044B3D, 0x044B40, 0x044B4C, 0x044B5C, 0x044B88, 0x044BD8, 0x044C19, 0x044C1C, 0x044C28,
+    0x044C38, 0x044C64, 0x044CB4, 0x044DA9, 0x044DAC, 0x044DB8, 0x044DC8, 0x044DF4, 0x044E44, 0x044F20, 0x0450B0, 0x0451F5,
+    0x0451F8, 0x045204, 0x045214, 0x045240, 0x045290, 0x04536C, 0x0454FC, 0x0459C5, 0x0459C8, 0x0459D4, 0x0459E4, 0x045A10,
+    0x045A60, 0x045B3C, 0x045CCC, 0x046118, 0x0468E8, 0x046F41, 0x046F44, 0x046F50, 0x046F60, 0x046F8C, 0x046FDC, 0x0470B8,
+    0x047248, 0x047694, 0x047E64, 0x049651, 0x049654, 0x049660, 0x049670, 0x04969C, 0x0496EC, 0x0497C8, 0x049958, 0x049DA4,
+    0x04A574, 0x04BAF0, 0x050DF2, 0x050DF5, 0x050E01, 0x050E04, 0x050E11, 0x050E14, 0x050E20, 0x050E30, 0x050E3D, 0x050E40,
+    0x050E4C, 0x050E5C, 0x050E8D, 0x050E90, 0x050E9C, 0x050EAC, 0x050ED8, 0x050F28, 0x050F69, 0x050F6C, 0x050F78, 0x050F88,
+    0x050FB4, 0x051004, 0x0510F9, 0x0510FC, 0x051108, 0x051118, 0x051144, 0x051194, 0x051270, 0x051400, 0x051545, 0x051548,
+    0x051554, 0x051564, 0x051590, 0x0515E0, 0x0516BC, 0x05184C, 0x051D15, 0x051D18, 0x051D24, 0x051D34, 0x051D60, 0x051DB0,
+    0x051E8C, 0x05201C, 0x052468, 0x052C38, 0x053291, 0x053294, 0x0532A0, 0x0532B0, 0x0532DC, 0x05332C, 0x053408, 0x053598,
+    0x0539E4, 0x0559A1, 0x0559A4, 0x0559B0, 0x0559C0, 0x0559EC, 0x055A3C, 0x055B18, 0x055CA8, 0x0560F4, 0x0568C4, 0x05A550,
+    0x05C50D, 0x05C510, 0x05C51C, 0x05C52C, 0x05C558, 0x05C5A8, 0x05C684, 0x05C814, 0x05CC60, 0x05D430, 0x05E9AC, 0x076417,
+    0x07641A, 0x076426, 0x076429, 0x076436, 0x076439, 0x076445, 0x076448, 0x076455, 0x076462, 0x076465, 0x076471, 0x076474,
+    0x076481, 0x076484, 0x076490, 0x0764B2, 0x0764B5, 0x0764C1, 0x0764C4, 0x0764D1, 0x0764D4, 0x0764F0, 0x0764FD, 0x076500,
+    0x07650C, 0x07654D, 0x076550, 0x07656C, 0x07658E, 0x076591, 0x07659D, 0x0765A0, 0x0765AD, 0x0765B0, 0x0765BC, 0x0765CC,
+    0x0765D9, 0x0765DC, 0x0765E8, 0x0765F8, 0x076629, 0x07662C, 0x076638, 0x076648, 0x076674, 0x07671E, 0x076721, 0x07672D,
+    0x076730, 0x07673D, 0x076740, 0x07674C, 0x07675C, 0x076769, 0x07676C, 0x076778, 0x0767B9, 0x0767BC, 0x0767C8, 0x0767D8,
+    0x076854, 0x076895, 0x076898, 0x0768A4, 0x0768B4, 0x0768E0, 0x076A25, 0x076A28, 0x076A34, 0x076A44, 0x076AC0, 0x076B6A,
+    0x076B6D, 0x076B79, 0x076B7C, 0x076B89, 0x076B8C, 0x076B98, 0x076BA8, 0x076BB5, 0x076BB8, 0x076BC4, 0x076BD4, 0x076C05,
+    0x076C08, 0x076C14, 0x076C24, 0x076C50, 0x076CA0, 0x076CE1, 0x076CE4, 0x076CF0, 0x076D00, 0x076D2C, 0x076D7C, 0x076E71,
+    0x076E74, 0x076E80, 0x076E90, 0x076EBC, 0x076F0C, 0x076FE8, 0x07733A, 0x07733D, 0x077349, 0x07734C, 0x077359, 0x07735C,
+    0x077368, 0x077378, 0x077385, 0x077388, 0x077394, 0x0773A4, 0x0773D5, 0x0773D8, 0x0773E4, 0x0773F4, 0x077420, 0x077470,
+    0x0774B1, 0x0774B4, 0x0774C0, 0x0774D0, 0x0774FC, 0x077641, 0x077644, 0x077650, 0x077660, 0x07768C, 0x0776DC, 0x077948,
+    0x077A8D, 0x077A90, 0x077A9C, 0x077AAC, 0x077AD8, 0x077B28, 0x077C04, 0x07825D, 0x078260, 0x07826C, 0x07827C, 0x0782A8,
+    0x0782F8, 0x078564, 0x0788B6, 0x0788B9, 0x0788C5, 0x0788C8, 0x0788D5, 0x0788D8, 0x0788E4, 0x0788F4, 0x078901, 0x078904,
+    0x078910, 0x078920, 0x078951, 0x078954, 0x078960, 0x078970, 0x07899C, 0x0789EC, 0x078A2D, 0x078A30, 0x078A3C, 0x078A4C,
+    0x078A78, 0x078AC8, 0x078BBD, 0x078BC0, 0x078BCC, 0x078BDC, 0x078C08, 0x078C58, 0x078D34, 0x078EC4, 0x079009, 0x07900C,
+    0x079018, 0x079028, 0x079054, 0x0790A4, 0x079180, 0x079310, 0x0797D9, 0x0797DC, 0x0797E8, 0x0797F8, 0x079824, 0x079874,
+    0x079950, 0x079AE0, 0x079F2C, 0x07AFC6, 0x07AFC9, 0x07AFD5, 0x07AFD8, 0x07AFE5, 0x07AFE8, 0x07AFF4, 0x07B004, 0x07B011,
+    0x07B014, 0x07B020, 0x07B030, 0x07B061, 0x07B064, 0x07B070, 0x07B080, 0x07B0AC, 0x07B0FC, 0x07B13D, 0x07B140, 0x07B14C,
+    0x07B15C, 0x07B188, 0x07B1D8, 0x07B2CD, 0x07B2D0, 0x07B2DC, 0x07B2EC, 0x07B318, 0x07B368, 0x07B444, 0x07B5D4, 0x07B719,
+    0x07B71C, 0x07B728, 0x07B738, 0x07B764, 0x07B7B4, 0x07B890, 0x07BEE9, 0x07BEEC, 0x07BEF8, 0x07BF08, 0x07BF34, 0x07BF84,
+    0x07C060, 0x07C1F0, 0x07CE0C, 0x07D465, 0x07D468, 0x07D474, 0x07D484, 0x07D4B0, 0x07D500, 0x07D5DC, 0x07D76C, 0x07DBB8,
+    0x07FB75, 0x07FB78, 0x07FB84, 0x07FB94, 0x07FBC0, 0x07FC10, 0x07FCEC, 0x07FE7C, 0x080A98, 0x081B32, 0x081B35, 0x081B41,
+    0x081B44, 0x081B51, 0x081B54, 0x081B60, 0x081B70, 0x081B7D, 0x081B80, 0x081B8C, 0x081B9C, 0x081BCD, 0x081BD0, 0x081BDC,
+    0x081BEC, 0x081C18, 0x081C68, 0x081CA9, 0x081CAC, 0x081CB8, 0x081CC8, 0x081CF4, 0x081D44, 0x081E39, 0x081E3C, 0x081E48,
+    0x081E58, 0x081E84, 0x081ED4, 0x081FB0, 0x082140, 0x082285, 0x082288, 0x082294, 0x0822A4, 0x0822D0, 0x082320, 0x0823FC,
+    0x08258C, 0x082A55, 0x082A58, 0x082A64, 0x082A74, 0x082AA0, 0x082AF0, 0x082BCC, 0x082D5C, 0x0831A8, 0x083978, 0x083FD1,
+    0x083FD4, 0x083FE0, 0x083FF0, 0x08401C, 0x08406C, 0x084148, 0x0842D8, 0x084724, 0x084EF4, 0x08DE82, 0x08DE85, 0x08DE91,
+    0x08DE94, 0x08DEA1, 0x08DEA4, 0x08DEB0, 0x08DEC0, 0x08DECD, 0x08DED0, 0x08DEDC, 0x08DEEC, 0x08DF1D, 0x08DF20, 0x08DF2C,
+    0x08DF3C, 0x08DF68, 0x08DFB8, 0x08DFF9, 0x08DFFC, 0x08E008, 0x08E018, 0x08E044, 0x08E094, 0x08E189, 0x08E18C, 0x08E198,
+    0x08E1A8, 0x08E1D4, 0x08E224, 0x08E300, 0x08E490, 0x08E5D5, 0x08E5D8, 0x08E5E4, 0x08E5F4, 0x08E620, 0x08E670, 0x08E74C,
+    0x08E8DC, 0x08EDA5, 0x08EDA8, 0x08EDB4, 0x08EDC4, 0x08EDF0, 0x08EE40, 0x08EF1C, 0x08F0AC, 0x08F4F8, 0x08FCC8, 0x090321,
+    0x090324, 0x090330, 0x090340, 0x09036C, 0x0903BC, 0x090498, 0x090628, 0x090A74, 0x092A31, 0x092A34, 0x092A40, 0x092A50,
+    0x092A7C, 0x092ACC, 0x092BA8, 0x092D38, 0x093184, 0x093954, 0x0975E0, 0x0A58ED, 0x0A58F0, 0x0A58FC, 0x0A590C, 0x0A5938,
+    0x0A5988, 0x0A5A64, 0x0A5BF4, 0x0A6040, 0x0A6810, 0x0AA49C, 0x0AF79E, 0x0AF7A1, 0x0AF7AD, 0x0AF7B0, 0x0AF7BD, 0x0AF7C0,
+    0x0AF7CC, 0x0AF7DC, 0x0AF7E9, 0x0AF7EC, 0x0AF7F8, 0x0AF808, 0x0AF839, 0x0AF83C, 0x0AF848, 0x0AF858, 0x0AF884, 0x0AF8D4,
+    0x0AF915, 0x0AF918, 0x0AF924, 0x0AF934, 0x0AF960, 0x0AF9B0, 0x0AFAA5, 0x0AFAA8, 0x0AFAB4, 0x0AFAC4, 0x0AFAF0, 0x0AFB40,
+    0x0AFC1C, 0x0AFDAC, 0x0AFEF1, 0x0AFEF4, 0x0AFF00, 0x0AFF10, 0x0AFF3C, 0x0AFF8C, 0x0B0068, 0x0B01F8, 0x0B06C1, 0x0B06C4,
+    0x0B06D0, 0x0B06E0, 0x0B070C, 0x0B075C, 0x0B0838, 0x0B09C8, 0x0B0E14, 0x0B15E4, 0x0B1C3D, 0x0B1C40, 0x0B1C4C, 0x0B1C5C,
+    0x0B1C88, 0x0B1CD8, 0x0B1DB4, 0x0B1F44, 0x0B2390, 0x0B2B60, 0x0B434D, 0x0B4350, 0x0B435C, 0x0B436C, 0x0B4398, 0x0B43E8,
+    0x0B44C4, 0x0B4654, 0x0B4AA0, 0x0B5270, 0x0B67EC, 0x0B8EFC, 0x0BAEB9, 0x0BAEBC, 0x0BAEC8, 0x0BAED8, 0x0BAF04, 0x0BAF54,
+    0x0BB030, 0x0BB1C0, 0x0BB60C, 0x0BBDDC, 0x0BD358, 0x0EC82E, 0x0EC831, 0x0EC83D, 0x0EC840, 0x0EC84D, 0x0EC850, 0x0EC85C,
+    0x0EC86C, 0x0EC879, 0x0EC87C, 0x0EC888, 0x0EC898, 0x0EC8C9, 0x0EC8CC, 0x0EC8D8, 0x0EC8E8, 0x0EC914, 0x0EC964, 0x0EC9A5,
+    0x0EC9A8, 0x0EC9B4, 0x0EC9C4, 0x0EC9F0, 0x0ECA40, 0x0ECB35, 0x0ECB38, 0x0ECB44, 0x0ECB54, 0x0ECB80, 0x0ECBD0, 0x0ECCAC,
+    0x0ECE3C, 0x0ECF81, 0x0ECF84, 0x0ECF90, 0x0ECFA0, 0x0ECFCC, 0x0ED01C, 0x0ED0F8, 0x0ED288, 0x0ED751, 0x0ED754, 0x0ED760,
+    0x0ED770, 0x0ED79C, 0x0ED7EC, 0x0ED8C8, 0x0EDA58, 0x0EDEA4, 0x0EE674, 0x0EECCD, 0x0EECD0, 0x0EECDC, 0x0EECEC, 0x0EED18,
+    0x0EED68, 0x0EEE44, 0x0EEFD4, 0x0EF420, 0x0EFBF0, 0x0F13DD, 0x0F13E0, 0x0F13EC, 0x0F13FC, 0x0F1428, 0x0F1478, 0x0F1554,
+    0x0F16E4, 0x0F1B30, 0x0F2300, 0x0F387C, 0x0F5F8C, 0x104299, 0x10429C, 0x1042A8, 0x1042B8, 0x1042E4, 0x104334, 0x104410,
+    0x1045A0, 0x1049EC, 0x1051BC, 0x106738, 0x108E48, 0x11BD04, 0x11E1A3, 0x11E1A6, 0x11E1B2, 0x11E1B5, 0x11E1C2, 0x11E1C5,
+    0x11E1D1, 0x11E1D4, 0x11E1E1, 0x11E1EE, 0x11E1F1, 0x11E1FD, 0x11E200, 0x11E20D, 0x11E210, 0x11E21C, 0x11E23E, 0x11E241,
+    0x11E24D, 0x11E250, 0x11E25D, 0x11E260, 0x11E27C, 0x11E289, 0x11E28C, 0x11E298, 0x11E2D9, 0x11E2DC, 0x11E2F8, 0x11E31A,
+    0x11E31D, 0x11E329, 0x11E32C, 0x11E339, 0x11E33C, 0x11E348, 0x11E358, 0x11E365, 0x11E368, 0x11E374, 0x11E384, 0x11E3B5,
+    0x11E3B8, 0x11E3C4, 0x11E3D4, 0x11E400, 0x11E4AA, 0x11E4AD, 0x11E4B9, 0x11E4BC, 0x11E4C9, 0x11E4CC, 0x11E4D8, 0x11E4E8,
+    0x11E4F5, 0x11E4F8, 0x11E504, 0x11E545, 0x11E548, 0x11E554, 0x11E564, 0x11E5E0, 0x11E621, 0x11E624, 0x11E630, 0x11E640,
+    0x11E66C, 0x11E7B1, 0x11E7B4, 0x11E7C0, 0x11E7D0, 0x11E84C, 0x11E8F6, 0x11E8F9, 0x11E905, 0x11E908, 0x11E915, 0x11E918,
+    0x11E924, 0x11E934, 0x11E941, 0x11E944, 0x11E950, 0x11E960, 0x11E991, 0x11E994, 0x11E9A0, 0x11E9B0, 0x11E9DC, 0x11EA2C,
+    0x11EA6D, 0x11EA70, 0x11EA7C, 0x11EA8C, 0x11EAB8, 0x11EB08, 0x11EBFD, 0x11EC00, 0x11EC0C, 0x11EC1C, 0x11EC48, 0x11EC98,
+    0x11ED74, 0x11F0C6, 0x11F0C9, 0x11F0D5, 0x11F0D8, 0x11F0E5, 0x11F0E8, 0x11F0F4, 0x11F104, 0x11F111, 0x11F114, 0x11F120,
+    0x11F130, 0x11F161, 0x11F164, 0x11F170, 0x11F180, 0x11F1AC, 0x11F1FC, 0x11F23D, 0x11F240, 0x11F24C, 0x11F25C, 0x11F288,
+    0x11F3CD, 0x11F3D0, 0x11F3DC, 0x11F3EC, 0x11F418, 0x11F468, 0x11F6D4, 0x11F819, 0x11F81C, 0x11F828, 0x11F838, 0x11F864,
+    0x11F8B4, 0x11F990, 0x11FFE9, 0x11FFEC, 0x11FFF8, 0x120008, 0x120034, 0x120084, 0x1202F0, 0x120642, 0x120645, 0x120651,
+    0x120654, 0x120661, 0x120664, 0x120670, 0x120680, 0x12068D, 0x120690, 0x12069C, 0x1206AC, 0x1206DD, 0x1206E0, 0x1206EC,
+    0x1206FC, 0x120728, 0x120778, 0x1207B9, 0x1207BC, 0x1207C8, 0x1207D8, 0x120804, 0x120854, 0x120949, 0x12094C, 0x120958,
+    0x120968, 0x120994, 0x1209E4, 0x120AC0, 0x120C50, 0x120D95, 0x120D98, 0x120DA4, 0x120DB4, 0x120DE0, 0x120E30, 0x120F0C,
+    0x12109C, 0x121565, 0x121568, 0x121574, 0x121584, 0x1215B0, 0x121600, 0x1216DC, 0x12186C, 0x121CB8, 0x122D52, 0x122D55,
+    0x122D61, 0x122D64, 0x122D71, 0x122D74, 0x122D80, 0x122D90, 0x122D9D, 0x122DA0, 0x122DAC, 0x122DBC, 0x122DED, 0x122DF0,
+    0x122DFC, 0x122E0C, 0x122E38, 0x122E88, 0x122EC9, 0x122ECC, 0x122ED8, 0x122EE8, 0x122F14, 0x122F64, 0x123059, 0x12305C,
+    0x123068, 0x123078, 0x1230A4, 0x1230F4, 0x1231D0, 0x123360, 0x1234A5, 0x1234A8, 0x1234B4, 0x1234C4, 0x1234F0, 0x123540,
+    0x12361C, 0x123C75, 0x123C78, 0x123C84, 0x123C94, 0x123CC0, 0x123D10, 0x123DEC, 0x123F7C, 0x124B98, 0x1251F1, 0x1251F4,
+    0x125200, 0x125210, 0x12523C, 0x12528C, 0x125368, 0x1254F8, 0x125944, 0x127901, 0x127904, 0x127910, 0x127920, 0x12794C,
+    0x12799C, 0x127A78, 0x127C08, 0x128824, 0x1298BE, 0x1298C1, 0x1298CD, 0x1298D0, 0x1298DD, 0x1298E0, 0x1298EC, 0x1298FC,
+    0x129909, 0x12990C, 0x129918, 0x129928, 0x129959, 0x12995C, 0x129968, 0x129978, 0x1299A4, 0x1299F4, 0x129A35, 0x129A38,
+    0x129A44, 0x129A54, 0x129A80, 0x129AD0, 0x129BC5, 0x129BC8, 0x129BD4, 0x129BE4, 0x129C10, 0x129C60, 0x129D3C, 0x129ECC,
+    0x12A011, 0x12A014, 0x12A020, 0x12A030, 0x12A05C, 0x12A0AC, 0x12A188, 0x12A318, 0x12A7E1, 0x12A7E4, 0x12A7F0, 0x12A800,
+    0x12A82C, 0x12A87C, 0x12A958, 0x12AAE8, 0x12AF34, 0x12B704, 0x12BD5D, 0x12BD60, 0x12BD6C, 0x12BD7C, 0x12BDA8, 0x12BDF8,
+    0x12BED4, 0x12C064, 0x12C4B0, 0x12CC80, 0x12E46D, 0x12E470, 0x12E47C, 0x12E48C, 0x12E4B8, 0x12E508, 0x12E5E4, 0x12E774,
+    0x12EBC0, 0x12F390, 0x13090C, 0x135C0E, 0x135C11, 0x135C1D, 0x135C20, 0x135C2D, 0x135C30, 0x135C3C, 0x135C4C, 0x135C59,
+    0x135C5C, 0x135C68, 0x135C78, 0x135CA9, 0x135CAC, 0x135CB8, 0x135CC8, 0x135CF4, 0x135D44, 0x135D85, 0x135D88, 0x135D94,
+    0x135DA4, 0x135DD0, 0x135E20, 0x135F15, 0x135F18, 0x135F24, 0x135F34, 0x135F60, 0x135FB0, 0x13608C, 0x13621C, 0x136361,
+    0x136364, 0x136370, 0x136380, 0x1363AC, 0x1363FC, 0x1364D8, 0x136668, 0x136B31, 0x136B34, 0x136B40, 0x136B50, 0x136B7C,
+    0x136BCC, 0x136CA8, 0x136E38, 0x137284, 0x137A54, 0x1380AD, 0x1380B0, 0x1380BC, 0x1380CC, 0x1380F8, 0x138148, 0x138224,
+    0x1383B4, 0x138800, 0x13A7BD, 0x13A7C0, 0x13A7CC, 0x13A7DC, 0x13A808, 0x13A858, 0x13A934, 0x13AAC4, 0x13AF10, 0x13B6E0,
+    0x13F36C, 0x141329, 0x14132C, 0x141338, 0x141348, 0x141374, 0x1413C4, 0x1414A0, 0x141630, 0x141A7C, 0x14224C, 0x1437C8,
+    0x14D679, 0x14D67C, 0x14D688, 0x14D698, 0x14D6C4, 0x14D714, 0x14D7F0, 0x14D980, 0x14DDCC, 0x14E59C, 0x152228, 0x15752A,
+    0x15752D, 0x157539, 0x15753C, 0x157549, 0x15754C, 0x157558, 0x157568, 0x157575, 0x157578, 0x157584, 0x157594, 0x1575C5,
+    0x1575C8, 0x1575D4, 0x1575E4, 0x157610, 0x157660, 0x1576A1, 0x1576A4, 0x1576B0, 0x1576C0, 0x1576EC, 0x15773C, 0x157831,
+    0x157834, 0x157840, 0x157850, 0x15787C, 0x1578CC, 0x1579A8, 0x157B38, 0x157C7D, 0x157C80, 0x157C8C, 0x157C9C, 0x157CC8,
+    0x157D18, 0x157DF4, 0x157F84, 0x15844D, 0x158450, 0x15845C, 0x15846C, 0x158498, 0x1584E8, 0x1585C4, 0x158754, 0x158BA0,
+    0x159370, 0x1599C9, 0x1599CC, 0x1599D8, 0x1599E8, 0x159A14, 0x159A64, 0x159B40, 0x159CD0, 0x15A11C, 0x15A8EC, 0x15C0D9,
+    0x15C0DC, 0x15C0E8, 0x15C0F8, 0x15C124, 0x15C174, 0x15C250, 0x15C3E0, 0x15C82C, 0x15CFFC, 0x15E578, 0x160C88, 0x162C45,
+    0x162C48, 0x162C54, 0x162C64, 0x162C90, 0x162CE0, 0x162DBC, 0x162F4C, 0x163398, 0x163B68, 0x1650E4, 0x1677F4, 0x16EF95,
+    0x16EF98, 0x16EFA4, 0x16EFB4, 0x16EFE0, 0x16F030, 0x16F10C, 0x16F29C, 0x16F6E8, 0x16FEB8, 0x171434, 0x173B44, 0x17A6B0,
+    0x1945BA, 0x1945BD, 0x1945C9, 0x1945CC, 0x1945D9, 0x1945DC, 0x1945E8, 0x1945F8, 0x194605, 0x194608, 0x194614, 0x194624,
+    0x194655, 0x194658, 0x194664, 0x194674, 0x1946A0, 0x1946F0, 0x194731, 0x194734, 0x194740, 0x194750, 0x19477C, 0x1947CC,
+    0x1948C1, 0x1948C4, 0x1948D0, 0x1948E0, 0x19490C, 0x19495C, 0x194A38, 0x194BC8, 0x194D0D, 0x194D10, 0x194D1C, 0x194D2C,
+    0x194D58, 0x194DA8, 0x194E84, 0x195014, 0x1954DD, 0x1954E0, 0x1954EC, 0x1954FC, 0x195528, 0x195578, 0x195654, 0x1957E4,
+    0x195C30, 0x196400, 0x196A59, 0x196A5C, 0x196A68, 0x196A78, 0x196AA4, 0x196AF4, 0x196BD0, 0x196D60, 0x1971AC, 0x19797C,
+    0x199169, 0x19916C, 0x199178, 0x199188, 0x1991B4, 0x199204, 0x1992E0, 0x199470, 0x1998BC, 0x19A08C, 0x19B608, 0x19DD18,
+    0x19FCD5, 0x19FCD8, 0x19FCE4, 0x19FCF4, 0x19FD20, 0x19FD70, 0x19FE4C, 0x19FFDC, 0x1A0428, 0x1A0BF8, 0x1A2174, 0x1AC025,
+    0x1AC028, 0x1AC034, 0x1AC044, 0x1AC070, 0x1AC0C0, 0x1AC19C, 0x1AC32C, 0x1AC778, 0x1ACF48, 0x1AE4C4, 0x1B0BD4, 0x1C3A90,
+    0x1CD941, 0x1CD944, 0x1CD950, 0x1CD960, 0x1CD98C, 0x1CD9DC, 0x1CDAB8, 0x1CDC48, 0x1CE094, 0x1CE864, 0x1CFDE0, 0x1D24F0,
+    0x1D905C,
+};
+
+// 一门数牌能拆成面子加一组雀头的张数组合，编码同上
+static const uint32_t win_table_melds_and_pair[18874] = {
+    0x000002, 0x00000A, 0x00000D, 0x000011, 0x000021, 0x000029, 0x00002C, 0x000030, 0x000032, 0x000035, 0x000040, 0x000041,
+    0x000044, 0x000048, 0x00004D, 0x000051, 0x000054, 0x000055, 0x000058, 0x00005C, 0x000060, 0x000063, 0x00006C, 0x000070,
+    0x000074, 0x000077, 0x00007B, 0x00009D, 0x0000A5, 0x0000A8, 0x0000AC, 0x0000BC, 0x0000C4, 0x0000C7, 0x0000CD, 0x0000D0,
+    0x0000DB, 0x0000DC, 0x0000DF, 0x0000E8, 0x0000EC, 0x0000EF, 0x0000F0, 0x0000F3, 0x0000F7, 0x0000FA, 0x0000FD, 0x000109,
+    0x00010C, 0x000119, 0x00011C, 0x000128, 0x00012B, 0x000138, 0x000140, 0x000143, 0x000145, 0x000148, 0x000154, 0x000157,
+    0x000164, 0x000167, 0x000168, 0x00016B, 0x000173, 0x000176, 0x000179, 0x000181, 0x000184, 0x000188, 0x000195, 0x000198,
+    0x0001A0, 0x0001A3, 0x0001A4, 0x0001A7, 0x0001A9, 0x0001AC, 0x0001B4, 0x0001B7, 0x0001B8, 0x0001BB, 0x0001BF, 0x0001C4,
+    0x0001C8, 0x0001CB, 0x0001CC, 0x0001CF, 0x0001D3, 0x0001D7, 0x0001DA, 0x0001E0, 0x0001E3, 0x0001E7, 0x0001EB, 0x0001EE,
+    0x0001EF, 0x0001F2, 0x000214, 0x00021C, 0x00021F, 0x000223, 0x000230, 0x000233, 0x00023B, 0x00023E, 0x000244, 0x000247,
+    0x00024F, 0x000252, 0x000253, 0x000256, 0x00025F, 0x000263, 0x000266, 0x000267, 0x00026A, 0x00026E, 0x000309, 0x000311,
+    0x000314, 0x000318, 0x000328, 0x000330, 0x000333, 0x000337, 0x000339, 0x00033C, 0x000347, 0x000348, 0x00034B, 0x00034F,
+    0x000354, 0x000358, 0x00035B, 0x00035C, 0x00035F, 0x000363, 0x000367, 0x00036A, 0x0003A4, 0x0003AC, 0x0003AF, 0x0003B3,
+    0x0003C3, 0x0003CB, 0x0003CE, 0x0003D4, 0x0003D7, 0x0003E2, 0x0003E3, 0x0003E6, 0x000401, 0x000404, 0x000410, 0x000413,
+    0x000420, 0x000423, 0x00042F, 0x000432, 0x00043F, 0x000447, 0x00044A, 0x00044C, 0x00044F, 0x00045B, 0x00045E, 0x000480,
+    0x000488, 0x00048B, 0x00048F, 0x00049C, 0x00049F, 0x0004A7, 0x0004AA, 0x0004AB, 0x0004AE, 0x0004B0, 0x0004B3, 0x0004BB,
+    0x0004BE, 0x0004BF, 0x0004C2, 0x0004C6, 0x0004CB, 0x0004CF, 0x0004D2, 0x0004D3, 0x0004D6, 0x0004DA, 0x0004DE, 0x0004E2,
+    0x0004E5, 0x0004F1, 0x0004F4, 0x000501, 0x000504, 0x000510, 0x000513, 0x000520, 0x00052D, 0x000530, 0x00053C, 0x00053F,
+    0x00054C, 0x00054F, 0x00055B, 0x00055E, 0x00057D, 0x000580, 0x00058C, 0x00058F, 0x00059C, 0x00059F, 0x0005BB, 0x0005C8,
+    0x0005CB, 0x0005D7, 0x0005DA, 0x000610, 0x000618, 0x00061B, 0x00061F, 0x00062F, 0x000637, 0x00063A, 0x00063E, 0x000640,
+    0x000643, 0x00064E, 0x00064F, 0x000652, 0x000656, 0x000659, 0x00065C, 0x000668, 0x00066B, 0x000678, 0x00067B, 0x000687,
+    0x00068A, 0x000697, 0x0006A4, 0x0006A7, 0x0006AB, 0x0006B3, 0x0006B6, 0x0006BA, 0x0006C3, 0x0006C6, 0x0006CA, 0x0006D2,
+    0x0006F4, 0x0006F7, 0x000703, 0x000706, 0x000708, 0x00070B, 0x000713, 0x000716, 0x000717, 0x00071A, 0x000727, 0x00072A,
+    0x000732, 0x000736, 0x00073F, 0x000742, 0x000746, 0x00074E, 0x000755, 0x00075D, 0x000760, 0x000764, 0x000774, 0x00077C,
+    0x00077F, 0x000783, 0x000785, 0x000788, 0x000793, 0x000794, 0x000797, 0x00079B, 0x0007A0, 0x0007A4, 0x0007A7, 0x0007A8,
+    0x0007AB, 0x0007AF, 0x0007B3, 0x0007B6, 0x0007BF, 0x0007C3, 0x0007C7, 0x0007CA, 0x0007CE, 0x0007E9, 0x0007EC, 0x0007F0,
+    0x0007F8, 0x0007FB, 0x0007FF, 0x000808, 0x00080B, 0x00080F, 0x000817, 0x00081A, 0x000820, 0x000823, 0x000827, 0x00082E,
+    0x00082F, 0x000832, 0x000834, 0x000837, 0x00083B, 0x00083F, 0x000842, 0x000843, 0x000846, 0x00084A, 0x00084D, 0x000850,
+    0x00085C, 0x00085F, 0x00086C, 0x00086F, 0x00087B, 0x00087E, 0x000884, 0x000887, 0x00088B, 0x000893, 0x000896, 0x000898,
+    0x00089B, 0x0008A3, 0x0008A6, 0x0008A7, 0x0008AA, 0x0008B7, 0x0008BA, 0x0008BB, 0x0008BE, 0x0008C2, 0x0008C6, 0x0008CC,
+    0x0008D4, 0x0008D7, 0x0008DB, 0x0008E8, 0x0008EB, 0x0008F3, 0x0008F6, 0x0008F7, 0x0008FA, 0x0008FC, 0x0008FF, 0x000907,
+    0x00090A, 0x00090B, 0x00090E, 0x000912, 0x000917, 0x00091B, 0x00091E, 0x00091F, 0x000922, 0x000926, 0x00092A, 0x000933,
+    0x000936, 0x00093A, 0x00093E, 0x000942, 0x000960, 0x000963, 0x000967, 0x00096F, 0x000972, 0x000976, 0x00097F, 0x000982,
+    0x000983, 0x000986, 0x00098E, 0x000997, 0x00099A, 0x00099E, 0x0009A2, 0x0009A6, 0x0009AB, 0x0009AE, 0x0009B2, 0x0009B6,
+    0x0009BA, 0x000A5C, 0x000A64, 0x000A67, 0x000A6B, 0x000A7B, 0x000A83, 0x000A86, 0x000A8A, 0x000A8C, 0x000A8F, 0x000A9A,
+    0x000A9B, 0x000A9E, 0x000AA2, 0x000AA7, 0x000AAB, 0x000AAE, 0x000AAF, 0x000AB2, 0x000AB6, 0x000ABA, 0x000AF0, 0x000AF3,
+    0x000AF7, 0x000AFF, 0x000B02, 0x000B06, 0x000B0F, 0x000B12, 0x000B16, 0x000B1E, 0x000B27, 0x000B2A, 0x000B2E, 0x000B36,
+    0x000B54, 0x000B57, 0x000B63, 0x000B66, 0x000B73, 0x000B76, 0x000B82, 0x000B8B, 0x000B8E, 0x000B92, 0x000B9A, 0x000B9F,
+    0x000BA2, 0x000BAA, 0x000BAE, 0x000BD3, 0x000BDB, 0x000BDE, 0x000BE2, 0x000BEF, 0x000BF2, 0x000BFA, 0x000BFE, 0x000C03,
+    0x000C06, 0x000C0E, 0x000C12, 0x000C1E, 0x000C22, 0x000C26, 0x000F25, 0x000F2D, 0x000F30, 0x000F34, 0x000F44, 0x000F4C,
+    0x000F4F, 0x000F53, 0x000F55, 0x000F58, 0x000F63, 0x000F64, 0x000F67, 0x000F6B, 0x000F70, 0x000F74, 0x000F77, 0x000F78,
+    0x000F7B, 0x000F7F, 0x000F83, 0x000F86, 0x000F8F, 0x000F93, 0x000F97, 0x000F9A, 0x000F9E, 0x000FC0, 0x000FC8, 0x000FCB,
+    0x000FCF, 0x000FDF, 0x000FE7, 0x000FEA, 0x000FF0, 0x000FF3, 0x000FFE, 0x000FFF, 0x001002, 0x00100B, 0x00100F, 0x001012,
+    0x001013, 0x001016, 0x00101A, 0x00101D, 0x001020, 0x00102C, 0x00102F, 0x00103C, 0x00103F, 0x00104B, 0x00104E, 0x00105B,
+    0x001063, 0x001066, 0x001068, 0x00106B, 0x001077, 0x00107A, 0x001087, 0x00108A, 0x00108B, 0x00108E, 0x001096, 0x00109C,
+    0x0010A4, 0x0010A7, 0x0010AB, 0x0010B8, 0x0010BB, 0x0010C3, 0x0010C6, 0x0010C7, 0x0010CA, 0x0010CC, 0x0010CF, 0x0010D7,
+    0x0010DA, 0x0010DB, 0x0010DE, 0x0010E2, 0x0010E7, 0x0010EB, 0x0010EE, 0x0010EF, 0x0010F2, 0x0010F6, 0x0010FA, 0x001103,
+    0x001106, 0x00110A, 0x00110E, 0x001112, 0x00122C, 0x001234, 0x001237, 0x00123B, 0x00124B, 0x001253, 0x001256, 0x00125A,
+    0x00125C, 0x00125F, 0x00126A, 0x00126B, 0x00126E, 0x001272, 0x001277, 0x00127B, 0x00127E, 0x00127F, 0x001282, 0x001286,
+    0x00128A, 0x0012C7, 0x0012CF, 0x0012D2, 0x0012D6, 0x0012E6, 0x0012EE, 0x0012F7, 0x0012FA, 0x001306, 0x001324, 0x001327,
+    0x001333, 0x001336, 0x001343, 0x001346, 0x001352, 0x001362, 0x00136A, 0x00136F, 0x001372, 0x00137E, 0x001405, 0x001408,
+    0x001414, 0x001417, 0x001424, 0x001427, 0x001433, 0x001436, 0x001443, 0x001450, 0x001453, 0x00145F, 0x001462, 0x00146F,
+    0x001472, 0x00147E, 0x0014A0, 0x0014A3, 0x0014AF, 0x0014B2, 0x0014BF, 0x0014C2, 0x0014DE, 0x0014EB, 0x0014EE, 0x0014FA,
+    0x001533, 0x00153B, 0x00153E, 0x001542, 0x001552, 0x00155A, 0x001563, 0x001566, 0x001572, 0x00157C, 0x00157F, 0x00158B,
+    0x00158E, 0x00159B, 0x00159E, 0x0015AA, 0x0015BA, 0x0015C7, 0x0015CA, 0x0015CE, 0x0015D6, 0x0015E6, 0x001678, 0x001680,
+    0x001683, 0x001687, 0x001697, 0x00169F, 0x0016A2, 0x0016A6, 0x0016A8, 0x0016AB, 0x0016B6, 0x0016B7, 0x0016BA, 0x0016BE,
+    0x0016C3, 0x0016C7, 0x0016CA, 0x0016CB, 0x0016CE, 0x0016D2, 0x0016D6, 0x0016E2, 0x0016E6, 0x0016EA, 0x00170C, 0x00170F,
+    0x001713, 0x00171B, 0x00171E, 0x001722, 0x00172B, 0x00172E, 0x001732, 0x00173A, 0x001743, 0x001746, 0x00174A, 0x001752,
+    0x001757, 0x00175A, 0x00175E, 0x001762, 0x001766, 0x001770, 0x001773, 0x00177F, 0x001782, 0x00178F, 0x001792, 0x00179E,
+    0x0017A7, 0x0017AA, 0x0017AE, 0x0017B6, 0x0017BB, 0x0017BE, 0x0017C6, 0x0017CA, 0x0017DA, 0x0017DE, 0x0017EF, 0x0017F7,
+    0x0017FA, 0x0017FE, 0x00180B, 0x00180E, 0x001816, 0x00181A, 0x00181F, 0x001822, 0x00182A, 0x00182E, 0x00183A, 0x00183E,
+    0x001842, 0x001856, 0x00186A, 0x00186D, 0x001879, 0x00187C, 0x001889, 0x00188C, 0x001898, 0x00189B, 0x0018A8, 0x0018B5,
+    0x0018B8, 0x0018C4, 0x0018C7, 0x0018D4, 0x0018D7, 0x0018E3, 0x0018E6, 0x001905, 0x001908, 0x001914, 0x001917, 0x001924,
+    0x001927, 0x001943, 0x001950, 0x001953, 0x00195F, 0x001962, 0x0019A0, 0x0019A3, 0x0019BF, 0x0019C2, 0x0019DE, 0x0019E1,
+    0x0019E4, 0x0019F0, 0x0019F3, 0x001A00, 0x001A03, 0x001A0F, 0x001A12, 0x001A1F, 0x001A2C, 0x001A2F, 0x001A3B, 0x001A3E,
+    0x001A4B, 0x001A4E, 0x001A5A, 0x001A7C, 0x001A7F, 0x001A8B, 0x001A8E, 0x001A9B, 0x001A9E, 0x001ABA, 0x001AC7, 0x001ACA,
+    0x001AD6, 0x001B71, 0x001B74, 0x001B80, 0x001B83, 0x001B90, 0x001B93, 0x001B9F, 0x001BA2, 0x001BAF, 0x001BBC, 0x001BBF,
+    0x001BCB, 0x001BCE, 0x001C0C, 0x001C0F, 0x001C1B, 0x001C1E, 0x001C2B, 0x001C2E, 0x001C4A, 0x001CA7, 0x001CAA, 0x001CC6,
+    0x001CE8, 0x001CEB, 0x001CF7, 0x001CFA, 0x001D07, 0x001D0A, 0x001D16, 0x001D26, 0x001D33, 0x001D36, 0x001D42, 0x001E48,
+    0x001E50, 0x001E53, 0x001E57, 0x001E67, 0x001E6F, 0x001E72, 0x001E76, 0x001E78, 0x001E7B, 0x001E86, 0x001E87, 0x001E8A,
+    0x001E8E, 0x001E93, 0x001E97, 0x001E9A, 0x001E9B, 0x001E9E, 0x001EA2, 0x001EA6, 0x001EB2, 0x001EB6, 0x001EBA, 0x001EE3,
+    0x001EEB, 0x001EEE, 0x001EF2, 0x001F02, 0x001F0A, 0x001F13, 0x001F16, 0x001F22, 0x001F2E, 0x001F32, 0x001F36, 0x001F40,
+    0x001F43, 0x001F4F, 0x001F52, 0x001F5F, 0x001F62, 0x001F6E, 0x001F7E, 0x001F86, 0x001F8B, 0x001F8E, 0x001F9A, 0x001FAA,
+    0x001FAE, 0x001FBD, 0x001FC0, 0x001FCC, 0x001FCF, 0x001FDC, 0x001FDF, 0x001FEB, 0x001FEE, 0x001FFB, 0x002008, 0x00200B,
+    0x002017, 0x00201A, 0x002027, 0x00202A, 0x002036, 0x002058, 0x00205B, 0x002067, 0x00206A, 0x002077, 0x00207A, 0x002096,
+    0x0020A3, 0x0020A6, 0x0020B2, 0x0020F3, 0x0020F6, 0x002112, 0x002134, 0x002137, 0x002143, 0x002146, 0x00214F, 0x002153,
+    0x002156, 0x002157, 0x00215A, 0x00215E, 0x002162, 0x00216E, 0x002172, 0x002176, 0x00217F, 0x002182, 0x00218E, 0x00219A,
+    0x00219E, 0x0021A2, 0x0021CF, 0x0021D2, 0x0021DE, 0x0021EA, 0x0021EE, 0x0021F2, 0x00221A, 0x0022C4, 0x0022C7, 0x0022D3,
+    0x0022D6, 0x0022E3, 0x0022E6, 0x0022F2, 0x002302, 0x00230F, 0x002312, 0x00231E, 0x002328, 0x00232B, 0x002337, 0x00233A,
+    0x002347, 0x00234A, 0x002356, 0x00235F, 0x002362, 0x002366, 0x00236E, 0x002373, 0x002376, 0x00237E, 0x002382, 0x002392,
+    0x0023C3, 0x0023C6, 0x0023D2, 0x0023E2, 0x0023FA, 0x00240E, 0x00243B, 0x00243E, 0x00244A, 0x002456, 0x00245A, 0x00245E,
+    0x002486, 0x0024A1, 0x0024A9, 0x0024AC, 0x0024B0, 0x0024C0, 0x0024C8, 0x0024CB, 0x0024CF, 0x0024D1, 0x0024D4, 0x0024DF,
+    0x0024E0, 0x0024E3, 0x0024E7, 0x0024EC, 0x0024F0, 0x0024F3, 0x0024F4, 0x0024F7, 0x0024FB, 0x0024FF, 0x002502, 0x00250B,
+    0x00250F, 0x002513, 0x002516, 0x00251A, 0x00253C, 0x002544, 0x002547, 0x00254B, 0x00255B, 0x002563, 0x002566, 0x00256C,
+    0x00256F, 0x00257A, 0x00257B, 0x00257E, 0x002587, 0x00258B, 0x00258E, 0x00258F, 0x002592, 0x002596, 0x002599, 0x00259C,
+    0x0025A8, 0x0025AB, 0x0025B8, 0x0025BB, 0x0025C7, 0x0025CA, 0x0025D7, 0x0025DF, 0x0025E2, 0x0025E4, 0x0025E7, 0x0025F3,
+    0x0025F6, 0x002603, 0x002606, 0x002607, 0x00260A, 0x002612, 0x002618, 0x002620, 0x002623, 0x002627, 0x002634, 0x002637,
+    0x00263F, 0x002642, 0x002643, 0x002646, 0x002648, 0x00264B, 0x002653, 0x002656, 0x002657, 0x00265A, 0x00265E, 0x002663,
+    0x002667, 0x00266A, 0x00266B, 0x00266E, 0x002672, 0x002676, 0x00267F, 0x002682, 0x002686, 0x00268A, 0x00268E, 0x0026B3,
+    0x0026BB, 0x0026BE, 0x0026C2, 0x0026CF, 0x0026D2, 0x0026DA, 0x0026E3, 0x0026E6, 0x0026EE, 0x0026F2, 0x0026FE, 0x002702,
+    0x002706, 0x00278D, 0x002790, 0x00279C, 0x00279F, 0x0027A8, 0x0027AC, 0x0027AF, 0x0027B0, 0x0027B3, 0x0027B7, 0x0027BB,
+    0x0027BE, 0x0027C7, 0x0027CB, 0x0027CF, 0x0027D2, 0x0027D6, 0x0027D8, 0x0027DB, 0x0027E6, 0x0027E7, 0x0027EA, 0x0027EE,
+    0x0027F3, 0x0027F7, 0x0027FA, 0x0027FB, 0x0027FE, 0x002802, 0x002806, 0x002828, 0x00282B, 0x002837, 0x00283A, 0x002843,
+    0x002847, 0x00284A, 0x00284B, 0x00284E, 0x002852, 0x002862, 0x002866, 0x00286A, 0x002873, 0x002876, 0x002882, 0x0028A0,
+    0x0028A3, 0x0028AF, 0x0028B2, 0x0028BF, 0x0028C2, 0x0028C3, 0x0028C6, 0x0028CE, 0x0028DE, 0x0028E2, 0x0028E6, 0x0028EB,
+    0x0028EE, 0x0028FA, 0x002904, 0x002907, 0x002913, 0x002916, 0x00291F, 0x002923, 0x002926, 0x002927, 0x00292A, 0x00292E,
+    0x002932, 0x00293B, 0x00293E, 0x002942, 0x002946, 0x00294A, 0x00294F, 0x002952, 0x00295A, 0x00295E, 0x00296A, 0x00296E,
+    0x002972, 0x002981, 0x002984, 0x002990, 0x002993, 0x0029A0, 0x0029A3, 0x0029AF, 0x0029B2, 0x0029BF, 0x0029CC, 0x0029CF,
+    0x0029DB, 0x0029DE, 0x0029EB, 0x0029EE, 0x0029FA, 0x002A1C, 0x002A1F, 0x002A2B, 0x002A2E, 0x002A3B, 0x002A3E, 0x002A5A,
+    0x002A67, 0x002A6A, 0x002A76, 0x002A94, 0x002A97, 0x002AA3, 0x002AA6, 0x002AAF, 0x002AB3, 0x002AB6, 0x002AB7, 0x002ABA,
+    0x002ABE, 0x002AC2, 0x002ACE, 0x002AD2, 0x002AD6, 0x002ADF, 0x002AE2, 0x002AEE, 0x002AF8, 0x002AFB, 0x002B07, 0x002B0A,
+    0x002B17, 0x002B1A, 0x002B26, 0x002B2F, 0x002B32, 0x002B36, 0x002B3E, 0x002B43, 0x002B46, 0x002B4A, 0x002B4E, 0x002B52,
+    0x002B62, 0x002B93, 0x002B96, 0x002BA2, 0x002BA7, 0x002BAA, 0x002BB2, 0x002BB6, 0x002BC6, 0x002BCA, 0x002BDE, 0x002BF4,
+    0x002BFC, 0x002BFF, 0x002C03, 0x002C13, 0x002C1B, 0x002C1E, 0x002C22, 0x002C24, 0x002C27, 0x002C32, 0x002C33, 0x002C36,
+    0x002C3A, 0x002C3F, 0x002C43, 0x002C46, 0x002C47, 0x002C4A, 0x002C4E, 0x002C52, 0x002C5E, 0x002C62, 0x002C66, 0x002C88,
+    0x002C8B, 0x002C8F, 0x002C97, 0x002C9A, 0x002C9E, 0x002CA7, 0x002CAA, 0x002CAE, 0x002CB6, 0x002CBF, 0x002CC2, 0x002CC6,
+    0x002CCE, 0x002CD3, 0x002CD6, 0x002CDA, 0x002CDE, 0x002CE2, 0x002CEC, 0x002CEF, 0x002CFB, 0x002CFE, 0x002D0B, 0x002D0E,
+    0x002D1A, 0x002D23, 0x002D26, 0x002D2A, 0x002D32, 0x002D37, 0x002D3A, 0x002D42, 0x002D46, 0x002D56, 0x002D5A, 0x002D6B,
+    0x002D73, 0x002D76, 0x002D7A, 0x002D87, 0x002D8A, 0x002D92, 0x002D96, 0x002D9B, 0x002D9E, 0x002DA6, 0x002DAA, 0x002DB6,
+    0x002DBA, 0x002DBE, 0x002DD2, 0x002DFF, 0x002E02, 0x002E06, 0x002E0E, 0x002E1E, 0x002E22, 0x002E36, 0x002E4A, 0x002EE0,
+    0x002EE3, 0x002EEF, 0x002EF2, 0x002EFB, 0x002EFF, 0x002F02, 0x002F03, 0x002F06, 0x002F0A, 0x002F0E, 0x002F1A, 0x002F1E,
+    0x002F22, 0x002F2B, 0x002F2E, 0x002F3A, 0x002F46, 0x002F4A, 0x002F4E, 0x002F7B, 0x002F7E, 0x002F8A, 0x002F8F, 0x002F92,
+    0x002F96, 0x002F9A, 0x002F9E, 0x002FAE, 0x002FC6, 0x002FF3, 0x002FF6, 0x003002, 0x003012, 0x003016, 0x00302A, 0x00303E,
+    0x003057, 0x00305A, 0x003066, 0x003072, 0x003076, 0x00307A, 0x00308E, 0x0030A2, 0x0033C4, 0x0033CC, 0x0033CF, 0x0033D3,
+    0x0033E3, 0x0033EB, 0x0033EE, 0x0033F2, 0x0033F4, 0x0033F7, 0x003402, 0x003403, 0x003406, 0x00340A, 0x00340F, 0x003413,
+    0x003416, 0x003417, 0x00341A, 0x00341E, 0x003422, 0x00342E, 0x003432, 0x003436, 0x00345F, 0x003467, 0x00346A, 0x00346E,
+    0x00347E, 0x003486, 0x00348F, 0x003492, 0x00349E, 0x0034AA, 0x0034AE, 0x0034B2, 0x0034BC, 0x0034BF, 0x0034CB, 0x0034CE,
+    0x0034DB, 0x0034DE, 0x0034EA, 0x0034FA, 0x003502, 0x003507, 0x00350A, 0x003516, 0x003526, 0x00352A, 0x00353B, 0x003543,
+    0x003546, 0x00354A, 0x003557, 0x00355A, 0x003562, 0x003566, 0x00356B, 0x00356E, 0x003576, 0x00357A, 0x003586, 0x00358A,
+    0x00358E, 0x0035A2, 0x0036B0, 0x0036B3, 0x0036BF, 0x0036C2, 0x0036CB, 0x0036CF, 0x0036D2, 0x0036D3, 0x0036D6, 0x0036DA,
+    0x0036DE, 0x0036EA, 0x0036EE, 0x0036F2, 0x0036FB, 0x0036FE, 0x00370A, 0x003716, 0x00371A, 0x00371E, 0x00374B, 0x00374E,
+    0x00375A, 0x003766, 0x00376A, 0x00376E, 0x003796, 0x0037C3, 0x0037C6, 0x0037D2, 0x0037E2, 0x0037E6, 0x00380E, 0x0038A4,
+    0x0038A7, 0x0038B3, 0x0038B6, 0x0038C3, 0x0038C6, 0x0038D2, 0x0038E2, 0x0038EF, 0x0038F2, 0x0038FE, 0x00390E, 0x00393F,
+    0x003942, 0x00394E, 0x00395E, 0x00398A, 0x0039B7, 0x0039BA, 0x0039C6, 0x0039D2, 0x0039D6, 0x0039DA, 0x003A02, 0x003A1B,
+    0x003A1E, 0x003A2A, 0x003A3A, 0x003A52, 0x003A66, 0x003B17, 0x003B1F, 0x003B22, 0x003B26, 0x003B36, 0x003B3E, 0x003B47,
+    0x003B4A, 0x003B56, 0x003B62, 0x003B66, 0x003B6A, 0x003BAB, 0x003BAE, 0x003BB2, 0x003BBA, 0x003BCA, 0x003BE2, 0x003BF6,
+    0x003C0F, 0x003C12, 0x003C1E, 0x003C2E, 0x003C46, 0x003C5A, 0x003C8E, 0x003C96, 0x003CAA, 0x003CBE, 0x004BB1, 0x004BB9,
+    0x004BBC, 0x004BC0, 0x004BD0, 0x004BD8, 0x004BDB, 0x004BDF, 0x004BE1, 0x004BE4, 0x004BEF, 0x004BF0, 0x004BF3, 0x004BF7,
+    0x004BFC, 0x004C00, 0x004C03, 0x004C04, 0x004C07, 0x004C0B, 0x004C0F, 0x004C12, 0x004C1B, 0x004C1F, 0x004C23, 0x004C26,
+    0x004C2A, 0x004C4C, 0x004C54, 0x004C57, 0x004C5B, 0x004C6B, 0x004C73, 0x004C76, 0x004C7C, 0x004C7F, 0x004C8A, 0x004C8B,
+    0x004C8E, 0x004C97, 0x004C9B, 0x004C9E, 0x004C9F, 0x004CA2, 0x004CA6, 0x004CA9, 0x004CAC, 0x004CB8, 0x004CBB, 0x004CC8,
+    0x004CCB, 0x004CD7, 0x004CDA, 0x004CE7, 0x004CEF, 0x004CF2, 0x004CF4, 0x004CF7, 0x004D03, 0x004D06, 0x004D13, 0x004D16,
+    0x004D17, 0x004D1A, 0x004D22, 0x004D28, 0x004D30, 0x004D33, 0x004D37, 0x004D44, 0x004D47, 0x004D4F, 0x004D52, 0x004D53,
+    0x004D56, 0x004D58, 0x004D5B, 0x004D63, 0x004D66, 0x004D67, 0x004D6A, 0x004D6E, 0x004D73, 0x004D77, 0x004D7A, 0x004D7B,
+    0x004D7E, 0x004D82, 0x004D86, 0x004D8F, 0x004D92, 0x004D96, 0x004D9A, 0x004D9E, 0x004DC3, 0x004DCB, 0x004DCE, 0x004DD2,
+    0x004DDF, 0x004DE2, 0x004DEA, 0x004DF3, 0x004DF6, 0x004DFE, 0x004E02, 0x004E0E, 0x004E12, 0x004E16, 0x004EB8, 0x004EC0,
+    0x004EC3, 0x004EC7, 0x004ED7, 0x004EDF, 0x004EE2, 0x004EE6, 0x004EE8, 0x004EEB, 0x004EF6, 0x004EF7, 0x004EFA, 0x004EFE,
+    0x004F03, 0x004F07, 0x004F0A, 0x004F0B, 0x004F0E, 0x004F12, 0x004F16, 0x004F53, 0x004F5B, 0x004F5E, 0x004F62, 0x004F72,
+    0x004F7A, 0x004F83, 0x004F86, 0x004F92, 0x004FB0, 0x004FB3, 0x004FBF, 0x004FC2, 0x004FCF, 0x004FD2, 0x004FDE, 0x004FEE,
+    0x004FF6, 0x004FFB, 0x004FFE, 0x00500A, 0x00502F, 0x005037, 0x00503A, 0x00503E, 0x00504B, 0x00504E, 0x005056, 0x00505A,
+    0x00505F, 0x005062, 0x00506A, 0x00506E, 0x00507A, 0x00507E, 0x005082, 0x005091, 0x005094, 0x0050A0, 0x0050A3, 0x0050B0,
+    0x0050B3, 0x0050BF, 0x0050C2, 0x0050CF, 0x0050DC, 0x0050DF, 0x0050EB, 0x0050EE, 0x0050FB, 0x0050FE, 0x00510A, 0x00512C,
+    0x00512F, 0x00513B, 0x00513E, 0x00514B, 0x00514E, 0x00516A, 0x005177, 0x00517A, 0x005186, 0x0051BF, 0x0051C7, 0x0051CA,
+    0x0051CE, 0x0051DE, 0x0051E6, 0x0051EF, 0x0051F2, 0x0051FE, 0x005208, 0x00520B, 0x005217, 0x00521A, 0x005227, 0x00522A,
+    0x005236, 0x005246, 0x005253, 0x005256, 0x00525A, 0x005262, 0x005272, 0x0052A3, 0x0052A6, 0x0052B2, 0x0052B7, 0x0052BA,
+    0x0052C2, 0x0052C6, 0x0052D6, 0x0052EE, 0x005304, 0x00530C, 0x00530F, 0x005313, 0x005323, 0x00532B, 0x00532E, 0x005332,
+    0x005334, 0x005337, 0x005342, 0x005343, 0x005346, 0x00534A, 0x00534F, 0x005353, 0x005356, 0x005357, 0x00535A, 0x00535E,
+    0x005362, 0x00536E, 0x005372, 0x005376, 0x005398, 0x00539B, 0x00539F, 0x0053A7, 0x0053AA, 0x0053AE, 0x0053B7, 0x0053BA,
+    0x0053BE, 0x0053C6, 0x0053CF, 0x0053D2, 0x0053D6, 0x0053DE, 0x0053E3, 0x0053E6, 0x0053EA, 0x0053EE, 0x0053F2, 0x0053FC,
+    0x0053FF, 0x00540B, 0x00540E, 0x00541B, 0x00541E, 0x00542A, 0x005433, 0x005436, 0x00543A, 0x005442, 0x005447, 0x00544A,
+    0x005452, 0x005456, 0x005466, 0x00546A, 0x00547B, 0x005483, 0x005486, 0x00548A, 0x005497, 0x00549A, 0x0054A2, 0x0054A6,
+    0x0054AB, 0x0054AE, 0x0054B6, 0x0054BA, 0x0054C6, 0x0054CA, 0x0054CE, 0x0054E2, 0x00550F, 0x005512, 0x005516, 0x00551E,
+    0x00552E, 0x005532, 0x005546, 0x00555A, 0x005AD4, 0x005ADC, 0x005ADF, 0x005AE3, 0x005AF3, 0x005AFB, 0x005AFE, 0x005B02,
+    0x005B04, 0x005B07, 0x005B12, 0x005B13, 0x005B16, 0x005B1A, 0x005B1F, 0x005B23, 0x005B26, 0x005B27, 0x005B2A, 0x005B2E,
+    0x005B32, 0x005B3E, 0x005B42, 0x005B46, 0x005B6F, 0x005B77, 0x005B7A, 0x005B7E, 0x005B8E, 0x005B96, 0x005B9F, 0x005BA2,
+    0x005BAE, 0x005BBA, 0x005BBE, 0x005BC2, 0x005BCC, 0x005BCF, 0x005BDB, 0x005BDE, 0x005BEB, 0x005BEE, 0x005BFA, 0x005C0A,
+    0x005C12, 0x005C17, 0x005C1A, 0x005C26, 0x005C36, 0x005C3A, 0x005C4B, 0x005C53, 0x005C56, 0x005C5A, 0x005C67, 0x005C6A,
+    0x005C72, 0x005C76, 0x005C7B, 0x005C7E, 0x005C86, 0x005C8A, 0x005C96, 0x005C9A, 0x005C9E, 0x005CB2, 0x005DDB, 0x005DE3,
+    0x005DE6, 0x005DEA, 0x005DFA, 0x005E02, 0x005E0B, 0x005E0E, 0x005E1A, 0x005E26, 0x005E2A, 0x005E2E, 0x005E76, 0x005E7E,
+    0x005EA6, 0x005ED3, 0x005ED6, 0x005EE2, 0x005EF2, 0x005F1E, 0x005FB4, 0x005FB7, 0x005FC3, 0x005FC6, 0x005FD3, 0x005FD6,
+    0x005FE2, 0x005FF2, 0x005FFF, 0x006002, 0x00600E, 0x00601E, 0x00604F, 0x006052, 0x00605E, 0x00606E, 0x00609A, 0x0060E2,
+    0x0060EA, 0x006112, 0x00612B, 0x00612E, 0x00613A, 0x00614A, 0x006176, 0x006419, 0x00641C, 0x006428, 0x00642B, 0x006438,
+    0x00643B, 0x006447, 0x00644A, 0x006457, 0x006464, 0x006467, 0x006473, 0x006476, 0x006483, 0x006486, 0x006492, 0x0064B4,
+    0x0064B7, 0x0064C3, 0x0064C6, 0x0064D3, 0x0064D6, 0x0064F2, 0x0064FF, 0x006502, 0x00650E, 0x00654F, 0x006552, 0x00656E,
+    0x006590, 0x006593, 0x00659F, 0x0065A2, 0x0065AF, 0x0065B2, 0x0065BE, 0x0065CE, 0x0065DB, 0x0065DE, 0x0065EA, 0x0065FA,
+    0x00662B, 0x00662E, 0x00663A, 0x00664A, 0x006676, 0x006720, 0x006723, 0x00672F, 0x006732, 0x00673F, 0x006742, 0x00674E,
+    0x00675E, 0x00676B, 0x00676E, 0x00677A, 0x0067BB, 0x0067BE, 0x0067CA, 0x0067DA, 0x006856, 0x006897, 0x00689A, 0x0068A6,
+    0x0068B6, 0x0068E2, 0x0069F7, 0x0069FF, 0x006A02, 0x006A06, 0x006A16, 0x006A1E, 0x006A27, 0x006A2A, 0x006A36, 0x006A42,
+    0x006A46, 0x006A4A, 0x006A92, 0x006A9A, 0x006AC2, 0x006AEF, 0x006AF2, 0x006AFE, 0x006B0E, 0x006B3A, 0x006B6C, 0x006B6F,
+    0x006B7B, 0x006B7E, 0x006B8B, 0x006B8E, 0x006B9A, 0x006BAA, 0x006BB7, 0x006BBA, 0x006BC6, 0x006BD6, 0x006C07, 0x006C0A,
+    0x006C16, 0x006C26, 0x006C52, 0x006CA2, 0x006CE3, 0x006CE6, 0x006CF2, 0x006CFE, 0x006D02, 0x006D06, 0x006D2E, 0x006D7E,
+    0x007050, 0x007058, 0x00705B, 0x00705F, 0x00706F, 0x007077, 0x00707A, 0x00707E, 0x007080, 0x007083, 0x00708E, 0x00708F,
+    0x007092, 0x007096, 0x00709B, 0x00709F, 0x0070A2, 0x0070A3, 0x0070A6, 0x0070AA, 0x0070AE, 0x0070BA, 0x0070BE, 0x0070C2,
+    0x0070EB, 0x0070F3, 0x0070F6, 0x0070FA, 0x00710A, 0x007112, 0x00711B, 0x00711E, 0x00712A, 0x007136, 0x00713A, 0x00713E,
+    0x007148, 0x00714B, 0x007157, 0x00715A, 0x007167, 0x00716A, 0x007176, 0x007186, 0x00718E, 0x007193, 0x007196, 0x0071A2,
+    0x0071B2, 0x0071B6, 0x0071C7, 0x0071CF, 0x0071D2, 0x0071D6, 0x0071E3, 0x0071E6, 0x0071EE, 0x0071F2, 0x0071F7, 0x0071FA,
+    0x007202, 0x007206, 0x007212, 0x007216, 0x00721A, 0x00722E, 0x007262, 0x00726A, 0x00727E, 0x007292, 0x00733C, 0x00733F,
+    0x00734B, 0x00734E, 0x007357, 0x00735B, 0x00735E, 0x00735F, 0x007362, 0x007366, 0x00736A, 0x007376, 0x00737A, 0x00737E,
+    0x007387, 0x00738A, 0x007396, 0x0073A2, 0x0073A6, 0x0073AA, 0x0073D7, 0x0073DA, 0x0073E6, 0x0073F2, 0x0073F6, 0x0073FA,
+    0x007422, 0x00744F, 0x007452, 0x00745E, 0x00746E, 0x007472, 0x00749A, 0x0074B3, 0x0074B6, 0x0074C2, 0x0074CE, 0x0074D2,
+    0x0074D6, 0x0074EA, 0x0074FE, 0x007530, 0x007533, 0x00753F, 0x007542, 0x00754F, 0x007552, 0x00755E, 0x00756E, 0x00757B,
+    0x00757E, 0x00758A, 0x00759A, 0x0075CB, 0x0075CE, 0x0075DA, 0x0075EA, 0x007616, 0x007643, 0x007646, 0x007652, 0x00765E,
+    0x007662, 0x007666, 0x00768E, 0x0076A7, 0x0076AA, 0x0076B6, 0x0076C6, 0x0076DE, 0x0076F2, 0x007742, 0x007756, 0x0077A3,
+    0x0077AB, 0x0077AE, 0x0077B2, 0x0077C2, 0x0077CA, 0x0077D3, 0x0077D6, 0x0077E2, 0x0077EE, 0x0077F2, 0x0077F6, 0x007837,
+    0x00783A, 0x00783E, 0x007846, 0x007856, 0x00786E, 0x007882, 0x00789B, 0x00789E, 0x0078AA, 0x0078BA, 0x0078D2, 0x0078E6,
+    0x00791A, 0x007922, 0x007936, 0x00794A, 0x0079AE, 0x007A12, 0x007A15, 0x007A21, 0x007A24, 0x007A31, 0x007A34, 0x007A40,
+    0x007A43, 0x007A50, 0x007A5D, 0x007A60, 0x007A6C, 0x007A6F, 0x007A7C, 0x007A7F, 0x007A8B, 0x007A8E, 0x007AAD, 0x007AB0,
+    0x007ABC, 0x007ABF, 0x007ACC, 0x007ACF, 0x007AEB, 0x007AF8, 0x007AFB, 0x007B07, 0x007B0A, 0x007B48, 0x007B4B, 0x007B67,
+    0x007B6A, 0x007B86, 0x007B89, 0x007B8C, 0x007B98, 0x007B9B, 0x007BA8, 0x007BAB, 0x007BB7, 0x007BBA, 0x007BC7, 0x007BD4,
+    0x007BD7, 0x007BE3, 0x007BE6, 0x007BF3, 0x007BF6, 0x007C02, 0x007C24, 0x007C27, 0x007C33, 0x007C36, 0x007C43, 0x007C46,
+    0x007C62, 0x007C6F, 0x007C72, 0x007C7E, 0x007D19, 0x007D1C, 0x007D28, 0x007D2B, 0x007D38, 0x007D3B, 0x007D47, 0x007D4A,
+    0x007D57, 0x007D64, 0x007D67, 0x007D73, 0x007D76, 0x007DB4, 0x007DB7, 0x007DC3, 0x007DC6, 0x007DD3, 0x007DD6, 0x007DF2,
+    0x007E4F, 0x007E52, 0x007E6E, 0x007E90, 0x007E93, 0x007E9F, 0x007EA2, 0x007EAF, 0x007EB2, 0x007EBE, 0x007ECE, 0x007EDB,
+    0x007EDE, 0x007EEA, 0x008020, 0x008023, 0x00802F, 0x008032, 0x00803F, 0x008042, 0x00804E, 0x00805E, 0x0080BB, 0x0080BE,
+    0x0080CA, 0x0080DA, 0x008156, 0x008165, 0x008168, 0x008174, 0x008177, 0x008184, 0x008187, 0x008193, 0x008196, 0x0081A3,
+    0x0081B0, 0x0081B3, 0x0081BF, 0x0081C2, 0x0081CF, 0x0081D2, 0x0081DE, 0x008200, 0x008203, 0x00820F, 0x008212, 0x00821F,
+    0x008222, 0x00823E, 0x00824B, 0x00824E, 0x00825A, 0x00829B, 0x00829E, 0x0082BA, 0x0082DC, 0x0082DF, 0x0082EB, 0x0082EE,
+    0x0082FB, 0x0082FE, 0x00830A, 0x00831A, 0x008327, 0x00832A, 0x008336, 0x008346, 0x008377, 0x00837A, 0x008386, 0x008396,
+    0x0083C2, 0x00846C, 0x00846F, 0x00847B, 0x00847E, 0x00848B, 0x00848E, 0x00849A, 0x0084AA, 0x0084B7, 0x0084BA, 0x0084C6,
+    0x008507, 0x00850A, 0x008516, 0x008526, 0x0085A2, 0x0085E3, 0x0085E6, 0x0085F2, 0x008602, 0x00862E, 0x008935, 0x008938,
+    0x008944, 0x008947, 0x008954, 0x008957, 0x008963, 0x008966, 0x008973, 0x008980, 0x008983, 0x00898F, 0x008992, 0x00899F,
+    0x0089A2, 0x0089AE, 0x0089D0, 0x0089D3, 0x0089DF, 0x0089E2, 0x0089EF, 0x0089F2, 0x008A0E, 0x008A1B, 0x008A1E, 0x008A2A,
+    0x008A6B, 0x008A6E, 0x008A8A, 0x008AAC, 0x008AAF, 0x008ABB, 0x008ABE, 0x008ACB, 0x008ACE, 0x008ADA, 0x008AEA, 0x008AF7,
+    0x008AFA, 0x008B06, 0x008B16, 0x008C3C, 0x008C3F, 0x008C4B, 0x008C4E, 0x008C5B, 0x008C5E, 0x008C6A, 0x008C7A, 0x008C87,
+    0x008C8A, 0x008C96, 0x008CD7, 0x008CDA, 0x008CE6, 0x008CF6, 0x008D72, 0x008F43, 0x008F46, 0x008F52, 0x008F62, 0x008FDE,
+    0x009088, 0x00908B, 0x009097, 0x00909A, 0x0090A7, 0x0090AA, 0x0090B6, 0x0090C6, 0x0090D3, 0x0090D6, 0x0090E2, 0x0090F2,
+    0x009123, 0x009126, 0x009132, 0x009142, 0x00916E, 0x0091BE, 0x0091FF, 0x009202, 0x00920E, 0x00921E, 0x00924A, 0x009760,
+    0x009768, 0x00976B, 0x00976F, 0x00977F, 0x009787, 0x00978A, 0x00978E, 0x009790, 0x009793, 0x00979E, 0x00979F, 0x0097A2,
+    0x0097A6, 0x0097AB, 0x0097AF, 0x0097B2, 0x0097B3, 0x0097B6, 0x0097BA, 0x0097BE, 0x0097CA, 0x0097CE, 0x0097D2, 0x0097FB,
+    0x009803, 0x009806, 0x00980A, 0x00981A, 0x009822, 0x00982B, 0x00982E, 0x00983A, 0x009846, 0x00984A, 0x00984E, 0x009858,
+    0x00985B, 0x009867, 0x00986A, 0x009877, 0x00987A, 0x009886, 0x009896, 0x00989E, 0x0098A3, 0x0098A6, 0x0098B2, 0x0098C2,
+    0x0098C6, 0x0098D7, 0x0098DF, 0x0098E2, 0x0098E6, 0x0098F3, 0x0098F6, 0x0098FE, 0x009902, 0x009907, 0x00990A, 0x009912,
+    0x009916, 0x009922, 0x009926, 0x00992A, 0x00993E, 0x009972, 0x00997A, 0x00998E, 0x0099A2, 0x009A67, 0x009A6F, 0x009A72,
+    0x009A76, 0x009A86, 0x009A8E, 0x009A97, 0x009A9A, 0x009AA6, 0x009AB2, 0x009AB6, 0x009ABA, 0x009B02, 0x009B0A, 0x009B32,
+    0x009B5F, 0x009B62, 0x009B6E, 0x009B7E, 0x009BAA, 0x009BDE, 0x009BE6, 0x009BFA, 0x009C0E, 0x009C40, 0x009C43, 0x009C4F,
+    0x009C52, 0x009C5F, 0x009C62, 0x009C6E, 0x009C7E, 0x009C8B, 0x009C8E, 0x009C9A, 0x009CAA, 0x009CDB, 0x009CDE, 0x009CEA,
+    0x009CFA, 0x009D26, 0x009D6E, 0x009D76, 0x009D9E, 0x009DB7, 0x009DBA, 0x009DC6, 0x009DD6, 0x009E02, 0x009E52, 0x009E66,
+    0x009EB1, 0x009EB4, 0x009EC0, 0x009EC3, 0x009ED0, 0x009ED3, 0x009EDF, 0x009EE2, 0x009EEF, 0x009EFC, 0x009EFF, 0x009F0B,
+    0x009F0E, 0x009F1B, 0x009F1E, 0x009F2A, 0x009F4C, 0x009F4F, 0x009F5B, 0x009F5E, 0x009F6B, 0x009F6E, 0x009F8A, 0x009F97,
+    0x009F9A, 0x009FA6, 0x009FE7, 0x009FEA, 0x00A006, 0x00A028, 0x00A02B, 0x00A037, 0x00A03A, 0x00A047, 0x00A04A, 0x00A056,
+    0x00A066, 0x00A073, 0x00A076, 0x00A082, 0x00A092, 0x00A0C3, 0x00A0C6, 0x00A0D2, 0x00A0E2, 0x00A10E, 0x00A1B8, 0x00A1BB,
+    0x00A1C7, 0x00A1CA, 0x00A1D7, 0x00A1DA, 0x00A1E6, 0x00A1F6, 0x00A203, 0x00A206, 0x00A212, 0x00A253, 0x00A256, 0x00A262,
+    0x00A272, 0x00A2EE, 0x00A32F, 0x00A332, 0x00A33E, 0x00A34E, 0x00A37A, 0x00A4BF, 0x00A4C2, 0x00A4CE, 0x00A4DE, 0x00A55A,
+    0x00A604, 0x00A607, 0x00A613, 0x00A616, 0x00A623, 0x00A626, 0x00A632, 0x00A642, 0x00A64F, 0x00A652, 0x00A65E, 0x00A66E,
+    0x00A683, 0x00A68B, 0x00A68E, 0x00A692, 0x00A69F, 0x00A6A2, 0x00A6AA, 0x00A6AE, 0x00A6B3, 0x00A6B6, 0x00A6BE, 0x00A6C2,
+    0x00A6CE, 0x00A6D2, 0x00A6D6, 0x00A6EA, 0x00A71E, 0x00A726, 0x00A73A, 0x00A74E, 0x00A77B, 0x00A77E, 0x00A78A, 0x00A79A,
+    0x00A7C6, 0x00A7FA, 0x00A802, 0x00A816, 0x00A82A, 0x00A90B, 0x00A90E, 0x00A91A, 0x00A92A, 0x00A956, 0x00A98A, 0x00A992,
+    0x00A9A6, 0x00A9BA, 0x00AA82, 0x00ADD4, 0x00ADD7, 0x00ADE3, 0x00ADE6, 0x00ADF3, 0x00ADF6, 0x00AE02, 0x00AE12, 0x00AE1F,
+    0x00AE22, 0x00AE2E, 0x00AE3E, 0x00AE6F, 0x00AE72, 0x00AE7E, 0x00AE8E, 0x00AEBA, 0x00AF0A, 0x00AF4B, 0x00AF4E, 0x00AF5A,
+    0x00AF6A, 0x00AF96, 0x00AFC8, 0x00AFCB, 0x00AFD7, 0x00AFDA, 0x00AFE7, 0x00AFEA, 0x00AFF6, 0x00B006, 0x00B013, 0x00B016,
+    0x00B022, 0x00B032, 0x00B063, 0x00B066, 0x00B072, 0x00B082, 0x00B0AE, 0x00B0DB, 0x00B0DE, 0x00B0EA, 0x00B0FA, 0x00B0FE,
+    0x00B126, 0x00B13F, 0x00B142, 0x00B14E, 0x00B15E, 0x00B176, 0x00B18A, 0x00B1DA, 0x00B2CF, 0x00B2D2, 0x00B2DE, 0x00B2EE,
+    0x00B31A, 0x00B36A, 0x00B3E2, 0x00B446, 0x00B527, 0x00B52A, 0x00B536, 0x00B546, 0x00B572, 0x00B5A6, 0x00B5AE, 0x00B5C2,
+    0x00B5D6, 0x00B69E, 0x00B71D, 0x00B725, 0x00B728, 0x00B72C, 0x00B73C, 0x00B744, 0x00B747, 0x00B74B, 0x00B74D, 0x00B750,
+    0x00B75B, 0x00B75C, 0x00B75F, 0x00B763, 0x00B768, 0x00B76C, 0x00B76F, 0x00B770, 0x00B773, 0x00B777, 0x00B77B, 0x00B77E,
+    0x00B787, 0x00B78B, 0x00B78F, 0x00B792, 0x00B796, 0x00B7B8, 0x00B7C0, 0x00B7C3, 0x00B7C7, 0x00B7D7, 0x00B7DF, 0x00B7E2,
+    0x00B7E8, 0x00B7EB, 0x00B7F6, 0x00B7F7, 0x00B7FA, 0x00B803, 0x00B807, 0x00B80A, 0x00B80B, 0x00B80E, 0x00B812, 0x00B815,
+    0x00B818, 0x00B824, 0x00B827, 0x00B834, 0x00B837, 0x00B843, 0x00B846, 0x00B853, 0x00B85B, 0x00B85E, 0x00B860, 0x00B863,
+    0x00B86F, 0x00B872, 0x00B87F, 0x00B882, 0x00B883, 0x00B886, 0x00B88E, 0x00B894, 0x00B89C, 0x00B89F, 0x00B8A3, 0x00B8B0,
+    0x00B8B3, 0x00B8BB, 0x00B8BE, 0x00B8BF, 0x00B8C2, 0x00B8C4, 0x00B8C7, 0x00B8CF, 0x00B8D2, 0x00B8D3, 0x00B8D6, 0x00B8DA,
+    0x00B8DF, 0x00B8E3, 0x00B8E6, 0x00B8E7, 0x00B8EA, 0x00B8EE, 0x00B8F2, 0x00B8FB, 0x00B8FE, 0x00B902, 0x00B906, 0x00B90A,
+    0x00B92F, 0x00B937, 0x00B93A, 0x00B93E, 0x00B94B, 0x00B94E, 0x00B956, 0x00B95F, 0x00B962, 0x00B96A, 0x00B96E, 0x00B97A,
+    0x00B97E, 0x00B982, 0x00BA24, 0x00BA2C, 0x00BA2F, 0x00BA33, 0x00BA43, 0x00BA4B, 0x00BA4E, 0x00BA52, 0x00BA54, 0x00BA57,
+    0x00BA62, 0x00BA63, 0x00BA66, 0x00BA6A, 0x00BA6F, 0x00BA73, 0x00BA76, 0x00BA77, 0x00BA7A, 0x00BA7E, 0x00BA82, 0x00BABF,
+    0x00BAC7, 0x00BACA, 0x00BACE, 0x00BADE, 0x00BAE6, 0x00BAEF, 0x00BAF2, 0x00BAFE, 0x00BB1C, 0x00BB1F, 0x00BB2B, 0x00BB2E,
+    0x00BB3B, 0x00BB3E, 0x00BB4A, 0x00BB5A, 0x00BB62, 0x00BB67, 0x00BB6A, 0x00BB76, 0x00BB9B, 0x00BBA3, 0x00BBA6, 0x00BBAA,
+    0x00BBB7, 0x00BBBA, 0x00BBC2, 0x00BBC6, 0x00BBCB, 0x00BBCE, 0x00BBD6, 0x00BBDA, 0x00BBE6, 0x00BBEA, 0x00BBEE, 0x00BBFD,
+    0x00BC00, 0x00BC0C, 0x00BC0F, 0x00BC1C, 0x00BC1F, 0x00BC2B, 0x00BC2E, 0x00BC3B, 0x00BC48, 0x00BC4B, 0x00BC57, 0x00BC5A,
+    0x00BC67, 0x00BC6A, 0x00BC76, 0x00BC98, 0x00BC9B, 0x00BCA7, 0x00BCAA, 0x00BCB7, 0x00BCBA, 0x00BCD6, 0x00BCE3, 0x00BCE6,
+    0x00BCF2, 0x00BD2B, 0x00BD33, 0x00BD36, 0x00BD3A, 0x00BD4A, 0x00BD52, 0x00BD5B, 0x00BD5E, 0x00BD6A, 0x00BD74, 0x00BD77,
+    0x00BD83, 0x00BD86, 0x00BD93, 0x00BD96, 0x00BDA2, 0x00BDB2, 0x00BDBF, 0x00BDC2, 0x00BDC6, 0x00BDCE, 0x00BDDE, 0x00BE0F,
+    0x00BE12, 0x00BE1E, 0x00BE23, 0x00BE26, 0x00BE2E, 0x00BE32, 0x00BE42, 0x00BE5A, 0x00BE70, 0x00BE78, 0x00BE7B, 0x00BE7F,
+    0x00BE8F, 0x00BE97, 0x00BE9A, 0x00BE9E, 0x00BEA0, 0x00BEA3, 0x00BEAE, 0x00BEAF, 0x00BEB2, 0x00BEB6, 0x00BEBB, 0x00BEBF,
+    0x00BEC2, 0x00BEC3, 0x00BEC6, 0x00BECA, 0x00BECE, 0x00BEDA, 0x00BEDE, 0x00BEE2, 0x00BF04, 0x00BF07, 0x00BF0B, 0x00BF13,
+    0x00BF16, 0x00BF1A, 0x00BF23, 0x00BF26, 0x00BF2A, 0x00BF32, 0x00BF3B, 0x00BF3E, 0x00BF42, 0x00BF4A, 0x00BF4F, 0x00BF52,
+    0x00BF56, 0x00BF5A, 0x00BF5E, 0x00BF68, 0x00BF6B, 0x00BF77, 0x00BF7A, 0x00BF87, 0x00BF8A, 0x00BF96, 0x00BF9F, 0x00BFA2,
+    0x00BFA6, 0x00BFAE, 0x00BFB3, 0x00BFB6, 0x00BFBE, 0x00BFC2, 0x00BFD2, 0x00BFD6, 0x00BFE7, 0x00BFEF, 0x00BFF2, 0x00BFF6,
+    0x00C003, 0x00C006, 0x00C00E, 0x00C012, 0x00C017, 0x00C01A, 0x00C022, 0x00C026, 0x00C032, 0x00C036, 0x00C03A, 0x00C04E,
+    0x00C07B, 0x00C07E, 0x00C082, 0x00C08A, 0x00C09A, 0x00C09E, 0x00C0B2, 0x00C0C6, 0x00C177, 0x00C17F, 0x00C182, 0x00C186,
+    0x00C196, 0x00C19E, 0x00C1A7, 0x00C1AA, 0x00C1B6, 0x00C1C2, 0x00C1C6, 0x00C1CA, 0x00C20B, 0x00C20E, 0x00C212, 0x00C21A,
+    0x00C22A, 0x00C242, 0x00C26F, 0x00C272, 0x00C27E, 0x00C28E, 0x00C2A6, 0x00C2BA, 0x00C2EE, 0x00C2F6, 0x00C30A, 0x00C31E,
+    0x00C5C1, 0x00C5C4, 0x00C5D0, 0x00C5D3, 0x00C5E0, 0x00C5E3, 0x00C5EF, 0x00C5F2, 0x00C5FF, 0x00C60C, 0x00C60F, 0x00C61B,
+    0x00C61E, 0x00C62B, 0x00C62E, 0x00C63A, 0x00C640, 0x00C648, 0x00C64B, 0x00C64F, 0x00C65C, 0x00C65F, 0x00C667, 0x00C66A,
+    0x00C66B, 0x00C66E, 0x00C670, 0x00C673, 0x00C67B, 0x00C67E, 0x00C67F, 0x00C682, 0x00C686, 0x00C68B, 0x00C68F, 0x00C692,
+    0x00C693, 0x00C696, 0x00C69A, 0x00C69E, 0x00C6A7, 0x00C6AA, 0x00C6AE, 0x00C6B2, 0x00C6B6, 0x00C6DB, 0x00C6E3, 0x00C6E6,
+    0x00C6EA, 0x00C6F7, 0x00C6FA, 0x00C702, 0x00C70B, 0x00C70E, 0x00C716, 0x00C71A, 0x00C726, 0x00C72A, 0x00C72E, 0x00C738,
+    0x00C73B, 0x00C747, 0x00C74A, 0x00C757, 0x00C75A, 0x00C766, 0x00C776, 0x00C77E, 0x00C783, 0x00C786, 0x00C792, 0x00C7A2,
+    0x00C7A6, 0x00C7B7, 0x00C7BF, 0x00C7C2, 0x00C7C6, 0x00C7D3, 0x00C7D6, 0x00C7DE, 0x00C7E2, 0x00C7E7, 0x00C7EA, 0x00C7F2,
+    0x00C7F6, 0x00C802, 0x00C806, 0x00C80A, 0x00C81E, 0x00C8C8, 0x00C8CB, 0x00C8D7, 0x00C8DA, 0x00C8E7, 0x00C8EA, 0x00C8F6,
+    0x00C906, 0x00C913, 0x00C916, 0x00C922, 0x00C947, 0x00C94F, 0x00C952, 0x00C956, 0x00C963, 0x00C966, 0x00C96E, 0x00C972,
+    0x00C977, 0x00C97A, 0x00C982, 0x00C986, 0x00C992, 0x00C996, 0x00C99A, 0x00C9E2, 0x00C9EA, 0x00C9FE, 0x00CA12, 0x00CA3F,
+    0x00CA42, 0x00CA4E, 0x00CA5E, 0x00CA8A, 0x00CB20, 0x00CB23, 0x00CB2F, 0x00CB32, 0x00CB3F, 0x00CB42, 0x00CB4E, 0x00CB5E,
+    0x00CB6B, 0x00CB6E, 0x00CB7A, 0x00CB8A, 0x00CBBB, 0x00CBBE, 0x00CBCA, 0x00CBCF, 0x00CBD2, 0x00CBDA, 0x00CBDE, 0x00CBEE,
+    0x00CC06, 0x00CC4E, 0x00CC56, 0x00CC6A, 0x00CC7E, 0x00CC97, 0x00CC9A, 0x00CCA6, 0x00CCB6, 0x00CCE2, 0x00CD14, 0x00CD17,
+    0x00CD23, 0x00CD26, 0x00CD33, 0x00CD36, 0x00CD42, 0x00CD52, 0x00CD5F, 0x00CD62, 0x00CD6E, 0x00CD7E, 0x00CD93, 0x00CD9B,
+    0x00CD9E, 0x00CDA2, 0x00CDAF, 0x00CDB2, 0x00CDBA, 0x00CDBE, 0x00CDC3, 0x00CDC6, 0x00CDCE, 0x00CDD2, 0x00CDDE, 0x00CDE2,
+    0x00CDE6, 0x00CDFA, 0x00CE27, 0x00CE2A, 0x00CE2E, 0x00CE36, 0x00CE46, 0x00CE4A, 0x00CE5E, 0x00CE72, 0x00CE8B, 0x00CE8E,
+    0x00CE9A, 0x00CEAA, 0x00CEC2, 0x00CED6, 0x00CF0A, 0x00CF12, 0x00CF26, 0x00CF3A, 0x00CF85, 0x00CF88, 0x00CF94, 0x00CF97,
+    0x00CFA4, 0x00CFA7, 0x00CFB3, 0x00CFB6, 0x00CFC3, 0x00CFD0, 0x00CFD3, 0x00CFDF, 0x00CFE2, 0x00CFEF, 0x00CFF2, 0x00CFFE,
+    0x00D020, 0x00D023, 0x00D02F, 0x00D032, 0x00D03F, 0x00D042, 0x00D05E, 0x00D06B, 0x00D06E, 0x00D07A, 0x00D0BB, 0x00D0BE,
+    0x00D0DA, 0x00D0FC, 0x00D0FF, 0x00D10B, 0x00D10E, 0x00D11B, 0x00D11E, 0x00D12A, 0x00D13A, 0x00D147, 0x00D14A, 0x00D156,
+    0x00D166, 0x00D197, 0x00D19A, 0x00D1A6, 0x00D1B6, 0x00D1E2, 0x00D28C, 0x00D28F, 0x00D29B, 0x00D29E, 0x00D2AB, 0x00D2AE,
+    0x00D2BA, 0x00D2CA, 0x00D2D7, 0x00D2DA, 0x00D2E6, 0x00D327, 0x00D32A, 0x00D336, 0x00D346, 0x00D3C2, 0x00D403, 0x00D406,
+    0x00D412, 0x00D422, 0x00D44E, 0x00D4E4, 0x00D4E7, 0x00D4F3, 0x00D4F6, 0x00D503, 0x00D506, 0x00D512, 0x00D522, 0x00D52F,
+    0x00D532, 0x00D53E, 0x00D54E, 0x00D563, 0x00D56B, 0x00D56E, 0x00D572, 0x00D57F, 0x00D582, 0x00D58A, 0x00D58E, 0x00D593,
+    0x00D596, 0x00D59E, 0x00D5A2, 0x00D5AE, 0x00D5B2, 0x00D5B6, 0x00D5CA, 0x00D5FE, 0x00D606, 0x00D61A, 0x00D62E, 0x00D65B,
+    0x00D65E, 0x00D66A, 0x00D67A, 0x00D6A6, 0x00D6D8, 0x00D6DB, 0x00D6E7, 0x00D6EA, 0x00D6F7, 0x00D6FA, 0x00D706, 0x00D716,
+    0x00D723, 0x00D726, 0x00D732, 0x00D742, 0x00D773, 0x00D776, 0x00D782, 0x00D792, 0x00D7BE, 0x00D7EB, 0x00D7EE, 0x00D7FA,
+    0x00D80A, 0x00D80E, 0x00D836, 0x00D84F, 0x00D852, 0x00D85E, 0x00D86A, 0x00D86E, 0x00D872, 0x00D886, 0x00D89A, 0x00D8EA,
+    0x00D9DF, 0x00D9E2, 0x00D9EE, 0x00D9FE, 0x00DA2A, 0x00DA43, 0x00DA46, 0x00DA52, 0x00DA62, 0x00DA7A, 0x00DA8E, 0x00DADE,
+    0x00DAF2, 0x00DB56, 0x00DBBC, 0x00DBC4, 0x00DBC7, 0x00DBCB, 0x00DBDB, 0x00DBE3, 0x00DBE6, 0x00DBEA, 0x00DBEC, 0x00DBEF,
+    0x00DBFA, 0x00DBFB, 0x00DBFE, 0x00DC02, 0x00DC07, 0x00DC0B, 0x00DC0E, 0x00DC0F, 0x00DC12, 0x00DC16, 0x00DC1A, 0x00DC26,
+    0x00DC2A, 0x00DC2E, 0x00DC57, 0x00DC5F, 0x00DC62, 0x00DC66, 0x00DC76, 0x00DC7E, 0x00DC87, 0x00DC8A, 0x00DC96, 0x00DCA2,
+    0x00DCA6, 0x00DCAA, 0x00DCB4, 0x00DCB7, 0x00DCC3, 0x00DCC6, 0x00DCD3, 0x00DCD6, 0x00DCE2, 0x00DCF2, 0x00DCFA, 0x00DCFF,
+    0x00DD02, 0x00DD0E, 0x00DD1E, 0x00DD22, 0x00DD33, 0x00DD3B, 0x00DD3E, 0x00DD42, 0x00DD4F, 0x00DD52, 0x00DD5A, 0x00DD5E,
+    0x00DD63, 0x00DD66, 0x00DD6E, 0x00DD72, 0x00DD7E, 0x00DD82, 0x00DD86, 0x00DD9A, 0x00DDCE, 0x00DDD6, 0x00DDEA, 0x00DDFE,
+    0x00DEA8, 0x00DEAB, 0x00DEB7, 0x00DEBA, 0x00DEC3, 0x00DEC7, 0x00DECA, 0x00DECB, 0x00DECE, 0x00DED2, 0x00DED6, 0x00DEE2,
+    0x00DEE6, 0x00DEEA, 0x00DEF3, 0x00DEF6, 0x00DF02, 0x00DF0E, 0x00DF12, 0x00DF16, 0x00DF43, 0x00DF46, 0x00DF52, 0x00DF5E,
+    0x00DF62, 0x00DF66, 0x00DF8E, 0x00DFBB, 0x00DFBE, 0x00DFCA, 0x00DFDA, 0x00DFDE, 0x00E006, 0x00E01F, 0x00E022, 0x00E02E,
+    0x00E03A, 0x00E03E, 0x00E042, 0x00E056, 0x00E06A, 0x00E09C, 0x00E09F, 0x00E0AB, 0x00E0AE, 0x00E0BB, 0x00E0BE, 0x00E0CA,
+    0x00E0DA, 0x00E0E7, 0x00E0EA, 0x00E0F6, 0x00E106, 0x00E137, 0x00E13A, 0x00E146, 0x00E156, 0x00E182, 0x00E1AF, 0x00E1B2,
+    0x00E1BE, 0x00E1CA, 0x00E1CE, 0x00E1D2, 0x00E1FA, 0x00E213, 0x00E216, 0x00E222, 0x00E232, 0x00E24A, 0x00E25E, 0x00E2AE,
+    0x00E2C2, 0x00E30F, 0x00E317, 0x00E31A, 0x00E31E, 0x00E32E, 0x00E336, 0x00E33F, 0x00E342, 0x00E34E, 0x00E35A, 0x00E35E,
+    0x00E362, 0x00E3A3, 0x00E3A6, 0x00E3AA, 0x00E3B2, 0x00E3C2, 0x00E3DA, 0x00E3EE, 0x00E407, 0x00E40A, 0x00E416, 0x00E426,
+    0x00E43E, 0x00E452, 0x00E486, 0x00E48E, 0x00E4A2, 0x00E4B6, 0x00E51A, 0x00E5FB, 0x00E5FE, 0x00E60A, 0x00E616, 0x00E61A,
+    0x00E61E, 0x00E646, 0x00E696, 0x00E6AA, 0x00E70E, 0x00E772, 0x00EA60, 0x00EA63, 0x00EA6F, 0x00EA72, 0x00EA7F, 0x00EA82,
+    0x00EA8E, 0x00EA9E, 0x00EAAB, 0x00EAAE, 0x00EABA, 0x00EACA, 0x00EADF, 0x00EAE7, 0x00EAEA, 0x00EAEE, 0x00EAFB, 0x00EAFE,
+    0x00EB06, 0x00EB0A, 0x00EB0F, 0x00EB12, 0x00EB1A, 0x00EB1E, 0x00EB2A, 0x00EB2E, 0x00EB32, 0x00EB46, 0x00EB7A, 0x00EB82,
+    0x00EB96, 0x00EBAA, 0x00EBD7, 0x00EBDA, 0x00EBE6, 0x00EBF6, 0x00EC22, 0x00EC56, 0x00EC5E, 0x00EC72, 0x00EC86, 0x00ED67,
+    0x00ED6A, 0x00ED76, 0x00ED86, 0x00EDB2, 0x00EDCB, 0x00EDCE, 0x00EDDA, 0x00EDE6, 0x00EDEA, 0x00EDEE, 0x00EE02, 0x00EE16,
+    0x00EE66, 0x00EEDE, 0x00EFBF, 0x00EFC2, 0x00EFCE, 0x00EFDE, 0x00F00A, 0x00F05A, 0x00F06E, 0x00F0D2, 0x00F136, 0x00F1B3,
+    0x00F1B6, 0x00F1C2, 0x00F1D2, 0x00F1FE, 0x00F232, 0x00F23A, 0x00F24E, 0x00F262, 0x00F2C6, 0x00F32A, 0x0102CC, 0x0102D4,
+    0x0102D7, 0x0102DB, 0x0102EB, 0x0102F3, 0x0102F6, 0x0102FA, 0x0102FC, 0x0102FF, 0x01030A, 0x01030B, 0x01030E, 0x010312,
+    0x010317, 0x01031B, 0x01031E, 0x01031F, 0x010322, 0x010326, 0x01032A, 0x010336, 0x01033A, 0x01033E, 0x010367, 0x01036F,
+    0x010372, 0x010376, 0x010386, 0x01038E, 0x010397, 0x01039A, 0x0103A6, 0x0103B2, 0x0103B6, 0x0103BA, 0x0103C4, 0x0103C7,
+    0x0103D3, 0x0103D6, 0x0103E3, 0x0103E6, 0x0103F2, 0x010402, 0x01040A, 0x01040F, 0x010412, 0x01041E, 0x01042E, 0x010432,
+    0x010443, 0x01044B, 0x01044E, 0x010452, 0x01045F, 0x010462, 0x01046A, 0x01046E, 0x010473, 0x010476, 0x01047E, 0x010482,
+    0x01048E, 0x010492, 0x010496, 0x0104AA, 0x0104DE, 0x0104E6, 0x0104FA, 0x01050E, 0x0105D3, 0x0105DB, 0x0105DE, 0x0105E2,
+    0x0105F2, 0x0105FA, 0x010603, 0x010606, 0x010612, 0x01061E, 0x010622, 0x010626, 0x01066E, 0x010676, 0x01069E, 0x0106CB,
+    0x0106CE, 0x0106DA, 0x0106EA, 0x010716, 0x01074A, 0x010752, 0x010766, 0x01077A, 0x0107AC, 0x0107AF, 0x0107BB, 0x0107BE,
+    0x0107CB, 0x0107CE, 0x0107DA, 0x0107EA, 0x0107F7, 0x0107FA, 0x010806, 0x010816, 0x010847, 0x01084A, 0x010856, 0x010866,
+    0x010892, 0x0108DA, 0x0108E2, 0x01090A, 0x010923, 0x010926, 0x010932, 0x010942, 0x01096E, 0x0109BE, 0x0109D2, 0x010A1F,
+    0x010A27, 0x010A2A, 0x010A2E, 0x010A3E, 0x010A46, 0x010A4F, 0x010A52, 0x010A5E, 0x010A6A, 0x010A6E, 0x010A72, 0x010AB3,
+    0x010AB6, 0x010ABA, 0x010AC2, 0x010AD2, 0x010AEA, 0x010AFE, 0x010B17, 0x010B1A, 0x010B26, 0x010B36, 0x010B4E, 0x010B62,
+    0x010B96, 0x010B9E, 0x010BB2, 0x010BC6, 0x010C2A, 0x011170, 0x011173, 0x01117F, 0x011182, 0x01118F, 0x011192, 0x01119E,
+    0x0111AE, 0x0111BB, 0x0111BE, 0x0111CA, 0x0111DA, 0x0111EF, 0x0111F7, 0x0111FA, 0x0111FE, 0x01120B, 0x01120E, 0x011216,
+    0x01121A, 0x01121F, 0x011222, 0x01122A, 0x01122E, 0x01123A, 0x01123E, 0x011242, 0x011256, 0x01128A, 0x011292, 0x0112A6,
+    0x0112BA, 0x0112E7, 0x0112EA, 0x0112F6, 0x011306, 0x011332, 0x011366, 0x01136E, 0x011382, 0x011396, 0x011477, 0x01147A,
+    0x011486, 0x011496, 0x0114C2, 0x0114F6, 0x0114FE, 0x011512, 0x011526, 0x0115EE, 0x0116CF, 0x0116D2, 0x0116DE, 0x0116EE,
+    0x01171A, 0x01176A, 0x01177E, 0x011846, 0x011B34, 0x011B37, 0x011B43, 0x011B46, 0x011B53, 0x011B56, 0x011B62, 0x011B72,
+    0x011B7F, 0x011B82, 0x011B8E, 0x011B9E, 0x011BCF, 0x011BD2, 0x011BDE, 0x011BEE, 0x011C1A, 0x011C6A, 0x011CAB, 0x011CAE,
+    0x011CBA, 0x011CCA, 0x011CF6, 0x011D46, 0x011E3B, 0x011E3E, 0x011E4A, 0x011E5A, 0x011E86, 0x011ED6, 0x011FB2, 0x012093,
+    0x012096, 0x0120A2, 0x0120B2, 0x0120DE, 0x012112, 0x01211A, 0x01212E, 0x012142, 0x01220A, 0x012287, 0x01228A, 0x012296,
+    0x0122A6, 0x0122D2, 0x012322, 0x01239A, 0x0123FE, 0x01276B, 0x012773, 0x012776, 0x01277A, 0x01278A, 0x012792, 0x01279B,
+    0x01279E, 0x0127AA, 0x0127B6, 0x0127BA, 0x0127BE, 0x012806, 0x01280E, 0x012836, 0x012863, 0x012866, 0x012872, 0x012882,
+    0x0128AE, 0x0128E2, 0x0128EA, 0x0128FE, 0x012912, 0x012A57, 0x012A5A, 0x012A66, 0x012A72, 0x012A76, 0x012A7A, 0x012AA2,
+    0x012AF2, 0x012B6A, 0x012BCE, 0x012C4B, 0x012C4E, 0x012C5A, 0x012C6A, 0x012C96, 0x012CE6, 0x012D5E, 0x012DC2, 0x012EBE,
+    0x012EC6, 0x012EEE, 0x012F52, 0x012FB6, 0x017A6D, 0x017A75, 0x017A78, 0x017A7C, 0x017A8C, 0x017A94, 0x017A97, 0x017A9B,
+    0x017A9D, 0x017AA0, 0x017AAB, 0x017AAC, 0x017AAF, 0x017AB3, 0x017AB8, 0x017ABC, 0x017ABF, 0x017AC0, 0x017AC3, 0x017AC7,
+    0x017ACB, 0x017ACE, 0x017AD7, 0x017ADB, 0x017ADF, 0x017AE2, 0x017AE6, 0x017B08, 0x017B10, 0x017B13, 0x017B17, 0x017B27,
+    0x017B2F, 0x017B32, 0x017B38, 0x017B3B, 0x017B46, 0x017B47, 0x017B4A, 0x017B53, 0x017B57, 0x017B5A, 0x017B5B, 0x017B5E,
+    0x017B62, 0x017B65, 0x017B68, 0x017B74, 0x017B77, 0x017B84, 0x017B87, 0x017B93, 0x017B96, 0x017BA3, 0x017BAB, 0x017BAE,
+    0x017BB0, 0x017BB3, 0x017BBF, 0x017BC2, 0x017BCF, 0x017BD2, 0x017BD3, 0x017BD6, 0x017BDE, 0x017BE4, 0x017BEC, 0x017BEF,
+    0x017BF3, 0x017C00, 0x017C03, 0x017C0B, 0x017C0E, 0x017C0F, 0x017C12, 0x017C14, 0x017C17, 0x017C1F, 0x017C22, 0x017C23,
+    0x017C26, 0x017C2A, 0x017C2F, 0x017C33, 0x017C36, 0x017C37, 0x017C3A, 0x017C3E, 0x017C42, 0x017C4B, 0x017C4E, 0x017C52,
+    0x017C56, 0x017C5A, 0x017C7F, 0x017C87, 0x017C8A, 0x017C8E, 0x017C9B, 0x017C9E, 0x017CA6, 0x017CAF, 0x017CB2, 0x017CBA,
+    0x017CBE, 0x017CCA, 0x017CCE, 0x017CD2, 0x017D74, 0x017D7C, 0x017D7F, 0x017D83, 0x017D93, 0x017D9B, 0x017D9E, 0x017DA2,
+    0x017DA4, 0x017DA7, 0x017DB2, 0x017DB3, 0x017DB6, 0x017DBA, 0x017DBF, 0x017DC3, 0x017DC6, 0x017DC7, 0x017DCA, 0x017DCE,
+    0x017DD2, 0x017E0F, 0x017E17, 0x017E1A, 0x017E1E, 0x017E2E, 0x017E36, 0x017E3F, 0x017E42, 0x017E4E, 0x017E6C, 0x017E6F,
+    0x017E7B, 0x017E7E, 0x017E8B, 0x017E8E, 0x017E9A, 0x017EAA, 0x017EB2, 0x017EB7, 0x017EBA, 0x017EC6, 0x017EEB, 0x017EF3,
+    0x017EF6, 0x017EFA, 0x017F07, 0x017F0A, 0x017F12, 0x017F16, 0x017F1B, 0x017F1E, 0x017F26, 0x017F2A, 0x017F36, 0x017F3A,
+    0x017F3E, 0x017F4D, 0x017F50, 0x017F5C, 0x017F5F, 0x017F6C, 0x017F6F, 0x017F7B, 0x017F7E, 0x017F8B, 0x017F98, 0x017F9B,
+    0x017FA7, 0x017FAA, 0x017FB7, 0x017FBA, 0x017FC6, 0x017FE8, 0x017FEB, 0x017FF7, 0x017FFA, 0x018007, 0x01800A, 0x018026,
+    0x018033, 0x018036, 0x018042, 0x01807B, 0x018083, 0x018086, 0x01808A, 0x01809A, 0x0180A2, 0x0180AB, 0x0180AE, 0x0180BA,
+    0x0180C4, 0x0180C7, 0x0180D3, 0x0180D6, 0x0180E3, 0x0180E6, 0x0180F2, 0x018102, 0x01810F, 0x018112, 0x018116, 0x01811E,
+    0x01812E, 0x01815F, 0x018162, 0x01816E, 0x018173, 0x018176, 0x01817E, 0x018182, 0x018192, 0x0181AA, 0x0181C0, 0x0181C8,
+    0x0181CB, 0x0181CF, 0x0181DF, 0x0181E7, 0x0181EA, 0x0181EE, 0x0181F0, 0x0181F3, 0x0181FE, 0x0181FF, 0x018202, 0x018206,
+    0x01820B, 0x01820F, 0x018212, 0x018213, 0x018216, 0x01821A, 0x01821E, 0x01822A, 0x01822E, 0x018232, 0x018254, 0x018257,
+    0x01825B, 0x018263, 0x018266, 0x01826A, 0x018273, 0x018276, 0x01827A, 0x018282, 0x01828B, 0x01828E, 0x018292, 0x01829A,
+    0x01829F, 0x0182A2, 0x0182A6, 0x0182AA, 0x0182AE, 0x0182B8, 0x0182BB, 0x0182C7, 0x0182CA, 0x0182D7, 0x0182DA, 0x0182E6,
+    0x0182EF, 0x0182F2, 0x0182F6, 0x0182FE, 0x018303, 0x018306, 0x01830E, 0x018312, 0x018322, 0x018326, 0x018337, 0x01833F,
+    0x018342, 0x018346, 0x018353, 0x018356, 0x01835E, 0x018362, 0x018367, 0x01836A, 0x018372, 0x018376, 0x018382, 0x018386,
+    0x01838A, 0x01839E, 0x0183CB, 0x0183CE, 0x0183D2, 0x0183DA, 0x0183EA, 0x0183EE, 0x018402, 0x018416, 0x0184C7, 0x0184CF,
+    0x0184D2, 0x0184D6, 0x0184E6, 0x0184EE, 0x0184F7, 0x0184FA, 0x018506, 0x018512, 0x018516, 0x01851A, 0x01855B, 0x01855E,
+    0x018562, 0x01856A, 0x01857A, 0x018592, 0x0185BF, 0x0185C2, 0x0185CE, 0x0185DE, 0x0185F6, 0x01860A, 0x01863E, 0x018646,
+    0x01865A, 0x01866E, 0x018990, 0x018998, 0x01899B, 0x01899F, 0x0189AF, 0x0189B7, 0x0189BA, 0x0189BE, 0x0189C0, 0x0189C3,
+    0x0189CE, 0x0189CF, 0x0189D2, 0x0189D6, 0x0189DB, 0x0189DF, 0x0189E2, 0x0189E3, 0x0189E6, 0x0189EA, 0x0189EE, 0x0189FA,
+    0x0189FE, 0x018A02, 0x018A2B, 0x018A33, 0x018A36, 0x018A3A, 0x018A4A, 0x018A52, 0x018A5B, 0x018A5E, 0x018A6A, 0x018A76,
+    0x018A7A, 0x018A7E, 0x018A88, 0x018A8B, 0x018A97, 0x018A9A, 0x018AA7, 0x018AAA, 0x018AB6, 0x018AC6, 0x018ACE, 0x018AD3,
+    0x018AD6, 0x018AE2, 0x018AF2, 0x018AF6, 0x018B07, 0x018B0F, 0x018B12, 0x018B16, 0x018B23, 0x018B26, 0x018B2E, 0x018B32,
+    0x018B37, 0x018B3A, 0x018B42, 0x018B46, 0x018B52, 0x018B56, 0x018B5A, 0x018B6E, 0x018C97, 0x018C9F, 0x018CA2, 0x018CA6,
+    0x018CB6, 0x018CBE, 0x018CC7, 0x018CCA, 0x018CD6, 0x018CE2, 0x018CE6, 0x018CEA, 0x018D32, 0x018D3A, 0x018D62, 0x018D8F,
+    0x018D92, 0x018D9E, 0x018DAE, 0x018DDA, 0x018E70, 0x018E73, 0x018E7F, 0x018E82, 0x018E8F, 0x018E92, 0x018E9E, 0x018EAE,
+    0x018EBB, 0x018EBE, 0x018ECA, 0x018EDA, 0x018F0B, 0x018F0E, 0x018F1A, 0x018F2A, 0x018F56, 0x018F9E, 0x018FA6, 0x018FCE,
+    0x018FE7, 0x018FEA, 0x018FF6, 0x019006, 0x019032, 0x0190E3, 0x0190EB, 0x0190EE, 0x0190F2, 0x019102, 0x01910A, 0x019113,
+    0x019116, 0x019122, 0x01912E, 0x019132, 0x019136, 0x019177, 0x01917A, 0x01917E, 0x019186, 0x019196, 0x0191AE, 0x0191C2,
+    0x0191DB, 0x0191DE, 0x0191EA, 0x0191FA, 0x019212, 0x019226, 0x01925A, 0x019262, 0x019276, 0x01928A, 0x0192D5, 0x0192D8,
+    0x0192E4, 0x0192E7, 0x0192F4, 0x0192F7, 0x019303, 0x019306, 0x019313, 0x019320, 0x019323, 0x01932F, 0x019332, 0x01933F,
+    0x019342, 0x01934E, 0x019370, 0x019373, 0x01937F, 0x019382, 0x01938F, 0x019392, 0x0193AE, 0x0193BB, 0x0193BE, 0x0193CA,
+    0x01940B, 0x01940E, 0x01942A, 0x01944C, 0x01944F, 0x01945B, 0x01945E, 0x01946B, 0x01946E, 0x01947A, 0x01948A, 0x019497,
+    0x01949A, 0x0194A6, 0x0194B6, 0x0194E7, 0x0194EA, 0x0194F6, 0x019506, 0x019532, 0x0195DC, 0x0195DF, 0x0195EB, 0x0195EE,
+    0x0195FB, 0x0195FE, 0x01960A, 0x01961A, 0x019627, 0x01962A, 0x019636, 0x019677, 0x01967A, 0x019686, 0x019696, 0x019712,
+    0x019753, 0x019756, 0x019762, 0x019772, 0x01979E, 0x0198B3, 0x0198BB, 0x0198BE, 0x0198C2, 0x0198D2, 0x0198DA, 0x0198E3,
+    0x0198E6, 0x0198F2, 0x0198FE, 0x019902, 0x019906, 0x01994E, 0x019956, 0x01997E, 0x0199AB, 0x0199AE, 0x0199BA, 0x0199CA,
+    0x0199F6, 0x019A28, 0x019A2B, 0x019A37, 0x019A3A, 0x019A47, 0x019A4A, 0x019A56, 0x019A66, 0x019A73, 0x019A76, 0x019A82,
+    0x019A92, 0x019AC3, 0x019AC6, 0x019AD2, 0x019AE2, 0x019B0E, 0x019B5E, 0x019B9F, 0x019BA2, 0x019BAE, 0x019BBA, 0x019BBE,
+    0x019BC2, 0x019BEA, 0x019C3A, 0x019D2F, 0x019D32, 0x019D3E, 0x019D4E, 0x019D7A, 0x019D93, 0x019D96, 0x019DA2, 0x019DB2,
+    0x019DCA, 0x019DDE, 0x019E2E, 0x019EA6, 0x019F0C, 0x019F14, 0x019F17, 0x019F1B, 0x019F2B, 0x019F33, 0x019F36, 0x019F3A,
+    0x019F3C, 0x019F3F, 0x019F4A, 0x019F4B, 0x019F4E, 0x019F52, 0x019F57, 0x019F5B, 0x019F5E, 0x019F5F, 0x019F62, 0x019F66,
+    0x019F6A, 0x019F76, 0x019F7A, 0x019F7E, 0x019FA7, 0x019FAF, 0x019FB2, 0x019FB6, 0x019FC6, 0x019FCE, 0x019FD7, 0x019FDA,
+    0x019FE6, 0x019FF2, 0x019FF6, 0x019FFA, 0x01A004, 0x01A007, 0x01A013, 0x01A016, 0x01A023, 0x01A026, 0x01A032, 0x01A042,
+    0x01A04A, 0x01A04F, 0x01A052, 0x01A05E, 0x01A06E, 0x01A072, 0x01A083, 0x01A08B, 0x01A08E, 0x01A092, 0x01A09F, 0x01A0A2,
+    0x01A0AA, 0x01A0AE, 0x01A0B3, 0x01A0B6, 0x01A0BE, 0x01A0C2, 0x01A0CE, 0x01A0D2, 0x01A0D6, 0x01A0EA, 0x01A11E, 0x01A126,
+    0x01A13A, 0x01A14E, 0x01A1F8, 0x01A1FB, 0x01A207, 0x01A20A, 0x01A213, 0x01A217, 0x01A21A, 0x01A21B, 0x01A21E, 0x01A222,
+    0x01A226, 0x01A232, 0x01A236, 0x01A23A, 0x01A243, 0x01A246, 0x01A252, 0x01A25E, 0x01A262, 0x01A266, 0x01A293, 0x01A296,
+    0x01A2A2, 0x01A2AE, 0x01A2B2, 0x01A2B6, 0x01A2DE, 0x01A30B, 0x01A30E, 0x01A31A, 0x01A32A, 0x01A32E, 0x01A356, 0x01A36F,
+    0x01A372, 0x01A37E, 0x01A38A, 0x01A38E, 0x01A392, 0x01A3A6, 0x01A3BA, 0x01A3EC, 0x01A3EF, 0x01A3FB, 0x01A3FE, 0x01A40B,
+    0x01A40E, 0x01A41A, 0x01A42A, 0x01A437, 0x01A43A, 0x01A446, 0x01A456, 0x01A487, 0x01A48A, 0x01A496, 0x01A4A6, 0x01A4D2,
+    0x01A4FF, 0x01A502, 0x01A50E, 0x01A51A, 0x01A51E, 0x01A522, 0x01A54A, 0x01A563, 0x01A566, 0x01A572, 0x01A582, 0x01A59A,
+    0x01A5AE, 0x01A5FE, 0x01A612, 0x01A65F, 0x01A667, 0x01A66A, 0x01A66E, 0x01A67E, 0x01A686, 0x01A68F, 0x01A692, 0x01A69E,
+    0x01A6AA, 0x01A6AE, 0x01A6B2, 0x01A6F3, 0x01A6F6, 0x01A6FA, 0x01A702, 0x01A712, 0x01A72A, 0x01A73E, 0x01A757, 0x01A75A,
+    0x01A766, 0x01A776, 0x01A78E, 0x01A7A2, 0x01A7D6, 0x01A7DE, 0x01A7F2, 0x01A806, 0x01A86A, 0x01A94B, 0x01A94E, 0x01A95A,
+    0x01A966, 0x01A96A, 0x01A96E, 0x01A996, 0x01A9E6, 0x01A9FA, 0x01AA5E, 0x01AAC2, 0x01C61C, 0x01C624, 0x01C627, 0x01C62B,
+    0x01C63B, 0x01C643, 0x01C646, 0x01C64A, 0x01C64C, 0x01C64F, 0x01C65A, 0x01C65B, 0x01C65E, 0x01C662, 0x01C667, 0x01C66B,
+    0x01C66E, 0x01C66F, 0x01C672, 0x01C676, 0x01C67A, 0x01C686, 0x01C68A, 0x01C68E, 0x01C6B7, 0x01C6BF, 0x01C6C2, 0x01C6C6,
+    0x01C6D6, 0x01C6DE, 0x01C6E7, 0x01C6EA, 0x01C6F6, 0x01C702, 0x01C706, 0x01C70A, 0x01C714, 0x01C717, 0x01C723, 0x01C726,
+    0x01C733, 0x01C736, 0x01C742, 0x01C752, 0x01C75A, 0x01C75F, 0x01C762, 0x01C76E, 0x01C77E, 0x01C782, 0x01C793, 0x01C79B,
+    0x01C79E, 0x01C7A2, 0x01C7AF, 0x01C7B2, 0x01C7BA, 0x01C7BE, 0x01C7C3, 0x01C7C6, 0x01C7CE, 0x01C7D2, 0x01C7DE, 0x01C7E2,
+    0x01C7E6, 0x01C7FA, 0x01C82E, 0x01C836, 0x01C84A, 0x01C85E, 0x01C923, 0x01C92B, 0x01C92E, 0x01C932, 0x01C942, 0x01C94A,
+    0x01C953, 0x01C956, 0x01C962, 0x01C96E, 0x01C972, 0x01C976, 0x01C9BE, 0x01C9C6, 0x01C9EE, 0x01CA1B, 0x01CA1E, 0x01CA2A,
+    0x01CA3A, 0x01CA66, 0x01CA9A, 0x01CAA2, 0x01CAB6, 0x01CACA, 0x01CAFC, 0x01CAFF, 0x01CB0B, 0x01CB0E, 0x01CB1B, 0x01CB1E,
+    0x01CB2A, 0x01CB3A, 0x01CB47, 0x01CB4A, 0x01CB56, 0x01CB66, 0x01CB97, 0x01CB9A, 0x01CBA6, 0x01CBB6, 0x01CBE2, 0x01CC2A,
+    0x01CC32, 0x01CC5A, 0x01CC73, 0x01CC76, 0x01CC82, 0x01CC92, 0x01CCBE, 0x01CD0E, 0x01CD22, 0x01CD6F, 0x01CD77, 0x01CD7A,
+    0x01CD7E, 0x01CD8E, 0x01CD96, 0x01CD9F, 0x01CDA2, 0x01CDAE, 0x01CDBA, 0x01CDBE, 0x01CDC2, 0x01CE03, 0x01CE06, 0x01CE0A,
+    0x01CE12, 0x01CE22, 0x01CE3A, 0x01CE4E, 0x01CE67, 0x01CE6A, 0x01CE76, 0x01CE86, 0x01CE9E, 0x01CEB2, 0x01CEE6, 0x01CEEE,
+    0x01CF02, 0x01CF16, 0x01CF7A, 0x01D53F, 0x01D547, 0x01D54A, 0x01D54E, 0x01D55E, 0x01D566, 0x01D56F, 0x01D572, 0x01D57E,
+    0x01D58A, 0x01D58E, 0x01D592, 0x01D5DA, 0x01D5E2, 0x01D60A, 0x01D637, 0x01D63A, 0x01D646, 0x01D656, 0x01D682, 0x01D6B6,
+    0x01D6BE, 0x01D6D2, 0x01D6E6, 0x01D846, 0x01D84E, 0x01D876, 0x01D93E, 0x01DA1F, 0x01DA22, 0x01DA2E, 0x01DA3E, 0x01DA6A,
+    0x01DABA, 0x01DB96, 0x01DE84, 0x01DE87, 0x01DE93, 0x01DE96, 0x01DEA3, 0x01DEA6, 0x01DEB2, 0x01DEC2, 0x01DECF, 0x01DED2,
+    0x01DEDE, 0x01DEEE, 0x01DF1F, 0x01DF22, 0x01DF2E, 0x01DF3E, 0x01DF6A, 0x01DFBA, 0x01DFFB, 0x01DFFE, 0x01E00A, 0x01E01A,
+    0x01E046, 0x01E096, 0x01E18B, 0x01E18E, 0x01E19A, 0x01E1AA, 0x01E1D6, 0x01E226, 0x01E302, 0x01E462, 0x01E46A, 0x01E492,
+    0x01E55A, 0x01E5D7, 0x01E5DA, 0x01E5E6, 0x01E5F6, 0x01E622, 0x01E672, 0x01E74E, 0x01F47D, 0x01F480, 0x01F48C, 0x01F48F,
+    0x01F49C, 0x01F49F, 0x01F4AB, 0x01F4AE, 0x01F4BB, 0x01F4C8, 0x01F4CB, 0x01F4D7, 0x01F4DA, 0x01F4E7, 0x01F4EA, 0x01F4F6,
+    0x01F518, 0x01F51B, 0x01F527, 0x01F52A, 0x01F537, 0x01F53A, 0x01F556, 0x01F563, 0x01F566, 0x01F572, 0x01F5B3, 0x01F5B6,
+    0x01F5D2, 0x01F5F4, 0x01F5F7, 0x01F603, 0x01F606, 0x01F613, 0x01F616, 0x01F622, 0x01F632, 0x01F63F, 0x01F642, 0x01F64E,
+    0x01F65E, 0x01F68F, 0x01F692, 0x01F69E, 0x01F6AE, 0x01F6DA, 0x01F784, 0x01F787, 0x01F793, 0x01F796, 0x01F7A3, 0x01F7A6,
+    0x01F7B2, 0x01F7C2, 0x01F7CF, 0x01F7D2, 0x01F7DE, 0x01F81F, 0x01F822, 0x01F82E, 0x01F83E, 0x01F8BA, 0x01F8FB, 0x01F8FE,
+    0x01F90A, 0x01F91A, 0x01F946, 0x01FA8B, 0x01FA8E, 0x01FA9A, 0x01FAAA, 0x01FB26, 0x01FBD0, 0x01FBD3, 0x01FBDF, 0x01FBE2,
+    0x01FBEF, 0x01FBF2, 0x01FBFE, 0x01FC0E, 0x01FC1B, 0x01FC1E, 0x01FC2A, 0x01FC3A, 0x01FC6B, 0x01FC6E, 0x01FC7A, 0x01FC8A,
+    0x01FCB6, 0x01FD06, 0x01FD47, 0x01FD4A, 0x01FD56, 0x01FD66, 0x01FD92, 0x01FDE2, 0x01FED7, 0x01FEDA, 0x01FEE6, 0x01FEF6,
+    0x01FF22, 0x01FF72, 0x02004E, 0x0203A0, 0x0203A3, 0x0203AF, 0x0203B2, 0x0203BF, 0x0203C2, 0x0203CE, 0x0203DE, 0x0203EB,
+    0x0203EE, 0x0203FA, 0x02040A, 0x02043B, 0x02043E, 0x02044A, 0x02045A, 0x020486, 0x0204D6, 0x020517, 0x02051A, 0x020526,
+    0x020536, 0x020562, 0x0206A7, 0x0206AA, 0x0206B6, 0x0206C6, 0x0206F2, 0x020742, 0x0209AE, 0x020AF3, 0x020AF6, 0x020B02,
+    0x020B12, 0x020B3E, 0x020B8E, 0x020C6A, 0x0211CB, 0x0211D3, 0x0211D6, 0x0211DA, 0x0211EA, 0x0211F2, 0x0211FB, 0x0211FE,
+    0x02120A, 0x021216, 0x02121A, 0x02121E, 0x021266, 0x02126E, 0x021296, 0x0212C3, 0x0212C6, 0x0212D2, 0x0212E2, 0x02130E,
+    0x021342, 0x02134A, 0x02135E, 0x021372, 0x0214D2, 0x0214DA, 0x021502, 0x0215CA, 0x0216AB, 0x0216AE, 0x0216BA, 0x0216CA,
+    0x0216F6, 0x021746, 0x021822, 0x02191C, 0x02191F, 0x02192B, 0x02192E, 0x02193B, 0x02193E, 0x02194A, 0x02195A, 0x021967,
+    0x02196A, 0x021976, 0x021986, 0x0219B7, 0x0219BA, 0x0219C6, 0x0219D6, 0x021A02, 0x021A52, 0x021A93, 0x021A96, 0x021AA2,
+    0x021AB2, 0x021ADE, 0x021B2E, 0x021C23, 0x021C26, 0x021C32, 0x021C42, 0x021C6E, 0x021CBE, 0x021D9A, 0x021F2A, 0x02206F,
+    0x022072, 0x02207E, 0x02208E, 0x0220BA, 0x0220EE, 0x0220F6, 0x02210A, 0x02211E, 0x0221E6, 0x022376, 0x023188, 0x023190,
+    0x023193, 0x023197, 0x0231A7, 0x0231AF, 0x0231B2, 0x0231B6, 0x0231B8, 0x0231BB, 0x0231C6, 0x0231C7, 0x0231CA, 0x0231CE,
+    0x0231D3, 0x0231D7, 0x0231DA, 0x0231DB, 0x0231DE, 0x0231E2, 0x0231E6, 0x0231F2, 0x0231F6, 0x0231FA, 0x023223, 0x02322B,
+    0x02322E, 0x023232, 0x023242, 0x02324A, 0x023253, 0x023256, 0x023262, 0x02326E, 0x023272, 0x023276, 0x023280, 0x023283,
+    0x02328F, 0x023292, 0x02329F, 0x0232A2, 0x0232AE, 0x0232BE, 0x0232C6, 0x0232CB, 0x0232CE, 0x0232DA, 0x0232EA, 0x0232EE,
+    0x0232FF, 0x023307, 0x02330A, 0x02330E, 0x02331B, 0x02331E, 0x023326, 0x02332A, 0x02332F, 0x023332, 0x02333A, 0x02333E,
+    0x02334A, 0x02334E, 0x023352, 0x023366, 0x02339A, 0x0233A2, 0x0233B6, 0x0233CA, 0x02348F, 0x023497, 0x02349A, 0x02349E,
+    0x0234AE, 0x0234B6, 0x0234BF, 0x0234C2, 0x0234CE, 0x0234DA, 0x0234DE, 0x0234E2, 0x02352A, 0x023532, 0x02355A, 0x023587,
+    0x02358A, 0x023596, 0x0235A6, 0x0235D2, 0x023606, 0x02360E, 0x023622, 0x023636, 0x023668, 0x02366B, 0x023677, 0x02367A,
+    0x023687, 0x02368A, 0x023696, 0x0236A6, 0x0236B3, 0x0236B6, 0x0236C2, 0x0236D2, 0x023703, 0x023706, 0x023712, 0x023722,
+    0x02374E, 0x023796, 0x02379E, 0x0237C6, 0x0237DF, 0x0237E2, 0x0237EE, 0x0237FE, 0x02382A, 0x02387A, 0x02388E, 0x0238DB,
+    0x0238E3, 0x0238E6, 0x0238EA, 0x0238FA, 0x023902, 0x02390B, 0x02390E, 0x02391A, 0x023926, 0x02392A, 0x02392E, 0x02396F,
+    0x023972, 0x023976, 0x02397E, 0x02398E, 0x0239A6, 0x0239BA, 0x0239D3, 0x0239D6, 0x0239E2, 0x0239F2, 0x023A0A, 0x023A1E,
+    0x023A52, 0x023A5A, 0x023A6E, 0x023A82, 0x023AE6, 0x023BE2, 0x023BEA, 0x023C12, 0x023C76, 0x023CDA, 0x02402C, 0x02402F,
+    0x02403B, 0x02403E, 0x02404B, 0x02404E, 0x02405A, 0x02406A, 0x024077, 0x02407A, 0x024086, 0x024096, 0x0240AB, 0x0240B3,
+    0x0240B6, 0x0240BA, 0x0240C7, 0x0240CA, 0x0240D2, 0x0240D6, 0x0240DB, 0x0240DE, 0x0240E6, 0x0240EA, 0x0240F6, 0x0240FA,
+    0x0240FE, 0x024112, 0x024146, 0x02414E, 0x024162, 0x024176, 0x0241A3, 0x0241A6, 0x0241B2, 0x0241C2, 0x0241EE, 0x024222,
+    0x02422A, 0x02423E, 0x024252, 0x024333, 0x024336, 0x024342, 0x024352, 0x02437E, 0x0243B2, 0x0243BA, 0x0243CE, 0x0243E2,
+    0x0244AA, 0x02458B, 0x02458E, 0x02459A, 0x0245AA, 0x0245D6, 0x024626, 0x02463A, 0x024702, 0x02477F, 0x024782, 0x02478E,
+    0x02479E, 0x0247CA, 0x0247FE, 0x024806, 0x02481A, 0x02482E, 0x024892, 0x0248F6, 0x0249F0, 0x0249F3, 0x0249FF, 0x024A02,
+    0x024A0F, 0x024A12, 0x024A1E, 0x024A2E, 0x024A3B, 0x024A3E, 0x024A4A, 0x024A5A, 0x024A8B, 0x024A8E, 0x024A9A, 0x024AAA,
+    0x024AD6, 0x024B26, 0x024B67, 0x024B6A, 0x024B76, 0x024B86, 0x024BB2, 0x024C02, 0x024CF7, 0x024CFA, 0x024D06, 0x024D16,
+    0x024D42, 0x024D92, 0x024E6E, 0x024F4F, 0x024F52, 0x024F5E, 0x024F6E, 0x024F9A, 0x024FCE, 0x024FD6, 0x024FEA, 0x024FFE,
+    0x0250C6, 0x025143, 0x025146, 0x025152, 0x025162, 0x02518E, 0x0251DE, 0x025256, 0x0252BA, 0x02544A, 0x0254AE, 0x025627,
+    0x02562F, 0x025632, 0x025636, 0x025646, 0x02564E, 0x025657, 0x02565A, 0x025666, 0x025672, 0x025676, 0x02567A, 0x0256C2,
+    0x0256CA, 0x0256F2, 0x02571F, 0x025722, 0x02572E, 0x02573E, 0x02576A, 0x02579E, 0x0257A6, 0x0257BA, 0x0257CE, 0x025913,
+    0x025916, 0x025922, 0x02592E, 0x025932, 0x025936, 0x02595E, 0x0259AE, 0x025A26, 0x025A8A, 0x025B07, 0x025B0A, 0x025B16,
+    0x025B26, 0x025B52, 0x025BA2, 0x025C1A, 0x025C7E, 0x025D7A, 0x025D82, 0x025DAA, 0x025E0E, 0x025E72, 0x026066, 0x02625A,
+    0x02625D, 0x026269, 0x02626C, 0x026279, 0x02627C, 0x026288, 0x02628B, 0x026298, 0x0262A5, 0x0262A8, 0x0262B4, 0x0262B7,
+    0x0262C4, 0x0262C7, 0x0262D3, 0x0262D6, 0x0262F5, 0x0262F8, 0x026304, 0x026307, 0x026314, 0x026317, 0x026333, 0x026340,
+    0x026343, 0x02634F, 0x026352, 0x026390, 0x026393, 0x0263AF, 0x0263B2, 0x0263CE, 0x0263D1, 0x0263D4, 0x0263E0, 0x0263E3,
+    0x0263F0, 0x0263F3, 0x0263FF, 0x026402, 0x02640F, 0x02641C, 0x02641F, 0x02642B, 0x02642E, 0x02643B, 0x02643E, 0x02644A,
+    0x02646C, 0x02646F, 0x02647B, 0x02647E, 0x02648B, 0x02648E, 0x0264AA, 0x0264B7, 0x0264BA, 0x0264C6, 0x026561, 0x026564,
+    0x026570, 0x026573, 0x026580, 0x026583, 0x02658F, 0x026592, 0x02659F, 0x0265AC, 0x0265AF, 0x0265BB, 0x0265BE, 0x0265FC,
+    0x0265FF, 0x02660B, 0x02660E, 0x02661B, 0x02661E, 0x02663A, 0x026697, 0x02669A, 0x0266B6, 0x0266D8, 0x0266DB, 0x0266E7,
+    0x0266EA, 0x0266F7, 0x0266FA, 0x026706, 0x026716, 0x026723, 0x026726, 0x026732, 0x026868, 0x02686B, 0x026877, 0x02687A,
+    0x026887, 0x02688A, 0x026896, 0x0268A6, 0x026903, 0x026906, 0x026912, 0x026922, 0x02699E, 0x0269AD, 0x0269B0, 0x0269BC,
+    0x0269BF, 0x0269CC, 0x0269CF, 0x0269DB, 0x0269DE, 0x0269EB, 0x0269F8, 0x0269FB, 0x026A07, 0x026A0A, 0x026A17, 0x026A1A,
+    0x026A26, 0x026A48, 0x026A4B, 0x026A57, 0x026A5A, 0x026A67, 0x026A6A, 0x026A86, 0x026A93, 0x026A96, 0x026AA2, 0x026AE3,
+    0x026AE6, 0x026B02, 0x026B24, 0x026B27, 0x026B33, 0x026B36, 0x026B43, 0x026B46, 0x026B52, 0x026B62, 0x026B6F, 0x026B72,
+    0x026B7E, 0x026B8E, 0x026BBF, 0x026BC2, 0x026BCE, 0x026BDE, 0x026C0A, 0x026CB4, 0x026CB7, 0x026CC3, 0x026CC6, 0x026CD3,
+    0x026CD6, 0x026CE2, 0x026CF2, 0x026CFF, 0x026D02, 0x026D0E, 0x026D4F, 0x026D52, 0x026D5E, 0x026D6E, 0x026DEA, 0x026E2B,
+    0x026E2E, 0x026E3A, 0x026E4A, 0x026E76, 0x02717D, 0x027180, 0x02718C, 0x02718F, 0x02719C, 0x02719F, 0x0271AB, 0x0271AE,
+    0x0271BB, 0x0271C8, 0x0271CB, 0x0271D7, 0x0271DA, 0x0271E7, 0x0271EA, 0x0271F6, 0x027218, 0x02721B, 0x027227, 0x02722A,
+    0x027237, 0x02723A, 0x027256, 0x027263, 0x027266, 0x027272, 0x0272B3, 0x0272B6, 0x0272D2, 0x0272F4, 0x0272F7, 0x027303,
+    0x027306, 0x027313, 0x027316, 0x027322, 0x027332, 0x02733F, 0x027342, 0x02734E, 0x02735E, 0x027484, 0x027487, 0x027493,
+    0x027496, 0x0274A3, 0x0274A6, 0x0274B2, 0x0274C2, 0x0274CF, 0x0274D2, 0x0274DE, 0x02751F, 0x027522, 0x02752E, 0x02753E,
+    0x0275BA, 0x02778B, 0x02778E, 0x02779A, 0x0277AA, 0x027826, 0x0278D0, 0x0278D3, 0x0278DF, 0x0278E2, 0x0278EF, 0x0278F2,
+    0x0278FE, 0x02790E, 0x02791B, 0x02791E, 0x02792A, 0x02793A, 0x02796B, 0x02796E, 0x02797A, 0x02798A, 0x0279B6, 0x027A06,
+    0x027A47, 0x027A4A, 0x027A56, 0x027A66, 0x027A92, 0x0280A0, 0x0280A3, 0x0280AF, 0x0280B2, 0x0280BF, 0x0280C2, 0x0280CE,
+    0x0280DE, 0x0280EB, 0x0280EE, 0x0280FA, 0x02810A, 0x02813B, 0x02813E, 0x02814A, 0x02815A, 0x028186, 0x0281D6, 0x0283A7,
+    0x0283AA, 0x0283B6, 0x0283C6, 0x0283F2, 0x028442, 0x0286AE, 0x0286F9, 0x0286FC, 0x028708, 0x02870B, 0x028718, 0x02871B,
+    0x028727, 0x02872A, 0x028737, 0x028744, 0x028747, 0x028753, 0x028756, 0x028763, 0x028766, 0x028772, 0x028794, 0x028797,
+    0x0287A3, 0x0287A6, 0x0287B3, 0x0287B6, 0x0287D2, 0x0287DF, 0x0287E2, 0x0287EE, 0x02882F, 0x028832, 0x02884E, 0x028870,
+    0x028873, 0x02887F, 0x028882, 0x02888F, 0x028892, 0x02889E, 0x0288AE, 0x0288BB, 0x0288BE, 0x0288CA, 0x0288DA, 0x02890B,
+    0x02890E, 0x02891A, 0x02892A, 0x028956, 0x028A00, 0x028A03, 0x028A0F, 0x028A12, 0x028A1F, 0x028A22, 0x028A2E, 0x028A3E,
+    0x028A4B, 0x028A4E, 0x028A5A, 0x028A9B, 0x028A9E, 0x028AAA, 0x028ABA, 0x028B36, 0x028B77, 0x028B7A, 0x028B86, 0x028B96,
+    0x028BC2, 0x028D07, 0x028D0A, 0x028D16, 0x028D26, 0x028DA2, 0x028E4C, 0x028E4F, 0x028E5B, 0x028E5E, 0x028E6B, 0x028E6E,
+    0x028E7A, 0x028E8A, 0x028E97, 0x028E9A, 0x028EA6, 0x028EB6, 0x028EE7, 0x028EEA, 0x028EF6, 0x028F06, 0x028F32, 0x028F82,
+    0x028FC3, 0x028FC6, 0x028FD2, 0x028FE2, 0x02900E, 0x02905E, 0x029153, 0x029156, 0x029162, 0x029172, 0x02919E, 0x0291EE,
+    0x0292CA, 0x02961C, 0x02961F, 0x02962B, 0x02962E, 0x02963B, 0x02963E, 0x02964A, 0x02965A, 0x029667, 0x02966A, 0x029676,
+    0x029686, 0x0296B7, 0x0296BA, 0x0296C6, 0x0296D6, 0x029702, 0x029752, 0x029793, 0x029796, 0x0297A2, 0x0297B2, 0x0297DE,
+    0x029923, 0x029926, 0x029932, 0x029942, 0x02996E, 0x0299BE, 0x029C2A, 0x029D6F, 0x029D72, 0x029D7E, 0x029D8E, 0x029DBA,
+    0x029E0A, 0x029EE6, 0x02AE09, 0x02AE0C, 0x02AE18, 0x02AE1B, 0x02AE28, 0x02AE2B, 0x02AE37, 0x02AE3A, 0x02AE47, 0x02AE54,
+    0x02AE57, 0x02AE63, 0x02AE66, 0x02AE73, 0x02AE76, 0x02AE82, 0x02AEA4, 0x02AEA7, 0x02AEB3, 0x02AEB6, 0x02AEC3, 0x02AEC6,
+    0x02AEE2, 0x02AEEF, 0x02AEF2, 0x02AEFE, 0x02AF3F, 0x02AF42, 0x02AF5E, 0x02AF80, 0x02AF83, 0x02AF8F, 0x02AF92, 0x02AF9F,
+    0x02AFA2, 0x02AFAE, 0x02AFBE, 0x02AFCB, 0x02AFCE, 0x02AFDA, 0x02AFEA, 0x02B01B, 0x02B01E, 0x02B02A, 0x02B03A, 0x02B066,
+    0x02B110, 0x02B113, 0x02B11F, 0x02B122, 0x02B12F, 0x02B132, 0x02B13E, 0x02B14E, 0x02B15B, 0x02B15E, 0x02B16A, 0x02B1AB,
+    0x02B1AE, 0x02B1BA, 0x02B1CA, 0x02B246, 0x02B287, 0x02B28A, 0x02B296, 0x02B2A6, 0x02B2D2, 0x02B417, 0x02B41A, 0x02B426,
+    0x02B436, 0x02B4B2, 0x02B55C, 0x02B55F, 0x02B56B, 0x02B56E, 0x02B57B, 0x02B57E, 0x02B58A, 0x02B59A, 0x02B5A7, 0x02B5AA,
+    0x02B5B6, 0x02B5C6, 0x02B5F7, 0x02B5FA, 0x02B606, 0x02B616, 0x02B642, 0x02B692, 0x02B6D3, 0x02B6D6, 0x02B6E2, 0x02B6F2,
+    0x02B71E, 0x02B76E, 0x02BD2C, 0x02BD2F, 0x02BD3B, 0x02BD3E, 0x02BD4B, 0x02BD4E, 0x02BD5A, 0x02BD6A, 0x02BD77, 0x02BD7A,
+    0x02BD86, 0x02BD96, 0x02BDC7, 0x02BDCA, 0x02BDD6, 0x02BDE6, 0x02BE12, 0x02BE62, 0x02BEA3, 0x02BEA6, 0x02BEB2, 0x02BEC2,
+    0x02BEEE, 0x02C033, 0x02C036, 0x02C042, 0x02C052, 0x02C07E, 0x02C0CE, 0x02C33A, 0x02CC4F, 0x02CC52, 0x02CC5E, 0x02CC6E,
+    0x02CC9A, 0x02CCEA, 0x02CF56, 0x02D2A8, 0x02D2AB, 0x02D2B7, 0x02D2BA, 0x02D2C7, 0x02D2CA, 0x02D2D6, 0x02D2E6, 0x02D2F3,
+    0x02D2F6, 0x02D302, 0x02D312, 0x02D343, 0x02D346, 0x02D352, 0x02D362, 0x02D38E, 0x02D3DE, 0x02D41F, 0x02D422, 0x02D42E,
+    0x02D43E, 0x02D46A, 0x02D4BA, 0x02D5AF, 0x02D5B2, 0x02D5BE, 0x02D5CE, 0x02D5FA, 0x02D64A, 0x02D726, 0x02D8B6, 0x02D9FB,
+    0x02D9FE, 0x02DA0A, 0x02DA1A, 0x02DA46, 0x02DA96, 0x02DB72, 0x02F4D8, 0x02F4E0, 0x02F4E3, 0x02F4E7, 0x02F4F7, 0x02F4FF,
+    0x02F502, 0x02F506, 0x02F508, 0x02F50B, 0x02F516, 0x02F517, 0x02F51A, 0x02F51E, 0x02F523, 0x02F527, 0x02F52A, 0x02F52B,
+    0x02F52E, 0x02F532, 0x02F536, 0x02F542, 0x02F546, 0x02F54A, 0x02F573, 0x02F57B, 0x02F57E, 0x02F582, 0x02F592, 0x02F59A,
+    0x02F5A3, 0x02F5A6, 0x02F5B2, 0x02F5BE, 0x02F5C2, 0x02F5C6, 0x02F5D0, 0x02F5D3, 0x02F5DF, 0x02F5E2, 0x02F5EF, 0x02F5F2,
+    0x02F5FE, 0x02F60E, 0x02F616, 0x02F61B, 0x02F61E, 0x02F62A, 0x02F63A, 0x02F63E, 0x02F64F, 0x02F657, 0x02F65A, 0x02F65E,
+    0x02F66B, 0x02F66E, 0x02F676, 0x02F67A, 0x02F67F, 0x02F682, 0x02F68A, 0x02F68E, 0x02F69A, 0x02F69E, 0x02F6A2, 0x02F6B6,
+    0x02F6EA, 0x02F6F2, 0x02F706, 0x02F71A, 0x02F7DF, 0x02F7E7, 0x02F7EA, 0x02F7EE, 0x02F7FE, 0x02F806, 0x02F80F, 0x02F812,
+    0x02F81E, 0x02F82A, 0x02F82E, 0x02F832, 0x02F87A, 0x02F882, 0x02F8AA, 0x02F8D7, 0x02F8DA, 0x02F8E6, 0x02F8F6, 0x02F922,
+    0x02F956, 0x02F95E, 0x02F972, 0x02F986, 0x02F9B8, 0x02F9BB, 0x02F9C7, 0x02F9CA, 0x02F9D7, 0x02F9DA, 0x02F9E6, 0x02F9F6,
+    0x02FA03, 0x02FA06, 0x02FA12, 0x02FA22, 0x02FA53, 0x02FA56, 0x02FA62, 0x02FA72, 0x02FA9E, 0x02FAE6, 0x02FAEE, 0x02FB16,
+    0x02FB2F, 0x02FB32, 0x02FB3E, 0x02FB4E, 0x02FB7A, 0x02FBCA, 0x02FBDE, 0x02FC2B, 0x02FC33, 0x02FC36, 0x02FC3A, 0x02FC4A,
+    0x02FC52, 0x02FC5B, 0x02FC5E, 0x02FC6A, 0x02FC76, 0x02FC7A, 0x02FC7E, 0x02FCBF, 0x02FCC2, 0x02FCC6, 0x02FCCE, 0x02FCDE,
+    0x02FCF6, 0x02FD0A, 0x02FD23, 0x02FD26, 0x02FD32, 0x02FD42, 0x02FD5A, 0x02FD6E, 0x02FDA2, 0x02FDAA, 0x02FDBE, 0x02FDD2,
+    0x02FE36, 0x02FF32, 0x02FF3A, 0x02FF62, 0x02FFC6, 0x03002A, 0x0303FB, 0x030403, 0x030406, 0x03040A, 0x03041A, 0x030422,
+    0x03042B, 0x03042E, 0x03043A, 0x030446, 0x03044A, 0x03044E, 0x030496, 0x03049E, 0x0304C6, 0x0304F3, 0x0304F6, 0x030502,
+    0x030512, 0x03053E, 0x030572, 0x03057A, 0x03058E, 0x0305A2, 0x030702, 0x03070A, 0x030732, 0x0307FA, 0x0308DB, 0x0308DE,
+    0x0308EA, 0x0308FA, 0x030926, 0x030976, 0x030A52, 0x030B4E, 0x030B56, 0x030B7E, 0x030BE2, 0x030C46, 0x030D40, 0x030D43,
+    0x030D4F, 0x030D52, 0x030D5F, 0x030D62, 0x030D6E, 0x030D7E, 0x030D8B, 0x030D8E, 0x030D9A, 0x030DAA, 0x030DDB, 0x030DDE,
+    0x030DEA, 0x030DFA, 0x030E26, 0x030E76, 0x030EB7, 0x030EBA, 0x030EC6, 0x030ED6, 0x030F02, 0x030F52, 0x031047, 0x03104A,
+    0x031056, 0x031066, 0x031092, 0x0310E2, 0x0311BE, 0x03131E, 0x031326, 0x03134E, 0x031416, 0x031493, 0x031496, 0x0314A2,
+    0x0314B2, 0x0314DE, 0x03152E, 0x03160A, 0x03179A, 0x0317FE, 0x031975, 0x031978, 0x031984, 0x031987, 0x031994, 0x031997,
+    0x0319A3, 0x0319A6, 0x0319B3, 0x0319C0, 0x0319C3, 0x0319CF, 0x0319D2, 0x0319DF, 0x0319E2, 0x0319EE, 0x031A10, 0x031A13,
+    0x031A1F, 0x031A22, 0x031A2F, 0x031A32, 0x031A4E, 0x031A5B, 0x031A5E, 0x031A6A, 0x031AAB, 0x031AAE, 0x031ACA, 0x031AEC,
+    0x031AEF, 0x031AFB, 0x031AFE, 0x031B0B, 0x031B0E, 0x031B1A, 0x031B2A, 0x031B37, 0x031B3A, 0x031B46, 0x031B56, 0x031B87,
+    0x031B8A, 0x031B96, 0x031BA6, 0x031BD2, 0x031C7C, 0x031C7F, 0x031C8B, 0x031C8E, 0x031C9B, 0x031C9E, 0x031CAA, 0x031CBA,
+    0x031CC7, 0x031CCA, 0x031CD6, 0x031D17, 0x031D1A, 0x031D26, 0x031D36, 0x031DB2, 0x031DF3, 0x031DF6, 0x031E02, 0x031E12,
+    0x031E3E, 0x031F83, 0x031F86, 0x031F92, 0x031FA2, 0x03201E, 0x0320C8, 0x0320CB, 0x0320D7, 0x0320DA, 0x0320E7, 0x0320EA,
+    0x0320F6, 0x032106, 0x032113, 0x032116, 0x032122, 0x032132, 0x032163, 0x032166, 0x032172, 0x032182, 0x0321AE, 0x0321FE,
+    0x03223F, 0x032242, 0x03224E, 0x03225E, 0x03228A, 0x0322DA, 0x0323CF, 0x0323D2, 0x0323DE, 0x0323EE, 0x03241A, 0x03246A,
+    0x032546, 0x032898, 0x03289B, 0x0328A7, 0x0328AA, 0x0328B7, 0x0328BA, 0x0328C6, 0x0328D6, 0x0328E3, 0x0328E6, 0x0328F2,
+    0x032902, 0x032933, 0x032936, 0x032942, 0x032952, 0x03297E, 0x0329CE, 0x032A0F, 0x032A12, 0x032A1E, 0x032A2E, 0x032A5A,
+    0x032B9F, 0x032BA2, 0x032BAE, 0x032BBE, 0x032BEA, 0x032C3A, 0x032EA6, 0x032FEB, 0x032FEE, 0x032FFA, 0x03300A, 0x033036,
+    0x033086, 0x033162, 0x0337BB, 0x0337BE, 0x0337CA, 0x0337DA, 0x033806, 0x033856, 0x033AC2, 0x033E14, 0x033E17, 0x033E23,
+    0x033E26, 0x033E33, 0x033E36, 0x033E42, 0x033E52, 0x033E5F, 0x033E62, 0x033E6E, 0x033E7E, 0x033EAF, 0x033EB2, 0x033EBE,
+    0x033ECE, 0x033EFA, 0x033F4A, 0x033F8B, 0x033F8E, 0x033F9A, 0x033FAA, 0x033FD6, 0x034026, 0x034087, 0x03408F, 0x034092,
+    0x034096, 0x0340A6, 0x0340AE, 0x0340B7, 0x0340BA, 0x0340C6, 0x0340D2, 0x0340D6, 0x0340DA, 0x03411B, 0x03411E, 0x034122,
+    0x03412A, 0x03413A, 0x034152, 0x034166, 0x03417F, 0x034182, 0x03418E, 0x03419E, 0x0341B6, 0x0341CA, 0x0341FE, 0x034206,
+    0x03421A, 0x03422E, 0x034292, 0x03438E, 0x034396, 0x0343BE, 0x034422, 0x034486, 0x034567, 0x03456A, 0x034576, 0x034586,
+    0x0345B2, 0x034602, 0x0346DE, 0x0347DA, 0x0347E2, 0x03480A, 0x03486E, 0x0348D2, 0x034D37, 0x034D3A, 0x034D46, 0x034D56,
+    0x034D82, 0x034DD2, 0x034EAE, 0x034FAA, 0x034FB2, 0x034FDA, 0x03503E, 0x0350A2, 0x03548A, 0x036524, 0x036527, 0x036533,
+    0x036536, 0x036543, 0x036546, 0x036552, 0x036562, 0x03656F, 0x036572, 0x03657E, 0x03658E, 0x0365BF, 0x0365C2, 0x0365CE,
+    0x0365DE, 0x03660A, 0x03665A, 0x03669B, 0x03669E, 0x0366AA, 0x0366BA, 0x0366E6, 0x036736, 0x03682B, 0x03682E, 0x03683A,
+    0x03684A, 0x036876, 0x0368C6, 0x0369A2, 0x036B32, 0x036C77, 0x036C7A, 0x036C86, 0x036C96, 0x036CC2, 0x036D12, 0x036DEE,
+    0x036EE8, 0x036EEB, 0x036EF7, 0x036EFA, 0x036F07, 0x036F0A, 0x036F16, 0x036F26, 0x036F33, 0x036F36, 0x036F42, 0x036F52,
+    0x036F83, 0x036F86, 0x036F92, 0x036FA2, 0x036FCE, 0x03701E, 0x03705F, 0x037062, 0x03706E, 0x03707E, 0x0370AA, 0x0370FA,
+    0x0371EF, 0x0371F2, 0x0371FE, 0x03720E, 0x03723A, 0x03728A, 0x037366, 0x037447, 0x03744A, 0x037456, 0x037466, 0x037492,
+    0x0374E2, 0x0374F6, 0x0375BE, 0x03763B, 0x03763E, 0x03764A, 0x03765A, 0x037686, 0x0376D6, 0x03774E, 0x0377B2, 0x037942,
+    0x037E0B, 0x037E0E, 0x037E1A, 0x037E2A, 0x037E56, 0x037EA6, 0x037F82, 0x038112, 0x03836A, 0x03855E, 0x0389C3, 0x0389C6,
+    0x0389D2, 0x0389E2, 0x038A0E, 0x038A5E, 0x038B3A, 0x038C36, 0x038C3E, 0x038C66, 0x038CCA, 0x038D2E, 0x039116, 0x039389,
+    0x039391, 0x039394, 0x039398, 0x0393A8, 0x0393B0, 0x0393B3, 0x0393B7, 0x0393B9, 0x0393BC, 0x0393C7, 0x0393C8, 0x0393CB,
+    0x0393CF, 0x0393D4, 0x0393D8, 0x0393DB, 0x0393DC, 0x0393DF, 0x0393E3, 0x0393E7, 0x0393EA, 0x0393F3, 0x0393F7, 0x0393FB,
+    0x0393FE, 0x039402, 0x039424, 0x03942C, 0x03942F, 0x039433, 0x039443, 0x03944B, 0x03944E, 0x039454, 0x039457, 0x039462,
+    0x039463, 0x039466, 0x03946F, 0x039473, 0x039476, 0x039477, 0x03947A, 0x03947E, 0x039481, 0x039484, 0x039490, 0x039493,
+    0x0394A0, 0x0394A3, 0x0394AF, 0x0394B2, 0x0394BF, 0x0394C7, 0x0394CA, 0x0394CC, 0x0394CF, 0x0394DB, 0x0394DE, 0x0394EB,
+    0x0394EE, 0x0394EF, 0x0394F2, 0x0394FA, 0x039500, 0x039508, 0x03950B, 0x03950F, 0x03951C, 0x03951F, 0x039527, 0x03952A,
+    0x03952B, 0x03952E, 0x039530, 0x039533, 0x03953B, 0x03953E, 0x03953F, 0x039542, 0x039546, 0x03954B, 0x03954F, 0x039552,
+    0x039553, 0x039556, 0x03955A, 0x03955E, 0x039567, 0x03956A, 0x03956E, 0x039572, 0x039576, 0x03959B, 0x0395A3, 0x0395A6,
+    0x0395AA, 0x0395B7, 0x0395BA, 0x0395C2, 0x0395CB, 0x0395CE, 0x0395D6, 0x0395DA, 0x0395E6, 0x0395EA, 0x0395EE, 0x039690,
+    0x039698, 0x03969B, 0x03969F, 0x0396AF, 0x0396B7, 0x0396BA, 0x0396BE, 0x0396C0, 0x0396C3, 0x0396CE, 0x0396CF, 0x0396D2,
+    0x0396D6, 0x0396DB, 0x0396DF, 0x0396E2, 0x0396E3, 0x0396E6, 0x0396EA, 0x0396EE, 0x03972B, 0x039733, 0x039736, 0x03973A,
+    0x03974A, 0x039752, 0x03975B, 0x03975E, 0x03976A, 0x039788, 0x03978B, 0x039797, 0x03979A, 0x0397A7, 0x0397AA, 0x0397B6,
+    0x0397C6, 0x0397CE, 0x0397D3, 0x0397D6, 0x0397E2, 0x039807, 0x03980F, 0x039812, 0x039816, 0x039823, 0x039826, 0x03982E,
+    0x039832, 0x039837, 0x03983A, 0x039842, 0x039846, 0x039852, 0x039856, 0x03985A, 0x039869, 0x03986C, 0x039878, 0x03987B,
+    0x039888, 0x03988B, 0x039897, 0x03989A, 0x0398A7, 0x0398B4, 0x0398B7, 0x0398C3, 0x0398C6, 0x0398D3, 0x0398D6, 0x0398E2,
+    0x039904, 0x039907, 0x039913, 0x039916, 0x039923, 0x039926, 0x039942, 0x03994F, 0x039952, 0x03995E, 0x039997, 0x03999F,
+    0x0399A2, 0x0399A6, 0x0399B6, 0x0399BE, 0x0399C7, 0x0399CA, 0x0399D6, 0x0399E0, 0x0399E3, 0x0399EF, 0x0399F2, 0x0399FF,
+    0x039A02, 0x039A0E, 0x039A1E, 0x039A2B, 0x039A2E, 0x039A32, 0x039A3A, 0x039A4A, 0x039A7B, 0x039A7E, 0x039A8A, 0x039A8F,
+    0x039A92, 0x039A9A, 0x039A9E, 0x039AAE, 0x039AC6, 0x039ADC, 0x039AE4, 0x039AE7, 0x039AEB, 0x039AFB, 0x039B03, 0x039B06,
+    0x039B0A, 0x039B0C, 0x039B0F, 0x039B1A, 0x039B1B, 0x039B1E, 0x039B22, 0x039B27, 0x039B2B, 0x039B2E, 0x039B2F, 0x039B32,
+    0x039B36, 0x039B3A, 0x039B46, 0x039B4A, 0x039B4E, 0x039B70, 0x039B73, 0x039B77, 0x039B7F, 0x039B82, 0x039B86, 0x039B8F,
+    0x039B92, 0x039B96, 0x039B9E, 0x039BA7, 0x039BAA, 0x039BAE, 0x039BB6, 0x039BBB, 0x039BBE, 0x039BC2, 0x039BC6, 0x039BCA,
+    0x039BD4, 0x039BD7, 0x039BE3, 0x039BE6, 0x039BF3, 0x039BF6, 0x039C02, 0x039C0B, 0x039C0E, 0x039C12, 0x039C1A, 0x039C1F,
+    0x039C22, 0x039C2A, 0x039C2E, 0x039C3E, 0x039C42, 0x039C53, 0x039C5B, 0x039C5E, 0x039C62, 0x039C6F, 0x039C72, 0x039C7A,
+    0x039C7E, 0x039C83, 0x039C86, 0x039C8E, 0x039C92, 0x039C9E, 0x039CA2, 0x039CA6, 0x039CBA, 0x039CE7, 0x039CEA, 0x039CEE,
+    0x039CF6, 0x039D06, 0x039D0A, 0x039D1E, 0x039D32, 0x039DE3, 0x039DEB, 0x039DEE, 0x039DF2, 0x039E02, 0x039E0A, 0x039E13,
+    0x039E16, 0x039E22, 0x039E2E, 0x039E32, 0x039E36, 0x039E77, 0x039E7A, 0x039E7E, 0x039E86, 0x039E96, 0x039EAE, 0x039EDB,
+    0x039EDE, 0x039EEA, 0x039EFA, 0x039F12, 0x039F26, 0x039F5A, 0x039F62, 0x039F76, 0x039F8A, 0x03A2AC, 0x03A2B4, 0x03A2B7,
+    0x03A2BB, 0x03A2CB, 0x03A2D3, 0x03A2D6, 0x03A2DA, 0x03A2DC, 0x03A2DF, 0x03A2EA, 0x03A2EB, 0x03A2EE, 0x03A2F2, 0x03A2F7,
+    0x03A2FB, 0x03A2FE, 0x03A2FF, 0x03A302, 0x03A306, 0x03A30A, 0x03A316, 0x03A31A, 0x03A31E, 0x03A347, 0x03A34F, 0x03A352,
+    0x03A356, 0x03A366, 0x03A36E, 0x03A377, 0x03A37A, 0x03A386, 0x03A392, 0x03A396, 0x03A39A, 0x03A3A4, 0x03A3A7, 0x03A3B3,
+    0x03A3B6, 0x03A3C3, 0x03A3C6, 0x03A3D2, 0x03A3E2, 0x03A3EA, 0x03A3EF, 0x03A3F2, 0x03A3FE, 0x03A40E, 0x03A412, 0x03A423,
+    0x03A42B, 0x03A42E, 0x03A432, 0x03A43F, 0x03A442, 0x03A44A, 0x03A44E, 0x03A453, 0x03A456, 0x03A45E, 0x03A462, 0x03A46E,
+    0x03A472, 0x03A476, 0x03A48A, 0x03A5B3, 0x03A5BB, 0x03A5BE, 0x03A5C2, 0x03A5D2, 0x03A5DA, 0x03A5E3, 0x03A5E6, 0x03A5F2,
+    0x03A5FE, 0x03A602, 0x03A606, 0x03A64E, 0x03A656, 0x03A67E, 0x03A6AB, 0x03A6AE, 0x03A6BA, 0x03A6CA, 0x03A6F6, 0x03A78C,
+    0x03A78F, 0x03A79B, 0x03A79E, 0x03A7AB, 0x03A7AE, 0x03A7BA, 0x03A7CA, 0x03A7D7, 0x03A7DA, 0x03A7E6, 0x03A7F6, 0x03A827,
+    0x03A82A, 0x03A836, 0x03A846, 0x03A872, 0x03A8BA, 0x03A8C2, 0x03A8EA, 0x03A903, 0x03A906, 0x03A912, 0x03A922, 0x03A94E,
+    0x03A9FF, 0x03AA07, 0x03AA0A, 0x03AA0E, 0x03AA1E, 0x03AA26, 0x03AA2F, 0x03AA32, 0x03AA3E, 0x03AA4A, 0x03AA4E, 0x03AA52,
+    0x03AA93, 0x03AA96, 0x03AA9A, 0x03AAA2, 0x03AAB2, 0x03AACA, 0x03AADE, 0x03AAF7, 0x03AAFA, 0x03AB06, 0x03AB16, 0x03AB2E,
+    0x03AB42, 0x03AB76, 0x03AB7E, 0x03AB92, 0x03ABA6, 0x03ABF1, 0x03ABF4, 0x03AC00, 0x03AC03, 0x03AC10, 0x03AC13, 0x03AC1F,
+    0x03AC22, 0x03AC2F, 0x03AC3C, 0x03AC3F, 0x03AC4B, 0x03AC4E, 0x03AC5B, 0x03AC5E, 0x03AC6A, 0x03AC8C, 0x03AC8F, 0x03AC9B,
+    0x03AC9E, 0x03ACAB, 0x03ACAE, 0x03ACCA, 0x03ACD7, 0x03ACDA, 0x03ACE6, 0x03AD27, 0x03AD2A, 0x03AD46, 0x03AD68, 0x03AD6B,
+    0x03AD77, 0x03AD7A, 0x03AD87, 0x03AD8A, 0x03AD96, 0x03ADA6, 0x03ADB3, 0x03ADB6, 0x03ADC2, 0x03ADD2, 0x03AE03, 0x03AE06,
+    0x03AE12, 0x03AE22, 0x03AE4E, 0x03AEF8, 0x03AEFB, 0x03AF07, 0x03AF0A, 0x03AF17, 0x03AF1A, 0x03AF26, 0x03AF36, 0x03AF43,
+    0x03AF46, 0x03AF52, 0x03AF93, 0x03AF96, 0x03AFA2, 0x03AFB2, 0x03B02E, 0x03B06F, 0x03B072, 0x03B07E, 0x03B08E, 0x03B0BA,
+    0x03B1CF, 0x03B1D7, 0x03B1DA, 0x03B1DE, 0x03B1EE, 0x03B1F6, 0x03B1FF, 0x03B202, 0x03B20E, 0x03B21A, 0x03B21E, 0x03B222,
+    0x03B26A, 0x03B272, 0x03B29A, 0x03B2C7, 0x03B2CA, 0x03B2D6, 0x03B2E6, 0x03B312, 0x03B344, 0x03B347, 0x03B353, 0x03B356,
+    0x03B363, 0x03B366, 0x03B372, 0x03B382, 0x03B38F, 0x03B392, 0x03B39E, 0x03B3AE, 0x03B3DF, 0x03B3E2, 0x03B3EE, 0x03B3FE,
+    0x03B42A, 0x03B47A, 0x03B4BB, 0x03B4BE, 0x03B4CA, 0x03B4D6, 0x03B4DA, 0x03B4DE, 0x03B506, 0x03B556, 0x03B64B, 0x03B64E,
+    0x03B65A, 0x03B66A, 0x03B696, 0x03B6AF, 0x03B6B2, 0x03B6BE, 0x03B6CE, 0x03B6E6, 0x03B6FA, 0x03B74A, 0x03B7C2, 0x03B828,
+    0x03B830, 0x03B833, 0x03B837, 0x03B847, 0x03B84F, 0x03B852, 0x03B856, 0x03B858, 0x03B85B, 0x03B866, 0x03B867, 0x03B86A,
+    0x03B86E, 0x03B873, 0x03B877, 0x03B87A, 0x03B87B, 0x03B87E, 0x03B882, 0x03B886, 0x03B892, 0x03B896, 0x03B89A, 0x03B8C3,
+    0x03B8CB, 0x03B8CE, 0x03B8D2, 0x03B8E2, 0x03B8EA, 0x03B8F3, 0x03B8F6, 0x03B902, 0x03B90E, 0x03B912, 0x03B916, 0x03B920,
+    0x03B923, 0x03B92F, 0x03B932, 0x03B93F, 0x03B942, 0x03B94E, 0x03B95E, 0x03B966, 0x03B96B, 0x03B96E, 0x03B97A, 0x03B98A,
+    0x03B98E, 0x03B99F, 0x03B9A7, 0x03B9AA, 0x03B9AE, 0x03B9BB, 0x03B9BE, 0x03B9C6, 0x03B9CA, 0x03B9CF, 0x03B9D2, 0x03B9DA,
+    0x03B9DE, 0x03B9EA, 0x03B9EE, 0x03B9F2, 0x03BA06, 0x03BA3A, 0x03BA42, 0x03BA56, 0x03BA6A, 0x03BB14, 0x03BB17, 0x03BB23,
+    0x03BB26, 0x03BB2F, 0x03BB33, 0x03BB36, 0x03BB37, 0x03BB3A, 0x03BB3E, 0x03BB42, 0x03BB4E, 0x03BB52, 0x03BB56, 0x03BB5F,
+    0x03BB62, 0x03BB6E, 0x03BB7A, 0x03BB7E, 0x03BB82, 0x03BBAF, 0x03BBB2, 0x03BBBE, 0x03BBCA, 0x03BBCE, 0x03BBD2, 0x03BBFA,
+    0x03BC27, 0x03BC2A, 0x03BC36, 0x03BC46, 0x03BC4A, 0x03BC72, 0x03BC8B, 0x03BC8E, 0x03BC9A, 0x03BCA6, 0x03BCAA, 0x03BCAE,
+    0x03BCC2, 0x03BCD6, 0x03BD08, 0x03BD0B, 0x03BD17, 0x03BD1A, 0x03BD27, 0x03BD2A, 0x03BD36, 0x03BD46, 0x03BD53, 0x03BD56,
+    0x03BD62, 0x03BD72, 0x03BDA3, 0x03BDA6, 0x03BDB2, 0x03BDC2, 0x03BDEE, 0x03BE1B, 0x03BE1E, 0x03BE2A, 0x03BE36, 0x03BE3A,
+    0x03BE3E, 0x03BE66, 0x03BE7F, 0x03BE82, 0x03BE8E, 0x03BE9E, 0x03BEB6, 0x03BECA, 0x03BF1A, 0x03BF2E, 0x03BF7B, 0x03BF83,
+    0x03BF86, 0x03BF8A, 0x03BF9A, 0x03BFA2, 0x03BFAB, 0x03BFAE, 0x03BFBA, 0x03BFC6, 0x03BFCA, 0x03BFCE, 0x03C00F, 0x03C012,
+    0x03C016, 0x03C01E, 0x03C02E, 0x03C046, 0x03C05A, 0x03C073, 0x03C076, 0x03C082, 0x03C092, 0x03C0AA, 0x03C0BE, 0x03C0F2,
+    0x03C0FA, 0x03C10E, 0x03C122, 0x03C186, 0x03C267, 0x03C26A, 0x03C276, 0x03C282, 0x03C286, 0x03C28A, 0x03C2B2, 0x03C302,
+    0x03C316, 0x03C37A, 0x03C3DE, 0x03C74B, 0x03C753, 0x03C756, 0x03C75A, 0x03C76A, 0x03C772, 0x03C77B, 0x03C77E, 0x03C78A,
+    0x03C796, 0x03C79A, 0x03C79E, 0x03C7E6, 0x03C7EE, 0x03C816, 0x03C843, 0x03C846, 0x03C852, 0x03C862, 0x03C88E, 0x03C8C2,
+    0x03C8CA, 0x03C8DE, 0x03C8F2, 0x03CA37, 0x03CA3A, 0x03CA46, 0x03CA52, 0x03CA56, 0x03CA5A, 0x03CA82, 0x03CAD2, 0x03CB4A,
+    0x03CC2B, 0x03CC2E, 0x03CC3A, 0x03CC4A, 0x03CC76, 0x03CCC6, 0x03CD3E, 0x03CDA2, 0x03CE9E, 0x03CEA6, 0x03CECE, 0x03CF32,
+    0x03CF96, 0x03DCC5, 0x03DCC8, 0x03DCD4, 0x03DCD7, 0x03DCE4, 0x03DCE7, 0x03DCF3, 0x03DCF6, 0x03DD03, 0x03DD10, 0x03DD13,
+    0x03DD1F, 0x03DD22, 0x03DD2F, 0x03DD32, 0x03DD3E, 0x03DD60, 0x03DD63, 0x03DD6F, 0x03DD72, 0x03DD7F, 0x03DD82, 0x03DD9E,
+    0x03DDAB, 0x03DDAE, 0x03DDBA, 0x03DDFB, 0x03DDFE, 0x03DE1A, 0x03DE3C, 0x03DE3F, 0x03DE4B, 0x03DE4E, 0x03DE5B, 0x03DE5E,
+    0x03DE6A, 0x03DE7A, 0x03DE87, 0x03DE8A, 0x03DE96, 0x03DEA6, 0x03DED7, 0x03DEDA, 0x03DEE6, 0x03DEF6, 0x03DF22, 0x03DF38,
+    0x03DF40, 0x03DF43, 0x03DF47, 0x03DF57, 0x03DF5F, 0x03DF62, 0x03DF66, 0x03DF68, 0x03DF6B, 0x03DF76, 0x03DF77, 0x03DF7A,
+    0x03DF7E, 0x03DF83, 0x03DF87, 0x03DF8A, 0x03DF8B, 0x03DF8E, 0x03DF92, 0x03DF96, 0x03DFA2, 0x03DFA6, 0x03DFAA, 0x03DFCC,
+    0x03DFCF, 0x03DFD3, 0x03DFDB, 0x03DFDE, 0x03DFE2, 0x03DFEB, 0x03DFEE, 0x03DFF2, 0x03DFFA, 0x03E003, 0x03E006, 0x03E00A,
+    0x03E012, 0x03E017, 0x03E01A, 0x03E01E, 0x03E022, 0x03E026, 0x03E030, 0x03E033, 0x03E03F, 0x03E042, 0x03E04F, 0x03E052,
+    0x03E05E, 0x03E067, 0x03E06A, 0x03E06E, 0x03E076, 0x03E07B, 0x03E07E, 0x03E086, 0x03E08A, 0x03E09A, 0x03E09E, 0x03E0AF,
+    0x03E0B7, 0x03E0BA, 0x03E0BE, 0x03E0CB, 0x03E0CE, 0x03E0D6, 0x03E0DA, 0x03E0DF, 0x03E0E2, 0x03E0EA, 0x03E0EE, 0x03E0FA,
+    0x03E0FE, 0x03E102, 0x03E116, 0x03E143, 0x03E146, 0x03E14A, 0x03E152, 0x03E162, 0x03E166, 0x03E17A, 0x03E18E, 0x03E23F,
+    0x03E247, 0x03E24A, 0x03E24E, 0x03E25E, 0x03E266, 0x03E26F, 0x03E272, 0x03E27E, 0x03E28A, 0x03E28E, 0x03E292, 0x03E2D3,
+    0x03E2D6, 0x03E2DA, 0x03E2E2, 0x03E2F2, 0x03E30A, 0x03E337, 0x03E33A, 0x03E346, 0x03E356, 0x03E36E, 0x03E382, 0x03E3B6,
+    0x03E3BE, 0x03E3D2, 0x03E3E6, 0x03E418, 0x03E41B, 0x03E427, 0x03E42A, 0x03E437, 0x03E43A, 0x03E446, 0x03E456, 0x03E463,
+    0x03E466, 0x03E472, 0x03E482, 0x03E4B3, 0x03E4B6, 0x03E4C2, 0x03E4D2, 0x03E4FE, 0x03E546, 0x03E54E, 0x03E576, 0x03E58F,
+    0x03E592, 0x03E59E, 0x03E5AE, 0x03E5DA, 0x03E62A, 0x03E63E, 0x03E68B, 0x03E693, 0x03E696, 0x03E69A, 0x03E6AA, 0x03E6B2,
+    0x03E6BB, 0x03E6BE, 0x03E6CA, 0x03E6D6, 0x03E6DA, 0x03E6DE, 0x03E71F, 0x03E722, 0x03E726, 0x03E72E, 0x03E73E, 0x03E756,
+    0x03E76A, 0x03E783, 0x03E786, 0x03E792, 0x03E7A2, 0x03E7BA, 0x03E7CE, 0x03E802, 0x03E80A, 0x03E81E, 0x03E832, 0x03E896,
+    0x03EBE8, 0x03EBEB, 0x03EBF7, 0x03EBFA, 0x03EC07, 0x03EC0A, 0x03EC16, 0x03EC26, 0x03EC33, 0x03EC36, 0x03EC42, 0x03EC52,
+    0x03EC83, 0x03EC86, 0x03EC92, 0x03ECA2, 0x03ECCE, 0x03ED1E, 0x03ED5F, 0x03ED62, 0x03ED6E, 0x03ED7E, 0x03EDAA, 0x03EE5B,
+    0x03EE63, 0x03EE66, 0x03EE6A, 0x03EE7A, 0x03EE82, 0x03EE8B, 0x03EE8E, 0x03EE9A, 0x03EEA6, 0x03EEAA, 0x03EEAE, 0x03EEEF,
+    0x03EEF2, 0x03EEF6, 0x03EEFE, 0x03EF0E, 0x03EF26, 0x03EF3A, 0x03EF53, 0x03EF56, 0x03EF62, 0x03EF72, 0x03EF8A, 0x03EF9E,
+    0x03EFD2, 0x03EFDA, 0x03EFEE, 0x03F002, 0x03F162, 0x03F16A, 0x03F192, 0x03F1F6, 0x03F25A, 0x03F33B, 0x03F33E, 0x03F34A,
+    0x03F35A, 0x03F386, 0x03F3D6, 0x03F4B2, 0x03F7A0, 0x03F7A3, 0x03F7AF, 0x03F7B2, 0x03F7BF, 0x03F7C2, 0x03F7CE, 0x03F7DE,
+    0x03F7EB, 0x03F7EE, 0x03F7FA, 0x03F80A, 0x03F83B, 0x03F83E, 0x03F84A, 0x03F85A, 0x03F886, 0x03F8D6, 0x03F917, 0x03F91A,
+    0x03F926, 0x03F936, 0x03F962, 0x03F9B2, 0x03FAA7, 0x03FAAA, 0x03FAB6, 0x03FAC6, 0x03FAF2, 0x03FB0B, 0x03FB0E, 0x03FB1A,
+    0x03FB2A, 0x03FB42, 0x03FB56, 0x03FBA6, 0x03FC1E, 0x03FD7E, 0x03FD86, 0x03FDAE, 0x03FE12, 0x03FE76, 0x03FEF3, 0x03FEF6,
+    0x03FF02, 0x03FF12, 0x03FF3E, 0x03FF8E, 0x04006A, 0x040164, 0x040167, 0x040173, 0x040176, 0x040183, 0x040186, 0x040192,
+    0x0401A2, 0x0401AF, 0x0401B2, 0x0401BE, 0x0401CE, 0x0401FF, 0x040202, 0x04020E, 0x04021E, 0x04024A, 0x04029A, 0x0402DB,
+    0x0402DE, 0x0402EA, 0x0402FA, 0x040326, 0x040376, 0x0403D7, 0x0403DF, 0x0403E2, 0x0403E6, 0x0403F6, 0x0403FE, 0x040407,
+    0x04040A, 0x040416, 0x040422, 0x040426, 0x04042A, 0x04046B, 0x04046E, 0x040472, 0x04047A, 0x04048A, 0x0404A2, 0x0404B6,
+    0x0404CF, 0x0404D2, 0x0404DE, 0x0404EE, 0x040506, 0x04051A, 0x04054E, 0x040556, 0x04056A, 0x04057E, 0x0405E2, 0x0406C3,
+    0x0406C6, 0x0406D2, 0x0406DE, 0x0406E2, 0x0406E6, 0x04070E, 0x04075E, 0x040772, 0x0407D6, 0x04083A, 0x0408B7, 0x0408BA,
+    0x0408C6, 0x0408D6, 0x040902, 0x040952, 0x0409CA, 0x040A2E, 0x040B2A, 0x040B32, 0x040B5A, 0x040BBE, 0x040C22, 0x040D99,
+    0x040D9C, 0x040DA8, 0x040DAB, 0x040DB8, 0x040DBB, 0x040DC7, 0x040DCA, 0x040DD7, 0x040DE4, 0x040DE7, 0x040DF3, 0x040DF6,
+    0x040E03, 0x040E06, 0x040E12, 0x040E34, 0x040E37, 0x040E43, 0x040E46, 0x040E53, 0x040E56, 0x040E72, 0x040E7F, 0x040E82,
+    0x040E8E, 0x040ECF, 0x040ED2, 0x040EEE, 0x040F10, 0x040F13, 0x040F1F, 0x040F22, 0x040F2F, 0x040F32, 0x040F3E, 0x040F4E,
+    0x040F5B, 0x040F5E, 0x040F6A, 0x040F7A, 0x040FAB, 0x040FAE, 0x040FBA, 0x040FCA, 0x040FF6, 0x0410A0, 0x0410A3, 0x0410AF,
+    0x0410B2, 0x0410BF, 0x0410C2, 0x0410CE, 0x0410DE, 0x0410EB, 0x0410EE, 0x0410FA, 0x04113B, 0x04113E, 0x04114A, 0x04115A,
+    0x0411D6, 0x041217, 0x04121A, 0x041226, 0x041236, 0x041262, 0x0413A7, 0x0413AA, 0x0413B6, 0x0413C6, 0x041442, 0x0414EC,
+    0x0414EF, 0x0414FB, 0x0414FE, 0x04150B, 0x04150E, 0x04151A, 0x04152A, 0x041537, 0x04153A, 0x041546, 0x041556, 0x041587,
+    0x04158A, 0x041596, 0x0415A6, 0x0415D2, 0x041622, 0x041663, 0x041666, 0x041672, 0x041682, 0x0416AE, 0x0416FE, 0x0417F3,
+    0x0417F6, 0x041802, 0x041812, 0x04183E, 0x04188E, 0x04196A, 0x041CBC, 0x041CBF, 0x041CCB, 0x041CCE, 0x041CDB, 0x041CDE,
+    0x041CEA, 0x041CFA, 0x041D07, 0x041D0A, 0x041D16, 0x041D26, 0x041D57, 0x041D5A, 0x041D66, 0x041D76, 0x041DA2, 0x041DF2,
+    0x041E33, 0x041E36, 0x041E42, 0x041E52, 0x041E7E, 0x041FC3, 0x041FC6, 0x041FD2, 0x041FE2, 0x04200E, 0x04205E, 0x0422CA,
+    0x04240F, 0x042412, 0x04241E, 0x04242E, 0x04245A, 0x0424AA, 0x042586, 0x042874, 0x042877, 0x042883, 0x042886, 0x042893,
+    0x042896, 0x0428A2, 0x0428B2, 0x0428BF, 0x0428C2, 0x0428CE, 0x0428DE, 0x04290F, 0x042912, 0x04291E, 0x04292E, 0x04295A,
+    0x0429AA, 0x0429EB, 0x0429EE, 0x0429FA, 0x042A0A, 0x042A36, 0x042A86, 0x042AE7, 0x042AEF, 0x042AF2, 0x042AF6, 0x042B06,
+    0x042B0E, 0x042B17, 0x042B1A, 0x042B26, 0x042B32, 0x042B36, 0x042B3A, 0x042B7B, 0x042B7E, 0x042B82, 0x042B8A, 0x042B9A,
+    0x042BB2, 0x042BC6, 0x042BDF, 0x042BE2, 0x042BEE, 0x042BFE, 0x042C16, 0x042C2A, 0x042C5E, 0x042C66, 0x042C7A, 0x042C8E,
+    0x042CF2, 0x042DEE, 0x042DF6, 0x042E1E, 0x042E82, 0x042EE6, 0x042FC7, 0x042FCA, 0x042FD6, 0x042FE6, 0x043012, 0x043062,
+    0x04313E, 0x043238, 0x04323B, 0x043247, 0x04324A, 0x043257, 0x04325A, 0x043266, 0x043276, 0x043283, 0x043286, 0x043292,
+    0x0432A2, 0x0432D3, 0x0432D6, 0x0432E2, 0x0432F2, 0x04331E, 0x04336E, 0x0433AF, 0x0433B2, 0x0433BE, 0x0433CE, 0x0433FA,
+    0x04344A, 0x04353F, 0x043542, 0x04354E, 0x04355E, 0x04358A, 0x0435DA, 0x0436B6, 0x043797, 0x04379A, 0x0437A6, 0x0437B6,
+    0x0437E2, 0x043832, 0x043846, 0x04390E, 0x04398B, 0x04398E, 0x04399A, 0x0439AA, 0x0439D6, 0x043A0A, 0x043A12, 0x043A26,
+    0x043A3A, 0x043A9E, 0x043B02, 0x043C92, 0x04415B, 0x04415E, 0x04416A, 0x04417A, 0x0441A6, 0x0441F6, 0x0442D2, 0x04434F,
+    0x044352, 0x04435E, 0x04436E, 0x04439A, 0x0443EA, 0x044462, 0x0444C6, 0x044656, 0x0446BA, 0x0448AE, 0x044AA4, 0x044AAC,
+    0x044AAF, 0x044AB3, 0x044AC3, 0x044ACB, 0x044ACE, 0x044AD2, 0x044AD4, 0x044AD7, 0x044AE2, 0x044AE3, 0x044AE6, 0x044AEA,
+    0x044AEF, 0x044AF3, 0x044AF6, 0x044AF7, 0x044AFA, 0x044AFE, 0x044B02, 0x044B0E, 0x044B12, 0x044B16, 0x044B3F, 0x044B47,
+    0x044B4A, 0x044B4E, 0x044B5E, 0x044B66, 0x044B6F, 0x044B72, 0x044B7E, 0x044B8A, 0x044B8E, 0x044B92, 0x044B9C, 0x044B9F,
+    0x044BAB, 0x044BAE, 0x044BBB, 0x044BBE, 0x044BCA, 0x044BDA, 0x044BE2, 0x044BE7, 0x044BEA, 0x044BF6, 0x044C06, 0x044C0A,
+    0x044C1B, 0x044C23, 0x044C26, 0x044C2A, 0x044C37, 0x044C3A, 0x044C42, 0x044C46, 0x044C4B, 0x044C4E, 0x044C56, 0x044C5A,
+    0x044C66, 0x044C6A, 0x044C6E, 0x044C82, 0x044CB6, 0x044CBE, 0x044CD2, 0x044CE6, 0x044DAB, 0x044DB3, 0x044DB6, 0x044DBA,
+    0x044DCA, 0x044DD2, 0x044DDB, 0x044DDE, 0x044DEA, 0x044DF6, 0x044DFA, 0x044DFE, 0x044E46, 0x044E4E, 0x044E76, 0x044EA3,
+    0x044EA6, 0x044EB2, 0x044EC2, 0x044EEE, 0x044F22, 0x044F2A, 0x044F3E, 0x044F52, 0x044F84, 0x044F87, 0x044F93, 0x044F96,
+    0x044FA3, 0x044FA6, 0x044FB2, 0x044FC2, 0x044FCF, 0x044FD2, 0x044FDE, 0x044FEE, 0x04501F, 0x045022, 0x04502E, 0x04503E,
+    0x04506A, 0x0450B2, 0x0450BA, 0x0450E2, 0x0450FB, 0x0450FE, 0x04510A, 0x04511A, 0x045146, 0x045196, 0x0451AA, 0x0451F7,
+    0x0451FF, 0x045202, 0x045206, 0x045216, 0x04521E, 0x045227, 0x04522A, 0x045236, 0x045242, 0x045246, 0x04524A, 0x04528B,
+    0x04528E, 0x045292, 0x04529A, 0x0452AA, 0x0452C2, 0x0452D6, 0x0452EF, 0x0452F2, 0x0452FE, 0x04530E, 0x045326, 0x04533A,
+    0x04536E, 0x045376, 0x04538A, 0x04539E, 0x045402, 0x0454FE, 0x045506, 0x04552E, 0x045592, 0x0455F6, 0x045948, 0x04594B,
+    0x045957, 0x04595A, 0x045967, 0x04596A, 0x045976, 0x045986, 0x045993, 0x045996, 0x0459A2, 0x0459B2, 0x0459C7, 0x0459CF,
+    0x0459D2, 0x0459D6, 0x0459E3, 0x0459E6, 0x0459EE, 0x0459F2, 0x0459F7, 0x0459FA, 0x045A02, 0x045A06, 0x045A12, 0x045A16,
+    0x045A1A, 0x045A2E, 0x045A62, 0x045A6A, 0x045A7E, 0x045A92, 0x045ABF, 0x045AC2, 0x045ACE, 0x045ADE, 0x045B0A, 0x045B3E,
+    0x045B46, 0x045B5A, 0x045B6E, 0x045C4F, 0x045C52, 0x045C5E, 0x045C6E, 0x045C9A, 0x045CCE, 0x045CD6, 0x045CEA, 0x045CFE,
+    0x045DC6, 0x045EA7, 0x045EAA, 0x045EB6, 0x045EC6, 0x045EF2, 0x045F42, 0x045F56, 0x04601E, 0x04609B, 0x04609E, 0x0460AA,
+    0x0460BA, 0x0460E6, 0x04611A, 0x046122, 0x046136, 0x04614A, 0x0461AE, 0x046212, 0x04630C, 0x04630F, 0x04631B, 0x04631E,
+    0x04632B, 0x04632E, 0x04633A, 0x04634A, 0x046357, 0x04635A, 0x046366, 0x046376, 0x0463A7, 0x0463AA, 0x0463B6, 0x0463C6,
+    0x0463F2, 0x046442, 0x046483, 0x046486, 0x046492, 0x0464A2, 0x0464CE, 0x04651E, 0x046613, 0x046616, 0x046622, 0x046632,
+    0x04665E, 0x0466AE, 0x04678A, 0x04686B, 0x04686E, 0x04687A, 0x04688A, 0x0468B6, 0x0468EA, 0x0468F2, 0x046906, 0x04691A,
+    0x0469E2, 0x046A5F, 0x046A62, 0x046A6E, 0x046A7E, 0x046AAA, 0x046AFA, 0x046B72, 0x046BD6, 0x046D66, 0x046DCA, 0x046F43,
+    0x046F4B, 0x046F4E, 0x046F52, 0x046F62, 0x046F6A, 0x046F73, 0x046F76, 0x046F82, 0x046F8E, 0x046F92, 0x046F96, 0x046FDE,
+    0x046FE6, 0x04700E, 0x04703B, 0x04703E, 0x04704A, 0x04705A, 0x047086, 0x0470BA, 0x0470C2, 0x0470D6, 0x0470EA, 0x04722F,
+    0x047232, 0x04723E, 0x04724A, 0x04724E, 0x047252, 0x04727A, 0x0472CA, 0x047342, 0x0473A6, 0x047423, 0x047426, 0x047432,
+    0x047442, 0x04746E, 0x0474BE, 0x047536, 0x04759A, 0x047696, 0x04769E, 0x0476C6, 0x04772A, 0x04778E, 0x047982, 0x047DE7,
+    0x047DEA, 0x047DF6, 0x047E06, 0x047E32, 0x047E66, 0x047E6E, 0x047E82, 0x047E96, 0x047F5E, 0x0480EE, 0x048152, 0x048346,
+    0x04853A, 0x0493E0, 0x0493E3, 0x0493EF, 0x0493F2, 0x0493FF, 0x049402, 0x04940E, 0x04941E, 0x04942B, 0x04942E, 0x04943A,
+    0x04944A, 0x04947B, 0x04947E, 0x04948A, 0x04949A, 0x0494C6, 0x049516, 0x049557, 0x04955A, 0x049566, 0x049576, 0x0495A2,
+    0x0495F2, 0x049653, 0x04965B, 0x04965E, 0x049662, 0x049672, 0x04967A, 0x049683, 0x049686, 0x049692, 0x04969E, 0x0496A2,
+    0x0496A6, 0x0496E7, 0x0496EA, 0x0496EE, 0x0496F6, 0x049706, 0x04971E, 0x049732, 0x04974B, 0x04974E, 0x04975A, 0x04976A,
+    0x049782, 0x049796, 0x0497CA, 0x0497D2, 0x0497E6, 0x0497FA, 0x04985E, 0x04995A, 0x049962, 0x04998A, 0x0499EE, 0x049A52,
+    0x049B33, 0x049B36, 0x049B42, 0x049B52, 0x049B7E, 0x049BCE, 0x049CAA, 0x049DA6, 0x049DAE, 0x049DD6, 0x049E3A, 0x049E9E,
+    0x04A303, 0x04A306, 0x04A312, 0x04A322, 0x04A34E, 0x04A39E, 0x04A47A, 0x04A4F7, 0x04A4FA, 0x04A506, 0x04A516, 0x04A542,
+    0x04A576, 0x04A57E, 0x04A592, 0x04A5A6, 0x04A60A, 0x04A66E, 0x04A7FE, 0x04AA56, 0x04AEBB, 0x04AEBE, 0x04AECA, 0x04AEDA,
+    0x04AF06, 0x04AF56, 0x04B032, 0x04B1C2, 0x04B226, 0x04B41A, 0x04B60E, 0x04B87F, 0x04B882, 0x04B88E, 0x04B89E, 0x04B8CA,
+    0x04B91A, 0x04B9F6, 0x04BAF2, 0x04BAFA, 0x04BB22, 0x04BB86, 0x04BBEA, 0x04BDDE, 0x04BFD2, 0x050DF4, 0x050DFC, 0x050DFF,
+    0x050E03, 0x050E13, 0x050E1B, 0x050E1E, 0x050E22, 0x050E24, 0x050E27, 0x050E32, 0x050E33, 0x050E36, 0x050E3A, 0x050E3F,
+    0x050E43, 0x050E46, 0x050E47, 0x050E4A, 0x050E4E, 0x050E52, 0x050E5E, 0x050E62, 0x050E66, 0x050E8F, 0x050E97, 0x050E9A,
+    0x050E9E, 0x050EAE, 0x050EB6, 0x050EBF, 0x050EC2, 0x050ECE, 0x050EDA, 0x050EDE, 0x050EE2, 0x050EEC, 0x050EEF, 0x050EFB,
+    0x050EFE, 0x050F0B, 0x050F0E, 0x050F1A, 0x050F2A, 0x050F32, 0x050F37, 0x050F3A, 0x050F46, 0x050F56, 0x050F5A, 0x050F6B,
+    0x050F73, 0x050F76, 0x050F7A, 0x050F87, 0x050F8A, 0x050F92, 0x050F96, 0x050F9B, 0x050F9E, 0x050FA6, 0x050FAA, 0x050FB6,
+    0x050FBA, 0x050FBE, 0x050FD2, 0x051006, 0x05100E, 0x051022, 0x051036, 0x0510FB, 0x051103, 0x051106, 0x05110A, 0x05111A,
+    0x051122, 0x05112B, 0x05112E, 0x05113A, 0x051146, 0x05114A, 0x05114E, 0x051196, 0x05119E, 0x0511C6, 0x0511F3, 0x0511F6,
+    0x051202, 0x051212, 0x05123E, 0x051272, 0x05127A, 0x05128E, 0x0512A2, 0x0512D4, 0x0512D7, 0x0512E3, 0x0512E6, 0x0512F3,
+    0x0512F6, 0x051302, 0x051312, 0x05131F, 0x051322, 0x05132E, 0x05133E, 0x05136F, 0x051372, 0x05137E, 0x05138E, 0x0513BA,
+    0x051402, 0x05140A, 0x051432, 0x05144B, 0x05144E, 0x05145A, 0x05146A, 0x051496, 0x0514E6, 0x0514FA, 0x051547, 0x05154F,
+    0x051552, 0x051556, 0x051566, 0x05156E, 0x051577, 0x05157A, 0x051586, 0x051592, 0x051596, 0x05159A, 0x0515DB, 0x0515DE,
+    0x0515E2, 0x0515EA, 0x0515FA, 0x051612, 0x051626, 0x05163F, 0x051642, 0x05164E, 0x05165E, 0x051676, 0x05168A, 0x0516BE,
+    0x0516C6, 0x0516DA, 0x0516EE, 0x051752, 0x05184E, 0x051856, 0x05187E, 0x0518E2, 0x051946, 0x051D17, 0x051D1F, 0x051D22,
+    0x051D26, 0x051D36, 0x051D3E, 0x051D47, 0x051D4A, 0x051D56, 0x051D62, 0x051D66, 0x051D6A, 0x051DB2, 0x051DBA, 0x051DE2,
+    0x051E0F, 0x051E12, 0x051E1E, 0x051E2E, 0x051E5A, 0x051E8E, 0x051E96, 0x051EAA, 0x051EBE, 0x05201E, 0x052026, 0x05204E,
+    0x052116, 0x0521F7, 0x0521FA, 0x052206, 0x052216, 0x052242, 0x052292, 0x05236E, 0x05246A, 0x052472, 0x05249A, 0x0524FE,
+    0x052562, 0x05265C, 0x05265F, 0x05266B, 0x05266E, 0x05267B, 0x05267E, 0x05268A, 0x05269A, 0x0526A7, 0x0526AA, 0x0526B6,
+    0x0526C6, 0x0526F7, 0x0526FA, 0x052706, 0x052716, 0x052742, 0x052792, 0x0527D3, 0x0527D6, 0x0527E2, 0x0527F2, 0x05281E,
+    0x05286E, 0x052963, 0x052966, 0x052972, 0x052982, 0x0529AE, 0x0529FE, 0x052ADA, 0x052C3A, 0x052C42, 0x052C6A, 0x052D32,
+    0x052DAF, 0x052DB2, 0x052DBE, 0x052DCE, 0x052DFA, 0x052E4A, 0x052F26, 0x0530B6, 0x05311A, 0x053293, 0x05329B, 0x05329E,
+    0x0532A2, 0x0532B2, 0x0532BA, 0x0532C3, 0x0532C6, 0x0532D2, 0x0532DE, 0x0532E2, 0x0532E6, 0x05332E, 0x053336, 0x05335E,
+    0x05338B, 0x05338E, 0x05339A, 0x0533AA, 0x0533D6, 0x05340A, 0x053412, 0x053426, 0x05343A, 0x05357F, 0x053582, 0x05358E,
+    0x05359A, 0x05359E, 0x0535A2, 0x0535CA, 0x05361A, 0x053692, 0x0536F6, 0x053773, 0x053776, 0x053782, 0x053792, 0x0537BE,
+    0x05380E, 0x053886, 0x0538EA, 0x0539E6, 0x0539EE, 0x053A16, 0x053A7A, 0x053ADE, 0x053CD2, 0x055730, 0x055733, 0x05573F,
+    0x055742, 0x05574F, 0x055752, 0x05575E, 0x05576E, 0x05577B, 0x05577E, 0x05578A, 0x05579A, 0x0557CB, 0x0557CE, 0x0557DA,
+    0x0557EA, 0x055816, 0x055866, 0x0558A7, 0x0558AA, 0x0558B6, 0x0558C6, 0x0558F2, 0x055942, 0x0559A3, 0x0559AB, 0x0559AE,
+    0x0559B2, 0x0559C2, 0x0559CA, 0x0559D3, 0x0559D6, 0x0559E2, 0x0559EE, 0x0559F2, 0x0559F6, 0x055A37, 0x055A3A, 0x055A3E,
+    0x055A46, 0x055A56, 0x055A6E, 0x055A82, 0x055A9B, 0x055A9E, 0x055AAA, 0x055ABA, 0x055AD2, 0x055AE6, 0x055B1A, 0x055B22,
+    0x055B36, 0x055B4A, 0x055BAE, 0x055CAA, 0x055CB2, 0x055CDA, 0x055D3E, 0x055DA2, 0x055E83, 0x055E86, 0x055E92, 0x055EA2,
+    0x055ECE, 0x055F1E, 0x055FFA, 0x0560F6, 0x0560FE, 0x056126, 0x05618A, 0x0561EE, 0x056653, 0x056656, 0x056662, 0x056672,
+    0x05669E, 0x0566EE, 0x0567CA, 0x0568C6, 0x0568CE, 0x0568F6, 0x05695A, 0x0569BE, 0x056DA6, 0x05720B, 0x05720E, 0x05721A,
+    0x05722A, 0x057256, 0x0572A6, 0x057382, 0x057512, 0x057576, 0x05795E, 0x058804, 0x058807, 0x058813, 0x058816, 0x058823,
+    0x058826, 0x058832, 0x058842, 0x05884F, 0x058852, 0x05885E, 0x05886E, 0x05889F, 0x0588A2, 0x0588AE, 0x0588BE, 0x0588EA,
+    0x05893A, 0x05897B, 0x05897E, 0x05898A, 0x05899A, 0x0589C6, 0x058A16, 0x058B0B, 0x058B0E, 0x058B1A, 0x058B2A, 0x058B56,
+    0x058BA6, 0x058C82, 0x058E12, 0x058F57, 0x058F5A, 0x058F66, 0x058F76, 0x058FA2, 0x058FF2, 0x0590CE, 0x05925E, 0x059727,
+    0x05972A, 0x059736, 0x059746, 0x059772, 0x0597C2, 0x05989E, 0x059A2E, 0x059E7A, 0x05A2DF, 0x05A2E2, 0x05A2EE, 0x05A2FE,
+    0x05A32A, 0x05A37A, 0x05A456, 0x05A552, 0x05A55A, 0x05A582, 0x05A5E6, 0x05A64A, 0x05AA32, 0x05ACA3, 0x05ACA6, 0x05ACB2,
+    0x05ACC2, 0x05ACEE, 0x05AD3E, 0x05AE1A, 0x05AFAA, 0x05B202, 0x05B3F6, 0x05C50F, 0x05C517, 0x05C51A, 0x05C51E, 0x05C52E,
+    0x05C536, 0x05C53F, 0x05C542, 0x05C54E, 0x05C55A, 0x05C55E, 0x05C562, 0x05C5AA, 0x05C5B2, 0x05C5DA, 0x05C607, 0x05C60A,
+    0x05C616, 0x05C626, 0x05C652, 0x05C686, 0x05C68E, 0x05C6A2, 0x05C6B6, 0x05C816, 0x05C81E, 0x05C846, 0x05C90E, 0x05C9EF,
+    0x05C9F2, 0x05C9FE, 0x05CA0E, 0x05CA3A, 0x05CA8A, 0x05CB66, 0x05CC62, 0x05CC6A, 0x05CC92, 0x05CCF6, 0x05CD5A, 0x05D3B3,
+    0x05D3B6, 0x05D3C2, 0x05D3D2, 0x05D3FE, 0x05D432, 0x05D43A, 0x05D44E, 0x05D462, 0x05D52A, 0x05D6BA, 0x05D912, 0x05DB06,
+    0x05DD77, 0x05DD7A, 0x05DD86, 0x05DD96, 0x05DDC2, 0x05DE12, 0x05DEEE, 0x05E07E, 0x05E2D6, 0x05E4CA, 0x05E9AE, 0x05E9B6,
+    0x05E9DE, 0x05EAA6, 0x05EC9A, 0x05EE8E, 0x076419, 0x076421, 0x076424, 0x076428, 0x076438, 0x076440, 0x076443, 0x076447,
+    0x076449, 0x07644C, 0x076457, 0x076458, 0x07645B, 0x07645F, 0x076464, 0x076468, 0x07646B, 0x07646C, 0x07646F, 0x076473,
+    0x076477, 0x07647A, 0x076483, 0x076487, 0x07648B, 0x07648E, 0x076492, 0x0764B4, 0x0764BC, 0x0764BF, 0x0764C3, 0x0764D3,
+    0x0764DB, 0x0764DE, 0x0764E4, 0x0764E7, 0x0764F2, 0x0764F3, 0x0764F6, 0x0764FF, 0x076503, 0x076506, 0x076507, 0x07650A,
+    0x07650E, 0x076511, 0x076514, 0x076520, 0x076523, 0x076530, 0x076533, 0x07653F, 0x076542, 0x07654F, 0x076557, 0x07655A,
+    0x07655C, 0x07655F, 0x07656B, 0x07656E, 0x07657B, 0x07657E, 0x07657F, 0x076582, 0x07658A, 0x076590, 0x076598, 0x07659B,
+    0x07659F, 0x0765AC, 0x0765AF, 0x0765B7, 0x0765BA, 0x0765BB, 0x0765BE, 0x0765C0, 0x0765C3, 0x0765CB, 0x0765CE, 0x0765CF,
+    0x0765D2, 0x0765D6, 0x0765DB, 0x0765DF, 0x0765E2, 0x0765E3, 0x0765E6, 0x0765EA, 0x0765EE, 0x0765F7, 0x0765FA, 0x0765FE,
+    0x076602, 0x076606, 0x07662B, 0x076633, 0x076636, 0x07663A, 0x076647, 0x07664A, 0x076652, 0x07665B, 0x07665E, 0x076666,
+    0x07666A, 0x076676, 0x07667A, 0x07667E, 0x076720, 0x076728, 0x07672B, 0x07672F, 0x07673F, 0x076747, 0x07674A, 0x07674E,
+    0x076750, 0x076753, 0x07675E, 0x07675F, 0x076762, 0x076766, 0x07676B, 0x07676F, 0x076772, 0x076773, 0x076776, 0x07677A,
+    0x07677E, 0x0767BB, 0x0767C3, 0x0767C6, 0x0767CA, 0x0767DA, 0x0767E2, 0x0767EB, 0x0767EE, 0x0767FA, 0x076818, 0x07681B,
+    0x076827, 0x07682A, 0x076837, 0x07683A, 0x076846, 0x076856, 0x07685E, 0x076863, 0x076866, 0x076872, 0x076897, 0x07689F,
+    0x0768A2, 0x0768A6, 0x0768B3, 0x0768B6, 0x0768BE, 0x0768C2, 0x0768C7, 0x0768CA, 0x0768D2, 0x0768D6, 0x0768E2, 0x0768E6,
+    0x0768EA, 0x0768F9, 0x0768FC, 0x076908, 0x07690B, 0x076918, 0x07691B, 0x076927, 0x07692A, 0x076937, 0x076944, 0x076947,
+    0x076953, 0x076956, 0x076963, 0x076966, 0x076972, 0x076994, 0x076997, 0x0769A3, 0x0769A6, 0x0769B3, 0x0769B6, 0x0769D2,
+    0x0769DF, 0x0769E2, 0x0769EE, 0x076A27, 0x076A2F, 0x076A32, 0x076A36, 0x076A46, 0x076A4E, 0x076A57, 0x076A5A, 0x076A66,
+    0x076A70, 0x076A73, 0x076A7F, 0x076A82, 0x076A8F, 0x076A92, 0x076A9E, 0x076AAE, 0x076ABB, 0x076ABE, 0x076AC2, 0x076ACA,
+    0x076ADA, 0x076B0B, 0x076B0E, 0x076B1A, 0x076B1F, 0x076B22, 0x076B2A, 0x076B2E, 0x076B3E, 0x076B56, 0x076B6C, 0x076B74,
+    0x076B77, 0x076B7B, 0x076B8B, 0x076B93, 0x076B96, 0x076B9A, 0x076B9C, 0x076B9F, 0x076BAA, 0x076BAB, 0x076BAE, 0x076BB2,
+    0x076BB7, 0x076BBB, 0x076BBE, 0x076BBF, 0x076BC2, 0x076BC6, 0x076BCA, 0x076BD6, 0x076BDA, 0x076BDE, 0x076C00, 0x076C03,
+    0x076C07, 0x076C0F, 0x076C12, 0x076C16, 0x076C1F, 0x076C22, 0x076C26, 0x076C2E, 0x076C37, 0x076C3A, 0x076C3E, 0x076C46,
+    0x076C4B, 0x076C4E, 0x076C52, 0x076C56, 0x076C5A, 0x076C64, 0x076C67, 0x076C73, 0x076C76, 0x076C83, 0x076C86, 0x076C92,
+    0x076C9B, 0x076C9E, 0x076CA2, 0x076CAA, 0x076CAF, 0x076CB2, 0x076CBA, 0x076CBE, 0x076CCE, 0x076CD2, 0x076CE3, 0x076CEB,
+    0x076CEE, 0x076CF2, 0x076CFF, 0x076D02, 0x076D0A, 0x076D0E, 0x076D13, 0x076D16, 0x076D1E, 0x076D22, 0x076D2E, 0x076D32,
+    0x076D36, 0x076D4A, 0x076D77, 0x076D7A, 0x076D7E, 0x076D86, 0x076D96, 0x076D9A, 0x076DAE, 0x076DC2, 0x076E73, 0x076E7B,
+    0x076E7E, 0x076E82, 0x076E92, 0x076E9A, 0x076EA3, 0x076EA6, 0x076EB2, 0x076EBE, 0x076EC2, 0x076EC6, 0x076F07, 0x076F0A,
+    0x076F0E, 0x076F16, 0x076F26, 0x076F3E, 0x076F6B, 0x076F6E, 0x076F7A, 0x076F8A, 0x076FA2, 0x076FB6, 0x076FEA, 0x076FF2,
+    0x077006, 0x07701A, 0x07733C, 0x077344, 0x077347, 0x07734B, 0x07735B, 0x077363, 0x077366, 0x07736A, 0x07736C, 0x07736F,
+    0x07737A, 0x07737B, 0x07737E, 0x077382, 0x077387, 0x07738B, 0x07738E, 0x07738F, 0x077392, 0x077396, 0x07739A, 0x0773A6,
+    0x0773AA, 0x0773AE, 0x0773D7, 0x0773DF, 0x0773E2, 0x0773E6, 0x0773F6, 0x0773FE, 0x077407, 0x07740A, 0x077416, 0x077422,
+    0x077426, 0x07742A, 0x077434, 0x077437, 0x077443, 0x077446, 0x077453, 0x077456, 0x077462, 0x077472, 0x07747A, 0x07747F,
+    0x077482, 0x07748E, 0x07749E, 0x0774A2, 0x0774B3, 0x0774BB, 0x0774BE, 0x0774C2, 0x0774CF, 0x0774D2, 0x0774DA, 0x0774DE,
+    0x0774E3, 0x0774E6, 0x0774EE, 0x0774F2, 0x0774FE, 0x077502, 0x077506, 0x07751A, 0x077643, 0x07764B, 0x07764E, 0x077652,
+    0x077662, 0x07766A, 0x077673, 0x077676, 0x077682, 0x07768E, 0x077692, 0x077696, 0x0776DE, 0x0776E6, 0x07770E, 0x07773B,
+    0x07773E, 0x07774A, 0x07775A, 0x077786, 0x07781C, 0x07781F, 0x07782B, 0x07782E, 0x07783B, 0x07783E, 0x07784A, 0x07785A,
+    0x077867, 0x07786A, 0x077876, 0x077886, 0x0778B7, 0x0778BA, 0x0778C6, 0x0778D6, 0x077902, 0x07794A, 0x077952, 0x07797A,
+    0x077993, 0x077996, 0x0779A2, 0x0779B2, 0x0779DE, 0x077A8F, 0x077A97, 0x077A9A, 0x077A9E, 0x077AAE, 0x077AB6, 0x077ABF,
+    0x077AC2, 0x077ACE, 0x077ADA, 0x077ADE, 0x077AE2, 0x077B23, 0x077B26, 0x077B2A, 0x077B32, 0x077B42, 0x077B5A, 0x077B6E,
+    0x077B87, 0x077B8A, 0x077B96, 0x077BA6, 0x077BBE, 0x077BD2, 0x077C06, 0x077C0E, 0x077C22, 0x077C36, 0x077C81, 0x077C84,
+    0x077C90, 0x077C93, 0x077CA0, 0x077CA3, 0x077CAF, 0x077CB2, 0x077CBF, 0x077CCC, 0x077CCF, 0x077CDB, 0x077CDE, 0x077CEB,
+    0x077CEE, 0x077CFA, 0x077D1C, 0x077D1F, 0x077D2B, 0x077D2E, 0x077D3B, 0x077D3E, 0x077D5A, 0x077D67, 0x077D6A, 0x077D76,
+    0x077DB7, 0x077DBA, 0x077DD6, 0x077DF8, 0x077DFB, 0x077E07, 0x077E0A, 0x077E17, 0x077E1A, 0x077E26, 0x077E36, 0x077E43,
+    0x077E46, 0x077E52, 0x077E62, 0x077E93, 0x077E96, 0x077EA2, 0x077EB2, 0x077EDE, 0x077F88, 0x077F8B, 0x077F97, 0x077F9A,
+    0x077FA7, 0x077FAA, 0x077FB6, 0x077FC6, 0x077FD3, 0x077FD6, 0x077FE2, 0x078023, 0x078026, 0x078032, 0x078042, 0x0780BE,
+    0x0780FF, 0x078102, 0x07810E, 0x07811E, 0x07814A, 0x07825F, 0x078267, 0x07826A, 0x07826E, 0x07827E, 0x078286, 0x07828F,
+    0x078292, 0x07829E, 0x0782AA, 0x0782AE, 0x0782B2, 0x0782FA, 0x078302, 0x07832A, 0x078357, 0x07835A, 0x078366, 0x078376,
+    0x0783A2, 0x0783D4, 0x0783D7, 0x0783E3, 0x0783E6, 0x0783F3, 0x0783F6, 0x078402, 0x078412, 0x07841F, 0x078422, 0x07842E,
+    0x07843E, 0x07846F, 0x078472, 0x07847E, 0x07848E, 0x0784BA, 0x07850A, 0x07854B, 0x07854E, 0x07855A, 0x078566, 0x07856A,
+    0x07856E, 0x078596, 0x0785E6, 0x0786DB, 0x0786DE, 0x0786EA, 0x0786FA, 0x078726, 0x07873F, 0x078742, 0x07874E, 0x07875E,
+    0x078776, 0x07878A, 0x0787DA, 0x078852, 0x0788B8, 0x0788C0, 0x0788C3, 0x0788C7, 0x0788D7, 0x0788DF, 0x0788E2, 0x0788E6,
+    0x0788E8, 0x0788EB, 0x0788F6, 0x0788F7, 0x0788FA, 0x0788FE, 0x078903, 0x078907, 0x07890A, 0x07890B, 0x07890E, 0x078912,
+    0x078916, 0x078922, 0x078926, 0x07892A, 0x078953, 0x07895B, 0x07895E, 0x078962, 0x078972, 0x07897A, 0x078983, 0x078986,
+    0x078992, 0x07899E, 0x0789A2, 0x0789A6, 0x0789B0, 0x0789B3, 0x0789BF, 0x0789C2, 0x0789CF, 0x0789D2, 0x0789DE, 0x0789EE,
+    0x0789F6, 0x0789FB, 0x0789FE, 0x078A0A, 0x078A1A, 0x078A1E, 0x078A2F, 0x078A37, 0x078A3A, 0x078A3E, 0x078A4B, 0x078A4E,
+    0x078A56, 0x078A5A, 0x078A5F, 0x078A62, 0x078A6A, 0x078A6E, 0x078A7A, 0x078A7E, 0x078A82, 0x078A96, 0x078ACA, 0x078AD2,
+    0x078AE6, 0x078AFA, 0x078BA4, 0x078BA7, 0x078BB3, 0x078BB6, 0x078BBF, 0x078BC3, 0x078BC6, 0x078BC7, 0x078BCA, 0x078BCE,
+    0x078BD2, 0x078BDE, 0x078BE2, 0x078BE6, 0x078BEF, 0x078BF2, 0x078BFE, 0x078C0A, 0x078C0E, 0x078C12, 0x078C3F, 0x078C42,
+    0x078C4E, 0x078C5A, 0x078C5E, 0x078C62, 0x078C8A, 0x078CB7, 0x078CBA, 0x078CC6, 0x078CD6, 0x078CDA, 0x078D02, 0x078D1B,
+    0x078D1E, 0x078D2A, 0x078D36, 0x078D3A, 0x078D3E, 0x078D52, 0x078D66, 0x078D98, 0x078D9B, 0x078DA7, 0x078DAA, 0x078DB7,
+    0x078DBA, 0x078DC6, 0x078DD6, 0x078DE3, 0x078DE6, 0x078DF2, 0x078E02, 0x078E33, 0x078E36, 0x078E42, 0x078E52, 0x078E7E,
+    0x078EAB, 0x078EAE, 0x078EBA, 0x078EC6, 0x078ECA, 0x078ECE, 0x078EF6, 0x078F0F, 0x078F12, 0x078F1E, 0x078F2E, 0x078F46,
+    0x078F5A, 0x078FAA, 0x078FBE, 0x07900B, 0x079013, 0x079016, 0x07901A, 0x07902A, 0x079032, 0x07903B, 0x07903E, 0x07904A,
+    0x079056, 0x07905A, 0x07905E, 0x07909F, 0x0790A2, 0x0790A6, 0x0790AE, 0x0790BE, 0x0790D6, 0x0790EA, 0x079103, 0x079106,
+    0x079112, 0x079122, 0x07913A, 0x07914E, 0x079182, 0x07918A, 0x07919E, 0x0791B2, 0x079216, 0x0792F7, 0x0792FA, 0x079306,
+    0x079312, 0x079316, 0x07931A, 0x079342, 0x079392, 0x0793A6, 0x07940A, 0x07946E, 0x0797DB, 0x0797E3, 0x0797E6, 0x0797EA,
+    0x0797FA, 0x079802, 0x07980B, 0x07980E, 0x07981A, 0x079826, 0x07982A, 0x07982E, 0x079876, 0x07987E, 0x0798A6, 0x0798D3,
+    0x0798D6, 0x0798E2, 0x0798F2, 0x07991E, 0x079952, 0x07995A, 0x07996E, 0x079982, 0x079AC7, 0x079ACA, 0x079AD6, 0x079AE2,
+    0x079AE6, 0x079AEA, 0x079B12, 0x079B62, 0x079BDA, 0x079CBB, 0x079CBE, 0x079CCA, 0x079CDA, 0x079D06, 0x079D56, 0x079DCE,
+    0x079E32, 0x079F2E, 0x079F36, 0x079F5E, 0x079FC2, 0x07A026, 0x07AFC8, 0x07AFD0, 0x07AFD3, 0x07AFD7, 0x07AFE7, 0x07AFEF,
+    0x07AFF2, 0x07AFF6, 0x07AFF8, 0x07AFFB, 0x07B006, 0x07B007, 0x07B00A, 0x07B00E, 0x07B013, 0x07B017, 0x07B01A, 0x07B01B,
+    0x07B01E, 0x07B022, 0x07B026, 0x07B032, 0x07B036, 0x07B03A, 0x07B063, 0x07B06B, 0x07B06E, 0x07B072, 0x07B082, 0x07B08A,
+    0x07B093, 0x07B096, 0x07B0A2, 0x07B0AE, 0x07B0B2, 0x07B0B6, 0x07B0C0, 0x07B0C3, 0x07B0CF, 0x07B0D2, 0x07B0DF, 0x07B0E2,
+    0x07B0EE, 0x07B0FE, 0x07B106, 0x07B10B, 0x07B10E, 0x07B11A, 0x07B12A, 0x07B12E, 0x07B13F, 0x07B147, 0x07B14A, 0x07B14E,
+    0x07B15B, 0x07B15E, 0x07B166, 0x07B16A, 0x07B16F, 0x07B172, 0x07B17A, 0x07B17E, 0x07B18A, 0x07B18E, 0x07B192, 0x07B1A6,
+    0x07B1DA, 0x07B1E2, 0x07B1F6, 0x07B20A, 0x07B2CF, 0x07B2D7, 0x07B2DA, 0x07B2DE, 0x07B2EE, 0x07B2F6, 0x07B2FF, 0x07B302,
+    0x07B30E, 0x07B31A, 0x07B31E, 0x07B322, 0x07B36A, 0x07B372, 0x07B39A, 0x07B3C7, 0x07B3CA, 0x07B3D6, 0x07B3E6, 0x07B412,
+    0x07B446, 0x07B44E, 0x07B462, 0x07B476, 0x07B4A8, 0x07B4AB, 0x07B4B7, 0x07B4BA, 0x07B4C7, 0x07B4CA, 0x07B4D6, 0x07B4E6,
+    0x07B4F3, 0x07B4F6, 0x07B502, 0x07B512, 0x07B543, 0x07B546, 0x07B552, 0x07B562, 0x07B58E, 0x07B5D6, 0x07B5DE, 0x07B606,
+    0x07B61F, 0x07B622, 0x07B62E, 0x07B63E, 0x07B66A, 0x07B6BA, 0x07B6CE, 0x07B71B, 0x07B723, 0x07B726, 0x07B72A, 0x07B73A,
+    0x07B742, 0x07B74B, 0x07B74E, 0x07B75A, 0x07B766, 0x07B76A, 0x07B76E, 0x07B7AF, 0x07B7B2, 0x07B7B6, 0x07B7BE, 0x07B7CE,
+    0x07B7E6, 0x07B7FA, 0x07B813, 0x07B816, 0x07B822, 0x07B832, 0x07B84A, 0x07B85E, 0x07B892, 0x07B89A, 0x07B8AE, 0x07B8C2,
+    0x07B926, 0x07BEEB, 0x07BEF3, 0x07BEF6, 0x07BEFA, 0x07BF0A, 0x07BF12, 0x07BF1B, 0x07BF1E, 0x07BF2A, 0x07BF36, 0x07BF3A,
+    0x07BF3E, 0x07BF86, 0x07BF8E, 0x07BFB6, 0x07BFE3, 0x07BFE6, 0x07BFF2, 0x07C002, 0x07C02E, 0x07C062, 0x07C06A, 0x07C07E,
+    0x07C092, 0x07C1F2, 0x07C1FA, 0x07C222, 0x07C2EA, 0x07C3CB, 0x07C3CE, 0x07C3DA, 0x07C3EA, 0x07C416, 0x07C466, 0x07C542,
+    0x07C830, 0x07C833, 0x07C83F, 0x07C842, 0x07C84F, 0x07C852, 0x07C85E, 0x07C86E, 0x07C87B, 0x07C87E, 0x07C88A, 0x07C89A,
+    0x07C8CB, 0x07C8CE, 0x07C8DA, 0x07C8EA, 0x07C916, 0x07C966, 0x07C9A7, 0x07C9AA, 0x07C9B6, 0x07C9C6, 0x07C9F2, 0x07CA42,
+    0x07CB37, 0x07CB3A, 0x07CB46, 0x07CB56, 0x07CB82, 0x07CBD2, 0x07CCAE, 0x07CE0E, 0x07CE16, 0x07CE3E, 0x07CF06, 0x07CF83,
+    0x07CF86, 0x07CF92, 0x07CFA2, 0x07CFCE, 0x07D01E, 0x07D0FA, 0x07D467, 0x07D46F, 0x07D472, 0x07D476, 0x07D486, 0x07D48E,
+    0x07D497, 0x07D49A, 0x07D4A6, 0x07D4B2, 0x07D4B6, 0x07D4BA, 0x07D502, 0x07D50A, 0x07D532, 0x07D55F, 0x07D562, 0x07D56E,
+    0x07D57E, 0x07D5AA, 0x07D5DE, 0x07D5E6, 0x07D5FA, 0x07D60E, 0x07D753, 0x07D756, 0x07D762, 0x07D76E, 0x07D772, 0x07D776,
+    0x07D79E, 0x07D7EE, 0x07D866, 0x07D8CA, 0x07D947, 0x07D94A, 0x07D956, 0x07D966, 0x07D992, 0x07D9E2, 0x07DA5A, 0x07DABE,
+    0x07DBBA, 0x07DBC2, 0x07DBEA, 0x07DC4E, 0x07DCB2, 0x07DE29, 0x07DE2C, 0x07DE38, 0x07DE3B, 0x07DE48, 0x07DE4B, 0x07DE57,
+    0x07DE5A, 0x07DE67, 0x07DE74, 0x07DE77, 0x07DE83, 0x07DE86, 0x07DE93, 0x07DE96, 0x07DEA2, 0x07DEC4, 0x07DEC7, 0x07DED3,
+    0x07DED6, 0x07DEE3, 0x07DEE6, 0x07DF02, 0x07DF0F, 0x07DF12, 0x07DF1E, 0x07DF5F, 0x07DF62, 0x07DF7E, 0x07DFA0, 0x07DFA3,
+    0x07DFAF, 0x07DFB2, 0x07DFBF, 0x07DFC2, 0x07DFCE, 0x07DFDE, 0x07DFEB, 0x07DFEE, 0x07DFFA, 0x07E00A, 0x07E03B, 0x07E03E,
+    0x07E04A, 0x07E05A, 0x07E086, 0x07E130, 0x07E133, 0x07E13F, 0x07E142, 0x07E14F, 0x07E152, 0x07E15E, 0x07E16E, 0x07E17B,
+    0x07E17E, 0x07E18A, 0x07E1CB, 0x07E1CE, 0x07E1DA, 0x07E1EA, 0x07E266, 0x07E2A7, 0x07E2AA, 0x07E2B6, 0x07E2C6, 0x07E2F2,
+    0x07E437, 0x07E43A, 0x07E446, 0x07E456, 0x07E4D2, 0x07E57C, 0x07E57F, 0x07E58B, 0x07E58E, 0x07E59B, 0x07E59E, 0x07E5AA,
+    0x07E5BA, 0x07E5C7, 0x07E5CA, 0x07E5D6, 0x07E5E6, 0x07E617, 0x07E61A, 0x07E626, 0x07E636, 0x07E662, 0x07E6B2, 0x07E6F3,
+    0x07E6F6, 0x07E702, 0x07E712, 0x07E73E, 0x07E78E, 0x07E883, 0x07E886, 0x07E892, 0x07E8A2, 0x07E8CE, 0x07E91E, 0x07E9FA,
+    0x07ED4C, 0x07ED4F, 0x07ED5B, 0x07ED5E, 0x07ED6B, 0x07ED6E, 0x07ED7A, 0x07ED8A, 0x07ED97, 0x07ED9A, 0x07EDA6, 0x07EDB6,
+    0x07EDE7, 0x07EDEA, 0x07EDF6, 0x07EE06, 0x07EE32, 0x07EE82, 0x07EEC3, 0x07EEC6, 0x07EED2, 0x07EEE2, 0x07EF0E, 0x07F053,
+    0x07F056, 0x07F062, 0x07F072, 0x07F09E, 0x07F0EE, 0x07F35A, 0x07F49F, 0x07F4A2, 0x07F4AE, 0x07F4BE, 0x07F4EA, 0x07F53A,
+    0x07F616, 0x07FB77, 0x07FB7F, 0x07FB82, 0x07FB86, 0x07FB96, 0x07FB9E, 0x07FBA7, 0x07FBAA, 0x07FBB6, 0x07FBC2, 0x07FBC6,
+    0x07FBCA, 0x07FC12, 0x07FC1A, 0x07FC42, 0x07FC6F, 0x07FC72, 0x07FC7E, 0x07FC8E, 0x07FCBA, 0x07FCEE, 0x07FCF6, 0x07FD0A,
+    0x07FD1E, 0x07FE7E, 0x07FE86, 0x07FEAE, 0x07FF76, 0x080057, 0x08005A, 0x080066, 0x080076, 0x0800A2, 0x0800F2, 0x0801CE,
+    0x0802C8, 0x0802CB, 0x0802D7, 0x0802DA, 0x0802E7, 0x0802EA, 0x0802F6, 0x080306, 0x080313, 0x080316, 0x080322, 0x080332,
+    0x080363, 0x080366, 0x080372, 0x080382, 0x0803AE, 0x0803FE, 0x08043F, 0x080442, 0x08044E, 0x08045E, 0x08048A, 0x0804DA,
+    0x0805CF, 0x0805D2, 0x0805DE, 0x0805EE, 0x08061A, 0x08066A, 0x080746, 0x0808D6, 0x080A1B, 0x080A1E, 0x080A2A, 0x080A3A,
+    0x080A66, 0x080A9A, 0x080AA2, 0x080AB6, 0x080ACA, 0x080B92, 0x080D22, 0x0811EB, 0x0811EE, 0x0811FA, 0x08120A, 0x081236,
+    0x081286, 0x081362, 0x0813DF, 0x0813E2, 0x0813EE, 0x0813FE, 0x08142A, 0x08147A, 0x0814F2, 0x081556, 0x0816E6, 0x08193E,
+    0x081B34, 0x081B3C, 0x081B3F, 0x081B43, 0x081B53, 0x081B5B, 0x081B5E, 0x081B62, 0x081B64, 0x081B67, 0x081B72, 0x081B73,
+    0x081B76, 0x081B7A, 0x081B7F, 0x081B83, 0x081B86, 0x081B87, 0x081B8A, 0x081B8E, 0x081B92, 0x081B9E, 0x081BA2, 0x081BA6,
+    0x081BCF, 0x081BD7, 0x081BDA, 0x081BDE, 0x081BEE, 0x081BF6, 0x081BFF, 0x081C02, 0x081C0E, 0x081C1A, 0x081C1E, 0x081C22,
+    0x081C2C, 0x081C2F, 0x081C3B, 0x081C3E, 0x081C4B, 0x081C4E, 0x081C5A, 0x081C6A, 0x081C72, 0x081C77, 0x081C7A, 0x081C86,
+    0x081C96, 0x081C9A, 0x081CAB, 0x081CB3, 0x081CB6, 0x081CBA, 0x081CC7, 0x081CCA, 0x081CD2, 0x081CD6, 0x081CDB, 0x081CDE,
+    0x081CE6, 0x081CEA, 0x081CF6, 0x081CFA, 0x081CFE, 0x081D12, 0x081D46, 0x081D4E, 0x081D62, 0x081D76, 0x081E3B, 0x081E43,
+    0x081E46, 0x081E4A, 0x081E5A, 0x081E62, 0x081E6B, 0x081E6E, 0x081E7A, 0x081E86, 0x081E8A, 0x081E8E, 0x081ED6, 0x081EDE,
+    0x081F06, 0x081F33, 0x081F36, 0x081F42, 0x081F52, 0x081F7E, 0x081FB2, 0x081FBA, 0x081FCE, 0x081FE2, 0x082014, 0x082017,
+    0x082023, 0x082026, 0x082033, 0x082036, 0x082042, 0x082052, 0x08205F, 0x082062, 0x08206E, 0x08207E, 0x0820AF, 0x0820B2,
+    0x0820BE, 0x0820CE, 0x0820FA, 0x082142, 0x08214A, 0x082172, 0x08218B, 0x08218E, 0x08219A, 0x0821AA, 0x0821D6, 0x082226,
+    0x08223A, 0x082287, 0x08228F, 0x082292, 0x082296, 0x0822A6, 0x0822AE, 0x0822B7, 0x0822BA, 0x0822C6, 0x0822D2, 0x0822D6,
+    0x0822DA, 0x08231B, 0x08231E, 0x082322, 0x08232A, 0x08233A, 0x082352, 0x082366, 0x08237F, 0x082382, 0x08238E, 0x08239E,
+    0x0823B6, 0x0823CA, 0x0823FE, 0x082406, 0x08241A, 0x08242E, 0x082492, 0x08258E, 0x082596, 0x0825BE, 0x082622, 0x082686,
+    0x0829D8, 0x0829DB, 0x0829E7, 0x0829EA, 0x0829F7, 0x0829FA, 0x082A06, 0x082A16, 0x082A23, 0x082A26, 0x082A32, 0x082A42,
+    0x082A57, 0x082A5F, 0x082A62, 0x082A66, 0x082A73, 0x082A76, 0x082A7E, 0x082A82, 0x082A87, 0x082A8A, 0x082A92, 0x082A96,
+    0x082AA2, 0x082AA6, 0x082AAA, 0x082ABE, 0x082AF2, 0x082AFA, 0x082B0E, 0x082B22, 0x082B4F, 0x082B52, 0x082B5E, 0x082B6E,
+    0x082B9A, 0x082BCE, 0x082BD6, 0x082BEA, 0x082BFE, 0x082CDF, 0x082CE2, 0x082CEE, 0x082CFE, 0x082D2A, 0x082D5E, 0x082D66,
+    0x082D7A, 0x082D8E, 0x082E56, 0x082F37, 0x082F3A, 0x082F46, 0x082F56, 0x082F82, 0x082FD2, 0x082FE6, 0x0830AE, 0x08312B,
+    0x08312E, 0x08313A, 0x08314A, 0x083176, 0x0831AA, 0x0831B2, 0x0831C6, 0x0831DA, 0x08323E, 0x0832A2, 0x08339C, 0x08339F,
+    0x0833AB, 0x0833AE, 0x0833BB, 0x0833BE, 0x0833CA, 0x0833DA, 0x0833E7, 0x0833EA, 0x0833F6, 0x083406, 0x083437, 0x08343A,
+    0x083446, 0x083456, 0x083482, 0x0834D2, 0x083513, 0x083516, 0x083522, 0x083532, 0x08355E, 0x0835AE, 0x0836A3, 0x0836A6,
+    0x0836B2, 0x0836C2, 0x0836EE, 0x08373E, 0x08381A, 0x0838FB, 0x0838FE, 0x08390A, 0x08391A, 0x083946, 0x08397A, 0x083982,
+    0x083996, 0x0839AA, 0x083A72, 0x083AEF, 0x083AF2, 0x083AFE, 0x083B0E, 0x083B3A, 0x083B8A, 0x083C02, 0x083C66, 0x083DF6,
+    0x083E5A, 0x083FD3, 0x083FDB, 0x083FDE, 0x083FE2, 0x083FF2, 0x083FFA, 0x084003, 0x084006, 0x084012, 0x08401E, 0x084022,
+    0x084026, 0x08406E, 0x084076, 0x08409E, 0x0840CB, 0x0840CE, 0x0840DA, 0x0840EA, 0x084116, 0x08414A, 0x084152, 0x084166,
+    0x08417A, 0x0842BF, 0x0842C2, 0x0842CE, 0x0842DA, 0x0842DE, 0x0842E2, 0x08430A, 0x08435A, 0x0843D2, 0x084436, 0x0844B3,
+    0x0844B6, 0x0844C2, 0x0844D2, 0x0844FE, 0x08454E, 0x0845C6, 0x08462A, 0x084726, 0x08472E, 0x084756, 0x0847BA, 0x08481E,
+    0x084A12, 0x084E77, 0x084E7A, 0x084E86, 0x084E96, 0x084EC2, 0x084EF6, 0x084EFE, 0x084F12, 0x084F26, 0x084FEE, 0x08517E,
+    0x0851E2, 0x0853D6, 0x0855CA, 0x08DE84, 0x08DE8C, 0x08DE8F, 0x08DE93, 0x08DEA3, 0x08DEAB, 0x08DEAE, 0x08DEB2, 0x08DEB4,
+    0x08DEB7, 0x08DEC2, 0x08DEC3, 0x08DEC6, 0x08DECA, 0x08DECF, 0x08DED3, 0x08DED6, 0x08DED7, 0x08DEDA, 0x08DEDE, 0x08DEE2,
+    0x08DEEE, 0x08DEF2, 0x08DEF6, 0x08DF1F, 0x08DF27, 0x08DF2A, 0x08DF2E, 0x08DF3E, 0x08DF46, 0x08DF4F, 0x08DF52, 0x08DF5E,
+    0x08DF6A, 0x08DF6E, 0x08DF72, 0x08DF7C, 0x08DF7F, 0x08DF8B, 0x08DF8E, 0x08DF9B, 0x08DF9E, 0x08DFAA, 0x08DFBA, 0x08DFC2,
+    0x08DFC7, 0x08DFCA, 0x08DFD6, 0x08DFE6, 0x08DFEA, 0x08DFFB, 0x08E003, 0x08E006, 0x08E00A, 0x08E017, 0x08E01A, 0x08E022,
+    0x08E026, 0x08E02B, 0x08E02E, 0x08E036, 0x08E03A, 0x08E046, 0x08E04A, 0x08E04E, 0x08E062, 0x08E096, 0x08E09E, 0x08E0B2,
+    0x08E0C6, 0x08E18B, 0x08E193, 0x08E196, 0x08E19A, 0x08E1AA, 0x08E1B2, 0x08E1BB, 0x08E1BE, 0x08E1CA, 0x08E1D6, 0x08E1DA,
+    0x08E1DE, 0x08E226, 0x08E22E, 0x08E256, 0x08E283, 0x08E286, 0x08E292, 0x08E2A2, 0x08E2CE, 0x08E302, 0x08E30A, 0x08E31E,
+    0x08E332, 0x08E364, 0x08E367, 0x08E373, 0x08E376, 0x08E383, 0x08E386, 0x08E392, 0x08E3A2, 0x08E3AF, 0x08E3B2, 0x08E3BE,
+    0x08E3CE, 0x08E3FF, 0x08E402, 0x08E40E, 0x08E41E, 0x08E44A, 0x08E492, 0x08E49A, 0x08E4C2, 0x08E4DB, 0x08E4DE, 0x08E4EA,
+    0x08E4FA, 0x08E526, 0x08E576, 0x08E58A, 0x08E5D7, 0x08E5DF, 0x08E5E2, 0x08E5E6, 0x08E5F6, 0x08E5FE, 0x08E607, 0x08E60A,
+    0x08E616, 0x08E622, 0x08E626, 0x08E62A, 0x08E66B, 0x08E66E, 0x08E672, 0x08E67A, 0x08E68A, 0x08E6A2, 0x08E6B6, 0x08E6CF,
+    0x08E6D2, 0x08E6DE, 0x08E6EE, 0x08E706, 0x08E71A, 0x08E74E, 0x08E756, 0x08E76A, 0x08E77E, 0x08E7E2, 0x08E8DE, 0x08E8E6,
+    0x08E90E, 0x08E972, 0x08E9D6, 0x08EDA7, 0x08EDAF, 0x08EDB2, 0x08EDB6, 0x08EDC6, 0x08EDCE, 0x08EDD7, 0x08EDDA, 0x08EDE6,
+    0x08EDF2, 0x08EDF6, 0x08EDFA, 0x08EE42, 0x08EE4A, 0x08EE72, 0x08EE9F, 0x08EEA2, 0x08EEAE, 0x08EEBE, 0x08EEEA, 0x08EF1E,
+    0x08EF26, 0x08EF3A, 0x08EF4E, 0x08F0AE, 0x08F0B6, 0x08F0DE, 0x08F1A6, 0x08F287, 0x08F28A, 0x08F296, 0x08F2A6, 0x08F2D2,
+    0x08F322, 0x08F3FE, 0x08F4FA, 0x08F502, 0x08F52A, 0x08F58E, 0x08F5F2, 0x08F6EC, 0x08F6EF, 0x08F6FB, 0x08F6FE, 0x08F70B,
+    0x08F70E, 0x08F71A, 0x08F72A, 0x08F737, 0x08F73A, 0x08F746, 0x08F756, 0x08F787, 0x08F78A, 0x08F796, 0x08F7A6, 0x08F7D2,
+    0x08F822, 0x08F863, 0x08F866, 0x08F872, 0x08F882, 0x08F8AE, 0x08F8FE, 0x08F9F3, 0x08F9F6, 0x08FA02, 0x08FA12, 0x08FA3E,
+    0x08FA8E, 0x08FB6A, 0x08FCCA, 0x08FCD2, 0x08FCFA, 0x08FDC2, 0x08FE3F, 0x08FE42, 0x08FE4E, 0x08FE5E, 0x08FE8A, 0x08FEDA,
+    0x08FFB6, 0x090146, 0x0901AA, 0x090323, 0x09032B, 0x09032E, 0x090332, 0x090342, 0x09034A, 0x090353, 0x090356, 0x090362,
+    0x09036E, 0x090372, 0x090376, 0x0903BE, 0x0903C6, 0x0903EE, 0x09041B, 0x09041E, 0x09042A, 0x09043A, 0x090466, 0x09049A,
+    0x0904A2, 0x0904B6, 0x0904CA, 0x09060F, 0x090612, 0x09061E, 0x09062A, 0x09062E, 0x090632, 0x09065A, 0x0906AA, 0x090722,
+    0x090786, 0x090803, 0x090806, 0x090812, 0x090822, 0x09084E, 0x09089E, 0x090916, 0x09097A, 0x090A76, 0x090A7E, 0x090AA6,
+    0x090B0A, 0x090B6E, 0x090D62, 0x092A33, 0x092A3B, 0x092A3E, 0x092A42, 0x092A52, 0x092A5A, 0x092A63, 0x092A66, 0x092A72,
+    0x092A7E, 0x092A82, 0x092A86, 0x092ACE, 0x092AD6, 0x092AFE, 0x092B2B, 0x092B2E, 0x092B3A, 0x092B4A, 0x092B76, 0x092BAA,
+    0x092BB2, 0x092BC6, 0x092BDA, 0x092D3A, 0x092D42, 0x092D6A, 0x092E32, 0x092F13, 0x092F16, 0x092F22, 0x092F32, 0x092F5E,
+    0x092FAE, 0x09308A, 0x093186, 0x09318E, 0x0931B6, 0x09321A, 0x09327E, 0x093956, 0x09395E, 0x093986, 0x093A4E, 0x093E36,
+    0x09429B, 0x09429E, 0x0942AA, 0x0942BA, 0x0942E6, 0x094336, 0x094412, 0x0945A2, 0x0949EE, 0x095894, 0x095897, 0x0958A3,
+    0x0958A6, 0x0958B3, 0x0958B6, 0x0958C2, 0x0958D2, 0x0958DF, 0x0958E2, 0x0958EE, 0x0958FE, 0x09592F, 0x095932, 0x09593E,
+    0x09594E, 0x09597A, 0x0959CA, 0x095A0B, 0x095A0E, 0x095A1A, 0x095A2A, 0x095A56, 0x095AA6, 0x095B9B, 0x095B9E, 0x095BAA,
+    0x095BBA, 0x095BE6, 0x095C36, 0x095D12, 0x095EA2, 0x095FE7, 0x095FEA, 0x095FF6, 0x096006, 0x096032, 0x096082, 0x09615E,
+    0x0962EE, 0x0967B7, 0x0967BA, 0x0967C6, 0x0967D6, 0x096802, 0x096852, 0x09692E, 0x096ABE, 0x096F0A, 0x0975E2, 0x0975EA,
+    0x097612, 0x0976DA, 0x097AC2, 0x097D33, 0x097D36, 0x097D42, 0x097D52, 0x097D7E, 0x097DCE, 0x097EAA, 0x09803A, 0x098486,
+    0x09C671, 0x09C674, 0x09C680, 0x09C683, 0x09C690, 0x09C693, 0x09C69F, 0x09C6A2, 0x09C6AF, 0x09C6BC, 0x09C6BF, 0x09C6CB,
+    0x09C6CE, 0x09C6DB, 0x09C6DE, 0x09C6EA, 0x09C70C, 0x09C70F, 0x09C71B, 0x09C71E, 0x09C72B, 0x09C72E, 0x09C74A, 0x09C757,
+    0x09C75A, 0x09C766, 0x09C7A7, 0x09C7AA, 0x09C7C6, 0x09C7E8, 0x09C7EB, 0x09C7F7, 0x09C7FA, 0x09C807, 0x09C80A, 0x09C816,
+    0x09C826, 0x09C833, 0x09C836, 0x09C842, 0x09C852, 0x09C883, 0x09C886, 0x09C892, 0x09C8A2, 0x09C8CE, 0x09C978, 0x09C97B,
+    0x09C987, 0x09C98A, 0x09C997, 0x09C99A, 0x09C9A6, 0x09C9B6, 0x09C9C3, 0x09C9C6, 0x09C9D2, 0x09CA13, 0x09CA16, 0x09CA22,
+    0x09CA32, 0x09CAAE, 0x09CAEF, 0x09CAF2, 0x09CAFE, 0x09CB0E, 0x09CB3A, 0x09CC7F, 0x09CC82, 0x09CC8E, 0x09CC9E, 0x09CD1A,
+    0x09CDC4, 0x09CDC7, 0x09CDD3, 0x09CDD6, 0x09CDE3, 0x09CDE6, 0x09CDF2, 0x09CE02, 0x09CE0F, 0x09CE12, 0x09CE1E, 0x09CE2E,
+    0x09CE5F, 0x09CE62, 0x09CE6E, 0x09CE7E, 0x09CEAA, 0x09CEFA, 0x09CF3B, 0x09CF3E, 0x09CF4A, 0x09CF5A, 0x09CF86, 0x09CFD6,
+    0x09D0CB, 0x09D0CE, 0x09D0DA, 0x09D0EA, 0x09D116, 0x09D166, 0x09D242, 0x09D594, 0x09D597, 0x09D5A3, 0x09D5A6, 0x09D5B3,
+    0x09D5B6, 0x09D5C2, 0x09D5D2, 0x09D5DF, 0x09D5E2, 0x09D5EE, 0x09D5FE, 0x09D62F, 0x09D632, 0x09D63E, 0x09D64E, 0x09D67A,
+    0x09D6CA, 0x09D70B, 0x09D70E, 0x09D71A, 0x09D72A, 0x09D756, 0x09D89B, 0x09D89E, 0x09D8AA, 0x09D8BA, 0x09D8E6, 0x09D936,
+    0x09DBA2, 0x09DCE7, 0x09DCEA, 0x09DCF6, 0x09DD06, 0x09DD32, 0x09DD82, 0x09DE5E, 0x09E4B7, 0x09E4BA, 0x09E4C6, 0x09E4D6,
+    0x09E502, 0x09E552, 0x09E7BE, 0x09EB10, 0x09EB13, 0x09EB1F, 0x09EB22, 0x09EB2F, 0x09EB32, 0x09EB3E, 0x09EB4E, 0x09EB5B,
+    0x09EB5E, 0x09EB6A, 0x09EB7A, 0x09EBAB, 0x09EBAE, 0x09EBBA, 0x09EBCA, 0x09EBF6, 0x09EC46, 0x09EC87, 0x09EC8A, 0x09EC96,
+    0x09ECA6, 0x09ECD2, 0x09ED22, 0x09EE17, 0x09EE1A, 0x09EE26, 0x09EE36, 0x09EE62, 0x09EEB2, 0x09EF8E, 0x09F11E, 0x09F263,
+    0x09F266, 0x09F272, 0x09F282, 0x09F2AE, 0x09F2FE, 0x09F3DA, 0x09F56A, 0x09FA33, 0x09FA36, 0x09FA42, 0x09FA52, 0x09FA7E,
+    0x09FACE, 0x09FBAA, 0x09FD3A, 0x0A0186, 0x0A1220, 0x0A1223, 0x0A122F, 0x0A1232, 0x0A123F, 0x0A1242, 0x0A124E, 0x0A125E,
+    0x0A126B, 0x0A126E, 0x0A127A, 0x0A128A, 0x0A12BB, 0x0A12BE, 0x0A12CA, 0x0A12DA, 0x0A1306, 0x0A1356, 0x0A1397, 0x0A139A,
+    0x0A13A6, 0x0A13B6, 0x0A13E2, 0x0A1432, 0x0A1527, 0x0A152A, 0x0A1536, 0x0A1546, 0x0A1572, 0x0A15C2, 0x0A169E, 0x0A182E,
+    0x0A1973, 0x0A1976, 0x0A1982, 0x0A1992, 0x0A19BE, 0x0A1A0E, 0x0A1AEA, 0x0A2143, 0x0A2146, 0x0A2152, 0x0A2162, 0x0A218E,
+    0x0A21DE, 0x0A22BA, 0x0A244A, 0x0A3066, 0x0A36BF, 0x0A36C2, 0x0A36CE, 0x0A36DE, 0x0A370A, 0x0A375A, 0x0A3836, 0x0A39C6,
+    0x0A3E12, 0x0A58EF, 0x0A58F7, 0x0A58FA, 0x0A58FE, 0x0A590E, 0x0A5916, 0x0A591F, 0x0A5922, 0x0A592E, 0x0A593A, 0x0A593E,
+    0x0A5942, 0x0A598A, 0x0A5992, 0x0A59BA, 0x0A59E7, 0x0A59EA, 0x0A59F6, 0x0A5A06, 0x0A5A32, 0x0A5A66, 0x0A5A6E, 0x0A5A82,
+    0x0A5A96, 0x0A5BF6, 0x0A5BFE, 0x0A5C26, 0x0A5CEE, 0x0A5DCF, 0x0A5DD2, 0x0A5DDE, 0x0A5DEE, 0x0A5E1A, 0x0A5E6A, 0x0A5F46,
+    0x0A6042, 0x0A604A, 0x0A6072, 0x0A60D6, 0x0A613A, 0x0A6812, 0x0A681A, 0x0A6842, 0x0A690A, 0x0A6CF2, 0x0A7157, 0x0A715A,
+    0x0A7166, 0x0A7176, 0x0A71A2, 0x0A71F2, 0x0A72CE, 0x0A745E, 0x0A78AA, 0x0A7D8C, 0x0A7D8F, 0x0A7D9B, 0x0A7D9E, 0x0A7DAB,
+    0x0A7DAE, 0x0A7DBA, 0x0A7DCA, 0x0A7DD7, 0x0A7DDA, 0x0A7DE6, 0x0A7DF6, 0x0A7E27, 0x0A7E2A, 0x0A7E36, 0x0A7E46, 0x0A7E72,
+    0x0A7EC2, 0x0A7F03, 0x0A7F06, 0x0A7F12, 0x0A7F22, 0x0A7F4E, 0x0A7F9E, 0x0A8093, 0x0A8096, 0x0A80A2, 0x0A80B2, 0x0A80DE,
+    0x0A812E, 0x0A820A, 0x0A839A, 0x0A84DF, 0x0A84E2, 0x0A84EE, 0x0A84FE, 0x0A852A, 0x0A857A, 0x0A8656, 0x0A87E6, 0x0A8CAF,
+    0x0A8CB2, 0x0A8CBE, 0x0A8CCE, 0x0A8CFA, 0x0A8D4A, 0x0A8E26, 0x0A8FB6, 0x0A9402, 0x0A9BD2, 0x0AA22B, 0x0AA22E, 0x0AA23A,
+    0x0AA24A, 0x0AA276, 0x0AA2C6, 0x0AA3A2, 0x0AA49E, 0x0AA4A6, 0x0AA4CE, 0x0AA532, 0x0AA596, 0x0AA97E, 0x0AB14E, 0x0AF7A0,
+    0x0AF7A8, 0x0AF7AB, 0x0AF7AF, 0x0AF7BF, 0x0AF7C7, 0x0AF7CA, 0x0AF7CE, 0x0AF7D0, 0x0AF7D3, 0x0AF7DE, 0x0AF7DF, 0x0AF7E2,
+    0x0AF7E6, 0x0AF7EB, 0x0AF7EF, 0x0AF7F2, 0x0AF7F3, 0x0AF7F6, 0x0AF7FA, 0x0AF7FE, 0x0AF80A, 0x0AF80E, 0x0AF812, 0x0AF83B,
+    0x0AF843, 0x0AF846, 0x0AF84A, 0x0AF85A, 0x0AF862, 0x0AF86B, 0x0AF86E, 0x0AF87A, 0x0AF886, 0x0AF88A, 0x0AF88E, 0x0AF898,
+    0x0AF89B, 0x0AF8A7, 0x0AF8AA, 0x0AF8B7, 0x0AF8BA, 0x0AF8C6, 0x0AF8D6, 0x0AF8DE, 0x0AF8E3, 0x0AF8E6, 0x0AF8F2, 0x0AF902,
+    0x0AF906, 0x0AF917, 0x0AF91F, 0x0AF922, 0x0AF926, 0x0AF933, 0x0AF936, 0x0AF93E, 0x0AF942, 0x0AF947, 0x0AF94A, 0x0AF952,
+    0x0AF956, 0x0AF962, 0x0AF966, 0x0AF96A, 0x0AF97E, 0x0AF9B2, 0x0AF9BA, 0x0AF9CE, 0x0AF9E2, 0x0AFAA7, 0x0AFAAF, 0x0AFAB2,
+    0x0AFAB6, 0x0AFAC6, 0x0AFACE, 0x0AFAD7, 0x0AFADA, 0x0AFAE6, 0x0AFAF2, 0x0AFAF6, 0x0AFAFA, 0x0AFB42, 0x0AFB4A, 0x0AFB72,
+    0x0AFB9F, 0x0AFBA2, 0x0AFBAE, 0x0AFBBE, 0x0AFBEA, 0x0AFC1E, 0x0AFC26, 0x0AFC3A, 0x0AFC4E, 0x0AFC80, 0x0AFC83, 0x0AFC8F,
+    0x0AFC92, 0x0AFC9F, 0x0AFCA2, 0x0AFCAE, 0x0AFCBE, 0x0AFCCB, 0x0AFCCE, 0x0AFCDA, 0x0AFCEA, 0x0AFD1B, 0x0AFD1E, 0x0AFD2A,
+    0x0AFD3A, 0x0AFD66, 0x0AFDAE, 0x0AFDB6, 0x0AFDDE, 0x0AFDF7, 0x0AFDFA, 0x0AFE06, 0x0AFE16, 0x0AFE42, 0x0AFE92, 0x0AFEA6,
+    0x0AFEF3, 0x0AFEFB, 0x0AFEFE, 0x0AFF02, 0x0AFF12, 0x0AFF1A, 0x0AFF23, 0x0AFF26, 0x0AFF32, 0x0AFF3E, 0x0AFF42, 0x0AFF46,
+    0x0AFF87, 0x0AFF8A, 0x0AFF8E, 0x0AFF96, 0x0AFFA6, 0x0AFFBE, 0x0AFFD2, 0x0AFFEB, 0x0AFFEE, 0x0AFFFA, 0x0B000A, 0x0B0022,
+    0x0B0036, 0x0B006A, 0x0B0072, 0x0B0086, 0x0B009A, 0x0B00FE, 0x0B01FA, 0x0B0202, 0x0B022A, 0x0B028E, 0x0B02F2, 0x0B06C3,
+    0x0B06CB, 0x0B06CE, 0x0B06D2, 0x0B06E2, 0x0B06EA, 0x0B06F3, 0x0B06F6, 0x0B0702, 0x0B070E, 0x0B0712, 0x0B0716, 0x0B075E,
+    0x0B0766, 0x0B078E, 0x0B07BB, 0x0B07BE, 0x0B07CA, 0x0B07DA, 0x0B0806, 0x0B083A, 0x0B0842, 0x0B0856, 0x0B086A, 0x0B09CA,
+    0x0B09D2, 0x0B09FA, 0x0B0AC2, 0x0B0BA3, 0x0B0BA6, 0x0B0BB2, 0x0B0BC2, 0x0B0BEE, 0x0B0C3E, 0x0B0D1A, 0x0B0E16, 0x0B0E1E,
+    0x0B0E46, 0x0B0EAA, 0x0B0F0E, 0x0B1008, 0x0B100B, 0x0B1017, 0x0B101A, 0x0B1027, 0x0B102A, 0x0B1036, 0x0B1046, 0x0B1053,
+    0x0B1056, 0x0B1062, 0x0B1072, 0x0B10A3, 0x0B10A6, 0x0B10B2, 0x0B10C2, 0x0B10EE, 0x0B113E, 0x0B117F, 0x0B1182, 0x0B118E,
+    0x0B119E, 0x0B11CA, 0x0B121A, 0x0B130F, 0x0B1312, 0x0B131E, 0x0B132E, 0x0B135A, 0x0B13AA, 0x0B1486, 0x0B15E6, 0x0B15EE,
+    0x0B1616, 0x0B16DE, 0x0B175B, 0x0B175E, 0x0B176A, 0x0B177A, 0x0B17A6, 0x0B17F6, 0x0B18D2, 0x0B1A62, 0x0B1AC6, 0x0B1C3F,
+    0x0B1C47, 0x0B1C4A, 0x0B1C4E, 0x0B1C5E, 0x0B1C66, 0x0B1C6F, 0x0B1C72, 0x0B1C7E, 0x0B1C8A, 0x0B1C8E, 0x0B1C92, 0x0B1CDA,
+    0x0B1CE2, 0x0B1D0A, 0x0B1D37, 0x0B1D3A, 0x0B1D46, 0x0B1D56, 0x0B1D82, 0x0B1DB6, 0x0B1DBE, 0x0B1DD2, 0x0B1DE6, 0x0B1F2B,
+    0x0B1F2E, 0x0B1F3A, 0x0B1F46, 0x0B1F4A, 0x0B1F4E, 0x0B1F76, 0x0B1FC6, 0x0B203E, 0x0B20A2, 0x0B211F, 0x0B2122, 0x0B212E,
+    0x0B213E, 0x0B216A, 0x0B21BA, 0x0B2232, 0x0B2296, 0x0B2392, 0x0B239A, 0x0B23C2, 0x0B2426, 0x0B248A, 0x0B267E, 0x0B2B62,
+    0x0B2B6A, 0x0B2B92, 0x0B2C5A, 0x0B2E4E, 0x0B3042, 0x0B40DC, 0x0B40DF, 0x0B40EB, 0x0B40EE, 0x0B40FB, 0x0B40FE, 0x0B410A,
+    0x0B411A, 0x0B4127, 0x0B412A, 0x0B4136, 0x0B4146, 0x0B4177, 0x0B417A, 0x0B4186, 0x0B4196, 0x0B41C2, 0x0B4212, 0x0B4253,
+    0x0B4256, 0x0B4262, 0x0B4272, 0x0B429E, 0x0B42EE, 0x0B434F, 0x0B4357, 0x0B435A, 0x0B435E, 0x0B436E, 0x0B4376, 0x0B437F,
+    0x0B4382, 0x0B438E, 0x0B439A, 0x0B439E, 0x0B43A2, 0x0B43E3, 0x0B43E6, 0x0B43EA, 0x0B43F2, 0x0B4402, 0x0B441A, 0x0B442E,
+    0x0B4447, 0x0B444A, 0x0B4456, 0x0B4466, 0x0B447E, 0x0B4492, 0x0B44C6, 0x0B44CE, 0x0B44E2, 0x0B44F6, 0x0B455A, 0x0B4656,
+    0x0B465E, 0x0B4686, 0x0B46EA, 0x0B474E, 0x0B482F, 0x0B4832, 0x0B483E, 0x0B484E, 0x0B487A, 0x0B48CA, 0x0B49A6, 0x0B4AA2,
+    0x0B4AAA, 0x0B4AD2, 0x0B4B36, 0x0B4B9A, 0x0B4FFF, 0x0B5002, 0x0B500E, 0x0B501E, 0x0B504A, 0x0B509A, 0x0B5176, 0x0B5272,
+    0x0B527A, 0x0B52A2, 0x0B5306, 0x0B536A, 0x0B5752, 0x0B5BB7, 0x0B5BBA, 0x0B5BC6, 0x0B5BD6, 0x0B5C02, 0x0B5C52, 0x0B5D2E,
+    0x0B5EBE, 0x0B5F22, 0x0B630A, 0x0B657B, 0x0B657E, 0x0B658A, 0x0B659A, 0x0B65C6, 0x0B6616, 0x0B66F2, 0x0B67EE, 0x0B67F6,
+    0x0B681E, 0x0B6882, 0x0B68E6, 0x0B6ADA, 0x0B6CCE, 0x0B71B0, 0x0B71B3, 0x0B71BF, 0x0B71C2, 0x0B71CF, 0x0B71D2, 0x0B71DE,
+    0x0B71EE, 0x0B71FB, 0x0B71FE, 0x0B720A, 0x0B721A, 0x0B724B, 0x0B724E, 0x0B725A, 0x0B726A, 0x0B7296, 0x0B72E6, 0x0B7327,
+    0x0B732A, 0x0B7336, 0x0B7346, 0x0B7372, 0x0B73C2, 0x0B74B7, 0x0B74BA, 0x0B74C6, 0x0B74D6, 0x0B7502, 0x0B7552, 0x0B762E,
+    0x0B77BE, 0x0B7903, 0x0B7906, 0x0B7912, 0x0B7922, 0x0B794E, 0x0B799E, 0x0B7A7A, 0x0B7C0A, 0x0B80D3, 0x0B80D6, 0x0B80E2,
+    0x0B80F2, 0x0B811E, 0x0B816E, 0x0B824A, 0x0B83DA, 0x0B8826, 0x0B8C8B, 0x0B8C8E, 0x0B8C9A, 0x0B8CAA, 0x0B8CD6, 0x0B8D26,
+    0x0B8E02, 0x0B8EFE, 0x0B8F06, 0x0B8F2E, 0x0B8F92, 0x0B8FF6, 0x0B93DE, 0x0B964F, 0x0B9652, 0x0B965E, 0x0B966E, 0x0B969A,
+    0x0B96EA, 0x0B97C6, 0x0B9956, 0x0B9BAE, 0x0B9DA2, 0x0BA572, 0x0BA766, 0x0BAEBB, 0x0BAEC3, 0x0BAEC6, 0x0BAECA, 0x0BAEDA,
+    0x0BAEE2, 0x0BAEEB, 0x0BAEEE, 0x0BAEFA, 0x0BAF06, 0x0BAF0A, 0x0BAF0E, 0x0BAF56, 0x0BAF5E, 0x0BAF86, 0x0BAFB3, 0x0BAFB6,
+    0x0BAFC2, 0x0BAFD2, 0x0BAFFE, 0x0BB032, 0x0BB03A, 0x0BB04E, 0x0BB062, 0x0BB1C2, 0x0BB1CA, 0x0BB1F2, 0x0BB2BA, 0x0BB39B,
+    0x0BB39E, 0x0BB3AA, 0x0BB3BA, 0x0BB3E6, 0x0BB436, 0x0BB512, 0x0BB60E, 0x0BB616, 0x0BB63E, 0x0BB6A2, 0x0BB706, 0x0BBD5F,
+    0x0BBD62, 0x0BBD6E, 0x0BBD7E, 0x0BBDAA, 0x0BBDDE, 0x0BBDE6, 0x0BBDFA, 0x0BBE0E, 0x0BBED6, 0x0BC066, 0x0BC2BE, 0x0BC4B2,
+    0x0BC723, 0x0BC726, 0x0BC732, 0x0BC742, 0x0BC76E, 0x0BC7BE, 0x0BC89A, 0x0BCA2A, 0x0BCC82, 0x0BCE76, 0x0BD35A, 0x0BD362,
+    0x0BD38A, 0x0BD452, 0x0BD646, 0x0BD83A, 0x0BE1FE, 0x0BEBC2, 0x0BEBC5, 0x0BEBD1, 0x0BEBD4, 0x0BEBE1, 0x0BEBE4, 0x0BEBF0,
+    0x0BEBF3, 0x0BEC00, 0x0BEC0D, 0x0BEC10, 0x0BEC1C, 0x0BEC1F, 0x0BEC2C, 0x0BEC2F, 0x0BEC3B, 0x0BEC3E, 0x0BEC5D, 0x0BEC60,
+    0x0BEC6C, 0x0BEC6F, 0x0BEC7C, 0x0BEC7F, 0x0BEC9B, 0x0BECA8, 0x0BECAB, 0x0BECB7, 0x0BECBA, 0x0BECF8, 0x0BECFB, 0x0BED17,
+    0x0BED1A, 0x0BED36, 0x0BED39, 0x0BED3C, 0x0BED48, 0x0BED4B, 0x0BED58, 0x0BED5B, 0x0BED67, 0x0BED6A, 0x0BED77, 0x0BED84,
+    0x0BED87, 0x0BED93, 0x0BED96, 0x0BEDA3, 0x0BEDA6, 0x0BEDB2, 0x0BEDD4, 0x0BEDD7, 0x0BEDE3, 0x0BEDE6, 0x0BEDF3, 0x0BEDF6,
+    0x0BEE12, 0x0BEE1F, 0x0BEE22, 0x0BEE2E, 0x0BEEC9, 0x0BEECC, 0x0BEED8, 0x0BEEDB, 0x0BEEE8, 0x0BEEEB, 0x0BEEF7, 0x0BEEFA,
+    0x0BEF07, 0x0BEF14, 0x0BEF17, 0x0BEF23, 0x0BEF26, 0x0BEF64, 0x0BEF67, 0x0BEF73, 0x0BEF76, 0x0BEF83, 0x0BEF86, 0x0BEFA2,
+    0x0BEFFF, 0x0BF002, 0x0BF01E, 0x0BF040, 0x0BF043, 0x0BF04F, 0x0BF052, 0x0BF05F, 0x0BF062, 0x0BF06E, 0x0BF07E, 0x0BF08B,
+    0x0BF08E, 0x0BF09A, 0x0BF1D0, 0x0BF1D3, 0x0BF1DF, 0x0BF1E2, 0x0BF1EF, 0x0BF1F2, 0x0BF1FE, 0x0BF20E, 0x0BF26B, 0x0BF26E,
+    0x0BF27A, 0x0BF28A, 0x0BF306, 0x0BF315, 0x0BF318, 0x0BF324, 0x0BF327, 0x0BF334, 0x0BF337, 0x0BF343, 0x0BF346, 0x0BF353,
+    0x0BF360, 0x0BF363, 0x0BF36F, 0x0BF372, 0x0BF37F, 0x0BF382, 0x0BF38E, 0x0BF3B0, 0x0BF3B3, 0x0BF3BF, 0x0BF3C2, 0x0BF3CF,
+    0x0BF3D2, 0x0BF3EE, 0x0BF3FB, 0x0BF3FE, 0x0BF40A, 0x0BF44B, 0x0BF44E, 0x0BF46A, 0x0BF48C, 0x0BF48F, 0x0BF49B, 0x0BF49E,
+    0x0BF4AB, 0x0BF4AE, 0x0BF4BA, 0x0BF4CA, 0x0BF4D7, 0x0BF4DA, 0x0BF4E6, 0x0BF4F6, 0x0BF527, 0x0BF52A, 0x0BF536, 0x0BF546,
+    0x0BF572, 0x0BF61C, 0x0BF61F, 0x0BF62B, 0x0BF62E, 0x0BF63B, 0x0BF63E, 0x0BF64A, 0x0BF65A, 0x0BF667, 0x0BF66A, 0x0BF676,
+    0x0BF6B7, 0x0BF6BA, 0x0BF6C6, 0x0BF6D6, 0x0BF752, 0x0BF793, 0x0BF796, 0x0BF7A2, 0x0BF7B2, 0x0BF7DE, 0x0BFAE5, 0x0BFAE8,
+    0x0BFAF4, 0x0BFAF7, 0x0BFB04, 0x0BFB07, 0x0BFB13, 0x0BFB16, 0x0BFB23, 0x0BFB30, 0x0BFB33, 0x0BFB3F, 0x0BFB42, 0x0BFB4F,
+    0x0BFB52, 0x0BFB5E, 0x0BFB80, 0x0BFB83, 0x0BFB8F, 0x0BFB92, 0x0BFB9F, 0x0BFBA2, 0x0BFBBE, 0x0BFBCB, 0x0BFBCE, 0x0BFBDA,
+    0x0BFC1B, 0x0BFC1E, 0x0BFC3A, 0x0BFC5C, 0x0BFC5F, 0x0BFC6B, 0x0BFC6E, 0x0BFC7B, 0x0BFC7E, 0x0BFC8A, 0x0BFC9A, 0x0BFCA7,
+    0x0BFCAA, 0x0BFCB6, 0x0BFCC6, 0x0BFDEC, 0x0BFDEF, 0x0BFDFB, 0x0BFDFE, 0x0BFE0B, 0x0BFE0E, 0x0BFE1A, 0x0BFE2A, 0x0BFE37,
+    0x0BFE3A, 0x0BFE46, 0x0BFE87, 0x0BFE8A, 0x0BFE96, 0x0BFEA6, 0x0BFF22, 0x0C00F3, 0x0C00F6, 0x0C0102, 0x0C0112, 0x0C018E,
+    0x0C0238, 0x0C023B, 0x0C0247, 0x0C024A, 0x0C0257, 0x0C025A, 0x0C0266, 0x0C0276, 0x0C0283, 0x0C0286, 0x0C0292, 0x0C02A2,
+    0x0C02D3, 0x0C02D6, 0x0C02E2, 0x0C02F2, 0x0C031E, 0x0C036E, 0x0C03AF, 0x0C03B2, 0x0C03BE, 0x0C03CE, 0x0C03FA, 0x0C0A08,
+    0x0C0A0B, 0x0C0A17, 0x0C0A1A, 0x0C0A27, 0x0C0A2A, 0x0C0A36, 0x0C0A46, 0x0C0A53, 0x0C0A56, 0x0C0A62, 0x0C0A72, 0x0C0AA3,
+    0x0C0AA6, 0x0C0AB2, 0x0C0AC2, 0x0C0AEE, 0x0C0B3E, 0x0C0D0F, 0x0C0D12, 0x0C0D1E, 0x0C0D2E, 0x0C0D5A, 0x0C0DAA, 0x0C1016,
+    0x0C1061, 0x0C1064, 0x0C1070, 0x0C1073, 0x0C1080, 0x0C1083, 0x0C108F, 0x0C1092, 0x0C109F, 0x0C10AC, 0x0C10AF, 0x0C10BB,
+    0x0C10BE, 0x0C10CB, 0x0C10CE, 0x0C10DA, 0x0C10FC, 0x0C10FF, 0x0C110B, 0x0C110E, 0x0C111B, 0x0C111E, 0x0C113A, 0x0C1147,
+    0x0C114A, 0x0C1156, 0x0C1197, 0x0C119A, 0x0C11B6, 0x0C11D8, 0x0C11DB, 0x0C11E7, 0x0C11EA, 0x0C11F7, 0x0C11FA, 0x0C1206,
+    0x0C1216, 0x0C1223, 0x0C1226, 0x0C1232, 0x0C1242, 0x0C1273, 0x0C1276, 0x0C1282, 0x0C1292, 0x0C12BE, 0x0C1368, 0x0C136B,
+    0x0C1377, 0x0C137A, 0x0C1387, 0x0C138A, 0x0C1396, 0x0C13A6, 0x0C13B3, 0x0C13B6, 0x0C13C2, 0x0C1403, 0x0C1406, 0x0C1412,
+    0x0C1422, 0x0C149E, 0x0C14DF, 0x0C14E2, 0x0C14EE, 0x0C14FE, 0x0C152A, 0x0C166F, 0x0C1672, 0x0C167E, 0x0C168E, 0x0C170A,
+    0x0C17B4, 0x0C17B7, 0x0C17C3, 0x0C17C6, 0x0C17D3, 0x0C17D6, 0x0C17E2, 0x0C17F2, 0x0C17FF, 0x0C1802, 0x0C180E, 0x0C181E,
+    0x0C184F, 0x0C1852, 0x0C185E, 0x0C186E, 0x0C189A, 0x0C18EA, 0x0C192B, 0x0C192E, 0x0C193A, 0x0C194A, 0x0C1976, 0x0C19C6,
+    0x0C1ABB, 0x0C1ABE, 0x0C1ACA, 0x0C1ADA, 0x0C1B06, 0x0C1B56, 0x0C1C32, 0x0C1F84, 0x0C1F87, 0x0C1F93, 0x0C1F96, 0x0C1FA3,
+    0x0C1FA6, 0x0C1FB2, 0x0C1FC2, 0x0C1FCF, 0x0C1FD2, 0x0C1FDE, 0x0C1FEE, 0x0C201F, 0x0C2022, 0x0C202E, 0x0C203E, 0x0C206A,
+    0x0C20BA, 0x0C20FB, 0x0C20FE, 0x0C210A, 0x0C211A, 0x0C2146, 0x0C228B, 0x0C228E, 0x0C229A, 0x0C22AA, 0x0C22D6, 0x0C2326,
+    0x0C2592, 0x0C26D7, 0x0C26DA, 0x0C26E6, 0x0C26F6, 0x0C2722, 0x0C2772, 0x0C284E, 0x0C3771, 0x0C3774, 0x0C3780, 0x0C3783,
+    0x0C3790, 0x0C3793, 0x0C379F, 0x0C37A2, 0x0C37AF, 0x0C37BC, 0x0C37BF, 0x0C37CB, 0x0C37CE, 0x0C37DB, 0x0C37DE, 0x0C37EA,
+    0x0C380C, 0x0C380F, 0x0C381B, 0x0C381E, 0x0C382B, 0x0C382E, 0x0C384A, 0x0C3857, 0x0C385A, 0x0C3866, 0x0C38A7, 0x0C38AA,
+    0x0C38C6, 0x0C38E8, 0x0C38EB, 0x0C38F7, 0x0C38FA, 0x0C3907, 0x0C390A, 0x0C3916, 0x0C3926, 0x0C3933, 0x0C3936, 0x0C3942,
+    0x0C3952, 0x0C3983, 0x0C3986, 0x0C3992, 0x0C39A2, 0x0C39CE, 0x0C3A78, 0x0C3A7B, 0x0C3A87, 0x0C3A8A, 0x0C3A97, 0x0C3A9A,
+    0x0C3AA6, 0x0C3AB6, 0x0C3AC3, 0x0C3AC6, 0x0C3AD2, 0x0C3B13, 0x0C3B16, 0x0C3B22, 0x0C3B32, 0x0C3BAE, 0x0C3BEF, 0x0C3BF2,
+    0x0C3BFE, 0x0C3C0E, 0x0C3C3A, 0x0C3D7F, 0x0C3D82, 0x0C3D8E, 0x0C3D9E, 0x0C3E1A, 0x0C3EC4, 0x0C3EC7, 0x0C3ED3, 0x0C3ED6,
+    0x0C3EE3, 0x0C3EE6, 0x0C3EF2, 0x0C3F02, 0x0C3F0F, 0x0C3F12, 0x0C3F1E, 0x0C3F2E, 0x0C3F5F, 0x0C3F62, 0x0C3F6E, 0x0C3F7E,
+    0x0C3FAA, 0x0C3FFA, 0x0C403B, 0x0C403E, 0x0C404A, 0x0C405A, 0x0C4086, 0x0C40D6, 0x0C4694, 0x0C4697, 0x0C46A3, 0x0C46A6,
+    0x0C46B3, 0x0C46B6, 0x0C46C2, 0x0C46D2, 0x0C46DF, 0x0C46E2, 0x0C46EE, 0x0C46FE, 0x0C472F, 0x0C4732, 0x0C473E, 0x0C474E,
+    0x0C477A, 0x0C47CA, 0x0C480B, 0x0C480E, 0x0C481A, 0x0C482A, 0x0C4856, 0x0C499B, 0x0C499E, 0x0C49AA, 0x0C49BA, 0x0C49E6,
+    0x0C4A36, 0x0C4CA2, 0x0C55B7, 0x0C55BA, 0x0C55C6, 0x0C55D6, 0x0C5602, 0x0C5652, 0x0C58BE, 0x0C5C10, 0x0C5C13, 0x0C5C1F,
+    0x0C5C22, 0x0C5C2F, 0x0C5C32, 0x0C5C3E, 0x0C5C4E, 0x0C5C5B, 0x0C5C5E, 0x0C5C6A, 0x0C5C7A, 0x0C5CAB, 0x0C5CAE, 0x0C5CBA,
+    0x0C5CCA, 0x0C5CF6, 0x0C5D46, 0x0C5D87, 0x0C5D8A, 0x0C5D96, 0x0C5DA6, 0x0C5DD2, 0x0C5E22, 0x0C5F17, 0x0C5F1A, 0x0C5F26,
+    0x0C5F36, 0x0C5F62, 0x0C5FB2, 0x0C608E, 0x0C621E, 0x0C6363, 0x0C6366, 0x0C6372, 0x0C6382, 0x0C63AE, 0x0C63FE, 0x0C64DA,
+    0x0C8320, 0x0C8323, 0x0C832F, 0x0C8332, 0x0C833F, 0x0C8342, 0x0C834E, 0x0C835E, 0x0C836B, 0x0C836E, 0x0C837A, 0x0C838A,
+    0x0C83BB, 0x0C83BE, 0x0C83CA, 0x0C83DA, 0x0C8406, 0x0C8456, 0x0C8497, 0x0C849A, 0x0C84A6, 0x0C84B6, 0x0C84E2, 0x0C8532,
+    0x0C8627, 0x0C862A, 0x0C8636, 0x0C8646, 0x0C8672, 0x0C86C2, 0x0C879E, 0x0C892E, 0x0C9243, 0x0C9246, 0x0C9252, 0x0C9262,
+    0x0C928E, 0x0C92DE, 0x0C93BA, 0x0C954A, 0x0CA166, 0x0CA2DD, 0x0CA2E0, 0x0CA2EC, 0x0CA2EF, 0x0CA2FC, 0x0CA2FF, 0x0CA30B,
+    0x0CA30E, 0x0CA31B, 0x0CA328, 0x0CA32B, 0x0CA337, 0x0CA33A, 0x0CA347, 0x0CA34A, 0x0CA356, 0x0CA378, 0x0CA37B, 0x0CA387,
+    0x0CA38A, 0x0CA397, 0x0CA39A, 0x0CA3B6, 0x0CA3C3, 0x0CA3C6, 0x0CA3D2, 0x0CA413, 0x0CA416, 0x0CA432, 0x0CA454, 0x0CA457,
+    0x0CA463, 0x0CA466, 0x0CA473, 0x0CA476, 0x0CA482, 0x0CA492, 0x0CA49F, 0x0CA4A2, 0x0CA4AE, 0x0CA4BE, 0x0CA4EF, 0x0CA4F2,
+    0x0CA4FE, 0x0CA50E, 0x0CA53A, 0x0CA5E4, 0x0CA5E7, 0x0CA5F3, 0x0CA5F6, 0x0CA603, 0x0CA606, 0x0CA612, 0x0CA622, 0x0CA62F,
+    0x0CA632, 0x0CA63E, 0x0CA67F, 0x0CA682, 0x0CA68E, 0x0CA69E, 0x0CA71A, 0x0CA75B, 0x0CA75E, 0x0CA76A, 0x0CA77A, 0x0CA7A6,
+    0x0CA8EB, 0x0CA8EE, 0x0CA8FA, 0x0CA90A, 0x0CA986, 0x0CAA30, 0x0CAA33, 0x0CAA3F, 0x0CAA42, 0x0CAA4F, 0x0CAA52, 0x0CAA5E,
+    0x0CAA6E, 0x0CAA7B, 0x0CAA7E, 0x0CAA8A, 0x0CAA9A, 0x0CAACB, 0x0CAACE, 0x0CAADA, 0x0CAAEA, 0x0CAB16, 0x0CAB66, 0x0CABA7,
+    0x0CABAA, 0x0CABB6, 0x0CABC6, 0x0CABF2, 0x0CAC42, 0x0CAD37, 0x0CAD3A, 0x0CAD46, 0x0CAD56, 0x0CAD82, 0x0CADD2, 0x0CAEAE,
+    0x0CB200, 0x0CB203, 0x0CB20F, 0x0CB212, 0x0CB21F, 0x0CB222, 0x0CB22E, 0x0CB23E, 0x0CB24B, 0x0CB24E, 0x0CB25A, 0x0CB26A,
+    0x0CB29B, 0x0CB29E, 0x0CB2AA, 0x0CB2BA, 0x0CB2E6, 0x0CB336, 0x0CB377, 0x0CB37A, 0x0CB386, 0x0CB396, 0x0CB3C2, 0x0CB507,
+    0x0CB50A, 0x0CB516, 0x0CB526, 0x0CB552, 0x0CB5A2, 0x0CB80E, 0x0CB953, 0x0CB956, 0x0CB962, 0x0CB972, 0x0CB99E, 0x0CB9EE,
+    0x0CBACA, 0x0CC123, 0x0CC126, 0x0CC132, 0x0CC142, 0x0CC16E, 0x0CC1BE, 0x0CC42A, 0x0CC77C, 0x0CC77F, 0x0CC78B, 0x0CC78E,
+    0x0CC79B, 0x0CC79E, 0x0CC7AA, 0x0CC7BA, 0x0CC7C7, 0x0CC7CA, 0x0CC7D6, 0x0CC7E6, 0x0CC817, 0x0CC81A, 0x0CC826, 0x0CC836,
+    0x0CC862, 0x0CC8B2, 0x0CC8F3, 0x0CC8F6, 0x0CC902, 0x0CC912, 0x0CC93E, 0x0CC98E, 0x0CCA83, 0x0CCA86, 0x0CCA92, 0x0CCAA2,
+    0x0CCACE, 0x0CCB1E, 0x0CCBFA, 0x0CCD8A, 0x0CCECF, 0x0CCED2, 0x0CCEDE, 0x0CCEEE, 0x0CCF1A, 0x0CCF6A, 0x0CD046, 0x0CD1D6,
+    0x0CD69F, 0x0CD6A2, 0x0CD6AE, 0x0CD6BE, 0x0CD6EA, 0x0CD73A, 0x0CD816, 0x0CD9A6, 0x0CDDF2, 0x0CEE8C, 0x0CEE8F, 0x0CEE9B,
+    0x0CEE9E, 0x0CEEAB, 0x0CEEAE, 0x0CEEBA, 0x0CEECA, 0x0CEED7, 0x0CEEDA, 0x0CEEE6, 0x0CEEF6, 0x0CEF27, 0x0CEF2A, 0x0CEF36,
+    0x0CEF46, 0x0CEF72, 0x0CEFC2, 0x0CF003, 0x0CF006, 0x0CF012, 0x0CF022, 0x0CF04E, 0x0CF09E, 0x0CF193, 0x0CF196, 0x0CF1A2,
+    0x0CF1B2, 0x0CF1DE, 0x0CF22E, 0x0CF30A, 0x0CF49A, 0x0CF5DF, 0x0CF5E2, 0x0CF5EE, 0x0CF5FE, 0x0CF62A, 0x0CF67A, 0x0CF756,
+    0x0CFDAF, 0x0CFDB2, 0x0CFDBE, 0x0CFDCE, 0x0CFDFA, 0x0CFE4A, 0x0CFF26, 0x0D00B6, 0x0D0CD2, 0x0D132B, 0x0D132E, 0x0D133A,
+    0x0D134A, 0x0D1376, 0x0D13C6, 0x0D14A2, 0x0D1632, 0x0D1A7E, 0x0D662D, 0x0D6630, 0x0D663C, 0x0D663F, 0x0D664C, 0x0D664F,
+    0x0D665B, 0x0D665E, 0x0D666B, 0x0D6678, 0x0D667B, 0x0D6687, 0x0D668A, 0x0D6697, 0x0D669A, 0x0D66A6, 0x0D66C8, 0x0D66CB,
+    0x0D66D7, 0x0D66DA, 0x0D66E7, 0x0D66EA, 0x0D6706, 0x0D6713, 0x0D6716, 0x0D6722, 0x0D6763, 0x0D6766, 0x0D6782, 0x0D67A4,
+    0x0D67A7, 0x0D67B3, 0x0D67B6, 0x0D67C3, 0x0D67C6, 0x0D67D2, 0x0D67E2, 0x0D67EF, 0x0D67F2, 0x0D67FE, 0x0D680E, 0x0D683F,
+    0x0D6842, 0x0D684E, 0x0D685E, 0x0D688A, 0x0D6934, 0x0D6937, 0x0D6943, 0x0D6946, 0x0D6953, 0x0D6956, 0x0D6962, 0x0D6972,
+    0x0D697F, 0x0D6982, 0x0D698E, 0x0D69CF, 0x0D69D2, 0x0D69DE, 0x0D69EE, 0x0D6A6A, 0x0D6AAB, 0x0D6AAE, 0x0D6ABA, 0x0D6ACA,
+    0x0D6AF6, 0x0D6C3B, 0x0D6C3E, 0x0D6C4A, 0x0D6C5A, 0x0D6CD6, 0x0D6D80, 0x0D6D83, 0x0D6D8F, 0x0D6D92, 0x0D6D9F, 0x0D6DA2,
+    0x0D6DAE, 0x0D6DBE, 0x0D6DCB, 0x0D6DCE, 0x0D6DDA, 0x0D6DEA, 0x0D6E1B, 0x0D6E1E, 0x0D6E2A, 0x0D6E3A, 0x0D6E66, 0x0D6EB6,
+    0x0D6EF7, 0x0D6EFA, 0x0D6F06, 0x0D6F16, 0x0D6F42, 0x0D6F92, 0x0D7087, 0x0D708A, 0x0D7096, 0x0D70A6, 0x0D70D2, 0x0D7122,
+    0x0D71FE, 0x0D7550, 0x0D7553, 0x0D755F, 0x0D7562, 0x0D756F, 0x0D7572, 0x0D757E, 0x0D758E, 0x0D759B, 0x0D759E, 0x0D75AA,
+    0x0D75BA, 0x0D75EB, 0x0D75EE, 0x0D75FA, 0x0D760A, 0x0D7636, 0x0D7686, 0x0D76C7, 0x0D76CA, 0x0D76D6, 0x0D76E6, 0x0D7712,
+    0x0D7857, 0x0D785A, 0x0D7866, 0x0D7876, 0x0D78A2, 0x0D78F2, 0x0D7B5E, 0x0D7CA3, 0x0D7CA6, 0x0D7CB2, 0x0D7CC2, 0x0D7CEE,
+    0x0D7D3E, 0x0D7E1A, 0x0D8473, 0x0D8476, 0x0D8482, 0x0D8492, 0x0D84BE, 0x0D850E, 0x0D877A, 0x0D8ACC, 0x0D8ACF, 0x0D8ADB,
+    0x0D8ADE, 0x0D8AEB, 0x0D8AEE, 0x0D8AFA, 0x0D8B0A, 0x0D8B17, 0x0D8B1A, 0x0D8B26, 0x0D8B36, 0x0D8B67, 0x0D8B6A, 0x0D8B76,
+    0x0D8B86, 0x0D8BB2, 0x0D8C02, 0x0D8C43, 0x0D8C46, 0x0D8C52, 0x0D8C62, 0x0D8C8E, 0x0D8CDE, 0x0D8DD3, 0x0D8DD6, 0x0D8DE2,
+    0x0D8DF2, 0x0D8E1E, 0x0D8E6E, 0x0D8F4A, 0x0D90DA, 0x0D921F, 0x0D9222, 0x0D922E, 0x0D923E, 0x0D926A, 0x0D92BA, 0x0D9396,
+    0x0D9526, 0x0DB1DC, 0x0DB1DF, 0x0DB1EB, 0x0DB1EE, 0x0DB1FB, 0x0DB1FE, 0x0DB20A, 0x0DB21A, 0x0DB227, 0x0DB22A, 0x0DB236,
+    0x0DB246, 0x0DB277, 0x0DB27A, 0x0DB286, 0x0DB296, 0x0DB2C2, 0x0DB312, 0x0DB353, 0x0DB356, 0x0DB362, 0x0DB372, 0x0DB39E,
+    0x0DB3EE, 0x0DB4E3, 0x0DB4E6, 0x0DB4F2, 0x0DB502, 0x0DB52E, 0x0DB57E, 0x0DB65A, 0x0DB7EA, 0x0DB92F, 0x0DB932, 0x0DB93E,
+    0x0DB94E, 0x0DB97A, 0x0DB9CA, 0x0DBAA6, 0x0DC0FF, 0x0DC102, 0x0DC10E, 0x0DC11E, 0x0DC14A, 0x0DC19A, 0x0DC276, 0x0DC406,
+    0x0DD022, 0x0DFD8B, 0x0DFD8E, 0x0DFD9A, 0x0DFDAA, 0x0DFDD6, 0x0DFE26, 0x0DFF02, 0x0E0092, 0x0E0CAE, 0x0E1D48, 0x0E1D4B,
+    0x0E1D57, 0x0E1D5A, 0x0E1D67, 0x0E1D6A, 0x0E1D76, 0x0E1D86, 0x0E1D93, 0x0E1D96, 0x0E1DA2, 0x0E1DB2, 0x0E1DE3, 0x0E1DE6,
+    0x0E1DF2, 0x0E1E02, 0x0E1E2E, 0x0E1E7E, 0x0E1EBF, 0x0E1EC2, 0x0E1ECE, 0x0E1EDE, 0x0E1F0A, 0x0E1F5A, 0x0E204F, 0x0E2052,
+    0x0E205E, 0x0E206E, 0x0E209A, 0x0E20EA, 0x0E21C6, 0x0E2356, 0x0E249B, 0x0E249E, 0x0E24AA, 0x0E24BA, 0x0E24E6, 0x0E2536,
+    0x0E2612, 0x0E27A2, 0x0E2C6B, 0x0E2C6E, 0x0E2C7A, 0x0E2C8A, 0x0E2CB6, 0x0E2D06, 0x0E2DE2, 0x0E2F72, 0x0E33BE, 0x0E3B8E,
+    0x0E41E7, 0x0E41EA, 0x0E41F6, 0x0E4206, 0x0E4232, 0x0E4282, 0x0E435E, 0x0E44EE, 0x0E493A, 0x0EC830, 0x0EC838, 0x0EC83B,
+    0x0EC83F, 0x0EC84F, 0x0EC857, 0x0EC85A, 0x0EC85E, 0x0EC860, 0x0EC863, 0x0EC86E, 0x0EC86F, 0x0EC872, 0x0EC876, 0x0EC87B,
+    0x0EC87F, 0x0EC882, 0x0EC883, 0x0EC886, 0x0EC88A, 0x0EC88E, 0x0EC89A, 0x0EC89E, 0x0EC8A2, 0x0EC8CB, 0x0EC8D3, 0x0EC8D6,
+    0x0EC8DA, 0x0EC8EA, 0x0EC8F2, 0x0EC8FB, 0x0EC8FE, 0x0EC90A, 0x0EC916, 0x0EC91A, 0x0EC91E, 0x0EC928, 0x0EC92B, 0x0EC937,
+    0x0EC93A, 0x0EC947, 0x0EC94A, 0x0EC956, 0x0EC966, 0x0EC96E, 0x0EC973, 0x0EC976, 0x0EC982, 0x0EC992, 0x0EC996, 0x0EC9A7,
+    0x0EC9AF, 0x0EC9B2, 0x0EC9B6, 0x0EC9C3, 0x0EC9C6, 0x0EC9CE, 0x0EC9D2, 0x0EC9D7, 0x0EC9DA, 0x0EC9E2, 0x0EC9E6, 0x0EC9F2,
+    0x0EC9F6, 0x0EC9FA, 0x0ECA0E, 0x0ECA42, 0x0ECA4A, 0x0ECA5E, 0x0ECA72, 0x0ECB37, 0x0ECB3F, 0x0ECB42, 0x0ECB46, 0x0ECB56,
+    0x0ECB5E, 0x0ECB67, 0x0ECB6A, 0x0ECB76, 0x0ECB82, 0x0ECB86, 0x0ECB8A, 0x0ECBD2, 0x0ECBDA, 0x0ECC02, 0x0ECC2F, 0x0ECC32,
+    0x0ECC3E, 0x0ECC4E, 0x0ECC7A, 0x0ECCAE, 0x0ECCB6, 0x0ECCCA, 0x0ECCDE, 0x0ECD10, 0x0ECD13, 0x0ECD1F, 0x0ECD22, 0x0ECD2F,
+    0x0ECD32, 0x0ECD3E, 0x0ECD4E, 0x0ECD5B, 0x0ECD5E, 0x0ECD6A, 0x0ECD7A, 0x0ECDAB, 0x0ECDAE, 0x0ECDBA, 0x0ECDCA, 0x0ECDF6,
+    0x0ECE3E, 0x0ECE46, 0x0ECE6E, 0x0ECE87, 0x0ECE8A, 0x0ECE96, 0x0ECEA6, 0x0ECED2, 0x0ECF22, 0x0ECF36, 0x0ECF83, 0x0ECF8B,
+    0x0ECF8E, 0x0ECF92, 0x0ECFA2, 0x0ECFAA, 0x0ECFB3, 0x0ECFB6, 0x0ECFC2, 0x0ECFCE, 0x0ECFD2, 0x0ECFD6, 0x0ED017, 0x0ED01A,
+    0x0ED01E, 0x0ED026, 0x0ED036, 0x0ED04E, 0x0ED062, 0x0ED07B, 0x0ED07E, 0x0ED08A, 0x0ED09A, 0x0ED0B2, 0x0ED0C6, 0x0ED0FA,
+    0x0ED102, 0x0ED116, 0x0ED12A, 0x0ED18E, 0x0ED28A, 0x0ED292, 0x0ED2BA, 0x0ED31E, 0x0ED382, 0x0ED753, 0x0ED75B, 0x0ED75E,
+    0x0ED762, 0x0ED772, 0x0ED77A, 0x0ED783, 0x0ED786, 0x0ED792, 0x0ED79E, 0x0ED7A2, 0x0ED7A6, 0x0ED7EE, 0x0ED7F6, 0x0ED81E,
+    0x0ED84B, 0x0ED84E, 0x0ED85A, 0x0ED86A, 0x0ED896, 0x0ED8CA, 0x0ED8D2, 0x0ED8E6, 0x0ED8FA, 0x0EDA5A, 0x0EDA62, 0x0EDA8A,
+    0x0EDB52, 0x0EDC33, 0x0EDC36, 0x0EDC42, 0x0EDC52, 0x0EDC7E, 0x0EDCCE, 0x0EDDAA, 0x0EDEA6, 0x0EDEAE, 0x0EDED6, 0x0EDF3A,
+    0x0EDF9E, 0x0EE098, 0x0EE09B, 0x0EE0A7, 0x0EE0AA, 0x0EE0B7, 0x0EE0BA, 0x0EE0C6, 0x0EE0D6, 0x0EE0E3, 0x0EE0E6, 0x0EE0F2,
+    0x0EE102, 0x0EE133, 0x0EE136, 0x0EE142, 0x0EE152, 0x0EE17E, 0x0EE1CE, 0x0EE20F, 0x0EE212, 0x0EE21E, 0x0EE22E, 0x0EE25A,
+    0x0EE2AA, 0x0EE39F, 0x0EE3A2, 0x0EE3AE, 0x0EE3BE, 0x0EE3EA, 0x0EE43A, 0x0EE516, 0x0EE676, 0x0EE67E, 0x0EE6A6, 0x0EE76E,
+    0x0EE7EB, 0x0EE7EE, 0x0EE7FA, 0x0EE80A, 0x0EE836, 0x0EE886, 0x0EE962, 0x0EEAF2, 0x0EEB56, 0x0EECCF, 0x0EECD7, 0x0EECDA,
+    0x0EECDE, 0x0EECEE, 0x0EECF6, 0x0EECFF, 0x0EED02, 0x0EED0E, 0x0EED1A, 0x0EED1E, 0x0EED22, 0x0EED6A, 0x0EED72, 0x0EED9A,
+    0x0EEDC7, 0x0EEDCA, 0x0EEDD6, 0x0EEDE6, 0x0EEE12, 0x0EEE46, 0x0EEE4E, 0x0EEE62, 0x0EEE76, 0x0EEFBB, 0x0EEFBE, 0x0EEFCA,
+    0x0EEFD6, 0x0EEFDA, 0x0EEFDE, 0x0EF006, 0x0EF056, 0x0EF0CE, 0x0EF132, 0x0EF1AF, 0x0EF1B2, 0x0EF1BE, 0x0EF1CE, 0x0EF1FA,
+    0x0EF24A, 0x0EF2C2, 0x0EF326, 0x0EF422, 0x0EF42A, 0x0EF452, 0x0EF4B6, 0x0EF51A, 0x0EF70E, 0x0EFBF2, 0x0EFBFA, 0x0EFC22,
+    0x0EFCEA, 0x0EFEDE, 0x0F00D2, 0x0F13DF, 0x0F13E7, 0x0F13EA, 0x0F13EE, 0x0F13FE, 0x0F1406, 0x0F140F, 0x0F1412, 0x0F141E,
+    0x0F142A, 0x0F142E, 0x0F1432, 0x0F147A, 0x0F1482, 0x0F14AA, 0x0F14D7, 0x0F14DA, 0x0F14E6, 0x0F14F6, 0x0F1522, 0x0F1556,
+    0x0F155E, 0x0F1572, 0x0F1586, 0x0F16E6, 0x0F16EE, 0x0F1716, 0x0F17DE, 0x0F18BF, 0x0F18C2, 0x0F18CE, 0x0F18DE, 0x0F190A,
+    0x0F195A, 0x0F1A36, 0x0F1B32, 0x0F1B3A, 0x0F1B62, 0x0F1BC6, 0x0F1C2A, 0x0F2302, 0x0F230A, 0x0F2332, 0x0F23FA, 0x0F27E2,
+    0x0F2C47, 0x0F2C4A, 0x0F2C56, 0x0F2C66, 0x0F2C92, 0x0F2CE2, 0x0F2DBE, 0x0F2F4E, 0x0F339A, 0x0F387E, 0x0F3886, 0x0F38AE,
+    0x0F3976, 0x0F3B6A, 0x0F3D5E, 0x0F4240, 0x0F4243, 0x0F424F, 0x0F4252, 0x0F425F, 0x0F4262, 0x0F426E, 0x0F427E, 0x0F428B,
+    0x0F428E, 0x0F429A, 0x0F42AA, 0x0F42DB, 0x0F42DE, 0x0F42EA, 0x0F42FA, 0x0F4326, 0x0F4376, 0x0F43B7, 0x0F43BA, 0x0F43C6,
+    0x0F43D6, 0x0F4402, 0x0F4452, 0x0F4547, 0x0F454A, 0x0F4556, 0x0F4566, 0x0F4592, 0x0F45E2, 0x0F46BE, 0x0F484E, 0x0F4993,
+    0x0F4996, 0x0F49A2, 0x0F49B2, 0x0F49DE, 0x0F4A2E, 0x0F4B0A, 0x0F4C9A, 0x0F5163, 0x0F5166, 0x0F5172, 0x0F5182, 0x0F51AE,
+    0x0F51FE, 0x0F52DA, 0x0F546A, 0x0F58B6, 0x0F5F8E, 0x0F5F96, 0x0F5FBE, 0x0F6086, 0x0F646E, 0x0F66DF, 0x0F66E2, 0x0F66EE,
+    0x0F66FE, 0x0F672A, 0x0F677A, 0x0F6856, 0x0F69E6, 0x0F6E32, 0x0F7602, 0x0F77F6, 0x0F7F49, 0x0F7F4C, 0x0F7F58, 0x0F7F5B,
+    0x0F7F68, 0x0F7F6B, 0x0F7F77, 0x0F7F7A, 0x0F7F87, 0x0F7F94, 0x0F7F97, 0x0F7FA3, 0x0F7FA6, 0x0F7FB3, 0x0F7FB6, 0x0F7FC2,
+    0x0F7FE4, 0x0F7FE7, 0x0F7FF3, 0x0F7FF6, 0x0F8003, 0x0F8006, 0x0F8022, 0x0F802F, 0x0F8032, 0x0F803E, 0x0F807F, 0x0F8082,
+    0x0F809E, 0x0F80C0, 0x0F80C3, 0x0F80CF, 0x0F80D2, 0x0F80DF, 0x0F80E2, 0x0F80EE, 0x0F80FE, 0x0F810B, 0x0F810E, 0x0F811A,
+    0x0F812A, 0x0F815B, 0x0F815E, 0x0F816A, 0x0F817A, 0x0F81A6, 0x0F8250, 0x0F8253, 0x0F825F, 0x0F8262, 0x0F826F, 0x0F8272,
+    0x0F827E, 0x0F828E, 0x0F829B, 0x0F829E, 0x0F82AA, 0x0F82EB, 0x0F82EE, 0x0F82FA, 0x0F830A, 0x0F8386, 0x0F83C7, 0x0F83CA,
+    0x0F83D6, 0x0F83E6, 0x0F8412, 0x0F8557, 0x0F855A, 0x0F8566, 0x0F8576, 0x0F85F2, 0x0F869C, 0x0F869F, 0x0F86AB, 0x0F86AE,
+    0x0F86BB, 0x0F86BE, 0x0F86CA, 0x0F86DA, 0x0F86E7, 0x0F86EA, 0x0F86F6, 0x0F8706, 0x0F8737, 0x0F873A, 0x0F8746, 0x0F8756,
+    0x0F8782, 0x0F87D2, 0x0F8813, 0x0F8816, 0x0F8822, 0x0F8832, 0x0F885E, 0x0F88AE, 0x0F89A3, 0x0F89A6, 0x0F89B2, 0x0F89C2,
+    0x0F89EE, 0x0F8A3E, 0x0F8B1A, 0x0F8E6C, 0x0F8E6F, 0x0F8E7B, 0x0F8E7E, 0x0F8E8B, 0x0F8E8E, 0x0F8E9A, 0x0F8EAA, 0x0F8EB7,
+    0x0F8EBA, 0x0F8EC6, 0x0F8ED6, 0x0F8F07, 0x0F8F0A, 0x0F8F16, 0x0F8F26, 0x0F8F52, 0x0F8FA2, 0x0F8FE3, 0x0F8FE6, 0x0F8FF2,
+    0x0F9002, 0x0F902E, 0x0F9173, 0x0F9176, 0x0F9182, 0x0F9192, 0x0F91BE, 0x0F920E, 0x0F947A, 0x0F95BF, 0x0F95C2, 0x0F95CE,
+    0x0F95DE, 0x0F960A, 0x0F965A, 0x0F9736, 0x0F9D8F, 0x0F9D92, 0x0F9D9E, 0x0F9DAE, 0x0F9DDA, 0x0F9E2A, 0x0FA096, 0x0FA3E8,
+    0x0FA3EB, 0x0FA3F7, 0x0FA3FA, 0x0FA407, 0x0FA40A, 0x0FA416, 0x0FA426, 0x0FA433, 0x0FA436, 0x0FA442, 0x0FA452, 0x0FA483,
+    0x0FA486, 0x0FA492, 0x0FA4A2, 0x0FA4CE, 0x0FA51E, 0x0FA55F, 0x0FA562, 0x0FA56E, 0x0FA57E, 0x0FA5AA, 0x0FA5FA, 0x0FA6EF,
+    0x0FA6F2, 0x0FA6FE, 0x0FA70E, 0x0FA73A, 0x0FA78A, 0x0FA866, 0x0FA9F6, 0x0FAB3B, 0x0FAB3E, 0x0FAB4A, 0x0FAB5A, 0x0FAB86,
+    0x0FABD6, 0x0FACB2, 0x0FAE42, 0x0FB30B, 0x0FB30E, 0x0FB31A, 0x0FB32A, 0x0FB356, 0x0FB3A6, 0x0FB482, 0x0FB612, 0x0FBA5E,
+    0x0FCAF8, 0x0FCAFB, 0x0FCB07, 0x0FCB0A, 0x0FCB17, 0x0FCB1A, 0x0FCB26, 0x0FCB36, 0x0FCB43, 0x0FCB46, 0x0FCB52, 0x0FCB62,
+    0x0FCB93, 0x0FCB96, 0x0FCBA2, 0x0FCBB2, 0x0FCBDE, 0x0FCC2E, 0x0FCC6F, 0x0FCC72, 0x0FCC7E, 0x0FCC8E, 0x0FCCBA, 0x0FCD0A,
+    0x0FCDFF, 0x0FCE02, 0x0FCE0E, 0x0FCE1E, 0x0FCE4A, 0x0FCE9A, 0x0FCF76, 0x0FD106, 0x0FD24B, 0x0FD24E, 0x0FD25A, 0x0FD26A,
+    0x0FD296, 0x0FD2E6, 0x0FD3C2, 0x0FDA1B, 0x0FDA1E, 0x0FDA2A, 0x0FDA3A, 0x0FDA66, 0x0FDAB6, 0x0FDB92, 0x0FDD22, 0x0FE93E,
+    0x0FEF97, 0x0FEF9A, 0x0FEFA6, 0x0FEFB6, 0x0FEFE2, 0x0FF032, 0x0FF10E, 0x0FF29E, 0x0FF6EA, 0x1016A7, 0x1016AA, 0x1016B6,
+    0x1016C6, 0x1016F2, 0x101742, 0x10181E, 0x1019AE, 0x1025CA, 0x103664, 0x103667, 0x103673, 0x103676, 0x103683, 0x103686,
+    0x103692, 0x1036A2, 0x1036AF, 0x1036B2, 0x1036BE, 0x1036CE, 0x1036FF, 0x103702, 0x10370E, 0x10371E, 0x10374A, 0x10379A,
+    0x1037DB, 0x1037DE, 0x1037EA, 0x1037FA, 0x103826, 0x103876, 0x10396B, 0x10396E, 0x10397A, 0x10398A, 0x1039B6, 0x103A06,
+    0x103AE2, 0x103C72, 0x103DB7, 0x103DBA, 0x103DC6, 0x103DD6, 0x103E02, 0x103E52, 0x103F2E, 0x1040BE, 0x10429B, 0x1042A3,
+    0x1042A6, 0x1042AA, 0x1042BA, 0x1042C2, 0x1042CB, 0x1042CE, 0x1042DA, 0x1042E6, 0x1042EA, 0x1042EE, 0x104336, 0x10433E,
+    0x104366, 0x104393, 0x104396, 0x1043A2, 0x1043B2, 0x1043DE, 0x104412, 0x10441A, 0x10442E, 0x104442, 0x104587, 0x10458A,
+    0x104596, 0x1045A2, 0x1045A6, 0x1045AA, 0x1045D2, 0x104622, 0x10469A, 0x1046FE, 0x10477B, 0x10477E, 0x10478A, 0x10479A,
+    0x1047C6, 0x104816, 0x10488E, 0x1048F2, 0x1049EE, 0x1049F6, 0x104A1E, 0x104A82, 0x104AE6, 0x104CDA, 0x1051BE, 0x1051C6,
+    0x1051EE, 0x1052B6, 0x1054AA, 0x10569E, 0x105B03, 0x105B06, 0x105B12, 0x105B22, 0x105B4E, 0x105B9E, 0x105C7A, 0x105E0A,
+    0x106256, 0x10673A, 0x106742, 0x10676A, 0x106832, 0x106A26, 0x106C1A, 0x108213, 0x108216, 0x108222, 0x108232, 0x10825E,
+    0x1082AE, 0x10838A, 0x10851A, 0x108966, 0x108E4A, 0x108E52, 0x108E7A, 0x108F42, 0x109136, 0x10932A, 0x10A6B2, 0x10F9B4,
+    0x10F9B7, 0x10F9C3, 0x10F9C6, 0x10F9D3, 0x10F9D6, 0x10F9E2, 0x10F9F2, 0x10F9FF, 0x10FA02, 0x10FA0E, 0x10FA1E, 0x10FA4F,
+    0x10FA52, 0x10FA5E, 0x10FA6E, 0x10FA9A, 0x10FAEA, 0x10FB2B, 0x10FB2E, 0x10FB3A, 0x10FB4A, 0x10FB76, 0x10FBC6, 0x10FCBB,
+    0x10FCBE, 0x10FCCA, 0x10FCDA, 0x10FD06, 0x10FD56, 0x10FE32, 0x10FFC2, 0x110107, 0x11010A, 0x110116, 0x110126, 0x110152,
+    0x1101A2, 0x11027E, 0x11040E, 0x1108D7, 0x1108DA, 0x1108E6, 0x1108F6, 0x110922, 0x110972, 0x110A4E, 0x110BDE, 0x11102A,
+    0x1117FA, 0x111E53, 0x111E56, 0x111E62, 0x111E72, 0x111E9E, 0x111EEE, 0x111FCA, 0x11215A, 0x1125A6, 0x112A88, 0x112A8B,
+    0x112A97, 0x112A9A, 0x112AA7, 0x112AAA, 0x112AB6, 0x112AC6, 0x112AD3, 0x112AD6, 0x112AE2, 0x112AF2, 0x112B23, 0x112B26,
+    0x112B32, 0x112B42, 0x112B6E, 0x112BBE, 0x112BFF, 0x112C02, 0x112C0E, 0x112C1E, 0x112C4A, 0x112C9A, 0x112D8F, 0x112D92,
+    0x112D9E, 0x112DAE, 0x112DDA, 0x112E2A, 0x112F06, 0x113096, 0x1131DB, 0x1131DE, 0x1131EA, 0x1131FA, 0x113226, 0x113276,
+    0x113352, 0x1134E2, 0x1139AB, 0x1139AE, 0x1139BA, 0x1139CA, 0x1139F6, 0x113A46, 0x113B22, 0x113CB2, 0x1140FE, 0x114563,
+    0x114566, 0x114572, 0x114582, 0x1145AE, 0x1145FE, 0x1146DA, 0x11486A, 0x1148CE, 0x114CB6, 0x114F27, 0x114F2A, 0x114F36,
+    0x114F46, 0x114F72, 0x114FC2, 0x11509E, 0x11522E, 0x115486, 0x11567A, 0x115E4A, 0x117637, 0x11763A, 0x117646, 0x117656,
+    0x117682, 0x1176D2, 0x1177AE, 0x11793E, 0x117D8A, 0x11855A, 0x119112, 0x119AD6, 0x11B0CF, 0x11B0D2, 0x11B0DE, 0x11B0EE,
+    0x11B11A, 0x11B16A, 0x11B246, 0x11B3D6, 0x11B822, 0x11BD06, 0x11BD0E, 0x11BD36, 0x11BDFE, 0x11BFF2, 0x11C1E6, 0x11D56E,
+    0x11E1A5, 0x11E1AD, 0x11E1B0, 0x11E1B4, 0x11E1C4, 0x11E1CC, 0x11E1CF, 0x11E1D3, 0x11E1D5, 0x11E1D8, 0x11E1E3, 0x11E1E4,
+    0x11E1E7, 0x11E1EB, 0x11E1F0, 0x11E1F4, 0x11E1F7, 0x11E1F8, 0x11E1FB, 0x11E1FF, 0x11E203, 0x11E206, 0x11E20F, 0x11E213,
+    0x11E217, 0x11E21A, 0x11E21E, 0x11E240, 0x11E248, 0x11E24B, 0x11E24F, 0x11E25F, 0x11E267, 0x11E26A, 0x11E270, 0x11E273,
+    0x11E27E, 0x11E27F, 0x11E282, 0x11E28B, 0x11E28F, 0x11E292, 0x11E293, 0x11E296, 0x11E29A, 0x11E29D, 0x11E2A0, 0x11E2AC,
+    0x11E2AF, 0x11E2BC, 0x11E2BF, 0x11E2CB, 0x11E2CE, 0x11E2DB, 0x11E2E3, 0x11E2E6, 0x11E2E8, 0x11E2EB, 0x11E2F7, 0x11E2FA,
+    0x11E307, 0x11E30A, 0x11E30B, 0x11E30E, 0x11E316, 0x11E31C, 0x11E324, 0x11E327, 0x11E32B, 0x11E338, 0x11E33B, 0x11E343,
+    0x11E346, 0x11E347, 0x11E34A, 0x11E34C, 0x11E34F, 0x11E357, 0x11E35A, 0x11E35B, 0x11E35E, 0x11E362, 0x11E367, 0x11E36B,
+    0x11E36E, 0x11E36F, 0x11E372, 0x11E376, 0x11E37A, 0x11E383, 0x11E386, 0x11E38A, 0x11E38E, 0x11E392, 0x11E3B7, 0x11E3BF,
+    0x11E3C2, 0x11E3C6, 0x11E3D3, 0x11E3D6, 0x11E3DE, 0x11E3E7, 0x11E3EA, 0x11E3F2, 0x11E3F6, 0x11E402, 0x11E406, 0x11E40A,
+    0x11E4AC, 0x11E4B4, 0x11E4B7, 0x11E4BB, 0x11E4CB, 0x11E4D3, 0x11E4D6, 0x11E4DA, 0x11E4DC, 0x11E4DF, 0x11E4EA, 0x11E4EB,
+    0x11E4EE, 0x11E4F2, 0x11E4F7, 0x11E4FB, 0x11E4FE, 0x11E4FF, 0x11E502, 0x11E506, 0x11E50A, 0x11E547, 0x11E54F, 0x11E552,
+    0x11E556, 0x11E566, 0x11E56E, 0x11E577, 0x11E57A, 0x11E586, 0x11E5A4, 0x11E5A7, 0x11E5B3, 0x11E5B6, 0x11E5C3, 0x11E5C6,
+    0x11E5D2, 0x11E5E2, 0x11E5EA, 0x11E5EF, 0x11E5F2, 0x11E5FE, 0x11E623, 0x11E62B, 0x11E62E, 0x11E632, 0x11E63F, 0x11E642,
+    0x11E64A, 0x11E64E, 0x11E653, 0x11E656, 0x11E65E, 0x11E662, 0x11E66E, 0x11E672, 0x11E676, 0x11E685, 0x11E688, 0x11E694,
+    0x11E697, 0x11E6A4, 0x11E6A7, 0x11E6B3, 0x11E6B6, 0x11E6C3, 0x11E6D0, 0x11E6D3, 0x11E6DF, 0x11E6E2, 0x11E6EF, 0x11E6F2,
+    0x11E6FE, 0x11E720, 0x11E723, 0x11E72F, 0x11E732, 0x11E73F, 0x11E742, 0x11E75E, 0x11E76B, 0x11E76E, 0x11E77A, 0x11E7B3,
+    0x11E7BB, 0x11E7BE, 0x11E7C2, 0x11E7D2, 0x11E7DA, 0x11E7E3, 0x11E7E6, 0x11E7F2, 0x11E7FC, 0x11E7FF, 0x11E80B, 0x11E80E,
+    0x11E81B, 0x11E81E, 0x11E82A, 0x11E83A, 0x11E847, 0x11E84A, 0x11E84E, 0x11E856, 0x11E866, 0x11E897, 0x11E89A, 0x11E8A6,
+    0x11E8AB, 0x11E8AE, 0x11E8B6, 0x11E8BA, 0x11E8CA, 0x11E8E2, 0x11E8F8, 0x11E900, 0x11E903, 0x11E907, 0x11E917, 0x11E91F,
+    0x11E922, 0x11E926, 0x11E928, 0x11E92B, 0x11E936, 0x11E937, 0x11E93A, 0x11E93E, 0x11E943, 0x11E947, 0x11E94A, 0x11E94B,
+    0x11E94E, 0x11E952, 0x11E956, 0x11E962, 0x11E966, 0x11E96A, 0x11E98C, 0x11E98F, 0x11E993, 0x11E99B, 0x11E99E, 0x11E9A2,
+    0x11E9AB, 0x11E9AE, 0x11E9B2, 0x11E9BA, 0x11E9C3, 0x11E9C6, 0x11E9CA, 0x11E9D2, 0x11E9D7, 0x11E9DA, 0x11E9DE, 0x11E9E2,
+    0x11E9E6, 0x11E9F0, 0x11E9F3, 0x11E9FF, 0x11EA02, 0x11EA0F, 0x11EA12, 0x11EA1E, 0x11EA27, 0x11EA2A, 0x11EA2E, 0x11EA36,
+    0x11EA3B, 0x11EA3E, 0x11EA46, 0x11EA4A, 0x11EA5A, 0x11EA5E, 0x11EA6F, 0x11EA77, 0x11EA7A, 0x11EA7E, 0x11EA8B, 0x11EA8E,
+    0x11EA96, 0x11EA9A, 0x11EA9F, 0x11EAA2, 0x11EAAA, 0x11EAAE, 0x11EABA, 0x11EABE, 0x11EAC2, 0x11EAD6, 0x11EB03, 0x11EB06,
+    0x11EB0A, 0x11EB12, 0x11EB22, 0x11EB26, 0x11EB3A, 0x11EB4E, 0x11EBFF, 0x11EC07, 0x11EC0A, 0x11EC0E, 0x11EC1E, 0x11EC26,
+    0x11EC2F, 0x11EC32, 0x11EC3E, 0x11EC4A, 0x11EC4E, 0x11EC52, 0x11EC93, 0x11EC96, 0x11EC9A, 0x11ECA2, 0x11ECB2, 0x11ECCA,
+    0x11ECF7, 0x11ECFA, 0x11ED06, 0x11ED16, 0x11ED2E, 0x11ED42, 0x11ED76, 0x11ED7E, 0x11ED92, 0x11EDA6, 0x11F0C8, 0x11F0D0,
+    0x11F0D3, 0x11F0D7, 0x11F0E7, 0x11F0EF, 0x11F0F2, 0x11F0F6, 0x11F0F8, 0x11F0FB, 0x11F106, 0x11F107, 0x11F10A, 0x11F10E,
+    0x11F113, 0x11F117, 0x11F11A, 0x11F11B, 0x11F11E, 0x11F122, 0x11F126, 0x11F132, 0x11F136, 0x11F13A, 0x11F163, 0x11F16B,
+    0x11F16E, 0x11F172, 0x11F182, 0x11F18A, 0x11F193, 0x11F196, 0x11F1A2, 0x11F1AE, 0x11F1B2, 0x11F1B6, 0x11F1C0, 0x11F1C3,
+    0x11F1CF, 0x11F1D2, 0x11F1DF, 0x11F1E2, 0x11F1EE, 0x11F1FE, 0x11F206, 0x11F20B, 0x11F20E, 0x11F21A, 0x11F22A, 0x11F22E,
+    0x11F23F, 0x11F247, 0x11F24A, 0x11F24E, 0x11F25B, 0x11F25E, 0x11F266, 0x11F26A, 0x11F26F, 0x11F272, 0x11F27A, 0x11F27E,
+    0x11F28A, 0x11F28E, 0x11F292, 0x11F2A6, 0x11F3CF, 0x11F3D7, 0x11F3DA, 0x11F3DE, 0x11F3EE, 0x11F3F6, 0x11F3FF, 0x11F402,
+    0x11F40E, 0x11F41A, 0x11F41E, 0x11F422, 0x11F46A, 0x11F472, 0x11F49A, 0x11F4C7, 0x11F4CA, 0x11F4D6, 0x11F4E6, 0x11F512,
+    0x11F5A8, 0x11F5AB, 0x11F5B7, 0x11F5BA, 0x11F5C7, 0x11F5CA, 0x11F5D6, 0x11F5E6, 0x11F5F3, 0x11F5F6, 0x11F602, 0x11F612,
+    0x11F643, 0x11F646, 0x11F652, 0x11F662, 0x11F68E, 0x11F6D6, 0x11F6DE, 0x11F706, 0x11F71F, 0x11F722, 0x11F72E, 0x11F73E,
+    0x11F76A, 0x11F81B, 0x11F823, 0x11F826, 0x11F82A, 0x11F83A, 0x11F842, 0x11F84B, 0x11F84E, 0x11F85A, 0x11F866, 0x11F86A,
+    0x11F86E, 0x11F8AF, 0x11F8B2, 0x11F8B6, 0x11F8BE, 0x11F8CE, 0x11F8E6, 0x11F8FA, 0x11F913, 0x11F916, 0x11F922, 0x11F932,
+    0x11F94A, 0x11F95E, 0x11F992, 0x11F99A, 0x11F9AE, 0x11F9C2, 0x11FA0D, 0x11FA10, 0x11FA1C, 0x11FA1F, 0x11FA2C, 0x11FA2F,
+    0x11FA3B, 0x11FA3E, 0x11FA4B, 0x11FA58, 0x11FA5B, 0x11FA67, 0x11FA6A, 0x11FA77, 0x11FA7A, 0x11FA86, 0x11FAA8, 0x11FAAB,
+    0x11FAB7, 0x11FABA, 0x11FAC7, 0x11FACA, 0x11FAE6, 0x11FAF3, 0x11FAF6, 0x11FB02, 0x11FB43, 0x11FB46, 0x11FB62, 0x11FB84,
+    0x11FB87, 0x11FB93, 0x11FB96, 0x11FBA3, 0x11FBA6, 0x11FBB2, 0x11FBC2, 0x11FBCF, 0x11FBD2, 0x11FBDE, 0x11FBEE, 0x11FC1F,
+    0x11FC22, 0x11FC2E, 0x11FC3E, 0x11FC6A, 0x11FD14, 0x11FD17, 0x11FD23, 0x11FD26, 0x11FD33, 0x11FD36, 0x11FD42, 0x11FD52,
+    0x11FD5F, 0x11FD62, 0x11FD6E, 0x11FDAF, 0x11FDB2, 0x11FDBE, 0x11FDCE, 0x11FE4A, 0x11FE8B, 0x11FE8E, 0x11FE9A, 0x11FEAA,
+    0x11FED6, 0x11FFEB, 0x11FFF3, 0x11FFF6, 0x11FFFA, 0x12000A, 0x120012, 0x12001B, 0x12001E, 0x12002A, 0x120036, 0x12003A,
+    0x12003E, 0x120086, 0x12008E, 0x1200B6, 0x1200E3, 0x1200E6, 0x1200F2, 0x120102, 0x12012E, 0x120160, 0x120163, 0x12016F,
+    0x120172, 0x12017F, 0x120182, 0x12018E, 0x12019E, 0x1201AB, 0x1201AE, 0x1201BA, 0x1201CA, 0x1201FB, 0x1201FE, 0x12020A,
+    0x12021A, 0x120246, 0x120296, 0x1202D7, 0x1202DA, 0x1202E6, 0x1202F2, 0x1202F6, 0x1202FA, 0x120322, 0x120372, 0x120467,
+    0x12046A, 0x120476, 0x120486, 0x1204B2, 0x1204CB, 0x1204CE, 0x1204DA, 0x1204EA, 0x120502, 0x120516, 0x120566, 0x1205DE,
+    0x120644, 0x12064C, 0x12064F, 0x120653, 0x120663, 0x12066B, 0x12066E, 0x120672, 0x120674, 0x120677, 0x120682, 0x120683,
+    0x120686, 0x12068A, 0x12068F, 0x120693, 0x120696, 0x120697, 0x12069A, 0x12069E, 0x1206A2, 0x1206AE, 0x1206B2, 0x1206B6,
+    0x1206DF, 0x1206E7, 0x1206EA, 0x1206EE, 0x1206FE, 0x120706, 0x12070F, 0x120712, 0x12071E, 0x12072A, 0x12072E, 0x120732,
+    0x12073C, 0x12073F, 0x12074B, 0x12074E, 0x12075B, 0x12075E, 0x12076A, 0x12077A, 0x120782, 0x120787, 0x12078A, 0x120796,
+    0x1207A6, 0x1207AA, 0x1207BB, 0x1207C3, 0x1207C6, 0x1207CA, 0x1207D7, 0x1207DA, 0x1207E2, 0x1207E6, 0x1207EB, 0x1207EE,
+    0x1207F6, 0x1207FA, 0x120806, 0x12080A, 0x12080E, 0x120822, 0x120856, 0x12085E, 0x120872, 0x120886, 0x120930, 0x120933,
+    0x12093F, 0x120942, 0x12094B, 0x12094F, 0x120952, 0x120953, 0x120956, 0x12095A, 0x12095E, 0x12096A, 0x12096E, 0x120972,
+    0x12097B, 0x12097E, 0x12098A, 0x120996, 0x12099A, 0x12099E, 0x1209CB, 0x1209CE, 0x1209DA, 0x1209E6, 0x1209EA, 0x1209EE,
+    0x120A16, 0x120A43, 0x120A46, 0x120A52, 0x120A62, 0x120A66, 0x120A8E, 0x120AA7, 0x120AAA, 0x120AB6, 0x120AC2, 0x120AC6,
+    0x120ACA, 0x120ADE, 0x120AF2, 0x120B24, 0x120B27, 0x120B33, 0x120B36, 0x120B43, 0x120B46, 0x120B52, 0x120B62, 0x120B6F,
+    0x120B72, 0x120B7E, 0x120B8E, 0x120BBF, 0x120BC2, 0x120BCE, 0x120BDE, 0x120C0A, 0x120C37, 0x120C3A, 0x120C46, 0x120C52,
+    0x120C56, 0x120C5A, 0x120C82, 0x120C9B, 0x120C9E, 0x120CAA, 0x120CBA, 0x120CD2, 0x120CE6, 0x120D36, 0x120D4A, 0x120D97,
+    0x120D9F, 0x120DA2, 0x120DA6, 0x120DB6, 0x120DBE, 0x120DC7, 0x120DCA, 0x120DD6, 0x120DE2, 0x120DE6, 0x120DEA, 0x120E2B,
+    0x120E2E, 0x120E32, 0x120E3A, 0x120E4A, 0x120E62, 0x120E76, 0x120E8F, 0x120E92, 0x120E9E, 0x120EAE, 0x120EC6, 0x120EDA,
+    0x120F0E, 0x120F16, 0x120F2A, 0x120F3E, 0x120FA2, 0x121083, 0x121086, 0x121092, 0x12109E, 0x1210A2, 0x1210A6, 0x1210CE,
+    0x12111E, 0x121132, 0x121196, 0x1211FA, 0x121567, 0x12156F, 0x121572, 0x121576, 0x121586, 0x12158E, 0x121597, 0x12159A,
+    0x1215A6, 0x1215B2, 0x1215B6, 0x1215BA, 0x121602, 0x12160A, 0x121632, 0x12165F, 0x121662, 0x12166E, 0x12167E, 0x1216AA,
+    0x1216DE, 0x1216E6, 0x1216FA, 0x12170E, 0x121853, 0x121856, 0x121862, 0x12186E, 0x121872, 0x121876, 0x12189E, 0x1218EE,
+    0x121966, 0x121A47, 0x121A4A, 0x121A56, 0x121A66, 0x121A92, 0x121AE2, 0x121B5A, 0x121BBE, 0x121CBA, 0x121CC2, 0x121CEA,
+    0x121D4E, 0x121DB2, 0x122D54, 0x122D5C, 0x122D5F, 0x122D63, 0x122D73, 0x122D7B, 0x122D7E, 0x122D82, 0x122D84, 0x122D87,
+    0x122D92, 0x122D93, 0x122D96, 0x122D9A, 0x122D9F, 0x122DA3, 0x122DA6, 0x122DA7, 0x122DAA, 0x122DAE, 0x122DB2, 0x122DBE,
+    0x122DC2, 0x122DC6, 0x122DEF, 0x122DF7, 0x122DFA, 0x122DFE, 0x122E0E, 0x122E16, 0x122E1F, 0x122E22, 0x122E2E, 0x122E3A,
+    0x122E3E, 0x122E42, 0x122E4C, 0x122E4F, 0x122E5B, 0x122E5E, 0x122E6B, 0x122E6E, 0x122E7A, 0x122E8A, 0x122E92, 0x122E97,
+    0x122E9A, 0x122EA6, 0x122EB6, 0x122EBA, 0x122ECB, 0x122ED3, 0x122ED6, 0x122EDA, 0x122EE7, 0x122EEA, 0x122EF2, 0x122EF6,
+    0x122EFB, 0x122EFE, 0x122F06, 0x122F0A, 0x122F16, 0x122F1A, 0x122F1E, 0x122F32, 0x122F66, 0x122F6E, 0x122F82, 0x122F96,
+    0x12305B, 0x123063, 0x123066, 0x12306A, 0x12307A, 0x123082, 0x12308B, 0x12308E, 0x12309A, 0x1230A6, 0x1230AA, 0x1230AE,
+    0x1230F6, 0x1230FE, 0x123126, 0x123153, 0x123156, 0x123162, 0x123172, 0x12319E, 0x1231D2, 0x1231DA, 0x1231EE, 0x123202,
+    0x123234, 0x123237, 0x123243, 0x123246, 0x123253, 0x123256, 0x123262, 0x123272, 0x12327F, 0x123282, 0x12328E, 0x12329E,
+    0x1232CF, 0x1232D2, 0x1232DE, 0x1232EE, 0x12331A, 0x123362, 0x12336A, 0x123392, 0x1233AB, 0x1233AE, 0x1233BA, 0x1233CA,
+    0x1233F6, 0x123446, 0x12345A, 0x1234A7, 0x1234AF, 0x1234B2, 0x1234B6, 0x1234C6, 0x1234CE, 0x1234D7, 0x1234DA, 0x1234E6,
+    0x1234F2, 0x1234F6, 0x1234FA, 0x12353B, 0x12353E, 0x123542, 0x12354A, 0x12355A, 0x123572, 0x123586, 0x12359F, 0x1235A2,
+    0x1235AE, 0x1235BE, 0x1235D6, 0x1235EA, 0x12361E, 0x123626, 0x12363A, 0x12364E, 0x1236B2, 0x123C77, 0x123C7F, 0x123C82,
+    0x123C86, 0x123C96, 0x123C9E, 0x123CA7, 0x123CAA, 0x123CB6, 0x123CC2, 0x123CC6, 0x123CCA, 0x123D12, 0x123D1A, 0x123D42,
+    0x123D6F, 0x123D72, 0x123D7E, 0x123D8E, 0x123DBA, 0x123DEE, 0x123DF6, 0x123E0A, 0x123E1E, 0x123F7E, 0x123F86, 0x123FAE,
+    0x124076, 0x124157, 0x12415A, 0x124166, 0x124176, 0x1241A2, 0x1241F2, 0x1242CE, 0x1245BC, 0x1245BF, 0x1245CB, 0x1245CE,
+    0x1245DB, 0x1245DE, 0x1245EA, 0x1245FA, 0x124607, 0x12460A, 0x124616, 0x124626, 0x124657, 0x12465A, 0x124666, 0x124676,
+    0x1246A2, 0x1246F2, 0x124733, 0x124736, 0x124742, 0x124752, 0x12477E, 0x1247CE, 0x1248C3, 0x1248C6, 0x1248D2, 0x1248E2,
+    0x12490E, 0x12495E, 0x124A3A, 0x124B9A, 0x124BA2, 0x124BCA, 0x124C92, 0x124D0F, 0x124D12, 0x124D1E, 0x124D2E, 0x124D5A,
+    0x124DAA, 0x124E86, 0x1251F3, 0x1251FB, 0x1251FE, 0x125202, 0x125212, 0x12521A, 0x125223, 0x125226, 0x125232, 0x12523E,
+    0x125242, 0x125246, 0x12528E, 0x125296, 0x1252BE, 0x1252EB, 0x1252EE, 0x1252FA, 0x12530A, 0x125336, 0x12536A, 0x125372,
+    0x125386, 0x12539A, 0x1254DF, 0x1254E2, 0x1254EE, 0x1254FA, 0x1254FE, 0x125502, 0x12552A, 0x12557A, 0x1255F2, 0x125656,
+    0x1256D3, 0x1256D6, 0x1256E2, 0x1256F2, 0x12571E, 0x12576E, 0x1257E6, 0x12584A, 0x125946, 0x12594E, 0x125976, 0x1259DA,
+    0x125A3E, 0x125BB5, 0x125BB8, 0x125BC4, 0x125BC7, 0x125BD4, 0x125BD7, 0x125BE3, 0x125BE6, 0x125BF3, 0x125C00, 0x125C03,
+    0x125C0F, 0x125C12, 0x125C1F, 0x125C22, 0x125C2E, 0x125C50, 0x125C53, 0x125C5F, 0x125C62, 0x125C6F, 0x125C72, 0x125C8E,
+    0x125C9B, 0x125C9E, 0x125CAA, 0x125CEB, 0x125CEE, 0x125D0A, 0x125D2C, 0x125D2F, 0x125D3B, 0x125D3E, 0x125D4B, 0x125D4E,
+    0x125D5A, 0x125D6A, 0x125D77, 0x125D7A, 0x125D86, 0x125D96, 0x125DC7, 0x125DCA, 0x125DD6, 0x125DE6, 0x125E12, 0x125EBC,
+    0x125EBF, 0x125ECB, 0x125ECE, 0x125EDB, 0x125EDE, 0x125EEA, 0x125EFA, 0x125F07, 0x125F0A, 0x125F16, 0x125F57, 0x125F5A,
+    0x125F66, 0x125F76, 0x125FF2, 0x126033, 0x126036, 0x126042, 0x126052, 0x12607E, 0x1261C3, 0x1261C6, 0x1261D2, 0x1261E2,
+    0x12625E, 0x126308, 0x12630B, 0x126317, 0x12631A, 0x126327, 0x12632A, 0x126336, 0x126346, 0x126353, 0x126356, 0x126362,
+    0x126372, 0x1263A3, 0x1263A6, 0x1263B2, 0x1263C2, 0x1263EE, 0x12643E, 0x12647F, 0x126482, 0x12648E, 0x12649E, 0x1264CA,
+    0x12651A, 0x12660F, 0x126612, 0x12661E, 0x12662E, 0x12665A, 0x1266AA, 0x126786, 0x126AD8, 0x126ADB, 0x126AE7, 0x126AEA,
+    0x126AF7, 0x126AFA, 0x126B06, 0x126B16, 0x126B23, 0x126B26, 0x126B32, 0x126B42, 0x126B73, 0x126B76, 0x126B82, 0x126B92,
+    0x126BBE, 0x126C0E, 0x126C4F, 0x126C52, 0x126C5E, 0x126C6E, 0x126C9A, 0x126DDF, 0x126DE2, 0x126DEE, 0x126DFE, 0x126E2A,
+    0x126E7A, 0x1270E6, 0x12722B, 0x12722E, 0x12723A, 0x12724A, 0x127276, 0x1272C6, 0x1273A2, 0x127903, 0x12790B, 0x12790E,
+    0x127912, 0x127922, 0x12792A, 0x127933, 0x127936, 0x127942, 0x12794E, 0x127952, 0x127956, 0x12799E, 0x1279A6, 0x1279CE,
+    0x1279FB, 0x1279FE, 0x127A0A, 0x127A1A, 0x127A46, 0x127A7A, 0x127A82, 0x127A96, 0x127AAA, 0x127C0A, 0x127C12, 0x127C3A,
+    0x127D02, 0x127DE3, 0x127DE6, 0x127DF2, 0x127E02, 0x127E2E, 0x127E7E, 0x127F5A, 0x128054, 0x128057, 0x128063, 0x128066,
+    0x128073, 0x128076, 0x128082, 0x128092, 0x12809F, 0x1280A2, 0x1280AE, 0x1280BE, 0x1280EF, 0x1280F2, 0x1280FE, 0x12810E,
+    0x12813A, 0x12818A, 0x1281CB, 0x1281CE, 0x1281DA, 0x1281EA, 0x128216, 0x128266, 0x12835B, 0x12835E, 0x12836A, 0x12837A,
+    0x1283A6, 0x1283F6, 0x1284D2, 0x128662, 0x1287A7, 0x1287AA, 0x1287B6, 0x1287C6, 0x1287F2, 0x128826, 0x12882E, 0x128842,
+    0x128856, 0x12891E, 0x128AAE, 0x128F77, 0x128F7A, 0x128F86, 0x128F96, 0x128FC2, 0x129012, 0x1290EE, 0x12916B, 0x12916E,
+    0x12917A, 0x12918A, 0x1291B6, 0x129206, 0x12927E, 0x1292E2, 0x129472, 0x1296CA, 0x1298C0, 0x1298C8, 0x1298CB, 0x1298CF,
+    0x1298DF, 0x1298E7, 0x1298EA, 0x1298EE, 0x1298F0, 0x1298F3, 0x1298FE, 0x1298FF, 0x129902, 0x129906, 0x12990B, 0x12990F,
+    0x129912, 0x129913, 0x129916, 0x12991A, 0x12991E, 0x12992A, 0x12992E, 0x129932, 0x12995B, 0x129963, 0x129966, 0x12996A,
+    0x12997A, 0x129982, 0x12998B, 0x12998E, 0x12999A, 0x1299A6, 0x1299AA, 0x1299AE, 0x1299B8, 0x1299BB, 0x1299C7, 0x1299CA,
+    0x1299D7, 0x1299DA, 0x1299E6, 0x1299F6, 0x1299FE, 0x129A03, 0x129A06, 0x129A12, 0x129A22, 0x129A26, 0x129A37, 0x129A3F,
+    0x129A42, 0x129A46, 0x129A53, 0x129A56, 0x129A5E, 0x129A62, 0x129A67, 0x129A6A, 0x129A72, 0x129A76, 0x129A82, 0x129A86,
+    0x129A8A, 0x129A9E, 0x129AD2, 0x129ADA, 0x129AEE, 0x129B02, 0x129BC7, 0x129BCF, 0x129BD2, 0x129BD6, 0x129BE6, 0x129BEE,
+    0x129BF7, 0x129BFA, 0x129C06, 0x129C12, 0x129C16, 0x129C1A, 0x129C62, 0x129C6A, 0x129C92, 0x129CBF, 0x129CC2, 0x129CCE,
+    0x129CDE, 0x129D0A, 0x129D3E, 0x129D46, 0x129D5A, 0x129D6E, 0x129DA0, 0x129DA3, 0x129DAF, 0x129DB2, 0x129DBF, 0x129DC2,
+    0x129DCE, 0x129DDE, 0x129DEB, 0x129DEE, 0x129DFA, 0x129E0A, 0x129E3B, 0x129E3E, 0x129E4A, 0x129E5A, 0x129E86, 0x129ECE,
+    0x129ED6, 0x129EFE, 0x129F17, 0x129F1A, 0x129F26, 0x129F36, 0x129F62, 0x129FB2, 0x129FC6, 0x12A013, 0x12A01B, 0x12A01E,
+    0x12A022, 0x12A032, 0x12A03A, 0x12A043, 0x12A046, 0x12A052, 0x12A05E, 0x12A062, 0x12A066, 0x12A0A7, 0x12A0AA, 0x12A0AE,
+    0x12A0B6, 0x12A0C6, 0x12A0DE, 0x12A0F2, 0x12A10B, 0x12A10E, 0x12A11A, 0x12A12A, 0x12A142, 0x12A156, 0x12A18A, 0x12A192,
+    0x12A1A6, 0x12A1BA, 0x12A21E, 0x12A31A, 0x12A322, 0x12A34A, 0x12A3AE, 0x12A412, 0x12A764, 0x12A767, 0x12A773, 0x12A776,
+    0x12A783, 0x12A786, 0x12A792, 0x12A7A2, 0x12A7AF, 0x12A7B2, 0x12A7BE, 0x12A7CE, 0x12A7E3, 0x12A7EB, 0x12A7EE, 0x12A7F2,
+    0x12A7FF, 0x12A802, 0x12A80A, 0x12A80E, 0x12A813, 0x12A816, 0x12A81E, 0x12A822, 0x12A82E, 0x12A832, 0x12A836, 0x12A84A,
+    0x12A87E, 0x12A886, 0x12A89A, 0x12A8AE, 0x12A8DB, 0x12A8DE, 0x12A8EA, 0x12A8FA, 0x12A926, 0x12A95A, 0x12A962, 0x12A976,
+    0x12A98A, 0x12AA6B, 0x12AA6E, 0x12AA7A, 0x12AA8A, 0x12AAB6, 0x12AAEA, 0x12AAF2, 0x12AB06, 0x12AB1A, 0x12ABE2, 0x12ACC3,
+    0x12ACC6, 0x12ACD2, 0x12ACE2, 0x12AD0E, 0x12AD5E, 0x12AD72, 0x12AE3A, 0x12AEB7, 0x12AEBA, 0x12AEC6, 0x12AED6, 0x12AF02,
+    0x12AF36, 0x12AF3E, 0x12AF52, 0x12AF66, 0x12AFCA, 0x12B02E, 0x12B128, 0x12B12B, 0x12B137, 0x12B13A, 0x12B147, 0x12B14A,
+    0x12B156, 0x12B166, 0x12B173, 0x12B176, 0x12B182, 0x12B192, 0x12B1C3, 0x12B1C6, 0x12B1D2, 0x12B1E2, 0x12B20E, 0x12B25E,
+    0x12B29F, 0x12B2A2, 0x12B2AE, 0x12B2BE, 0x12B2EA, 0x12B33A, 0x12B42F, 0x12B432, 0x12B43E, 0x12B44E, 0x12B47A, 0x12B4CA,
+    0x12B5A6, 0x12B687, 0x12B68A, 0x12B696, 0x12B6A6, 0x12B6D2, 0x12B706, 0x12B70E, 0x12B722, 0x12B736, 0x12B7FE, 0x12B87B,
+    0x12B87E, 0x12B88A, 0x12B89A, 0x12B8C6, 0x12B916, 0x12B98E, 0x12B9F2, 0x12BB82, 0x12BBE6, 0x12BD5F, 0x12BD67, 0x12BD6A,
+    0x12BD6E, 0x12BD7E, 0x12BD86, 0x12BD8F, 0x12BD92, 0x12BD9E, 0x12BDAA, 0x12BDAE, 0x12BDB2, 0x12BDFA, 0x12BE02, 0x12BE2A,
+    0x12BE57, 0x12BE5A, 0x12BE66, 0x12BE76, 0x12BEA2, 0x12BED6, 0x12BEDE, 0x12BEF2, 0x12BF06, 0x12C04B, 0x12C04E, 0x12C05A,
+    0x12C066, 0x12C06A, 0x12C06E, 0x12C096, 0x12C0E6, 0x12C15E, 0x12C1C2, 0x12C23F, 0x12C242, 0x12C24E, 0x12C25E, 0x12C28A,
+    0x12C2DA, 0x12C352, 0x12C3B6, 0x12C4B2, 0x12C4BA, 0x12C4E2, 0x12C546, 0x12C5AA, 0x12C79E, 0x12CC03, 0x12CC06, 0x12CC12,
+    0x12CC22, 0x12CC4E, 0x12CC82, 0x12CC8A, 0x12CC9E, 0x12CCB2, 0x12CD7A, 0x12CF0A, 0x12CF6E, 0x12D162, 0x12D356, 0x12E46F,
+    0x12E477, 0x12E47A, 0x12E47E, 0x12E48E, 0x12E496, 0x12E49F, 0x12E4A2, 0x12E4AE, 0x12E4BA, 0x12E4BE, 0x12E4C2, 0x12E50A,
+    0x12E512, 0x12E53A, 0x12E567, 0x12E56A, 0x12E576, 0x12E586, 0x12E5B2, 0x12E5E6, 0x12E5EE, 0x12E602, 0x12E616, 0x12E776,
+    0x12E77E, 0x12E7A6, 0x12E86E, 0x12E94F, 0x12E952, 0x12E95E, 0x12E96E, 0x12E99A, 0x12E9EA, 0x12EAC6, 0x12EBC2, 0x12EBCA,
+    0x12EBF2, 0x12EC56, 0x12ECBA, 0x12F313, 0x12F316, 0x12F322, 0x12F332, 0x12F35E, 0x12F392, 0x12F39A, 0x12F3AE, 0x12F3C2,
+    0x12F48A, 0x12F61A, 0x12F872, 0x12FCD7, 0x12FCDA, 0x12FCE6, 0x12FCF6, 0x12FD22, 0x12FD72, 0x12FE4E, 0x12FFDE, 0x130236,
+    0x13042A, 0x13090E, 0x130916, 0x13093E, 0x130A06, 0x130BFA, 0x130DEE, 0x134FD9, 0x134FDC, 0x134FE8, 0x134FEB, 0x134FF8,
+    0x134FFB, 0x135007, 0x13500A, 0x135017, 0x135024, 0x135027, 0x135033, 0x135036, 0x135043, 0x135046, 0x135052, 0x135074,
+    0x135077, 0x135083, 0x135086, 0x135093, 0x135096, 0x1350B2, 0x1350BF, 0x1350C2, 0x1350CE, 0x13510F, 0x135112, 0x13512E,
+    0x135150, 0x135153, 0x13515F, 0x135162, 0x13516F, 0x135172, 0x13517E, 0x13518E, 0x13519B, 0x13519E, 0x1351AA, 0x1351BA,
+    0x1351EB, 0x1351EE, 0x1351FA, 0x13520A, 0x135236, 0x1352E0, 0x1352E3, 0x1352EF, 0x1352F2, 0x1352FF, 0x135302, 0x13530E,
+    0x13531E, 0x13532B, 0x13532E, 0x13533A, 0x13537B, 0x13537E, 0x13538A, 0x13539A, 0x135416, 0x135457, 0x13545A, 0x135466,
+    0x135476, 0x1354A2, 0x1355E7, 0x1355EA, 0x1355F6, 0x135606, 0x135682, 0x13572C, 0x13572F, 0x13573B, 0x13573E, 0x13574B,
+    0x13574E, 0x13575A, 0x13576A, 0x135777, 0x13577A, 0x135786, 0x135796, 0x1357C7, 0x1357CA, 0x1357D6, 0x1357E6, 0x135812,
+    0x135862, 0x1358A3, 0x1358A6, 0x1358B2, 0x1358C2, 0x1358EE, 0x13593E, 0x135A33, 0x135A36, 0x135A42, 0x135A52, 0x135A7E,
+    0x135ACE, 0x135BAA, 0x135C10, 0x135C18, 0x135C1B, 0x135C1F, 0x135C2F, 0x135C37, 0x135C3A, 0x135C3E, 0x135C40, 0x135C43,
+    0x135C4E, 0x135C4F, 0x135C52, 0x135C56, 0x135C5B, 0x135C5F, 0x135C62, 0x135C63, 0x135C66, 0x135C6A, 0x135C6E, 0x135C7A,
+    0x135C7E, 0x135C82, 0x135CAB, 0x135CB3, 0x135CB6, 0x135CBA, 0x135CCA, 0x135CD2, 0x135CDB, 0x135CDE, 0x135CEA, 0x135CF6,
+    0x135CFA, 0x135CFE, 0x135D08, 0x135D0B, 0x135D17, 0x135D1A, 0x135D27, 0x135D2A, 0x135D36, 0x135D46, 0x135D4E, 0x135D53,
+    0x135D56, 0x135D62, 0x135D72, 0x135D76, 0x135D87, 0x135D8F, 0x135D92, 0x135D96, 0x135DA3, 0x135DA6, 0x135DAE, 0x135DB2,
+    0x135DB7, 0x135DBA, 0x135DC2, 0x135DC6, 0x135DD2, 0x135DD6, 0x135DDA, 0x135DEE, 0x135E22, 0x135E2A, 0x135E3E, 0x135E52,
+    0x135EFC, 0x135EFF, 0x135F0B, 0x135F0E, 0x135F17, 0x135F1B, 0x135F1E, 0x135F1F, 0x135F22, 0x135F26, 0x135F2A, 0x135F36,
+    0x135F3A, 0x135F3E, 0x135F47, 0x135F4A, 0x135F56, 0x135F62, 0x135F66, 0x135F6A, 0x135F97, 0x135F9A, 0x135FA6, 0x135FB2,
+    0x135FB6, 0x135FBA, 0x135FE2, 0x13600F, 0x136012, 0x13601E, 0x13602E, 0x136032, 0x13605A, 0x136073, 0x136076, 0x136082,
+    0x13608E, 0x136092, 0x136096, 0x1360AA, 0x1360BE, 0x1360F0, 0x1360F3, 0x1360FF, 0x136102, 0x13610F, 0x136112, 0x13611E,
+    0x13612E, 0x13613B, 0x13613E, 0x13614A, 0x13615A, 0x13618B, 0x13618E, 0x13619A, 0x1361AA, 0x1361D6, 0x136203, 0x136206,
+    0x136212, 0x13621E, 0x136222, 0x136226, 0x13624E, 0x136267, 0x13626A, 0x136276, 0x136286, 0x13629E, 0x1362B2, 0x136302,
+    0x136316, 0x136363, 0x13636B, 0x13636E, 0x136372, 0x136382, 0x13638A, 0x136393, 0x136396, 0x1363A2, 0x1363AE, 0x1363B2,
+    0x1363B6, 0x1363F7, 0x1363FA, 0x1363FE, 0x136406, 0x136416, 0x13642E, 0x136442, 0x13645B, 0x13645E, 0x13646A, 0x13647A,
+    0x136492, 0x1364A6, 0x1364DA, 0x1364E2, 0x1364F6, 0x13650A, 0x13656E, 0x13664F, 0x136652, 0x13665E, 0x13666A, 0x13666E,
+    0x136672, 0x13669A, 0x1366EA, 0x1366FE, 0x136762, 0x1367C6, 0x136B33, 0x136B3B, 0x136B3E, 0x136B42, 0x136B52, 0x136B5A,
+    0x136B63, 0x136B66, 0x136B72, 0x136B7E, 0x136B82, 0x136B86, 0x136BCE, 0x136BD6, 0x136BFE, 0x136C2B, 0x136C2E, 0x136C3A,
+    0x136C4A, 0x136C76, 0x136CAA, 0x136CB2, 0x136CC6, 0x136CDA, 0x136E1F, 0x136E22, 0x136E2E, 0x136E3A, 0x136E3E, 0x136E42,
+    0x136E6A, 0x136EBA, 0x136F32, 0x137013, 0x137016, 0x137022, 0x137032, 0x13705E, 0x1370AE, 0x137126, 0x13718A, 0x137286,
+    0x13728E, 0x1372B6, 0x13731A, 0x13737E, 0x137478, 0x13747B, 0x137487, 0x13748A, 0x137497, 0x13749A, 0x1374A6, 0x1374B6,
+    0x1374C3, 0x1374C6, 0x1374D2, 0x1374E2, 0x137513, 0x137516, 0x137522, 0x137532, 0x13755E, 0x1375AE, 0x1375EF, 0x1375F2,
+    0x1375FE, 0x13760E, 0x13763A, 0x13768A, 0x13777F, 0x137782, 0x13778E, 0x13779E, 0x1377CA, 0x13781A, 0x1378F6, 0x137A56,
+    0x137A5E, 0x137A86, 0x137B4E, 0x137BCB, 0x137BCE, 0x137BDA, 0x137BEA, 0x137C16, 0x137C66, 0x137D42, 0x137ED2, 0x137F36,
+    0x1380AF, 0x1380B7, 0x1380BA, 0x1380BE, 0x1380CE, 0x1380D6, 0x1380DF, 0x1380E2, 0x1380EE, 0x1380FA, 0x1380FE, 0x138102,
+    0x13814A, 0x138152, 0x13817A, 0x1381A7, 0x1381AA, 0x1381B6, 0x1381C6, 0x1381F2, 0x138226, 0x13822E, 0x138242, 0x138256,
+    0x13839B, 0x13839E, 0x1383AA, 0x1383B6, 0x1383BA, 0x1383BE, 0x1383E6, 0x138436, 0x1384AE, 0x138512, 0x13858F, 0x138592,
+    0x13859E, 0x1385AE, 0x1385DA, 0x13862A, 0x1386A2, 0x138706, 0x138802, 0x13880A, 0x138832, 0x138896, 0x1388FA, 0x138AEE,
+    0x139B88, 0x139B8B, 0x139B97, 0x139B9A, 0x139BA7, 0x139BAA, 0x139BB6, 0x139BC6, 0x139BD3, 0x139BD6, 0x139BE2, 0x139BF2,
+    0x139C23, 0x139C26, 0x139C32, 0x139C42, 0x139C6E, 0x139CBE, 0x139CFF, 0x139D02, 0x139D0E, 0x139D1E, 0x139D4A, 0x139D9A,
+    0x139E8F, 0x139E92, 0x139E9E, 0x139EAE, 0x139EDA, 0x139F2A, 0x13A006, 0x13A196, 0x13A2DB, 0x13A2DE, 0x13A2EA, 0x13A2FA,
+    0x13A326, 0x13A376, 0x13A452, 0x13A7BF, 0x13A7C7, 0x13A7CA, 0x13A7CE, 0x13A7DE, 0x13A7E6, 0x13A7EF, 0x13A7F2, 0x13A7FE,
+    0x13A80A, 0x13A80E, 0x13A812, 0x13A85A, 0x13A862, 0x13A88A, 0x13A8B7, 0x13A8BA, 0x13A8C6, 0x13A8D6, 0x13A902, 0x13A936,
+    0x13A93E, 0x13A952, 0x13A966, 0x13AAAB, 0x13AAAE, 0x13AABA, 0x13AAC6, 0x13AACA, 0x13AACE, 0x13AAF6, 0x13AB46, 0x13ABBE,
+    0x13AC22, 0x13AC9F, 0x13ACA2, 0x13ACAE, 0x13ACBE, 0x13ACEA, 0x13AD3A, 0x13ADB2, 0x13AE16, 0x13AF12, 0x13AF1A, 0x13AF42,
+    0x13AFA6, 0x13B00A, 0x13B6E2, 0x13B6EA, 0x13B712, 0x13B7DA, 0x13B9CE, 0x13BBC2, 0x13C027, 0x13C02A, 0x13C036, 0x13C046,
+    0x13C072, 0x13C0C2, 0x13C19E, 0x13C32E, 0x13C77A, 0x13D620, 0x13D623, 0x13D62F, 0x13D632, 0x13D63F, 0x13D642, 0x13D64E,
+    0x13D65E, 0x13D66B, 0x13D66E, 0x13D67A, 0x13D68A, 0x13D6BB, 0x13D6BE, 0x13D6CA, 0x13D6DA, 0x13D706, 0x13D756, 0x13D797,
+    0x13D79A, 0x13D7A6, 0x13D7B6, 0x13D7E2, 0x13D832, 0x13D927, 0x13D92A, 0x13D936, 0x13D946, 0x13D972, 0x13D9C2, 0x13DA9E,
+    0x13DC2E, 0x13DD73, 0x13DD76, 0x13DD82, 0x13DD92, 0x13DDBE, 0x13DE0E, 0x13DEEA, 0x13E07A, 0x13E543, 0x13E546, 0x13E552,
+    0x13E562, 0x13E58E, 0x13E5DE, 0x13E6BA, 0x13E737, 0x13E73A, 0x13E746, 0x13E756, 0x13E782, 0x13E7D2, 0x13E84A, 0x13E8AE,
+    0x13EA3E, 0x13EC96, 0x13F36E, 0x13F376, 0x13F39E, 0x13F466, 0x13F65A, 0x13F84E, 0x13FABF, 0x13FAC2, 0x13FACE, 0x13FADE,
+    0x13FB0A, 0x13FB5A, 0x13FC36, 0x13FDC6, 0x140212, 0x1406F4, 0x1406F7, 0x140703, 0x140706, 0x140713, 0x140716, 0x140722,
+    0x140732, 0x14073F, 0x140742, 0x14074E, 0x14075E, 0x14078F, 0x140792, 0x14079E, 0x1407AE, 0x1407DA, 0x14082A, 0x14086B,
+    0x14086E, 0x14087A, 0x14088A, 0x1408B6, 0x140906, 0x1409FB, 0x1409FE, 0x140A0A, 0x140A1A, 0x140A46, 0x140A96, 0x140B72,
+    0x140D02, 0x140E47, 0x140E4A, 0x140E56, 0x140E66, 0x140E92, 0x140EE2, 0x140FBE, 0x14114E, 0x14132B, 0x141333, 0x141336,
+    0x14133A, 0x14134A, 0x141352, 0x14135B, 0x14135E, 0x14136A, 0x141376, 0x14137A, 0x14137E, 0x1413C6, 0x1413CE, 0x1413F6,
+    0x141423, 0x141426, 0x141432, 0x141442, 0x14146E, 0x1414A2, 0x1414AA, 0x1414BE, 0x1414D2, 0x141617, 0x14161A, 0x141626,
+    0x141632, 0x141636, 0x14163A, 0x141662, 0x1416B2, 0x14172A, 0x14178E, 0x14180B, 0x14180E, 0x14181A, 0x14182A, 0x141856,
+    0x1418A6, 0x14191E, 0x141982, 0x141A7E, 0x141A86, 0x141AAE, 0x141B12, 0x141B76, 0x141D6A, 0x1421CF, 0x1421D2, 0x1421DE,
+    0x1421EE, 0x14221A, 0x14224E, 0x142256, 0x14226A, 0x14227E, 0x142346, 0x1424D6, 0x14253A, 0x14272E, 0x142922, 0x142B93,
+    0x142B96, 0x142BA2, 0x142BB2, 0x142BDE, 0x142C2E, 0x142D0A, 0x142E9A, 0x1430F2, 0x1432E6, 0x1437CA, 0x1437D2, 0x1437FA,
+    0x1438C2, 0x143AB6, 0x143CAA, 0x1443FD, 0x144400, 0x14440C, 0x14440F, 0x14441C, 0x14441F, 0x14442B, 0x14442E, 0x14443B,
+    0x144448, 0x14444B, 0x144457, 0x14445A, 0x144467, 0x14446A, 0x144476, 0x144498, 0x14449B, 0x1444A7, 0x1444AA, 0x1444B7,
+    0x1444BA, 0x1444D6, 0x1444E3, 0x1444E6, 0x1444F2, 0x144533, 0x144536, 0x144552, 0x144574, 0x144577, 0x144583, 0x144586,
+    0x144593, 0x144596, 0x1445A2, 0x1445B2, 0x1445BF, 0x1445C2, 0x1445CE, 0x1445DE, 0x14460F, 0x144612, 0x14461E, 0x14462E,
+    0x14465A, 0x144704, 0x144707, 0x144713, 0x144716, 0x144723, 0x144726, 0x144732, 0x144742, 0x14474F, 0x144752, 0x14475E,
+    0x14479F, 0x1447A2, 0x1447AE, 0x1447BE, 0x14483A, 0x14487B, 0x14487E, 0x14488A, 0x14489A, 0x1448C6, 0x144A0B, 0x144A0E,
+    0x144A1A, 0x144A2A, 0x144AA6, 0x144B50, 0x144B53, 0x144B5F, 0x144B62, 0x144B6F, 0x144B72, 0x144B7E, 0x144B8E, 0x144B9B,
+    0x144B9E, 0x144BAA, 0x144BBA, 0x144BEB, 0x144BEE, 0x144BFA, 0x144C0A, 0x144C36, 0x144C86, 0x144CC7, 0x144CCA, 0x144CD6,
+    0x144CE6, 0x144D12, 0x144D62, 0x144E57, 0x144E5A, 0x144E66, 0x144E76, 0x144EA2, 0x144EF2, 0x144FCE, 0x145320, 0x145323,
+    0x14532F, 0x145332, 0x14533F, 0x145342, 0x14534E, 0x14535E, 0x14536B, 0x14536E, 0x14537A, 0x14538A, 0x1453BB, 0x1453BE,
+    0x1453CA, 0x1453DA, 0x145406, 0x145456, 0x145497, 0x14549A, 0x1454A6, 0x1454B6, 0x1454E2, 0x145627, 0x14562A, 0x145636,
+    0x145646, 0x145672, 0x1456C2, 0x14592E, 0x145A73, 0x145A76, 0x145A82, 0x145A92, 0x145ABE, 0x145B0E, 0x145BEA, 0x146243,
+    0x146246, 0x146252, 0x146262, 0x14628E, 0x1462DE, 0x14654A, 0x14689C, 0x14689F, 0x1468AB, 0x1468AE, 0x1468BB, 0x1468BE,
+    0x1468CA, 0x1468DA, 0x1468E7, 0x1468EA, 0x1468F6, 0x146906, 0x146937, 0x14693A, 0x146946, 0x146956, 0x146982, 0x1469D2,
+    0x146A13, 0x146A16, 0x146A22, 0x146A32, 0x146A5E, 0x146AAE, 0x146BA3, 0x146BA6, 0x146BB2, 0x146BC2, 0x146BEE, 0x146C3E,
+    0x146D1A, 0x146EAA, 0x146FEF, 0x146FF2, 0x146FFE, 0x14700E, 0x14703A, 0x14708A, 0x147166, 0x1472F6, 0x1477BF, 0x1477C2,
+    0x1477CE, 0x1477DE, 0x14780A, 0x14785A, 0x147936, 0x147AC6, 0x147F12, 0x148FAC, 0x148FAF, 0x148FBB, 0x148FBE, 0x148FCB,
+    0x148FCE, 0x148FDA, 0x148FEA, 0x148FF7, 0x148FFA, 0x149006, 0x149016, 0x149047, 0x14904A, 0x149056, 0x149066, 0x149092,
+    0x1490E2, 0x149123, 0x149126, 0x149132, 0x149142, 0x14916E, 0x1491BE, 0x1492B3, 0x1492B6, 0x1492C2, 0x1492D2, 0x1492FE,
+    0x14934E, 0x14942A, 0x1495BA, 0x1496FF, 0x149702, 0x14970E, 0x14971E, 0x14974A, 0x14979A, 0x149876, 0x149ECF, 0x149ED2,
+    0x149EDE, 0x149EEE, 0x149F1A, 0x149F6A, 0x14A046, 0x14A1D6, 0x14ADF2, 0x14B44B, 0x14B44E, 0x14B45A, 0x14B46A, 0x14B496,
+    0x14B4E6, 0x14B5C2, 0x14B752, 0x14BB9E, 0x14CA44, 0x14CA47, 0x14CA53, 0x14CA56, 0x14CA63, 0x14CA66, 0x14CA72, 0x14CA82,
+    0x14CA8F, 0x14CA92, 0x14CA9E, 0x14CAAE, 0x14CADF, 0x14CAE2, 0x14CAEE, 0x14CAFE, 0x14CB2A, 0x14CB7A, 0x14CBBB, 0x14CBBE,
+    0x14CBCA, 0x14CBDA, 0x14CC06, 0x14CC56, 0x14CD4B, 0x14CD4E, 0x14CD5A, 0x14CD6A, 0x14CD96, 0x14CDE6, 0x14CEC2, 0x14D052,
+    0x14D197, 0x14D19A, 0x14D1A6, 0x14D1B6, 0x14D1E2, 0x14D232, 0x14D30E, 0x14D49E, 0x14D67B, 0x14D683, 0x14D686, 0x14D68A,
+    0x14D69A, 0x14D6A2, 0x14D6AB, 0x14D6AE, 0x14D6BA, 0x14D6C6, 0x14D6CA, 0x14D6CE, 0x14D716, 0x14D71E, 0x14D746, 0x14D773,
+    0x14D776, 0x14D782, 0x14D792, 0x14D7BE, 0x14D7F2, 0x14D7FA, 0x14D80E, 0x14D822, 0x14D967, 0x14D96A, 0x14D976, 0x14D982,
+    0x14D986, 0x14D98A, 0x14D9B2, 0x14DA02, 0x14DA7A, 0x14DADE, 0x14DB5B, 0x14DB5E, 0x14DB6A, 0x14DB7A, 0x14DBA6, 0x14DBF6,
+    0x14DC6E, 0x14DCD2, 0x14DDCE, 0x14DDD6, 0x14DDFE, 0x14DE62, 0x14DEC6, 0x14E0BA, 0x14E59E, 0x14E5A6, 0x14E5CE, 0x14E696,
+    0x14E88A, 0x14EA7E, 0x14EEE3, 0x14EEE6, 0x14EEF2, 0x14EF02, 0x14EF2E, 0x14EF7E, 0x14F05A, 0x14F1EA, 0x14F636, 0x14FB18,
+    0x14FB1B, 0x14FB27, 0x14FB2A, 0x14FB37, 0x14FB3A, 0x14FB46, 0x14FB56, 0x14FB63, 0x14FB66, 0x14FB72, 0x14FB82, 0x14FBB3,
+    0x14FBB6, 0x14FBC2, 0x14FBD2, 0x14FBFE, 0x14FC4E, 0x14FC8F, 0x14FC92, 0x14FC9E, 0x14FCAE, 0x14FCDA, 0x14FD2A, 0x14FE1F,
+    0x14FE22, 0x14FE2E, 0x14FE3E, 0x14FE6A, 0x14FEBA, 0x14FF96, 0x150126, 0x15026B, 0x15026E, 0x15027A, 0x15028A, 0x1502B6,
+    0x150306, 0x1503E2, 0x150572, 0x150A3B, 0x150A3E, 0x150A4A, 0x150A5A, 0x150A86, 0x150AD6, 0x150BB2, 0x150D42, 0x15118E,
+    0x1515F3, 0x1515F6, 0x151602, 0x151612, 0x15163E, 0x15168E, 0x15176A, 0x1518FA, 0x15195E, 0x151D46, 0x151FB7, 0x151FBA,
+    0x151FC6, 0x151FD6, 0x152002, 0x152052, 0x15212E, 0x15222A, 0x152232, 0x15225A, 0x1522BE, 0x152322, 0x152516, 0x15270A,
+    0x152EDA, 0x1546C7, 0x1546CA, 0x1546D6, 0x1546E6, 0x154712, 0x154762, 0x15483E, 0x1549CE, 0x154E1A, 0x15508B, 0x15508E,
+    0x15509A, 0x1550AA, 0x1550D6, 0x155126, 0x155202, 0x155392, 0x1555EA, 0x1557DE, 0x155FAE, 0x1561A2, 0x156B66, 0x15752C,
+    0x157534, 0x157537, 0x15753B, 0x15754B, 0x157553, 0x157556, 0x15755A, 0x15755C, 0x15755F, 0x15756A, 0x15756B, 0x15756E,
+    0x157572, 0x157577, 0x15757B, 0x15757E, 0x15757F, 0x157582, 0x157586, 0x15758A, 0x157596, 0x15759A, 0x15759E, 0x1575C7,
+    0x1575CF, 0x1575D2, 0x1575D6, 0x1575E6, 0x1575EE, 0x1575F7, 0x1575FA, 0x157606, 0x157612, 0x157616, 0x15761A, 0x157624,
+    0x157627, 0x157633, 0x157636, 0x157643, 0x157646, 0x157652, 0x157662, 0x15766A, 0x15766F, 0x157672, 0x15767E, 0x15768E,
+    0x157692, 0x1576A3, 0x1576AB, 0x1576AE, 0x1576B2, 0x1576BF, 0x1576C2, 0x1576CA, 0x1576CE, 0x1576D3, 0x1576D6, 0x1576DE,
+    0x1576E2, 0x1576EE, 0x1576F2, 0x1576F6, 0x15770A, 0x15773E, 0x157746, 0x15775A, 0x15776E, 0x157833, 0x15783B, 0x15783E,
+    0x157842, 0x157852, 0x15785A, 0x157863, 0x157866, 0x157872, 0x15787E, 0x157882, 0x157886, 0x1578CE, 0x1578D6, 0x1578FE,
+    0x15792B, 0x15792E, 0x15793A, 0x15794A, 0x157976, 0x1579AA, 0x1579B2, 0x1579C6, 0x1579DA, 0x157A0C, 0x157A0F, 0x157A1B,
+    0x157A1E, 0x157A2B, 0x157A2E, 0x157A3A, 0x157A4A, 0x157A57, 0x157A5A, 0x157A66, 0x157A76, 0x157AA7, 0x157AAA, 0x157AB6,
+    0x157AC6, 0x157AF2, 0x157B3A, 0x157B42, 0x157B6A, 0x157B83, 0x157B86, 0x157B92, 0x157BA2, 0x157BCE, 0x157C1E, 0x157C32,
+    0x157C7F, 0x157C87, 0x157C8A, 0x157C8E, 0x157C9E, 0x157CA6, 0x157CAF, 0x157CB2, 0x157CBE, 0x157CCA, 0x157CCE, 0x157CD2,
+    0x157D13, 0x157D16, 0x157D1A, 0x157D22, 0x157D32, 0x157D4A, 0x157D5E, 0x157D77, 0x157D7A, 0x157D86, 0x157D96, 0x157DAE,
+    0x157DC2, 0x157DF6, 0x157DFE, 0x157E12, 0x157E26, 0x157E8A, 0x157F86, 0x157F8E, 0x157FB6, 0x15801A, 0x15807E, 0x15844F,
+    0x158457, 0x15845A, 0x15845E, 0x15846E, 0x158476, 0x15847F, 0x158482, 0x15848E, 0x15849A, 0x15849E, 0x1584A2, 0x1584EA,
+    0x1584F2, 0x15851A, 0x158547, 0x15854A, 0x158556, 0x158566, 0x158592, 0x1585C6, 0x1585CE, 0x1585E2, 0x1585F6, 0x158756,
+    0x15875E, 0x158786, 0x15884E, 0x15892F, 0x158932, 0x15893E, 0x15894E, 0x15897A, 0x1589CA, 0x158AA6, 0x158BA2, 0x158BAA,
+    0x158BD2, 0x158C36, 0x158C9A, 0x158D94, 0x158D97, 0x158DA3, 0x158DA6, 0x158DB3, 0x158DB6, 0x158DC2, 0x158DD2, 0x158DDF,
+    0x158DE2, 0x158DEE, 0x158DFE, 0x158E2F, 0x158E32, 0x158E3E, 0x158E4E, 0x158E7A, 0x158ECA, 0x158F0B, 0x158F0E, 0x158F1A,
+    0x158F2A, 0x158F56, 0x158FA6, 0x15909B, 0x15909E, 0x1590AA, 0x1590BA, 0x1590E6, 0x159136, 0x159212, 0x159372, 0x15937A,
+    0x1593A2, 0x15946A, 0x1594E7, 0x1594EA, 0x1594F6, 0x159506, 0x159532, 0x159582, 0x15965E, 0x1597EE, 0x159852, 0x1599CB,
+    0x1599D3, 0x1599D6, 0x1599DA, 0x1599EA, 0x1599F2, 0x1599FB, 0x1599FE, 0x159A0A, 0x159A16, 0x159A1A, 0x159A1E, 0x159A66,
+    0x159A6E, 0x159A96, 0x159AC3, 0x159AC6, 0x159AD2, 0x159AE2, 0x159B0E, 0x159B42, 0x159B4A, 0x159B5E, 0x159B72, 0x159CB7,
+    0x159CBA, 0x159CC6, 0x159CD2, 0x159CD6, 0x159CDA, 0x159D02, 0x159D52, 0x159DCA, 0x159E2E, 0x159EAB, 0x159EAE, 0x159EBA,
+    0x159ECA, 0x159EF6, 0x159F46, 0x159FBE, 0x15A022, 0x15A11E, 0x15A126, 0x15A14E, 0x15A1B2, 0x15A216, 0x15A40A, 0x15A8EE,
+    0x15A8F6, 0x15A91E, 0x15A9E6, 0x15ABDA, 0x15ADCE, 0x15BE68, 0x15BE6B, 0x15BE77, 0x15BE7A, 0x15BE87, 0x15BE8A, 0x15BE96,
+    0x15BEA6, 0x15BEB3, 0x15BEB6, 0x15BEC2, 0x15BED2, 0x15BF03, 0x15BF06, 0x15BF12, 0x15BF22, 0x15BF4E, 0x15BF9E, 0x15BFDF,
+    0x15BFE2, 0x15BFEE, 0x15BFFE, 0x15C02A, 0x15C07A, 0x15C0DB, 0x15C0E3, 0x15C0E6, 0x15C0EA, 0x15C0FA, 0x15C102, 0x15C10B,
+    0x15C10E, 0x15C11A, 0x15C126, 0x15C12A, 0x15C12E, 0x15C16F, 0x15C172, 0x15C176, 0x15C17E, 0x15C18E, 0x15C1A6, 0x15C1BA,
+    0x15C1D3, 0x15C1D6, 0x15C1E2, 0x15C1F2, 0x15C20A, 0x15C21E, 0x15C252, 0x15C25A, 0x15C26E, 0x15C282, 0x15C2E6, 0x15C3E2,
+    0x15C3EA, 0x15C412, 0x15C476, 0x15C4DA, 0x15C5BB, 0x15C5BE, 0x15C5CA, 0x15C5DA, 0x15C606, 0x15C656, 0x15C732, 0x15C82E,
+    0x15C836, 0x15C85E, 0x15C8C2, 0x15C926, 0x15CD8B, 0x15CD8E, 0x15CD9A, 0x15CDAA, 0x15CDD6, 0x15CE26, 0x15CF02, 0x15CFFE,
+    0x15D006, 0x15D02E, 0x15D092, 0x15D0F6, 0x15D4DE, 0x15D943, 0x15D946, 0x15D952, 0x15D962, 0x15D98E, 0x15D9DE, 0x15DABA,
+    0x15DC4A, 0x15DCAE, 0x15E096, 0x15E307, 0x15E30A, 0x15E316, 0x15E326, 0x15E352, 0x15E3A2, 0x15E47E, 0x15E57A, 0x15E582,
+    0x15E5AA, 0x15E60E, 0x15E672, 0x15E866, 0x15EA5A, 0x15EF3C, 0x15EF3F, 0x15EF4B, 0x15EF4E, 0x15EF5B, 0x15EF5E, 0x15EF6A,
+    0x15EF7A, 0x15EF87, 0x15EF8A, 0x15EF96, 0x15EFA6, 0x15EFD7, 0x15EFDA, 0x15EFE6, 0x15EFF6, 0x15F022, 0x15F072, 0x15F0B3,
+    0x15F0B6, 0x15F0C2, 0x15F0D2, 0x15F0FE, 0x15F14E, 0x15F243, 0x15F246, 0x15F252, 0x15F262, 0x15F28E, 0x15F2DE, 0x15F3BA,
+    0x15F54A, 0x15F68F, 0x15F692, 0x15F69E, 0x15F6AE, 0x15F6DA, 0x15F72A, 0x15F806, 0x15F996, 0x15FE5F, 0x15FE62, 0x15FE6E,
+    0x15FE7E, 0x15FEAA, 0x15FEFA, 0x15FFD6, 0x160166, 0x1605B2, 0x160A17, 0x160A1A, 0x160A26, 0x160A36, 0x160A62, 0x160AB2,
+    0x160B8E, 0x160C8A, 0x160C92, 0x160CBA, 0x160D1E, 0x160D82, 0x16116A, 0x1613DB, 0x1613DE, 0x1613EA, 0x1613FA, 0x161426,
+    0x161476, 0x161552, 0x1616E2, 0x16193A, 0x161B2E, 0x1622FE, 0x1624F2, 0x162C47, 0x162C4F, 0x162C52, 0x162C56, 0x162C66,
+    0x162C6E, 0x162C77, 0x162C7A, 0x162C86, 0x162C92, 0x162C96, 0x162C9A, 0x162CE2, 0x162CEA, 0x162D12, 0x162D3F, 0x162D42,
+    0x162D4E, 0x162D5E, 0x162D8A, 0x162DBE, 0x162DC6, 0x162DDA, 0x162DEE, 0x162F4E, 0x162F56, 0x162F7E, 0x163046, 0x163127,
+    0x16312A, 0x163136, 0x163146, 0x163172, 0x1631C2, 0x16329E, 0x16339A, 0x1633A2, 0x1633CA, 0x16342E, 0x163492, 0x163AEB,
+    0x163AEE, 0x163AFA, 0x163B0A, 0x163B36, 0x163B6A, 0x163B72, 0x163B86, 0x163B9A, 0x163C62, 0x163DF2, 0x16404A, 0x16423E,
+    0x1644AF, 0x1644B2, 0x1644BE, 0x1644CE, 0x1644FA, 0x16454A, 0x164626, 0x1647B6, 0x164A0E, 0x164C02, 0x1650E6, 0x1650EE,
+    0x165116, 0x1651DE, 0x1653D2, 0x1655C6, 0x165F8A, 0x167583, 0x167586, 0x167592, 0x1675A2, 0x1675CE, 0x16761E, 0x1676FA,
+    0x1677F6, 0x1677FE, 0x167826, 0x16788A, 0x1678EE, 0x167CD6, 0x1684A6, 0x16869A, 0x16905E, 0x169A22, 0x16E360, 0x16E363,
+    0x16E36F, 0x16E372, 0x16E37F, 0x16E382, 0x16E38E, 0x16E39E, 0x16E3AB, 0x16E3AE, 0x16E3BA, 0x16E3CA, 0x16E3FB, 0x16E3FE,
+    0x16E40A, 0x16E41A, 0x16E446, 0x16E496, 0x16E4D7, 0x16E4DA, 0x16E4E6, 0x16E4F6, 0x16E522, 0x16E572, 0x16E667, 0x16E66A,
+    0x16E676, 0x16E686, 0x16E6B2, 0x16E702, 0x16E7DE, 0x16E96E, 0x16EAB3, 0x16EAB6, 0x16EAC2, 0x16EAD2, 0x16EAFE, 0x16EB4E,
+    0x16EC2A, 0x16EDBA, 0x16EF97, 0x16EF9F, 0x16EFA2, 0x16EFA6, 0x16EFB6, 0x16EFBE, 0x16EFC7, 0x16EFCA, 0x16EFD6, 0x16EFE2,
+    0x16EFE6, 0x16EFEA, 0x16F032, 0x16F03A, 0x16F062, 0x16F08F, 0x16F092, 0x16F09E, 0x16F0AE, 0x16F0DA, 0x16F10E, 0x16F116,
+    0x16F12A, 0x16F13E, 0x16F283, 0x16F286, 0x16F292, 0x16F29E, 0x16F2A2, 0x16F2A6, 0x16F2CE, 0x16F31E, 0x16F396, 0x16F3FA,
+    0x16F477, 0x16F47A, 0x16F486, 0x16F496, 0x16F4C2, 0x16F512, 0x16F58A, 0x16F5EE, 0x16F6EA, 0x16F6F2, 0x16F71A, 0x16F77E,
+    0x16F7E2, 0x16F9D6, 0x16FEBA, 0x16FEC2, 0x16FEEA, 0x16FFB2, 0x1701A6, 0x17039A, 0x1707FF, 0x170802, 0x17080E, 0x17081E,
+    0x17084A, 0x17089A, 0x170976, 0x170B06, 0x170F52, 0x171436, 0x17143E, 0x171466, 0x17152E, 0x171722, 0x171916, 0x172F0F,
+    0x172F12, 0x172F1E, 0x172F2E, 0x172F5A, 0x172FAA, 0x173086, 0x173216, 0x173662, 0x1738D3, 0x1738D6, 0x1738E2, 0x1738F2,
+    0x17391E, 0x17396E, 0x173A4A, 0x173B46, 0x173B4E, 0x173B76, 0x173BDA, 0x173C3E, 0x173E32, 0x174026, 0x1747F6, 0x1753AE,
+    0x1769A7, 0x1769AA, 0x1769B6, 0x1769C6, 0x1769F2, 0x176A42, 0x176B1E, 0x176CAE, 0x1770FA, 0x1778CA, 0x177ABE, 0x178482,
+    0x178E46, 0x179A7B, 0x179A7E, 0x179A8A, 0x179A9A, 0x179AC6, 0x179B16, 0x179BF2, 0x179D82, 0x17A1CE, 0x17A6B2, 0x17A6BA,
+    0x17A6E2, 0x17A7AA, 0x17A99E, 0x17AB92, 0x17B556, 0x17BF1A, 0x1945BC, 0x1945C4, 0x1945C7, 0x1945CB, 0x1945DB, 0x1945E3,
+    0x1945E6, 0x1945EA, 0x1945EC, 0x1945EF, 0x1945FA, 0x1945FB, 0x1945FE, 0x194602, 0x194607, 0x19460B, 0x19460E, 0x19460F,
+    0x194612, 0x194616, 0x19461A, 0x194626, 0x19462A, 0x19462E, 0x194657, 0x19465F, 0x194662, 0x194666, 0x194676, 0x19467E,
+    0x194687, 0x19468A, 0x194696, 0x1946A2, 0x1946A6, 0x1946AA, 0x1946B4, 0x1946B7, 0x1946C3, 0x1946C6, 0x1946D3, 0x1946D6,
+    0x1946E2, 0x1946F2, 0x1946FA, 0x1946FF, 0x194702, 0x19470E, 0x19471E, 0x194722, 0x194733, 0x19473B, 0x19473E, 0x194742,
+    0x19474F, 0x194752, 0x19475A, 0x19475E, 0x194763, 0x194766, 0x19476E, 0x194772, 0x19477E, 0x194782, 0x194786, 0x19479A,
+    0x1947CE, 0x1947D6, 0x1947EA, 0x1947FE, 0x1948C3, 0x1948CB, 0x1948CE, 0x1948D2, 0x1948E2, 0x1948EA, 0x1948F3, 0x1948F6,
+    0x194902, 0x19490E, 0x194912, 0x194916, 0x19495E, 0x194966, 0x19498E, 0x1949BB, 0x1949BE, 0x1949CA, 0x1949DA, 0x194A06,
+    0x194A3A, 0x194A42, 0x194A56, 0x194A6A, 0x194A9C, 0x194A9F, 0x194AAB, 0x194AAE, 0x194ABB, 0x194ABE, 0x194ACA, 0x194ADA,
+    0x194AE7, 0x194AEA, 0x194AF6, 0x194B06, 0x194B37, 0x194B3A, 0x194B46, 0x194B56, 0x194B82, 0x194BCA, 0x194BD2, 0x194BFA,
+    0x194C13, 0x194C16, 0x194C22, 0x194C32, 0x194C5E, 0x194CAE, 0x194CC2, 0x194D0F, 0x194D17, 0x194D1A, 0x194D1E, 0x194D2E,
+    0x194D36, 0x194D3F, 0x194D42, 0x194D4E, 0x194D5A, 0x194D5E, 0x194D62, 0x194DA3, 0x194DA6, 0x194DAA, 0x194DB2, 0x194DC2,
+    0x194DDA, 0x194DEE, 0x194E07, 0x194E0A, 0x194E16, 0x194E26, 0x194E3E, 0x194E52, 0x194E86, 0x194E8E, 0x194EA2, 0x194EB6,
+    0x194F1A, 0x195016, 0x19501E, 0x195046, 0x1950AA, 0x19510E, 0x1954DF, 0x1954E7, 0x1954EA, 0x1954EE, 0x1954FE, 0x195506,
+    0x19550F, 0x195512, 0x19551E, 0x19552A, 0x19552E, 0x195532, 0x19557A, 0x195582, 0x1955AA, 0x1955D7, 0x1955DA, 0x1955E6,
+    0x1955F6, 0x195622, 0x195656, 0x19565E, 0x195672, 0x195686, 0x1957E6, 0x1957EE, 0x195816, 0x1958DE, 0x1959BF, 0x1959C2,
+    0x1959CE, 0x1959DE, 0x195A0A, 0x195A5A, 0x195B36, 0x195C32, 0x195C3A, 0x195C62, 0x195CC6, 0x195D2A, 0x195E24, 0x195E27,
+    0x195E33, 0x195E36, 0x195E43, 0x195E46, 0x195E52, 0x195E62, 0x195E6F, 0x195E72, 0x195E7E, 0x195E8E, 0x195EBF, 0x195EC2,
+    0x195ECE, 0x195EDE, 0x195F0A, 0x195F5A, 0x195F9B, 0x195F9E, 0x195FAA, 0x195FBA, 0x195FE6, 0x196036, 0x19612B, 0x19612E,
+    0x19613A, 0x19614A, 0x196176, 0x1961C6, 0x1962A2, 0x196402, 0x19640A, 0x196432, 0x1964FA, 0x196577, 0x19657A, 0x196586,
+    0x196596, 0x1965C2, 0x196612, 0x1966EE, 0x19687E, 0x1968E2, 0x196A5B, 0x196A63, 0x196A66, 0x196A6A, 0x196A7A, 0x196A82,
+    0x196A8B, 0x196A8E, 0x196A9A, 0x196AA6, 0x196AAA, 0x196AAE, 0x196AF6, 0x196AFE, 0x196B26, 0x196B53, 0x196B56, 0x196B62,
+    0x196B72, 0x196B9E, 0x196BD2, 0x196BDA, 0x196BEE, 0x196C02, 0x196D47, 0x196D4A, 0x196D56, 0x196D62, 0x196D66, 0x196D6A,
+    0x196D92, 0x196DE2, 0x196E5A, 0x196EBE, 0x196F3B, 0x196F3E, 0x196F4A, 0x196F5A, 0x196F86, 0x196FD6, 0x19704E, 0x1970B2,
+    0x1971AE, 0x1971B6, 0x1971DE, 0x197242, 0x1972A6, 0x19749A, 0x19797E, 0x197986, 0x1979AE, 0x197A76, 0x197C6A, 0x197E5E,
+    0x19916B, 0x199173, 0x199176, 0x19917A, 0x19918A, 0x199192, 0x19919B, 0x19919E, 0x1991AA, 0x1991B6, 0x1991BA, 0x1991BE,
+    0x199206, 0x19920E, 0x199236, 0x199263, 0x199266, 0x199272, 0x199282, 0x1992AE, 0x1992E2, 0x1992EA, 0x1992FE, 0x199312,
+    0x199472, 0x19947A, 0x1994A2, 0x19956A, 0x19964B, 0x19964E, 0x19965A, 0x19966A, 0x199696, 0x1996E6, 0x1997C2, 0x1998BE,
+    0x1998C6, 0x1998EE, 0x199952, 0x1999B6, 0x19A08E, 0x19A096, 0x19A0BE, 0x19A186, 0x19A56E, 0x19A9D3, 0x19A9D6, 0x19A9E2,
+    0x19A9F2, 0x19AA1E, 0x19AA6E, 0x19AB4A, 0x19ACDA, 0x19B126, 0x19B60A, 0x19B612, 0x19B63A, 0x19B702, 0x19B8F6, 0x19BAEA,
+    0x19BFCC, 0x19BFCF, 0x19BFDB, 0x19BFDE, 0x19BFEB, 0x19BFEE, 0x19BFFA, 0x19C00A, 0x19C017, 0x19C01A, 0x19C026, 0x19C036,
+    0x19C067, 0x19C06A, 0x19C076, 0x19C086, 0x19C0B2, 0x19C102, 0x19C143, 0x19C146, 0x19C152, 0x19C162, 0x19C18E, 0x19C1DE,
+    0x19C2D3, 0x19C2D6, 0x19C2E2, 0x19C2F2, 0x19C31E, 0x19C36E, 0x19C44A, 0x19C5DA, 0x19C71F, 0x19C722, 0x19C72E, 0x19C73E,
+    0x19C76A, 0x19C7BA, 0x19C896, 0x19CA26, 0x19CEEF, 0x19CEF2, 0x19CEFE, 0x19CF0E, 0x19CF3A, 0x19CF8A, 0x19D066, 0x19D1F6,
+    0x19D642, 0x19DD1A, 0x19DD22, 0x19DD4A, 0x19DE12, 0x19E1FA, 0x19E46B, 0x19E46E, 0x19E47A, 0x19E48A, 0x19E4B6, 0x19E506,
+    0x19E5E2, 0x19E772, 0x19EBBE, 0x19F38E, 0x19F582, 0x19FCD7, 0x19FCDF, 0x19FCE2, 0x19FCE6, 0x19FCF6, 0x19FCFE, 0x19FD07,
+    0x19FD0A, 0x19FD16, 0x19FD22, 0x19FD26, 0x19FD2A, 0x19FD72, 0x19FD7A, 0x19FDA2, 0x19FDCF, 0x19FDD2, 0x19FDDE, 0x19FDEE,
+    0x19FE1A, 0x19FE4E, 0x19FE56, 0x19FE6A, 0x19FE7E, 0x19FFDE, 0x19FFE6, 0x1A000E, 0x1A00D6, 0x1A01B7, 0x1A01BA, 0x1A01C6,
+    0x1A01D6, 0x1A0202, 0x1A0252, 0x1A032E, 0x1A042A, 0x1A0432, 0x1A045A, 0x1A04BE, 0x1A0522, 0x1A0B7B, 0x1A0B7E, 0x1A0B8A,
+    0x1A0B9A, 0x1A0BC6, 0x1A0BFA, 0x1A0C02, 0x1A0C16, 0x1A0C2A, 0x1A0CF2, 0x1A0E82, 0x1A10DA, 0x1A12CE, 0x1A153F, 0x1A1542,
+    0x1A154E, 0x1A155E, 0x1A158A, 0x1A15DA, 0x1A16B6, 0x1A1846, 0x1A1A9E, 0x1A1C92, 0x1A2176, 0x1A217E, 0x1A21A6, 0x1A226E,
+    0x1A2462, 0x1A2656, 0x1A301A, 0x1AB3F0, 0x1AB3F3, 0x1AB3FF, 0x1AB402, 0x1AB40F, 0x1AB412, 0x1AB41E, 0x1AB42E, 0x1AB43B,
+    0x1AB43E, 0x1AB44A, 0x1AB45A, 0x1AB48B, 0x1AB48E, 0x1AB49A, 0x1AB4AA, 0x1AB4D6, 0x1AB526, 0x1AB567, 0x1AB56A, 0x1AB576,
+    0x1AB586, 0x1AB5B2, 0x1AB602, 0x1AB6F7, 0x1AB6FA, 0x1AB706, 0x1AB716, 0x1AB742, 0x1AB792, 0x1AB86E, 0x1AB9FE, 0x1ABB43,
+    0x1ABB46, 0x1ABB52, 0x1ABB62, 0x1ABB8E, 0x1ABBDE, 0x1ABCBA, 0x1ABE4A, 0x1AC027, 0x1AC02F, 0x1AC032, 0x1AC036, 0x1AC046,
+    0x1AC04E, 0x1AC057, 0x1AC05A, 0x1AC066, 0x1AC072, 0x1AC076, 0x1AC07A, 0x1AC0C2, 0x1AC0CA, 0x1AC0F2, 0x1AC11F, 0x1AC122,
+    0x1AC12E, 0x1AC13E, 0x1AC16A, 0x1AC19E, 0x1AC1A6, 0x1AC1BA, 0x1AC1CE, 0x1AC313, 0x1AC316, 0x1AC322, 0x1AC32E, 0x1AC332,
+    0x1AC336, 0x1AC35E, 0x1AC3AE, 0x1AC426, 0x1AC48A, 0x1AC507, 0x1AC50A, 0x1AC516, 0x1AC526, 0x1AC552, 0x1AC5A2, 0x1AC61A,
+    0x1AC67E, 0x1AC77A, 0x1AC782, 0x1AC7AA, 0x1AC80E, 0x1AC872, 0x1ACA66, 0x1ACF4A, 0x1ACF52, 0x1ACF7A, 0x1AD042, 0x1AD236,
+    0x1AD42A, 0x1AD88F, 0x1AD892, 0x1AD89E, 0x1AD8AE, 0x1AD8DA, 0x1AD92A, 0x1ADA06, 0x1ADB96, 0x1ADFE2, 0x1AE4C6, 0x1AE4CE,
+    0x1AE4F6, 0x1AE5BE, 0x1AE7B2, 0x1AE9A6, 0x1AFF9F, 0x1AFFA2, 0x1AFFAE, 0x1AFFBE, 0x1AFFEA, 0x1B003A, 0x1B0116, 0x1B02A6,
+    0x1B06F2, 0x1B0BD6, 0x1B0BDE, 0x1B0C06, 0x1B0CCE, 0x1B0EC2, 0x1B10B6, 0x1B243E, 0x1B3A37, 0x1B3A3A, 0x1B3A46, 0x1B3A56,
+    0x1B3A82, 0x1B3AD2, 0x1B3BAE, 0x1B3D3E, 0x1B418A, 0x1B495A, 0x1B4B4E, 0x1B5ED6, 0x1BA814, 0x1BA817, 0x1BA823, 0x1BA826,
+    0x1BA833, 0x1BA836, 0x1BA842, 0x1BA852, 0x1BA85F, 0x1BA862, 0x1BA86E, 0x1BA87E, 0x1BA8AF, 0x1BA8B2, 0x1BA8BE, 0x1BA8CE,
+    0x1BA8FA, 0x1BA94A, 0x1BA98B, 0x1BA98E, 0x1BA99A, 0x1BA9AA, 0x1BA9D6, 0x1BAA26, 0x1BAB1B, 0x1BAB1E, 0x1BAB2A, 0x1BAB3A,
+    0x1BAB66, 0x1BABB6, 0x1BAC92, 0x1BAE22, 0x1BAF67, 0x1BAF6A, 0x1BAF76, 0x1BAF86, 0x1BAFB2, 0x1BB002, 0x1BB0DE, 0x1BB26E,
+    0x1BB737, 0x1BB73A, 0x1BB746, 0x1BB756, 0x1BB782, 0x1BB7D2, 0x1BB8AE, 0x1BBA3E, 0x1BBE8A, 0x1BC65A, 0x1BCCB3, 0x1BCCB6,
+    0x1BCCC2, 0x1BCCD2, 0x1BCCFE, 0x1BCD4E, 0x1BCE2A, 0x1BCFBA, 0x1BD406, 0x1BDBD6, 0x1BF3C3, 0x1BF3C6, 0x1BF3D2, 0x1BF3E2,
+    0x1BF40E, 0x1BF45E, 0x1BF53A, 0x1BF6CA, 0x1BFB16, 0x1C02E6, 0x1C1862, 0x1C2E5B, 0x1C2E5E, 0x1C2E6A, 0x1C2E7A, 0x1C2EA6,
+    0x1C2EF6, 0x1C2FD2, 0x1C3162, 0x1C35AE, 0x1C3A92, 0x1C3A9A, 0x1C3AC2, 0x1C3B8A, 0x1C3D7E, 0x1C3F72, 0x1C52FA, 0x1C5F2F,
+    0x1C5F32, 0x1C5F3E, 0x1C5F4E, 0x1C5F7A, 0x1C5FCA, 0x1C60A6, 0x1C6236, 0x1C6682, 0x1C6E52, 0x1C7A0A, 0x1C83CE, 0x1CD943,
+    0x1CD94B, 0x1CD94E, 0x1CD952, 0x1CD962, 0x1CD96A, 0x1CD973, 0x1CD976, 0x1CD982, 0x1CD98E, 0x1CD992, 0x1CD996, 0x1CD9DE,
+    0x1CD9E6, 0x1CDA0E, 0x1CDA3B, 0x1CDA3E, 0x1CDA4A, 0x1CDA5A, 0x1CDA86, 0x1CDABA, 0x1CDAC2, 0x1CDAD6, 0x1CDAEA, 0x1CDC4A,
+    0x1CDC52, 0x1CDC7A, 0x1CDD42, 0x1CDE23, 0x1CDE26, 0x1CDE32, 0x1CDE42, 0x1CDE6E, 0x1CDEBE, 0x1CDF9A, 0x1CE096, 0x1CE09E,
+    0x1CE0C6, 0x1CE12A, 0x1CE18E, 0x1CE866, 0x1CE86E, 0x1CE896, 0x1CE95E, 0x1CED46, 0x1CF1AB, 0x1CF1AE, 0x1CF1BA, 0x1CF1CA,
+    0x1CF1F6, 0x1CF246, 0x1CF322, 0x1CF4B2, 0x1CF8FE, 0x1CFDE2, 0x1CFDEA, 0x1CFE12, 0x1CFEDA, 0x1D00CE, 0x1D02C2, 0x1D227F,
+    0x1D2282, 0x1D228E, 0x1D229E, 0x1D22CA, 0x1D231A, 0x1D23F6, 0x1D24F2, 0x1D24FA, 0x1D2522, 0x1D2586, 0x1D25EA, 0x1D29D2,
+    0x1D31A2, 0x1D3D5A, 0x1D471E, 0x1D5353, 0x1D5356, 0x1D5362, 0x1D5372, 0x1D539E, 0x1D53EE, 0x1D54CA, 0x1D565A, 0x1D5AA6,
+    0x1D6276, 0x1D6E2E, 0x1D77F2, 0x1D905E, 0x1D9066, 0x1D908E, 0x1D9156, 0x1D953E, 0x1D9F02, 0x1DA8C6,
+};
+
+}
+
+#endif
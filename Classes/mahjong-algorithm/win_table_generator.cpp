@@ -0,0 +1,111 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+// 生成基本和型的和牌查找表win_table.h
+// 用法：g++ -std=c++11 -O2 win_table_generator.cpp -o win_table_generator && ./win_table_generator > win_table.h
+// 也可以在CMake中打开MAHJONG_BUILD_TOOLS，生成check_win_table目标以检查提交的win_table.h是否与生成结果一致
+
+#include <stdio.h>
+#include <stdint.h>
+#include <vector>
+
+// 一门牌能否全部拆成面子，need_pair表示是否还需要一组雀头
+// 只考虑点数最小的牌：要么作为雀头，要么组成刻子，要么组成顺子
+static bool is_complete(int (&cnt)[9], int kinds, bool need_pair) {
+    int r = 0;
+    while (r < kinds && cnt[r] == 0) {
+        ++r;
+    }
+    if (r == kinds) {
+        return !need_pair;
+    }
+
+    bool ret = false;
+    if (need_pair && cnt[r] > 1) {
+        cnt[r] -= 2;
+        ret = is_complete(cnt, kinds, false);
+        cnt[r] += 2;
+        if (ret) return true;
+    }
+    if (cnt[r] > 2) {
+        cnt[r] -= 3;
+        ret = is_complete(cnt, kinds, need_pair);
+        cnt[r] += 3;
+        if (ret) return true;
+    }
+    if (kinds == 9 && r < 7 && cnt[r + 1] > 0 && cnt[r + 2] > 0) {
+        --cnt[r]; --cnt[r + 1]; --cnt[r + 2];
+        ret = is_complete(cnt, kinds, need_pair);
+        ++cnt[r]; ++cnt[r + 1]; ++cnt[r + 2];
+    }
+    return ret;
+}
+
+// 输出一个数组
+static void print_array(const char *name, const std::vector<uint32_t> &keys) {
+    printf("static const uint32_t %s[%u] = {", name, static_cast<unsigned>(keys.size()));
+    for (size_t i = 0; i < keys.size(); ++i) {
+        printf(i % 12 == 0 ? "\n    0x%06X," : " 0x%06X,", keys[i]);
+    }
+    printf("\n};\n\n");
+}
+
+int main() {
+    // 下标按5进制将1~9的张数编码，与shanten.cpp中查表法的编码一致，递增枚举得到的就是有序的
+    std::vector<uint32_t> melds, pair;
+    int cnt[9] = { 0 };
+    for (uint32_t key = 0; key < 1953125; ++key) {
+        if (key > 0) {
+            for (int i = 0; ++cnt[i] == 5; ++i) {
+                cnt[i] = 0;
+            }
+        }
+
+        int sum = 0;
+        for (int i = 0; i < 9; ++i) {
+            sum += cnt[i];
+        }
+        if (sum > 14) {
+            continue;
+        }
+
+        if (sum % 3 == 0 && is_complete(cnt, 9, false)) {
+            melds.push_back(key);
+        }
+        else if (sum % 3 == 2 && is_complete(cnt, 9, true)) {
+            pair.push_back(key);
+        }
+    }
+
+    printf("%s", "\xEF\xBB\xBF");
+    printf("// 此文件由win_table_generator.cpp生成，请勿手动修改\n\n");
+    printf("#ifndef __MAHJONG_ALGORITHM__WIN_TABLE_H__\n");
+    printf("#define __MAHJONG_ALGORITHM__WIN_TABLE_H__\n\n");
+    printf("#include <stdint.h>\n\n");
+    printf("namespace mahjong {\n\n");
+    printf("// 一门数牌能全部拆成面子的张数组合，按5进制将1~9的张数编码，升序排列\n");
+    print_array("win_table_melds", melds);
+    printf("// 一门数牌能拆成面子加一组雀头的张数组合，编码同上\n");
+    print_array("win_table_melds_and_pair", pair);
+    printf("}\n\n#endif\n");
+    return 0;
+}
@@ -0,0 +1,189 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#include "worker_pool.h"
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <iterator>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <vector>
+
+// 线程池最多的线程数，超出的执行排队等待，由调用者自己完成
+#define MAX_POOL_THREAD_CNT 256
+
+namespace mahjong {
+
+// 共享线程池
+class worker_pool_t {
+public:
+    worker_pool_t() : _stopping(false) { }
+
+    ~worker_pool_t() {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            _stopping = true;
+        }
+        _work_cond.notify_all();
+        for (std::thread &t : _threads) {
+            t.join();
+        }
+    }
+
+    // 所有并行接口共用的实例，首次使用时构造（C++11保证局部静态变量的初始化是线程安全的）
+    static worker_pool_t &instance() {
+        static worker_pool_t pool;
+        return pool;
+    }
+
+    // 交给线程池执行worker_cnt次
+    void submit(parallel_job_t *job, size_t worker_cnt) {
+        {
+            std::lock_guard<std::mutex> lock(_mutex);
+            // 按需增加线程，之后一直复用
+            size_t thread_cnt = std::min<size_t>(worker_cnt, MAX_POOL_THREAD_CNT);
+            while (_threads.size() < thread_cnt) {
+                _threads.emplace_back(&worker_pool_t::thread_main, this);
+            }
+            _queue.insert(_queue.end(), worker_cnt, job);
+            job->_pending += worker_cnt;
+        }
+        if (worker_cnt > 1) {
+            _work_cond.notify_all();
+        }
+        else {
+            _work_cond.notify_one();
+        }
+    }
+
+    // 撤销尚未领取的执行，等待已领取的执行结束
+    void wait(parallel_job_t *job) {
+        std::unique_lock<std::mutex> lock(_mutex);
+        if (job->_pending == 0) {
+            return;
+        }
+        std::deque<parallel_job_t *>::iterator it = std::remove(_queue.begin(), _queue.end(), job);
+        job->_pending -= static_cast<size_t>(std::distance(it, _queue.end()));
+        _queue.erase(it, _queue.end());
+        _done_cond.wait(lock, [job]() { return job->_pending == 0; });
+    }
+
+private:
+    void thread_main() {
+        std::unique_lock<std::mutex> lock(_mutex);
+        for (;;) {
+            _work_cond.wait(lock, [this]() { return _stopping || !_queue.empty(); });
+            if (_queue.empty()) {
+                return;
+            }
+            parallel_job_t *job = _queue.front();
+            _queue.pop_front();
+
+            lock.unlock();
+            job->_func(job->_context);
+            lock.lock();
+
+            // 减到0之后job可能立即被析构，不能再访问
+            if (--job->_pending == 0) {
+                _done_cond.notify_all();
+            }
+        }
+    }
+
+    std::mutex _mutex;
+    std::condition_variable _work_cond;  // 有新的执行或者要退出
+    std::condition_variable _done_cond;  // 有执行结束
+    std::deque<parallel_job_t *> _queue;
+    std::vector<std::thread> _threads;
+    bool _stopping;
+};
+
+parallel_job_t::parallel_job_t(parallel_func_t func, void *context)
+    : _func(func), _context(context), _pending(0) {
+}
+
+parallel_job_t::~parallel_job_t() {
+    wait();
+}
+
+void parallel_job_t::start(size_t worker_cnt) {
+    if (worker_cnt > 0) {
+        worker_pool_t::instance().submit(this, worker_cnt);
+    }
+}
+
+void parallel_job_t::wait() {
+    worker_pool_t::instance().wait(this);
+}
+
+// 实际使用的线程数
+int parallel_thread_count(int thread_cnt) {
+    if (thread_cnt <= 0) {
+        thread_cnt = static_cast<int>(std::thread::hardware_concurrency());
+    }
+    return std::max(thread_cnt, 1);
+}
+
+namespace {
+    // parallel_for的工作状态
+    struct range_context_t {
+        size_t count;
+        size_t chunk_size;
+        std::atomic<size_t> next_idx;
+        void *context;
+        parallel_range_func_t func;
+    };
+}
+
+// 每次领取一段，直到全部领取完
+static void run_range_chunks(void *context) {
+    range_context_t *range = static_cast<range_context_t *>(context);
+    for (;;) {
+        size_t begin = range->next_idx.fetch_add(range->chunk_size);
+        if (begin >= range->count) {
+            break;
+        }
+        range->func(range->context, begin, std::min(begin + range->chunk_size, range->count));
+    }
+}
+
+// 用共享线程池并行处理下标[0, count)
+void parallel_for(size_t count, size_t chunk_size, int thread_cnt, void *context, parallel_range_func_t func) {
+    range_context_t range;
+    range.count = count;
+    range.chunk_size = std::max<size_t>(chunk_size, 1);
+    range.next_idx = 0;
+    range.context = context;
+    range.func = func;
+
+    // 调用者的线程也参与计算，所以只需另用thread_cnt-1个工作线程
+    const size_t chunk_cnt = (count + range.chunk_size - 1) / range.chunk_size;
+    const size_t worker_cnt = std::min(static_cast<size_t>(parallel_thread_count(thread_cnt) - 1), chunk_cnt > 0 ? chunk_cnt - 1 : 0);
+    parallel_job_t job(&run_range_chunks, &range);
+    job.start(worker_cnt);
+    run_range_chunks(&range);
+    job.wait();
+}
+
+}
@@ -0,0 +1,113 @@
+﻿/****************************************************************************
+ Copyright (c) 2016-2019 Jeff Wang <summer_insects@163.com>
+
+ Permission is hereby granted, free of charge, to any person obtaining a copy
+ of this software and associated documentation files (the "Software"), to deal
+ in the Software without restriction, including without limitation the rights
+ to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ copies of the Software, and to permit persons to whom the Software is
+ furnished to do so, subject to the following conditions:
+
+ The above copyright notice and this permission notice shall be included in all
+ copies or substantial portions of the Software.
+
+ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ SOFTWARE.
+ ****************************************************************************/
+
+#ifndef __MAHJONG_ALGORITHM__WORKER_POOL_H__
+#define __MAHJONG_ALGORITHM__WORKER_POOL_H__
+
+#include <stddef.h>
+
+namespace mahjong {
+
+/**
+ * @brief 并行执行的函数
+ *
+ * @param [in] context 上下文
+ */
+typedef void (*parallel_func_t)(void *context);
+
+/**
+ * @brief 在共享线程池上的一次并行执行
+ *  线程池中的线程在首次使用时启动，之后所有并行接口共用，不再每次调用都创建线程。
+ *  用法是让若干工作线程与调用者的线程执行同一个领取任务的循环，调用者自己执行完之后再wait
+ */
+class parallel_job_t {
+public:
+    /**
+     * @brief 构造
+     *
+     * @param [in] func 执行的函数
+     * @param [in] context 传给func的上下文
+     */
+    parallel_job_t(parallel_func_t func, void *context);
+
+    /**
+     * @brief 析构，同wait
+     */
+    ~parallel_job_t();
+
+    /**
+     * @brief 让线程池中最多worker_cnt个线程执行func，不等待执行结束
+     *
+     * @param [in] worker_cnt 工作线程数
+     */
+    void start(size_t worker_cnt);
+
+    /**
+     * @brief 等待执行结束
+     *  尚未被工作线程领取的执行直接撤销，所以func应当领取任务直到没有任务为止。
+     *  在func中再次使用线程池也不会死锁
+     */
+    void wait();
+
+    parallel_job_t(const parallel_job_t &) = delete;
+    parallel_job_t &operator=(const parallel_job_t &) = delete;
+
+private:
+    friend class worker_pool_t;
+
+    parallel_func_t _func;
+    void *_context;
+    size_t _pending;  ///< 已交给线程池但尚未执行完的次数
+};
+
+/**
+ * @brief 实际使用的线程数
+ *
+ * @param [in] thread_cnt 线程数，为0或负数时使用硬件线程数
+ * @return int 线程数（至少为1）
+ */
+int parallel_thread_count(int thread_cnt);
+
+/**
+ * @brief 处理一段下标的函数
+ *
+ * @param [in] context 上下文
+ * @param [in] begin 起始下标
+ * @param [in] end 结束下标（不含）
+ */
+typedef void (*parallel_range_func_t)(void *context, size_t begin, size_t end);
+
+/**
+ * @brief 用共享线程池并行处理下标[0, count)
+ *  每次领取chunk_size个，调用者的线程也参与处理，返回时全部处理完毕
+ *
+ * @param [in] count 下标总数
+ * @param [in] chunk_size 每次领取的个数（为0时按1处理）
+ * @param [in] thread_cnt 线程数（含调用者的线程），为0或负数时使用硬件线程数
+ * @param [in] context 传给func的上下文
+ * @param [in] func 处理函数
+ */
+void parallel_for(size_t count, size_t chunk_size, int thread_cnt, void *context, parallel_range_func_t func);
+
+}
+
+#endif
@@ -19,6 +19,11 @@ LOCAL_SRC_FILES := hellocpp/main.cpp \
                    ../../../Classes/mahjong-algorithm/fan_calculator.cpp \
                    ../../../Classes/mahjong-algorithm/stringify.cpp \
                    ../../../Classes/mahjong-algorithm/shanten.cpp \
+                   ../../../Classes/mahjong-algorithm/worker_pool.cpp \
+                   ../../../Classes/mahjong-algorithm/win_rate.cpp \
+                   ../../../Classes/mahjong-algorithm/hand_code.cpp \
+                   ../../../Classes/mahjong-algorithm/fan_cache.cpp \
+                   ../../../Classes/mahjong-algorithm/shanten_cache.cpp \
                    ../../../Classes/MahjongTheory/MahjongTheoryScene.cpp \
                    ../../../Classes/MainMenu/LeftSideMenu.cpp \
                    ../../../Classes/Other/OtherScene.cpp \